@@ -61,6 +61,7 @@ endfunction()
 macro(get_list_of_supported_optimizations PLATFORMS_LIST)
     list(APPEND PLATFORMS_LIST "")
     list(APPEND PLATFORMS_LIST "px")
+    list(APPEND PLATFORMS_LIST "avx2")
     list(APPEND PLATFORMS_LIST "avx512")
 endmacro(get_list_of_supported_optimizations)
 
@@ -72,6 +73,9 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
     list(APPEND SCAN_POSTFIX_LIST "")
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "")
     list(APPEND DEFAULT_BIT_WIDTH_LIST "")
+    list(APPEND WIDE_UNPACK_POSTFIX_LIST "")
+    list(APPEND WIDE_PACK_POSTFIX_LIST "")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "")
 
     #create list of functions that use only 8u 16u 32u postfixes
     list(APPEND DEFAULT_BIT_WIDTH_FUNCTIONS_LIST "unpack_prle")
@@ -86,6 +90,13 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
     list(APPEND DEFAULT_BIT_WIDTH_LIST "16u")
     list(APPEND DEFAULT_BIT_WIDTH_LIST "32u")
 
+    #create list of functions that also use 64u postfix for 33..64-bit elements
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "extract")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "extract_i")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "select")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "select_i")
+    list(APPEND WIDE_BIT_WIDTH_FUNCTIONS_LIST "expand")
+
     #create scan kernel postfixes
     list(APPEND SCAN_COMPARATOR_LIST "")
 
@@ -117,6 +128,10 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         endif()
     endforeach()
 
+    foreach(input_width RANGE 33 64 1)
+        list(APPEND WIDE_UNPACK_POSTFIX_LIST "_${input_width}u64u")
+    endforeach()
+
     # create pack kernel postfixes
     foreach(output_width RANGE 1 8 1)
         list(APPEND PACK_POSTFIX_LIST "_8u${output_width}u")
@@ -134,6 +149,10 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
     list(APPEND PACK_POSTFIX_LIST "_8u32u")
     list(APPEND PACK_POSTFIX_LIST "_16u32u")
 
+    foreach(output_width RANGE 33 64 1)
+        list(APPEND WIDE_PACK_POSTFIX_LIST "_64u${output_width}u")
+    endforeach()
+
     # create pack index kernel postfixes
     list(APPEND PACK_INDEX_POSTFIX_LIST "_nu")
     list(APPEND PACK_INDEX_POSTFIX_LIST "_8u")
@@ -161,12 +180,22 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         endforeach()
 
         #write BE kernels
+        foreach(UNPACK_POSTFIX IN LISTS UNPACK_POSTFIX_LIST)
+            file(APPEND ${directory}/${PLATFORM_PREFIX}unpack.cpp "\t${PLATFORM_PREFIX}qplc_unpack_be${UNPACK_POSTFIX},\n")
+        endforeach()
+
+        #write LE kernels for 33..64-bit elements
+        foreach(UNPACK_POSTFIX IN LISTS WIDE_UNPACK_POSTFIX_LIST)
+            file(APPEND ${directory}/${PLATFORM_PREFIX}unpack.cpp "\t${PLATFORM_PREFIX}qplc_unpack${UNPACK_POSTFIX},\n")
+        endforeach()
+
+        #write BE kernels for 33..64-bit elements
 
         #get last element of the list
         set(LAST_ELEMENT "")
-        list(GET UNPACK_POSTFIX_LIST -1 LAST_ELEMENT)
+        list(GET WIDE_UNPACK_POSTFIX_LIST -1 LAST_ELEMENT)
 
-        foreach(UNPACK_POSTFIX IN LISTS UNPACK_POSTFIX_LIST)
+        foreach(UNPACK_POSTFIX IN LISTS WIDE_UNPACK_POSTFIX_LIST)
 
             if(UNPACK_POSTFIX STREQUAL LAST_ELEMENT)
                 file(APPEND ${directory}/${PLATFORM_PREFIX}unpack.cpp "\t${PLATFORM_PREFIX}qplc_unpack_be${UNPACK_POSTFIX}};\n")
@@ -191,12 +220,22 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         endforeach()
 
         #write BE kernels
+        foreach(PACK_POSTFIX IN LISTS PACK_POSTFIX_LIST)
+            file(APPEND ${directory}/${PLATFORM_PREFIX}pack.cpp "\t${PLATFORM_PREFIX}qplc_pack_be${PACK_POSTFIX},\n")
+        endforeach()
+
+        #write LE kernels for 33..64-bit elements
+        foreach(PACK_POSTFIX IN LISTS WIDE_PACK_POSTFIX_LIST)
+            file(APPEND ${directory}/${PLATFORM_PREFIX}pack.cpp "\t${PLATFORM_PREFIX}qplc_pack${PACK_POSTFIX},\n")
+        endforeach()
+
+        #write BE kernels for 33..64-bit elements
 
         #get last element of the list
         set(LAST_ELEMENT "")
-        list(GET PACK_POSTFIX_LIST -1 LAST_ELEMENT)
+        list(GET WIDE_PACK_POSTFIX_LIST -1 LAST_ELEMENT)
 
-        foreach(PACK_POSTFIX IN LISTS PACK_POSTFIX_LIST)
+        foreach(PACK_POSTFIX IN LISTS WIDE_PACK_POSTFIX_LIST)
 
             if(PACK_POSTFIX STREQUAL LAST_ELEMENT)
                 file(APPEND ${directory}/${PLATFORM_PREFIX}pack.cpp "\t${PLATFORM_PREFIX}qplc_pack_be${PACK_POSTFIX}};\n")
@@ -253,6 +292,29 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}scan_i.cpp "}\n")
 
+        #
+        # Write scan_64u_i table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "scan_64u_i_table_t ${PLATFORM_PREFIX}scan_64u_i_table = {\n")
+
+        #get last element of the list
+        set(LAST_ELEMENT "")
+        list(GET SCAN_COMPARATOR_LIST -1 LAST_ELEMENT)
+
+        foreach(SCAN_COMPARATOR IN LISTS SCAN_COMPARATOR_LIST)
+
+            if(SCAN_COMPARATOR STREQUAL LAST_ELEMENT)
+                file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "\t${PLATFORM_PREFIX}qplc_scan_${SCAN_COMPARATOR}_64u8u_i};\n")
+            else()
+                file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "\t${PLATFORM_PREFIX}qplc_scan_${SCAN_COMPARATOR}_64u8u_i,\n")
+            endif()
+        endforeach()
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_64u_i.cpp "}\n")
+
         #
         # Write pack_index table
         #
@@ -271,6 +333,55 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}pack_index.cpp "}\n")
 
+        #
+        # Write scan_bits table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}scan_bits.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_bits.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_bits.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_bits.cpp "scan_bits_table_t ${PLATFORM_PREFIX}scan_bits_table = {\n")
+
+        #write LE kernels
+        foreach(input_width RANGE 1 32 1)
+            file(APPEND ${directory}/${PLATFORM_PREFIX}scan_bits.cpp "\t${PLATFORM_PREFIX}qplc_scan_bits_${input_width}u,\n")
+        endforeach()
+
+        #write BE kernels
+        foreach(input_width RANGE 1 32 1)
+            if(input_width EQUAL 32)
+                file(APPEND ${directory}/${PLATFORM_PREFIX}scan_bits.cpp "\t${PLATFORM_PREFIX}qplc_scan_bits_be_${input_width}u};\n")
+            else()
+                file(APPEND ${directory}/${PLATFORM_PREFIX}scan_bits.cpp "\t${PLATFORM_PREFIX}qplc_scan_bits_be_${input_width}u,\n")
+            endif()
+        endforeach()
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_bits.cpp "}\n")
+
+        #
+        # Write scan_in_set_i table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}scan_in_set_i.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_in_set_i.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_in_set_i.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_in_set_i.cpp "scan_in_set_i_table_t ${PLATFORM_PREFIX}scan_in_set_i_table = {\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_in_set_i.cpp "\t${PLATFORM_PREFIX}qplc_scan_in_set_8u_i,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_in_set_i.cpp "\t${PLATFORM_PREFIX}qplc_scan_in_set_16u8u_i,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_in_set_i.cpp "\t${PLATFORM_PREFIX}qplc_scan_in_set_32u8u_i};\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_in_set_i.cpp "}\n")
+
+        #
+        # Write bit_vector table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "namespace qpl::core_sw::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "bit_vector_table_t ${PLATFORM_PREFIX}bit_vector_table = {\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "\t${PLATFORM_PREFIX}qplc_bit_vector_and,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "\t${PLATFORM_PREFIX}qplc_bit_vector_or,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "\t${PLATFORM_PREFIX}qplc_bit_vector_and_not,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "\t${PLATFORM_PREFIX}qplc_bit_vector_xor};\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bit_vector.cpp "}\n")
+
         #
         # Write default bit width functions
         #
@@ -280,11 +391,18 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
             file(APPEND ${directory}/${PLATFORM_PREFIX}${DEAULT_BIT_WIDTH_FUNCTION}.cpp "namespace qpl::core_sw::dispatcher\n{\n")
             file(APPEND ${directory}/${PLATFORM_PREFIX}${DEAULT_BIT_WIDTH_FUNCTION}.cpp "${DEAULT_BIT_WIDTH_FUNCTION}_table_t ${PLATFORM_PREFIX}${DEAULT_BIT_WIDTH_FUNCTION}_table = {\n")
 
+            set(BIT_WIDTH_LIST ${DEFAULT_BIT_WIDTH_LIST})
+            list(FIND WIDE_BIT_WIDTH_FUNCTIONS_LIST ${DEAULT_BIT_WIDTH_FUNCTION} WIDE_FUNCTION_INDEX)
+
+            if(NOT WIDE_FUNCTION_INDEX EQUAL -1)
+                list(APPEND BIT_WIDTH_LIST "64u")
+            endif()
+
             #get last element of the list
             set(LAST_ELEMENT "")
-            list(GET DEFAULT_BIT_WIDTH_LIST -1 LAST_ELEMENT)
+            list(GET BIT_WIDTH_LIST -1 LAST_ELEMENT)
 
-            foreach(BIT_WIDTH IN LISTS DEFAULT_BIT_WIDTH_LIST)
+            foreach(BIT_WIDTH IN LISTS BIT_WIDTH_LIST)
 
                 set(FUNCTION_NAME "")
                 get_function_name_with_default_bit_width(${DEAULT_BIT_WIDTH_FUNCTION} ${BIT_WIDTH} FUNCTION_NAME)
@@ -310,7 +428,8 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "\t${PLATFORM_PREFIX}qplc_bit_aggregates_8u,\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "\t${PLATFORM_PREFIX}qplc_aggregates_8u,\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "\t${PLATFORM_PREFIX}qplc_aggregates_16u,\n")
-        file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "\t${PLATFORM_PREFIX}qplc_aggregates_32u};\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "\t${PLATFORM_PREFIX}qplc_aggregates_32u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "\t${PLATFORM_PREFIX}qplc_aggregates_64u};\n")
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "}\n")
 
@@ -360,7 +479,8 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "namespace qpl::core_sw::dispatcher\n{\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "crc64_table_t ${PLATFORM_PREFIX}crc64_table = {\n")
 
-        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t${PLATFORM_PREFIX}qplc_crc64};\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}qplc_crc64),\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}qplc_crc64_init)};\n")
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}crc64.cpp "}\n")
 
@@ -380,6 +500,7 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
         # Write deflate functions table
         #
         file(WRITE ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_slow_icf.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_optimal_icf.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_hash_table.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_histogram.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
@@ -388,7 +509,8 @@ function(generate_unpack_kernel_arrays current_directory PLATFORMS_LIST)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}slow_deflate_icf_body),\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_histogram_reset),\n")
-        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_hash_table_reset)};\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_hash_table_reset),\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}optimal_deflate_icf_body)};\n")
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "}\n")
 
@@ -190,6 +190,20 @@ extern "C" {
 */
 #define QPL_FLAG_FORCE_ARRAY_OUTPUT 0x00800000U
 
+/* Multi-threading flags */
+/**
+ * Use several threads for a single job, see @ref qpl_job.num_threads. The meaning depends on the operation:
+ * - Compression, software path only: a single (@ref QPL_FLAG_FIRST | @ref QPL_FLAG_LAST) job is split into
+ *   parts compressed concurrently by the host threads;
+ * - Decompression, software path only: with @ref QPL_FLAG_GZIP_MODE, all the members of a multi-member gzip
+ *   stream are decompressed. A single deflate stream is not split;
+ * - Scan, software and auto paths, @ref qpl_execute_job only: a large scan with a nominal bit-vector output is
+ *   split into segments processed concurrently by the host threads and, on the auto path, by the accelerator.
+ *
+ * Compression and decompression jobs are never split between the accelerator and the host threads.
+ */
+#define QPL_FLAG_PARALLEL 0x01000000U
+
 /* NUMA support flags */
 
 /**
@@ -259,6 +273,30 @@ typedef enum {
     qpl_op_select  = 0x12U, /**< Down-sampling filter operation (@ref ANALYTIC_OPERATIONS group) */
     qpl_op_expand  = 0x15U, /**< Up-sampling filter operation (@ref ANALYTIC_OPERATIONS group) */
 
+    // start filter bit-vector operations
+    /**
+     * Bitwise "and" of two bit-vectors (@ref ANALYTIC_OPERATIONS group), source-1 and source-2 are bit-vectors
+     * of @ref qpl_job.num_input_elements bits (src1_bit_width = src2_bit_width = 1). The aggregates report
+     * the number of set bits of the result and the indices of the first and the last set bits.
+     * The bit-vector operations are not supported on @ref qpl_path_hardware.
+     */
+    qpl_op_bit_and = 0x16U,
+
+    /**
+     * Bitwise "or" of two bit-vectors (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_bit_or = 0x17U,
+
+    /**
+     * Bitwise "and-not" of two bit-vectors (@ref ANALYTIC_OPERATIONS group), source-1 AND NOT source-2
+     */
+    qpl_op_bit_and_not = 0x18U,
+
+    /**
+     * Bitwise "exclusive-or" of two bit-vectors (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_bit_xor = 0x19U,
+
     // start filter scan operations
     /**
      * Compare "equal" filter operation (@ref ANALYTIC_OPERATIONS group)
@@ -298,9 +336,43 @@ typedef enum {
     /**
      * Compare "not-in-range" filter operation (@ref ANALYTIC_OPERATIONS group)
      */
-    qpl_op_scan_not_range = 0x27U
+    qpl_op_scan_not_range = 0x27U,
+
+    /**
+     * Compare "in-set" filter operation (@ref ANALYTIC_OPERATIONS group), the set is passed as source-2:
+     * a bitmap of the accepted values for source-1 bit widths up to 16 (src2_bit_width = 1)
+     * or the accepted values in 32-bit format sorted in ascending order (src2_bit_width = 32).
+     * The operation is not supported on @ref qpl_path_hardware.
+     */
+    qpl_op_scan_in_set = 0x28U,
+
+    /**
+     * Compound scan filter operation (@ref ANALYTIC_OPERATIONS group), evaluates a program of up to
+     * @ref QPL_MAX_PREDICATE_LENGTH @ref qpl_scan_predicate instructions passed as source-2 and outputs
+     * a single bit-vector. The operation is not supported on @ref qpl_path_hardware.
+     */
+    qpl_op_scan_predicate = 0x29U
 } qpl_operation;
 
+/**
+ * @brief Enumerates classes of the @ref qpl_operation a @ref qpl_job can be initialized for,
+ *        values can be combined with a bitwise OR.
+ */
+typedef enum {
+    qpl_op_class_compression   = 0x00000001U, /**< @ref qpl_op_compress operation */
+    qpl_op_class_decompression = 0x00000002U, /**< @ref qpl_op_decompress operation */
+    qpl_op_class_analytics     = 0x00000004U, /**< Filter operations (@ref ANALYTIC_OPERATIONS group) */
+    qpl_op_class_crc           = 0x00000008U, /**< @ref qpl_op_crc64 operation */
+    qpl_op_class_all           = 0x0000000FU, /**< All operations, the default for @ref qpl_init_job */
+
+    /**
+     * @ref qpl_op_compress with the software-only levels @ref qpl_level_4 - @ref qpl_level_9, implies
+     * @ref qpl_op_class_compression and adds 256 KB of match search tables on the software path.
+     * Not a part of @ref qpl_op_class_all, so the default job is not enlarged for these levels.
+     */
+    qpl_op_class_high_ratio_compression = 0x00000010U
+} qpl_op_class;
+
 /**
  * @brief Enumerates mini-blocks sizes for the @ref qpl_op_compress and @ref qpl_op_decompress operations.
  */
@@ -375,17 +447,46 @@ typedef enum {
     qpl_level_1 = 1, /**< The fastest compression with low compression ratio*/
     qpl_level_2 = 2, /**< Not supported */
     qpl_level_3 = 3, /**< Medium compression speed, medium compression ratio*/
-    qpl_level_4 = 4, /**< Not supported */
-    qpl_level_5 = 5, /**< Not supported */
-    qpl_level_6 = 6, /**< Not supported */
-    qpl_level_7 = 7, /**< Not supported */
-    qpl_level_8 = 8, /**< Not supported */
-    qpl_level_9 = 9, /**< Not supported */
+    qpl_level_4 = 4, /**< Software path only, 32 KB window with lazy matching */
+    qpl_level_5 = 5, /**< Software path only, 32 KB window with lazy matching */
+    qpl_level_6 = 6, /**< Software path only, 32 KB window with lazy matching */
+    qpl_level_7 = 7, /**< Software path only, 32 KB window with deep lazy matching */
+    qpl_level_8 = 8, /**< Software path only, 32 KB window with deep lazy matching */
+    qpl_level_9 = 9, /**< Software path only, 32 KB window with optimal parsing of dynamic blocks */
     qpl_default_level =
             qpl_level_1, /**< Default compression level defined by the highest compression level supported by Accelerator */
-    qpl_high_level = qpl_level_3 /**< The level with highest compression level from supported by Intel QPL */
+    qpl_high_level = qpl_level_3 /**< The lowest of the software-only levels with better compression ratio */
 } qpl_compression_levels;
 
+/**
+ * @brief Maximal number of instructions in the program of @ref qpl_op_scan_predicate
+ */
+#define QPL_MAX_PREDICATE_LENGTH 16U
+
+/**
+ * @brief Enumerates instructions of the @ref qpl_op_scan_predicate program. The program is written in
+ *        postfix notation: comparisons push their results, logical instructions take the results from the top.
+ */
+typedef enum {
+    qpl_predicate_compare = 0U, /**< Pushes the result of the comparison of an element */
+    qpl_predicate_and     = 1U, /**< Replaces two top results with their conjunction */
+    qpl_predicate_or      = 2U, /**< Replaces two top results with their disjunction */
+    qpl_predicate_not     = 3U  /**< Replaces the top result with its negation */
+} qpl_predicate_opcode;
+
+/**
+ * @brief Instruction of the @ref qpl_op_scan_predicate program
+ *
+ * For example, `a >= 10 AND a < 100 AND a != 42` is written as:
+ * `{compare, ge, 10}, {compare, lt, 100}, {and}, {compare, ne, 42}, {and}`.
+ */
+typedef struct {
+    qpl_predicate_opcode opcode;     /**< Instruction */
+    qpl_operation        comparator; /**< One of @ref qpl_op_scan_eq - @ref qpl_op_scan_not_range for comparisons */
+    uint32_t             param_low;  /**< Low parameter of the comparison */
+    uint32_t             param_high; /**< High parameter of the range comparisons */
+} qpl_scan_predicate;
+
 #ifdef __cplusplus
 }
 #endif
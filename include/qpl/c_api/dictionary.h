@@ -33,6 +33,16 @@ extern "C" {
  */
 typedef struct qpl_dictionary qpl_dictionary;
 
+/**
+ * @brief Expected effect of a trained dictionary, measured by compressing the training samples on software path
+ */
+typedef struct {
+    uint32_t sample_count;               /**< Number of the compressed (non-empty) samples */
+    uint64_t source_size;                /**< Total size of the compressed samples */
+    uint64_t compressed_size;            /**< Total size of the samples compressed without a dictionary */
+    uint64_t dictionary_compressed_size; /**< Total size of the samples compressed with the trained dictionary */
+} qpl_dictionary_training_report;
+
 /** @} */
 
 /**
@@ -81,6 +91,38 @@ QPL_API(qpl_status, qpl_build_dictionary,
         (qpl_dictionary * dict_ptr, sw_compression_level sw_level, hw_compression_level hw_level,
          const uint8_t* raw_dict_ptr, size_t raw_dict_size));
 
+/**
+ * @brief Trains raw dictionary content on a set of samples, the result is passed to @ref qpl_build_dictionary
+ *
+ * Segments of the samples that contain substrings shared by many samples are selected and written in the order
+ * of increasing frequency, so the most frequent content is placed at the end of the dictionary. The size of the
+ * trained dictionary is limited by the history size of the hardware level (see @ref qpl_build_dictionary).
+ * If the total size of the samples fits into the dictionary, the samples are copied as is.
+ *
+ * @param[in]     samples_ptr        Pointer to the samples stored one after another
+ * @param[in]     sample_sizes_ptr   Pointer to the array with the size (in bytes) of every sample
+ * @param[in]     sample_count       Number of samples
+ * @param[in]     sw_level           The compression level for a software path the dictionary is evaluated with
+ * @param[in]     hw_level           The compression level for a hardware path the dictionary is trained for
+ * @param[out]    raw_dict_ptr       Pointer to the buffer for the raw dictionary
+ * @param[in,out] raw_dict_size_ptr  Size (in bytes) of the buffer for the raw dictionary, set to the trained size
+ * @param[out]    report_ptr         Pointer to the evaluation report, the evaluation is skipped if it is `NULL`
+ *
+ * @note The evaluation compresses every sample twice on software path: without a dictionary and with
+ *       the trained one.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_SIZE_ERR;
+ *     - @ref QPL_STS_BUFFER_TOO_LARGE_ERR;
+ *     - @ref QPL_STS_NO_MEM_ERR.
+ */
+QPL_API(qpl_status, qpl_train_dictionary,
+        (const uint8_t* samples_ptr, const size_t* sample_sizes_ptr, uint32_t sample_count,
+         sw_compression_level sw_level, hw_compression_level hw_level, uint8_t* raw_dict_ptr,
+         size_t* raw_dict_size_ptr, qpl_dictionary_training_report* report_ptr));
+
 /**
  * @brief Sets id to the dictionary specified
  *
@@ -173,6 +173,34 @@ qpl_status qpl_huffman_table_init_with_other(qpl_huffman_table_t table, const qp
  */
 qpl_status qpl_huffman_table_get_type(const qpl_huffman_table_t table, qpl_huffman_table_type_e* const type_ptr);
 
+/**
+ * @brief Chooses the table from the set that gives the smallest output for the source in canned mode
+ *
+ * @param[in]  source_ptr      source that is going to be compressed
+ * @param[in]  source_length   source length
+ * @param[in]  tables_ptr      array of deflate @ref qpl_huffman_table_t objects with compression tables
+ * @param[in]  table_count     number of tables in the array
+ * @param[in]  level           level that is going to be used for compression
+ * @param[out] table_index_ptr index of the chosen table, or `table_count` if the dynamic Huffman mode
+ *                             is expected to give smaller output than any of the tables
+ *
+ * @details The histogram of literals, lengths and offsets is gathered on the host for up to 32 KB of the source
+ * (the whole source or windows evenly spread over it). Size of the Huffman codes is estimated for every table,
+ * tables that do not have codes for some of the gathered symbols are skipped. The size of the dynamic Huffman
+ * output is estimated with the entropy of the sample and the approximate size of the deflate header.
+ *
+ * The entropy is the lower bound for the dynamic Huffman codes, so a table is chosen if its estimate exceeds
+ * the dynamic one by no more than 3%.
+ *
+ * The chosen table is then set to @ref qpl_job.huffman_table with the @ref QPL_FLAG_CANNED_MODE flag
+ * on both execution paths.
+ *
+ * @return status from @ref qpl_status
+ */
+qpl_status qpl_huffman_table_select_best(const uint8_t* const source_ptr, const uint32_t source_length,
+                                         const qpl_huffman_table_t* const tables_ptr, const uint32_t table_count,
+                                         const qpl_compression_levels level, uint32_t* const table_index_ptr);
+
 /** @} */
 
 /* --------------------------------------------------------------------------------*/
@@ -17,6 +17,7 @@
 #endif
 
 #include "qpl/c_api/defs.h"
+#include "qpl/c_api/job.h"
 #include "qpl/c_api/status.h"
 
 #ifdef __cplusplus
@@ -46,6 +47,29 @@ typedef struct {
     qpl_index* indices_ptr;           /**< Array with indices for mini-blocks */
 } qpl_index_table;
 
+/**
+ * @brief Maximal uncompressed size of a BGZF member, a member of this size always fits into 64 KB when compressed
+ */
+#define QPL_BGZF_MAX_MEMBER_SIZE 65280U
+
+/**
+ * @brief Entry of the BGZF index, the layout matches the entries of the `.gzi` index files
+ */
+typedef struct {
+    uint64_t compressed_offset;   /**< Offset of the member in the compressed stream */
+    uint64_t uncompressed_offset; /**< Offset of the member data in the uncompressed stream */
+} qpl_bgzf_index_entry;
+
+/**
+ * @brief Layout of a BGZF stream and an optional index of its members
+ */
+typedef struct {
+    uint32_t              member_size;     /**< Uncompressed size of the members, 0 - @ref QPL_BGZF_MAX_MEMBER_SIZE */
+    uint32_t              max_entry_count; /**< Number of entries available in entries_ptr */
+    uint32_t              entry_count;     /**< Number of written entries, one per member */
+    qpl_bgzf_index_entry* entries_ptr;     /**< Array for the index entries, NULL if the index is not needed */
+} qpl_bgzf_index;
+
 /** @} */
 
 /**
@@ -113,6 +137,81 @@ QPL_API(qpl_status, qpl_find_header_block_index,
 QPL_API(qpl_status, qpl_find_mini_block_index,
         (qpl_index_table * table_ptr, uint32_t mini_block_number, uint32_t* block_index_ptr))
 
+/**
+ * @brief Decompresses the whole indexed stream, deflate blocks and groups of their mini-blocks are decompressed
+ * concurrently by the host threads
+ *
+ * @param job_ptr   Pointer to the job that describes the stream
+ * @param table_ptr Pointer to the table with indices generated upon compression of the stream
+ *
+ * @details The following @ref qpl_job fields are used:
+ *      - @ref qpl_job.next_in_ptr and @ref qpl_job.available_in - the whole compressed stream, the bit offsets
+ *        from the table are counted from its beginning (including gzip/zlib header, if any);
+ *      - @ref qpl_job.next_out_ptr and @ref qpl_job.available_out - destination for the whole decompressed stream;
+ *      - @ref qpl_job.mini_block_size - mini-block size used upon compression;
+ *      - @ref qpl_job.num_threads - maximal number of host threads to use, 0 - use all available.
+ *
+ * Every group of mini-blocks is decompressed in random access mode (block header followed by the mini-blocks)
+ * by a separate software path job and written to its offset in the destination, the resulting CRC is checked
+ * against the cumulative CRC stored in the table.
+ *
+ * On success @ref qpl_job.total_out and @ref qpl_job.crc are updated as for a regular decompression job,
+ * @ref qpl_job.total_in is set to the end of the last deflate block (gzip/zlib trailer is not included).
+ *
+ * @note The operation is always executed on the host regardless of the job path.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_MISSING_INDEX_TABLE_ERR;
+ *     - @ref QPL_STS_INVALID_BLOCK_SIZE_ERR;
+ *     - @ref QPL_STS_SIZE_ERR;
+ *     - @ref QPL_STS_SRC_IS_SHORT_ERR;
+ *     - @ref QPL_STS_DST_IS_SHORT_ERR;
+ *     - @ref QPL_STS_NO_MEM_ERR;
+ *     - @ref QPL_STS_INDEX_CRC_ERR.
+ */
+QPL_API(qpl_status, qpl_decompress_indexed, (qpl_job * job_ptr, const qpl_index_table* table_ptr))
+
+/**
+ * @brief Compresses the whole input into a BGZF stream: a sequence of independent gzip members with the size
+ * of each member kept in the `BC` extra subfield, followed by the BGZF end-of-file member
+ *
+ * @param job_ptr   Pointer to the compression job
+ * @param index_ptr Pointer to the member layout and the index, can be NULL to use the default member size
+ *                  without an index
+ *
+ * @details The following @ref qpl_job fields are used:
+ *      - @ref qpl_job.next_in_ptr and @ref qpl_job.available_in - the whole input;
+ *      - @ref qpl_job.next_out_ptr and @ref qpl_job.available_out - destination for the whole stream,
+ *        `((available_in + member_size - 1) / member_size) * 65536 + 28` bytes are always enough;
+ *      - @ref qpl_job.level, @ref QPL_FLAG_DYNAMIC_HUFFMAN and @ref QPL_FLAG_OMIT_VERIFY flags - compression
+ *        parameters of every member;
+ *      - @ref qpl_job.num_threads - maximal number of host threads to use, 0 - use all available.
+ *
+ * Members are compressed concurrently by separate software path jobs. A member that does not fit into 64 KB
+ * after compression is written as a stored block.
+ *
+ * If the index is requested, an entry is written for every member (the end-of-file member is not included).
+ * The BGZF virtual offset of the uncompressed position `pos` is `(entry.compressed_offset << 16) |
+ * (pos - entry.uncompressed_offset)`, where `entry` is the member with number `pos / member_size`.
+ *
+ * On success @ref qpl_job.total_in, @ref qpl_job.total_out and @ref qpl_job.crc (CRC32 of the whole input)
+ * are updated as for a regular compression job.
+ *
+ * @note The operation is always executed on the host regardless of the job path.
+ * The stream is decompressed by a single @ref QPL_FLAG_GZIP_MODE | @ref QPL_FLAG_PARALLEL job or any gzip tool.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_INVALID_BLOCK_SIZE_ERR;
+ *     - @ref QPL_STS_INDEX_ARRAY_TOO_SMALL;
+ *     - @ref QPL_STS_DST_IS_SHORT_ERR;
+ *     - @ref QPL_STS_NO_MEM_ERR.
+ */
+QPL_API(qpl_status, qpl_compress_bgzf, (qpl_job * job_ptr, qpl_bgzf_index* index_ptr))
+
 /** @} */
 
 #ifdef __cplusplus
@@ -41,6 +41,8 @@ struct qpl_aux_data {
     uint8_t*   middle_layer_buffer_ptr; /**< Internal middle-level layer buffer */
     uint8_t*   hw_state_ptr;            /**< Hardware path execution context */
     qpl_path_t path;                    /**< @ref qpl_path_t marker */
+    uint32_t   sw_status;               /**< Status of the job executed asynchronously on the software path */
+    uint32_t   op_classes;              /**< @ref qpl_op_class bits the job is initialized for */
 };
 
 typedef struct qpl_aux_data qpl_data; /**< Hidden internal state structure */
@@ -88,7 +90,7 @@ typedef struct {
     // Filter Function Fields
     uint8_t* next_src2_ptr;      /**< Pointer to source-2 data. Updated value is returned */
     uint32_t available_src2;     /**< Number of valid bytes of source-2 data */
-    uint32_t src1_bit_width;     /**< Source-1 bit width for Analytics. Valid values are 1-32 */
+    uint32_t src1_bit_width;     /**< Source-1 bit width for Analytics. Valid values are 1-32 (1-64 for software) */
     uint32_t src2_bit_width;     /**< Source-2 bit width for Analytics. Valid values are 1-32 */
     uint32_t num_input_elements; /**< Number of input elements for Analytics */
 
@@ -107,6 +109,16 @@ typedef struct {
      */
     uint32_t param_high;
 
+    /**
+     * Low parameter for operation scan of 33..64-bit elements, used instead of @ref qpl_job.param_low
+     */
+    uint64_t param_low_64;
+
+    /**
+     * High parameter for operation scan of 33..64-bit elements, used instead of @ref qpl_job.param_high
+     */
+    uint64_t param_high_64;
+
     /**
      * Number of initial bytes to be dropped at the start of the Analytics portion of the pipeline
      */
@@ -128,9 +140,18 @@ typedef struct {
     uint32_t last_index_max_value;  /**< Output aggregate value - index of the last max value */
     uint32_t sum_value;             /**< Output aggregate value - sum of all values */
 
+    // 64-bit Filter Aggregate Values, the 32-bit ones above hold their low halves
+    uint64_t first_index_min_value_64; /**< Output aggregate value - index of the first min value */
+    uint64_t last_index_max_value_64;  /**< Output aggregate value - index of the last max value */
+    uint64_t sum_value_64;             /**< Output aggregate value - sum of all values without 32-bit wraparound */
+    uint32_t num_output_elements;      /**< Output aggregate value - number of elements written to the output */
+
     // NUMA ID
     int32_t numa_id; /**< ID of the NUMA. Set it to -1 for auto detecting */
 
+    // Multi-threading
+    uint32_t num_threads; /**< Number of host threads used with @ref QPL_FLAG_PARALLEL and @ref qpl_decompress_indexed, 0 - use all available */
+
     // storage for auxiliary data
     qpl_data data_ptr; /**< Internal memory buffers & structures for all Intel QPL operations */
 } qpl_job;
@@ -181,6 +202,48 @@ QPL_API(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t* job_size_p
  */
 QPL_API(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job* qpl_job_ptr))
 
+/**
+ * @brief Calculates the amount of memory, in bytes, required for the qpl_job structure that is able
+ * to perform only the given classes of operations.
+ *
+ * @param[in]   qpl_path      type of implementation path to use - @ref qpl_path_auto,
+ *                            @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]   op_classes    bitwise OR of the @ref qpl_op_class values
+ * @param[out]  job_size_ptr  a pointer to uint32_t, where the qpl_job size (in bytes) is stored
+ *
+ * @note Internal buffers of the operations that are not requested are not allocated, so such a job
+ *       is noticeably smaller than the one sized with @ref qpl_get_job_size,
+ *       e.g. a @ref qpl_op_class_crc job doesn't hold any compression or analytics state.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR.
+ */
+QPL_API(qpl_status, qpl_get_job_size_by_class, (qpl_path_t qpl_path, uint32_t op_classes, uint32_t* job_size_ptr))
+
+/**
+ * @brief Initializes the qpl_job structure for the given classes of operations,
+ * only internal buffers of these operations are set up and zeroed.
+ *
+ * @param[in]      qpl_path     type of implementation path to use - @ref qpl_path_auto,
+ *                              @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]      op_classes   bitwise OR of the @ref qpl_op_class values
+ * @param[in,out]  qpl_job_ptr  a pointer to the @ref qpl_job structure
+ *
+ * @warning Memory for qpl_job structure must be allocated at the application side. Size (in bytes)
+ * must be obtained with the @ref qpl_get_job_size_by_class function for the same path and classes.
+ *
+ * @note Submitting an operation outside of op_classes with such a job fails with @ref QPL_STS_OPERATION_ERR.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR;
+ *     - @ref QPL_STS_NULL_PTR_ERR.
+ */
+QPL_API(qpl_status, qpl_init_job_by_class, (qpl_path_t qpl_path, uint32_t op_classes, qpl_job* qpl_job_ptr))
+
 /**
  * @brief Parses the qpl_job structure and forms the corresponding processing functions pipeline.
  *
@@ -221,6 +284,47 @@ QPL_API(qpl_status, qpl_wait_job, (qpl_job * qpl_job_ptr))
  */
 QPL_API(qpl_status, qpl_check_job, (qpl_job * qpl_job_ptr))
 
+/**
+ * @brief Submits a batch of jobs. The jobs are checked once before the first submission, accelerator jobs are
+ *        enqueued back-to-back and software path jobs are spread over the host threads.
+ *
+ * @param[in,out]  jobs_ptr   Array of pointers to the initialized @ref qpl_job structures
+ * @param[in]      job_count  Number of jobs in the batch
+ *
+ * @note The submission is retried a limited number of times while the work queues are busy. If one of the jobs
+ *       can't be submitted, the jobs submitted before it are completed and the status of the failed submission
+ *       is returned (@ref QPL_STS_QUEUES_ARE_BUSY_ERR if the work queues stay busy), so either the whole batch
+ *       is in flight or none of it.
+ *
+ * @return One of statuses presented in the @ref qpl_status
+ */
+QPL_API(qpl_status, qpl_submit_jobs, (qpl_job** jobs_ptr, uint32_t job_count))
+
+/**
+ * @brief Checks the status of a batch submitted with @ref qpl_submit_jobs. The jobs are checked in order
+ *        starting from *completed_count_ptr, the counter is advanced past every completed job.
+ *
+ * @param[in,out]  jobs_ptr             Array of pointers to the submitted @ref qpl_job structures
+ * @param[in]      job_count            Number of jobs in the batch
+ * @param[in,out]  completed_count_ptr  Number of jobs already completed, shall be 0 for the first call
+ *
+ * @return
+ *     - @ref QPL_STS_BEING_PROCESSED if the next job is not completed yet;
+ *     - Status of the failed job, the job is jobs_ptr[*completed_count_ptr - 1];
+ *     - @ref QPL_STS_OK if all jobs are completed successfully.
+ */
+QPL_API(qpl_status, qpl_check_jobs, (qpl_job** jobs_ptr, uint32_t job_count, uint32_t* completed_count_ptr))
+
+/**
+ * @brief Waits until all jobs of a batch submitted with @ref qpl_submit_jobs are completed
+ *
+ * @param[in,out]  jobs_ptr   Array of pointers to the submitted @ref qpl_job structures
+ * @param[in]      job_count  Number of jobs in the batch
+ *
+ * @return @ref QPL_STS_OK if all jobs are completed successfully and the status of the first failed job otherwise
+ */
+QPL_API(qpl_status, qpl_wait_jobs, (qpl_job** jobs_ptr, uint32_t job_count))
+
 /**
  * @brief Completes @ref qpl_job lifecycle: disconnects from the internal library context, frees internal resources.
  *
@@ -54,6 +54,26 @@ typedef struct {
     uint32_t reserved_distances[2U];                /**< Reserved distance tokens */
 } qpl_histogram;
 
+/**
+ * @brief Method of statistics gathering used by @ref qpl_gather_deflate_statistics_with_options
+ */
+typedef enum {
+    qpl_statistics_full     = 0, /**< Match search over the whole source, as @ref qpl_gather_deflate_statistics does */
+    qpl_statistics_sampled  = 1, /**< Match search over the windows evenly spread over the source */
+    qpl_statistics_literals = 2  /**< Byte counting without match search, lengths and offsets are not gathered */
+} qpl_statistics_method;
+
+/**
+ * @struct qpl_statistics_options
+ * @brief Options of statistics gathering
+ */
+typedef struct {
+    qpl_statistics_method method;        /**< Method of statistics gathering */
+    uint32_t              sample_period; /**< One of `sample_period` 64 KB windows is processed in sampled method,
+                                              0 - default period (16) */
+    uint32_t              num_threads;   /**< Maximal number of host threads to use, 0 - use all available */
+} qpl_statistics_options;
+
 /** @} */
 
 /**
@@ -76,6 +96,34 @@ QPL_API(qpl_status, qpl_gather_deflate_statistics,
         (uint8_t * source_ptr, const uint32_t source_length, qpl_histogram* histogram_ptr,
          const qpl_compression_levels level, const qpl_path_t path))
 
+/**
+ * @brief Gathers deflate statistics (literals/lengths and offsets histogram) with the method and the number
+ * of threads set in the options
+ *
+ * @param[in]   source_ptr     Pointer to source vector that should be processed
+ * @param[in]   source_length  Source vector length
+ * @param[out]  histogram_ptr  Pointer to histogram to be updated
+ * @param[in]   level          Level of compression algorithm
+ * @param[in]   path           Execution path
+ * @param[in]   options_ptr    Pointer to @ref qpl_statistics_options
+ *
+ * @details The source is split into 1 MB chunks (64 KB windows for @ref qpl_statistics_sampled method) that are
+ * processed by up to `options_ptr->num_threads` host threads, the histograms of the chunks are added together.
+ * The result does not depend on the number of threads. Matches are not searched across the chunk borders.
+ *
+ * The sampled method counts the symbols of the processed windows only, so the counters are smaller than
+ * for the whole source, while their proportions are kept for the Huffman table building.
+ *
+ * @note The @ref qpl_statistics_sampled and @ref qpl_statistics_literals methods are executed on the host,
+ * @ref qpl_path_hardware supports the @ref qpl_statistics_full method only, the whole source is processed
+ * by the accelerator in this case.
+ *
+ * @return One of statuses presented in the @ref qpl_status
+ */
+QPL_API(qpl_status, qpl_gather_deflate_statistics_with_options,
+        (uint8_t * source_ptr, const uint32_t source_length, qpl_histogram* histogram_ptr,
+         const qpl_compression_levels level, const qpl_path_t path, const qpl_statistics_options* options_ptr))
+
 /** @} */
 
 #ifdef __cplusplus
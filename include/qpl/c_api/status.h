@@ -137,6 +137,7 @@ typedef enum {
     QPL_STS_ARCHIVE_HEADER_ERR        = QPL_SERVICE_LOGIC_ERROR(4U), /**< Invalid GZIP/Zlib header */
     QPL_STS_ARCHIVE_UNSUP_METHOD_ERR  = QPL_SERVICE_LOGIC_ERROR(5U), /**< Gzip/Zlib header specifies unsupported compress method */
     QPL_STS_OBJECT_ALLOCATION_ERR     = QPL_SERVICE_LOGIC_ERROR(6U), /**< Not able to allocate Huffman table object */
+    QPL_STS_INDEX_CRC_ERR             = QPL_SERVICE_LOGIC_ERROR(7U), /**< Decompressed mini-blocks do not match CRC from the indexing table */
 
 /* --- Corresponds to the error codes in Completion Record from Intel® In-Memory Analytics Accelerator --- */
     QPL_STS_BIG_HEADER_ERR                  = QPL_OPERATION_ERROR(1U),  /**< Reached the end of the input stream before decoding header and header is too big to fit in input buffer */
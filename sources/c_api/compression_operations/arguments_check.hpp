@@ -91,11 +91,11 @@ inline qpl_status bad_arguments_check<qpl_operation::qpl_op_compress>(const qpl_
     /* Check for Unsupported Compression Levels */
 
     // Check for unsupported compression levels
-    if (job_ptr->level != qpl_high_level && job_ptr->level != qpl_default_level) {
+    if (job_ptr->level != qpl_default_level && (job_ptr->level < qpl_high_level || job_ptr->level > qpl_level_9)) {
         return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
     }
-    // Check for high compression level on hw path
-    if (job_ptr->level == qpl_high_level && (job::get_execution_path(job_ptr) == ml::execution_path_t::hardware)) {
+    // Check for high compression levels on hw path
+    if (job_ptr->level != qpl_default_level && (job::get_execution_path(job_ptr) == ml::execution_path_t::hardware)) {
         return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
     }
 
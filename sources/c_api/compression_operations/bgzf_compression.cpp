@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Compression into BGZF streams (public C API)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "qpl/qpl.h"
+
+#include "lane_job.hpp"
+
+// Middle layer headers
+#include "dispatcher/sw_executor.hpp"
+#include "util/checksum.hpp"
+
+// Legacy
+#include "own_defs.h"
+
+namespace qpl {
+
+/**
+ * @brief Maximal size of a compressed BGZF member, the BSIZE field keeps the member size minus one in 16 bits
+ */
+static constexpr uint32_t bgzf_max_compressed_size = 64U * 1024U;
+
+/**
+ * @brief Size of the gzip header with the BGZF extra field
+ */
+static constexpr uint32_t bgzf_header_size = 18U;
+
+/**
+ * @brief Size of the gzip member trailer: CRC32 and ISIZE
+ */
+static constexpr uint32_t bgzf_trailer_size = 8U;
+
+/**
+ * @brief Size of the deflate stored block header: block type and LEN/NLEN fields
+ */
+static constexpr uint32_t bgzf_stored_header_size = 5U;
+
+/**
+ * @brief Number of members compressed by a lane in a single round, the members of a round are kept in the scratch
+ * buffer until they are written to the destination in order
+ */
+static constexpr uint32_t bgzf_members_per_lane = 4U;
+
+/**
+ * @brief gzip header with the BGZF "BC" extra subfield, BSIZE (last two bytes) is set per member
+ */
+static constexpr uint8_t bgzf_header[bgzf_header_size] = {0x1F, 0x8B, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                                          0xFF, 0x06, 0x00, 'B',  'C',  0x02, 0x00, 0x00, 0x00};
+
+/**
+ * @brief Empty member that marks the end of a BGZF stream
+ */
+static constexpr uint8_t bgzf_eof_member[] = {0x1F, 0x8B, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+                                              0x06, 0x00, 'B',  'C',  0x02, 0x00, 0x1B, 0x00, 0x03, 0x00,
+                                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+/**
+ * @brief Result of a member compression kept until the member is written to the destination
+ */
+struct bgzf_slot_t {
+    uint32_t size; /**< Size of the whole member with its header and trailer */
+    uint32_t crc;  /**< CRC32 of the member data */
+};
+
+/**
+ * @brief State shared by all the lanes of a single @ref qpl_compress_bgzf call
+ */
+struct bgzf_context_t {
+    const uint8_t*         source_ptr;
+    uint32_t               source_size;
+    uint32_t               member_size;
+    uint32_t               flags;
+    qpl_compression_levels level;
+    uint8_t*               scratch_ptr;
+    bgzf_slot_t*           slots_ptr;
+    uint32_t               first_member;
+    uint32_t               member_count;
+    std::atomic<uint32_t>  next_slot;
+    std::atomic<uint32_t>  status;
+};
+
+/**
+ * @brief Single worker of @ref qpl_compress_bgzf that owns its own compression job
+ */
+struct bgzf_lane_t {
+    bgzf_context_t* context_ptr = nullptr;
+    lane_job        job;
+};
+
+static inline void write_le16(uint8_t* destination_ptr, uint32_t value) noexcept {
+    destination_ptr[0] = static_cast<uint8_t>(value);
+    destination_ptr[1] = static_cast<uint8_t>(value >> 8U);
+}
+
+static inline void write_le32(uint8_t* destination_ptr, uint32_t value) noexcept {
+    write_le16(destination_ptr, value);
+    write_le16(destination_ptr + 2U, value >> 16U);
+}
+
+/**
+ * @brief Compresses a member into its scratch slot, the data is written as a stored block if it does not fit
+ */
+static uint32_t compress_bgzf_member(const bgzf_context_t& context, uint32_t slot_index, qpl_job* job_ptr) noexcept {
+    const uint32_t member_index = context.first_member + slot_index;
+    const uint32_t input_offset = member_index * context.member_size;
+    const uint32_t input_size   = std::min(context.member_size, context.source_size - input_offset);
+
+    uint8_t* const slot_ptr = context.scratch_ptr + static_cast<size_t>(slot_index) * bgzf_max_compressed_size;
+    uint8_t* const body_ptr = slot_ptr + bgzf_header_size;
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = context.level;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | context.flags;
+    job_ptr->next_in_ptr   = const_cast<uint8_t*>(context.source_ptr) + input_offset;
+    job_ptr->available_in  = input_size;
+    job_ptr->next_out_ptr  = body_ptr;
+    job_ptr->available_out = bgzf_max_compressed_size - bgzf_header_size - bgzf_trailer_size;
+    job_ptr->total_in      = 0U;
+    job_ptr->total_out     = 0U;
+
+    const uint32_t status = qpl_execute_job(job_ptr);
+
+    uint32_t body_size = 0U;
+    uint32_t crc       = 0U;
+
+    if (QPL_STS_OK == status) {
+        body_size = job_ptr->total_out;
+        crc       = job_ptr->crc;
+    } else if (QPL_STS_MORE_OUTPUT_NEEDED == status || QPL_STS_DST_IS_SHORT_ERR == status) {
+        // Incompressible data, QPL_BGZF_MAX_MEMBER_SIZE bytes always fit into a single final stored block
+        const uint8_t* const input_ptr = context.source_ptr + input_offset;
+
+        body_ptr[0] = 0x01U;
+        write_le16(body_ptr + 1U, input_size);
+        write_le16(body_ptr + 3U, ~input_size);
+        std::memcpy(body_ptr + bgzf_stored_header_size, input_ptr, input_size);
+
+        body_size = bgzf_stored_header_size + input_size;
+        crc       = ml::util::crc32_gzip(input_ptr, input_ptr + input_size, 0U);
+    } else {
+        return status;
+    }
+
+    const uint32_t member_size = bgzf_header_size + body_size + bgzf_trailer_size;
+
+    std::memcpy(slot_ptr, bgzf_header, bgzf_header_size);
+    write_le16(slot_ptr + bgzf_header_size - 2U, member_size - 1U);
+    write_le32(body_ptr + body_size, crc);
+    write_le32(body_ptr + body_size + 4U, input_size);
+
+    context.slots_ptr[slot_index] = {member_size, crc};
+
+    return QPL_STS_OK;
+}
+
+/**
+ * @brief Lane body, takes members of the current round from the shared counter until the round is done
+ * or any lane failed
+ */
+static void compress_bgzf_lane(bgzf_lane_t& lane) noexcept {
+    auto&       context = *lane.context_ptr;
+    auto* const job_ptr = lane.job.get();
+
+    while (QPL_STS_OK == context.status.load(std::memory_order_relaxed)) {
+        const uint32_t slot_index = context.next_slot.fetch_add(1U, std::memory_order_relaxed);
+        if (slot_index >= context.member_count) { break; }
+
+        const uint32_t status = compress_bgzf_member(context, slot_index, job_ptr);
+
+        if (QPL_STS_OK != status) {
+            uint32_t expected = QPL_STS_OK;
+            context.status.compare_exchange_strong(expected, status, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace qpl
+
+QPL_FUN("C" qpl_status, qpl_compress_bgzf, (qpl_job * job_ptr, qpl_bgzf_index* index_ptr)) {
+    using namespace qpl;
+
+    QPL_BAD_PTR_RET(job_ptr);
+    QPL_BAD_PTR_RET(job_ptr->next_out_ptr);
+    OWN_RETURN_ERROR(0U != job_ptr->available_in && nullptr == job_ptr->next_in_ptr, QPL_STS_NULL_PTR_ERR);
+
+    const uint32_t member_size = (nullptr == index_ptr || 0U == index_ptr->member_size) ? QPL_BGZF_MAX_MEMBER_SIZE
+                                                                                        : index_ptr->member_size;
+    OWN_RETURN_ERROR(member_size > QPL_BGZF_MAX_MEMBER_SIZE, QPL_STS_INVALID_BLOCK_SIZE_ERR);
+
+    const uint32_t source_size  = job_ptr->available_in;
+    const uint32_t member_count = static_cast<uint32_t>((static_cast<uint64_t>(source_size) + member_size - 1U) /
+                                                        member_size);
+
+    const bool is_index_requested = (nullptr != index_ptr && nullptr != index_ptr->entries_ptr);
+    if (is_index_requested) {
+        OWN_RETURN_ERROR(index_ptr->max_entry_count < member_count, QPL_STS_INDEX_ARRAY_TOO_SMALL);
+    }
+
+    auto& executor = ml::dispatcher::sw_executor::get_instance();
+
+    uint32_t lane_count = (0U == job_ptr->num_threads) ? executor.worker_count() : job_ptr->num_threads;
+    lane_count          = std::max(1U, std::min(lane_count, member_count));
+
+    const uint32_t round_size = lane_count * bgzf_members_per_lane;
+
+    std::unique_ptr<uint8_t[]> scratch(new (std::nothrow) uint8_t[static_cast<size_t>(round_size) *
+                                                                  bgzf_max_compressed_size]);
+    OWN_RETURN_ERROR(nullptr == scratch, QPL_STS_NO_MEM_ERR);
+
+    std::unique_ptr<bgzf_slot_t[]> slots(new (std::nothrow) bgzf_slot_t[round_size]);
+    OWN_RETURN_ERROR(nullptr == slots, QPL_STS_NO_MEM_ERR);
+
+    // Lane jobs reserve the tables of the levels 4-9 only if such a level is requested
+    const uint32_t lane_op_classes =
+            (job_ptr->level > qpl_high_level) ? qpl_op_class_high_ratio_compression : qpl_op_class_compression;
+
+    uint32_t   job_size = 0U;
+    qpl_status status   = qpl_get_job_size_by_class(qpl_path_software, lane_op_classes, &job_size);
+    if (QPL_STS_OK != status) { return status; }
+
+    std::unique_ptr<bgzf_lane_t[]> lanes(new (std::nothrow) bgzf_lane_t[lane_count]);
+    OWN_RETURN_ERROR(nullptr == lanes, QPL_STS_NO_MEM_ERR);
+
+    bgzf_context_t context {};
+    context.source_ptr  = job_ptr->next_in_ptr;
+    context.source_size = source_size;
+    context.member_size = member_size;
+    context.flags       = job_ptr->flags & (QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY);
+    context.level       = job_ptr->level;
+    context.scratch_ptr = scratch.get();
+    context.slots_ptr   = slots.get();
+
+    for (uint32_t i = 0U; i < lane_count; i++) {
+        lanes[i].context_ptr = &context;
+
+        status = lanes[i].job.init(qpl_path_software, lane_op_classes, job_size);
+        if (QPL_STS_OK != status) { return status; }
+    }
+
+    uint8_t* const destination_ptr  = job_ptr->next_out_ptr;
+    const uint32_t destination_size = job_ptr->available_out;
+
+    uint32_t output_offset = 0U;
+    uint32_t crc           = 0U;
+
+    for (uint32_t first_member = 0U; first_member < member_count; first_member += round_size) {
+        const uint32_t round_members = std::min(round_size, member_count - first_member);
+        const uint32_t round_lanes   = std::min(lane_count, round_members);
+
+        context.first_member = first_member;
+        context.member_count = round_members;
+        context.next_slot.store(0U);
+
+        executor.parallel_for(lanes.get(), round_lanes, &compress_bgzf_lane);
+
+        status = static_cast<qpl_status>(context.status.load());
+        if (QPL_STS_OK != status) { break; }
+
+        // Members are written in order, so the stream and the index do not depend on the lane scheduling
+        for (uint32_t slot = 0U; slot < round_members; slot++) {
+            const uint32_t member_index = first_member + slot;
+            const uint32_t input_offset = member_index * member_size;
+            const uint32_t input_size   = std::min(member_size, source_size - input_offset);
+
+            if (slots[slot].size > destination_size - output_offset) {
+                status = QPL_STS_DST_IS_SHORT_ERR;
+                break;
+            }
+
+            std::memcpy(destination_ptr + output_offset,
+                        scratch.get() + static_cast<size_t>(slot) * bgzf_max_compressed_size, slots[slot].size);
+
+            if (is_index_requested) { index_ptr->entries_ptr[member_index] = {output_offset, input_offset}; }
+
+            crc = ml::util::crc32_gzip_combine(crc, slots[slot].crc, input_size);
+            output_offset += slots[slot].size;
+        }
+
+        if (QPL_STS_OK != status) { break; }
+    }
+
+    if (QPL_STS_OK != status) { return status; }
+
+    OWN_RETURN_ERROR(sizeof(bgzf_eof_member) > destination_size - output_offset, QPL_STS_DST_IS_SHORT_ERR);
+
+    std::memcpy(destination_ptr + output_offset, bgzf_eof_member, sizeof(bgzf_eof_member));
+    output_offset += static_cast<uint32_t>(sizeof(bgzf_eof_member));
+
+    if (nullptr != index_ptr) { index_ptr->entry_count = is_index_requested ? member_count : 0U; }
+
+    job_ptr->total_in  = source_size;
+    job_ptr->total_out = output_offset;
+    job_ptr->crc       = crc;
+    job_ptr->next_in_ptr += source_size;
+    job_ptr->available_in = 0U;
+    job_ptr->next_out_ptr += output_offset;
+    job_ptr->available_out -= output_offset;
+
+    return QPL_STS_OK;
+}
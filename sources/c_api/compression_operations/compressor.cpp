@@ -164,6 +164,8 @@ uint32_t perform_compression(qpl_job* const job_ptr) noexcept {
             builder.dictionary(*job_ptr->dictionary);
         }
 
+        if (job_ptr->flags & QPL_FLAG_PARALLEL) { builder.parallel(job_ptr->num_threads); }
+
         auto state = builder.verify(!(job_ptr->flags & QPL_FLAG_OMIT_VERIFY)).build();
 
         if (job_ptr->flags & QPL_FLAG_CANNED_MODE) { // LZ Only
@@ -239,6 +239,26 @@ uint32_t perform_compression(qpl_job* const job_ptr) noexcept;
 template <qpl::ml::execution_path_t path>
 uint32_t perform_decompress(qpl_job* const job_ptr) noexcept;
 
+/**
+ * @brief Decompresses all the members of a (@ref QPL_FLAG_FIRST | @ref QPL_FLAG_LAST) gzip stream
+ *        submitted with @ref QPL_FLAG_PARALLEL.
+ *
+ * @details Members that keep their size in the BGZF extra subfield are decompressed concurrently on the host
+ *          executor, other members are decompressed one by one while the stream is scanned.
+ *          CRC32 and ISIZE of every member are checked, @ref qpl_job.crc is set to the CRC32 of the whole output.
+ *
+ * @param [in,out] job_ptr pointer onto user specified @ref qpl_job
+ *
+ * @return
+ *    - @ref QPL_STS_OK
+ *    - @ref QPL_STS_ARCHIVE_HEADER_ERR
+ *    - @ref QPL_STS_SRC_IS_SHORT_ERR
+ *    - @ref QPL_STS_DST_IS_SHORT_ERR
+ *    - @ref QPL_STS_INTL_VERIFY_ERR
+ *    - @ref QPL_STS_NO_MEM_ERR
+ */
+uint32_t perform_gzip_members_decompress(qpl_job* const job_ptr) noexcept;
+
 } // namespace qpl
 
 /** @} */
@@ -12,6 +12,7 @@
 // c_api
 #include "arguments_check.hpp"
 #include "compression_state_t.h"
+#include "compressor.hpp"
 #include "huffman_table.hpp"
 #include "job.hpp"
 #include "own_defs.h"
@@ -65,10 +66,19 @@ uint32_t perform_decompress(qpl_job* const job_ptr) noexcept {
 
     if (job_ptr->flags & QPL_FLAG_FIRST) { job::reset<qpl_op_decompress>(job_ptr); }
 
-    decompression_operation_result_t result {};
-
     OWN_QPL_CHECK_STATUS(qpl::job::validate_operation<qpl_op_decompress>(job_ptr));
 
+    if constexpr (execution_path_t::software == path) {
+        constexpr uint32_t gzip_members_flags =
+                QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE | QPL_FLAG_PARALLEL;
+
+        if (gzip_members_flags == (job_ptr->flags & gzip_members_flags)) {
+            return perform_gzip_members_decompress(job_ptr);
+        }
+    }
+
+    decompression_operation_result_t result {};
+
     qpl::ml::allocation_buffer_t state_buffer(job_ptr->data_ptr.middle_layer_buffer_ptr,
                                               job_ptr->data_ptr.hw_state_ptr);
 
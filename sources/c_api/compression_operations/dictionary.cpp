@@ -11,13 +11,133 @@
 
 #include "qpl/c_api/dictionary.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+
 #include "qpl/c_api/defs.h"
+#include "qpl/qpl.h"
 
 #include "common/defs.hpp"
 #include "compression/dictionary/dictionary_defs.hpp"
+#include "compression/dictionary/dictionary_training.hpp"
 #include "compression/dictionary/dictionary_utils.hpp"
 #include "util/checkers.hpp"
 
+// Legacy
+#include "own_checkers.h"
+
+namespace qpl {
+
+/**
+ * @brief Size of the deflate stored block header, an incompressible sample is counted as a stored block
+ */
+static constexpr uint32_t training_stored_header_size = 5U;
+
+/**
+ * @brief Compresses every non-empty sample on software path, with the dictionary if it is set
+ */
+static qpl_status compress_training_samples(qpl_job* job_ptr, const uint8_t* samples_ptr,
+                                            const size_t* sample_sizes_ptr, uint32_t sample_count,
+                                            qpl_compression_levels level, qpl_dictionary* dictionary_ptr,
+                                            uint8_t* destination_ptr, uint32_t destination_size,
+                                            uint64_t& compressed_size) noexcept {
+    const uint8_t* sample_ptr = samples_ptr;
+
+    for (uint32_t i = 0U; i < sample_count; sample_ptr += sample_sizes_ptr[i], i++) {
+        const auto sample_size = static_cast<uint32_t>(sample_sizes_ptr[i]);
+        if (0U == sample_size) { continue; }
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = level;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        job_ptr->next_in_ptr   = const_cast<uint8_t*>(sample_ptr);
+        job_ptr->available_in  = sample_size;
+        job_ptr->next_out_ptr  = destination_ptr;
+        job_ptr->available_out = destination_size;
+        job_ptr->total_in      = 0U;
+        job_ptr->total_out     = 0U;
+        job_ptr->dictionary    = dictionary_ptr;
+
+        const qpl_status status = qpl_execute_job(job_ptr);
+
+        if (QPL_STS_OK == status) {
+            compressed_size += job_ptr->total_out;
+        } else if (QPL_STS_MORE_OUTPUT_NEEDED == status || QPL_STS_DST_IS_SHORT_ERR == status) {
+            compressed_size += training_stored_header_size + sample_size;
+        } else {
+            return status;
+        }
+    }
+
+    return QPL_STS_OK;
+}
+
+/**
+ * @brief Fills in the training report by compressing the samples without a dictionary and with the trained one
+ */
+static qpl_status evaluate_trained_dictionary(const uint8_t* samples_ptr, const size_t* sample_sizes_ptr,
+                                              uint32_t sample_count, sw_compression_level sw_level,
+                                              const uint8_t* raw_dict_ptr, size_t raw_dict_size,
+                                              qpl_dictionary_training_report& report) noexcept {
+    report = {};
+
+    size_t max_sample_size = 0U;
+    for (uint32_t i = 0U; i < sample_count; i++) {
+        if (0U != sample_sizes_ptr[i]) {
+            report.sample_count++;
+            report.source_size += sample_sizes_ptr[i];
+        }
+
+        max_sample_size = std::max(max_sample_size, sample_sizes_ptr[i]);
+    }
+
+    const size_t destination_size = max_sample_size + max_sample_size / 8U + 1024U;
+    OWN_RETURN_ERROR(destination_size > UINT32_MAX, QPL_STS_BUFFER_TOO_LARGE_ERR);
+
+    // The software path dictionary level must match the compression level, the hardware part is not needed
+    const sw_compression_level   evaluation_sw_level = (SW_NONE == sw_level) ? LEVEL_1 : sw_level;
+    const qpl_compression_levels level = (LEVEL_3 == evaluation_sw_level) ? qpl_high_level : qpl_default_level;
+
+    const size_t dictionary_size = qpl_get_dictionary_size(evaluation_sw_level, HW_NONE, raw_dict_size);
+
+    uint32_t   job_size = 0U;
+    qpl_status status   = qpl_get_job_size_by_class(qpl_path_software, qpl_op_class_compression, &job_size);
+    if (QPL_STS_OK != status) { return status; }
+
+    std::unique_ptr<uint8_t[]> dictionary_buffer(new (std::nothrow) uint8_t[dictionary_size]);
+    std::unique_ptr<uint8_t[]> job_buffer(new (std::nothrow) uint8_t[job_size]);
+    std::unique_ptr<uint8_t[]> destination(new (std::nothrow) uint8_t[destination_size]);
+
+    OWN_RETURN_ERROR(!dictionary_buffer || !job_buffer || !destination, QPL_STS_NO_MEM_ERR);
+
+    auto* const dictionary_ptr = reinterpret_cast<qpl_dictionary*>(dictionary_buffer.get());
+    auto* const job_ptr        = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    status = qpl_build_dictionary(dictionary_ptr, evaluation_sw_level, HW_NONE, raw_dict_ptr, raw_dict_size);
+    if (QPL_STS_OK != status) { return status; }
+
+    status = qpl_init_job_by_class(qpl_path_software, qpl_op_class_compression, job_ptr);
+    if (QPL_STS_OK != status) { return status; }
+
+    status = compress_training_samples(job_ptr, samples_ptr, sample_sizes_ptr, sample_count, level, nullptr,
+                                       destination.get(), static_cast<uint32_t>(destination_size),
+                                       report.compressed_size);
+
+    if (QPL_STS_OK == status) {
+        status = compress_training_samples(job_ptr, samples_ptr, sample_sizes_ptr, sample_count, level,
+                                           dictionary_ptr, destination.get(), static_cast<uint32_t>(destination_size),
+                                           report.dictionary_compressed_size);
+    }
+
+    const qpl_status fini_status = qpl_fini_job(job_ptr);
+
+    return (QPL_STS_OK != status) ? status : fini_status;
+}
+
+} // namespace qpl
+
 extern "C" {
 
 size_t qpl_get_dictionary_size(sw_compression_level sw_level, hw_compression_level hw_dict_level,
@@ -56,6 +176,35 @@ qpl_status qpl_build_dictionary(qpl_dictionary* dict_ptr, sw_compression_level s
     return static_cast<qpl_status>(status);
 }
 
+qpl_status qpl_train_dictionary(const uint8_t* samples_ptr, const size_t* sample_sizes_ptr, uint32_t sample_count,
+                                sw_compression_level sw_level, hw_compression_level hw_level, uint8_t* raw_dict_ptr,
+                                size_t* raw_dict_size_ptr, qpl_dictionary_training_report* report_ptr) {
+    using namespace qpl::ml;
+    auto status = qpl::ml::bad_argument::check_for_nullptr(samples_ptr, sample_sizes_ptr, raw_dict_ptr,
+                                                            raw_dict_size_ptr);
+
+    if (status != status_list::ok) { return static_cast<qpl_status>(status); }
+
+    if (0U == sample_count) { return QPL_STS_SIZE_ERR; }
+
+    const hardware_dictionary_level hw_dict_level_internal =
+            compression::convert_public_hw_dict_level_to_internal(hw_level);
+
+    size_t raw_dict_size = 0U;
+
+    status = compression::train_dictionary(samples_ptr, sample_sizes_ptr, sample_count, hw_dict_level_internal,
+                                           raw_dict_ptr, *raw_dict_size_ptr, raw_dict_size);
+
+    if (status != status_list::ok) { return static_cast<qpl_status>(status); }
+
+    *raw_dict_size_ptr = raw_dict_size;
+
+    if (nullptr == report_ptr) { return QPL_STS_OK; }
+
+    return qpl::evaluate_trained_dictionary(samples_ptr, sample_sizes_ptr, sample_count, sw_level, raw_dict_ptr,
+                                            raw_dict_size, *report_ptr);
+}
+
 qpl_status qpl_set_dictionary_id(qpl_dictionary* dictionary_ptr, uint32_t dictionary_id) {
     using namespace qpl::ml;
     auto status = qpl::ml::bad_argument::check_for_nullptr(dictionary_ptr);
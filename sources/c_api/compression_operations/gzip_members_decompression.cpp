@@ -0,0 +1,336 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Parallel decompression of multi-member gzip streams (private C++ API)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "compressor.hpp"
+#include "lane_job.hpp"
+#include "qpl/qpl.h"
+
+// Middle layer headers
+#include "compression/stream_decorators/gzip_decorator.hpp"
+#include "dispatcher/sw_executor.hpp"
+#include "util/checksum.hpp"
+
+// Legacy
+#include "own_defs.h"
+
+namespace qpl {
+
+/**
+ * @brief Size of the gzip member trailer: CRC32 and ISIZE
+ */
+static constexpr uint32_t gzip_member_trailer_size = 8U;
+
+/**
+ * @brief Minimal size of a gzip member: fixed header and trailer
+ */
+static constexpr uint32_t gzip_member_min_size = 10U + gzip_member_trailer_size;
+
+/**
+ * @brief Initial capacity of the member list, the list is grown twice each time it gets full
+ */
+static constexpr uint32_t gzip_members_initial_capacity = 64U;
+
+/**
+ * @brief Member of a gzip stream that is decompressed by a single lane job
+ */
+struct gzip_member_t {
+    uint32_t input_offset;  /**< Offset of the member header in the source */
+    uint32_t input_size;    /**< Size of the member with its header and trailer */
+    uint32_t output_offset; /**< Offset of the member data in the destination */
+    uint32_t output_size;   /**< ISIZE field of the member trailer */
+};
+
+/**
+ * @brief List of gzip members found in the stream
+ */
+struct gzip_member_list_t {
+    std::unique_ptr<gzip_member_t[]> members_ptr = nullptr;
+    uint32_t                         count       = 0U;
+    uint32_t                         capacity    = 0U;
+
+    auto push(const gzip_member_t& member) noexcept -> bool {
+        if (count == capacity) {
+            const uint32_t new_capacity = std::max(gzip_members_initial_capacity, capacity * 2U);
+
+            std::unique_ptr<gzip_member_t[]> new_members(new (std::nothrow) gzip_member_t[new_capacity]);
+            if (nullptr == new_members) { return false; }
+
+            std::copy(members_ptr.get(), members_ptr.get() + count, new_members.get());
+
+            members_ptr = std::move(new_members);
+            capacity    = new_capacity;
+        }
+
+        members_ptr[count++] = member;
+
+        return true;
+    }
+};
+
+/**
+ * @brief State shared by all the lanes of a single multi-member decompression
+ */
+struct gzip_members_context_t {
+    const uint8_t*        source_ptr;
+    uint8_t*              destination_ptr;
+    const gzip_member_t*  members_ptr;
+    uint32_t              member_count;
+    std::atomic<uint32_t> next_member;
+    std::atomic<uint32_t> status;
+};
+
+/**
+ * @brief Single worker that owns its own decompression job
+ */
+struct gzip_members_lane_t {
+    gzip_members_context_t* context_ptr = nullptr;
+    lane_job                job;
+};
+
+static inline uint32_t read_le32(const uint8_t* source_ptr) noexcept {
+    uint32_t value = 0U;
+    std::memcpy(&value, source_ptr, sizeof(value));
+    return value;
+}
+
+static inline uint32_t read_le16(const uint8_t* source_ptr) noexcept {
+    return static_cast<uint32_t>(source_ptr[0]) | (static_cast<uint32_t>(source_ptr[1]) << 8U);
+}
+
+/**
+ * @brief Looks for the BGZF "BC" subfield of the gzip extra field and returns the member size kept in it,
+ * 0 is returned if the member has no such subfield
+ */
+static uint32_t get_bgzf_member_size(const uint8_t* member_ptr, uint32_t available_size) noexcept {
+    constexpr uint8_t  extra_flag        = 4U;
+    constexpr uint32_t fixed_header_size = 10U;
+    constexpr uint32_t subfield_header   = 4U;
+
+    if (available_size < fixed_header_size + 2U || !(member_ptr[3] & extra_flag)) { return 0U; }
+
+    const uint32_t extra_size = read_le16(member_ptr + fixed_header_size);
+    if (fixed_header_size + 2U + extra_size > available_size) { return 0U; }
+
+    const uint8_t* subfield_ptr = member_ptr + fixed_header_size + 2U;
+    const uint8_t* extra_end    = subfield_ptr + extra_size;
+
+    while (subfield_ptr + subfield_header <= extra_end) {
+        const uint32_t subfield_size = read_le16(subfield_ptr + 2U);
+
+        if ('B' == subfield_ptr[0] && 'C' == subfield_ptr[1] && 2U == subfield_size &&
+            subfield_ptr + subfield_header + 2U <= extra_end) {
+            return read_le16(subfield_ptr + subfield_header) + 1U;
+        }
+
+        subfield_ptr += subfield_header + subfield_size;
+    }
+
+    return 0U;
+}
+
+/**
+ * @brief Decompresses a member that has no size in its header, its end is the end of the deflate stream reported
+ * by the inflate followed by the trailer
+ */
+static uint32_t decompress_member_in_place(qpl_job* job_ptr, const uint8_t* source_ptr, uint32_t source_size,
+                                           uint8_t* destination_ptr, uint32_t destination_size,
+                                           gzip_member_t& member) noexcept {
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE;
+    job_ptr->next_in_ptr   = const_cast<uint8_t*>(source_ptr);
+    job_ptr->available_in  = source_size;
+    job_ptr->next_out_ptr  = destination_ptr;
+    job_ptr->available_out = destination_size;
+
+    const uint32_t status = qpl_execute_job(job_ptr);
+    if (QPL_STS_MORE_OUTPUT_NEEDED == status) { return QPL_STS_DST_IS_SHORT_ERR; }
+    if (QPL_STS_OK != status) { return status; }
+
+    // Processed bytes include the header, the deflate stream and the trailer
+    if (job_ptr->total_in > source_size) { return QPL_STS_SRC_IS_SHORT_ERR; }
+
+    const uint8_t* const trailer_ptr = source_ptr + job_ptr->total_in - gzip_member_trailer_size;
+
+    if (read_le32(trailer_ptr) != job_ptr->crc || read_le32(trailer_ptr + 4U) != job_ptr->total_out) {
+        return QPL_STS_INTL_VERIFY_ERR;
+    }
+
+    member.input_size  = job_ptr->total_in;
+    member.output_size = job_ptr->total_out;
+
+    return QPL_STS_OK;
+}
+
+/**
+ * @brief Decompresses a member whose boundaries are known and checks its CRC32 and ISIZE against the trailer
+ */
+static uint32_t decompress_member(const gzip_members_context_t& context, const gzip_member_t& member,
+                                  qpl_job* job_ptr) noexcept {
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE;
+    job_ptr->next_in_ptr   = const_cast<uint8_t*>(context.source_ptr) + member.input_offset;
+    job_ptr->available_in  = member.input_size;
+    job_ptr->next_out_ptr  = context.destination_ptr + member.output_offset;
+    job_ptr->available_out = member.output_size;
+
+    const uint32_t status = qpl_execute_job(job_ptr);
+    if (QPL_STS_MORE_OUTPUT_NEEDED == status) { return QPL_STS_INTL_VERIFY_ERR; }
+    if (QPL_STS_OK != status) { return status; }
+
+    // The job skips the trailer check if the deflate stream ends before the trailer, so it is repeated here
+    const uint8_t* const trailer_ptr =
+            context.source_ptr + member.input_offset + member.input_size - gzip_member_trailer_size;
+
+    if (job_ptr->total_out != member.output_size || job_ptr->crc != read_le32(trailer_ptr)) {
+        return QPL_STS_INTL_VERIFY_ERR;
+    }
+
+    return QPL_STS_OK;
+}
+
+/**
+ * @brief Lane body, takes members from the shared counter until the work is done or any lane failed
+ */
+static void decompress_members_lane(gzip_members_lane_t& lane) noexcept {
+    auto&       context = *lane.context_ptr;
+    auto* const job_ptr = lane.job.get();
+
+    while (QPL_STS_OK == context.status.load(std::memory_order_relaxed)) {
+        const uint32_t member_index = context.next_member.fetch_add(1U, std::memory_order_relaxed);
+        if (member_index >= context.member_count) { break; }
+
+        const uint32_t status = decompress_member(context, context.members_ptr[member_index], job_ptr);
+
+        if (QPL_STS_OK != status) {
+            uint32_t expected = QPL_STS_OK;
+            context.status.compare_exchange_strong(expected, status, std::memory_order_relaxed);
+        }
+    }
+}
+
+uint32_t perform_gzip_members_decompress(qpl_job* const job_ptr) noexcept {
+    using namespace qpl::ml;
+
+    OWN_RETURN_ERROR(0U == job_ptr->available_in, QPL_STS_SIZE_ERR);
+
+    auto& executor = dispatcher::sw_executor::get_instance();
+
+    const uint32_t max_lane_count = (0U == job_ptr->num_threads) ? executor.worker_count() : job_ptr->num_threads;
+
+    uint32_t   job_size = 0U;
+    qpl_status status   = qpl_get_job_size_by_class(qpl_path_software, qpl_op_class_decompression, &job_size);
+    if (QPL_STS_OK != status) { return status; }
+
+    std::unique_ptr<gzip_members_lane_t[]> lanes(new (std::nothrow) gzip_members_lane_t[std::max(1U, max_lane_count)]);
+    OWN_RETURN_ERROR(nullptr == lanes, QPL_STS_NO_MEM_ERR);
+
+    // Job of lane 0 decompresses the members met during the scan, it is released on any return
+    status = lanes[0].job.init(qpl_path_software, qpl_op_class_decompression, job_size);
+    if (QPL_STS_OK != status) { return status; }
+
+    auto* const scan_job_ptr = lanes[0].job.get();
+
+    const uint8_t* const source_ptr       = job_ptr->next_in_ptr;
+    const uint32_t       source_size      = job_ptr->available_in;
+    uint8_t* const       destination_ptr  = job_ptr->next_out_ptr;
+    const uint32_t       destination_size = job_ptr->available_out;
+
+    // Scan the members: BGZF members keep their size in the header, so their decompression is deferred to the lanes,
+    // other members have to be decompressed in place to find out where the next member starts
+    gzip_member_list_t deferred_members;
+
+    uint32_t input_offset  = 0U;
+    uint32_t output_offset = 0U;
+    uint32_t crc           = 0U;
+
+    while (input_offset < source_size) {
+        const uint8_t* const member_ptr     = source_ptr + input_offset;
+        const uint32_t       available_size = source_size - input_offset;
+
+        OWN_RETURN_ERROR(available_size < gzip_member_min_size, QPL_STS_SRC_IS_SHORT_ERR);
+
+        compression::gzip_decorator::gzip_header header {};
+
+        const auto header_status = compression::gzip_decorator::read_header(member_ptr, available_size, header);
+        OWN_RETURN_ERROR(status_list::ok != header_status, QPL_STS_ARCHIVE_HEADER_ERR);
+
+        gzip_member_t member {input_offset, 0U, output_offset, 0U};
+
+        const uint32_t bgzf_member_size = get_bgzf_member_size(member_ptr, available_size);
+
+        if (0U != bgzf_member_size) {
+            OWN_RETURN_ERROR(bgzf_member_size > available_size, QPL_STS_SRC_IS_SHORT_ERR);
+            OWN_RETURN_ERROR(bgzf_member_size < header.byte_size + gzip_member_trailer_size,
+                             QPL_STS_ARCHIVE_HEADER_ERR);
+
+            member.input_size  = bgzf_member_size;
+            member.output_size = read_le32(member_ptr + bgzf_member_size - 4U);
+
+            OWN_RETURN_ERROR(member.output_size > destination_size - output_offset, QPL_STS_DST_IS_SHORT_ERR);
+            OWN_RETURN_ERROR(!deferred_members.push(member), QPL_STS_NO_MEM_ERR);
+        } else {
+            const uint32_t member_status =
+                    decompress_member_in_place(scan_job_ptr, member_ptr, available_size,
+                                               destination_ptr + output_offset, destination_size - output_offset,
+                                               member);
+            if (QPL_STS_OK != member_status) { return static_cast<qpl_status>(member_status); }
+        }
+
+        const uint32_t member_crc = read_le32(member_ptr + member.input_size - gzip_member_trailer_size);
+        crc = util::crc32_gzip_combine(crc, member_crc, member.output_size);
+
+        input_offset += member.input_size;
+        output_offset += member.output_size;
+    }
+
+    if (0U != deferred_members.count) {
+        const uint32_t lane_count = std::max(1U, std::min(max_lane_count, deferred_members.count));
+
+        for (uint32_t i = 1U; i < lane_count; i++) {
+            status = lanes[i].job.init(qpl_path_software, qpl_op_class_decompression, job_size);
+            if (QPL_STS_OK != status) { return status; }
+        }
+
+        gzip_members_context_t context {};
+        context.source_ptr      = source_ptr;
+        context.destination_ptr = destination_ptr;
+        context.members_ptr     = deferred_members.members_ptr.get();
+        context.member_count    = deferred_members.count;
+
+        for (uint32_t i = 0U; i < lane_count; i++) {
+            lanes[i].context_ptr = &context;
+        }
+
+        executor.parallel_for(lanes.get(), lane_count, &decompress_members_lane);
+
+        status = static_cast<qpl_status>(context.status.load());
+    }
+
+    if (QPL_STS_OK != status) { return status; }
+
+    job_ptr->total_in  = input_offset;
+    job_ptr->total_out = output_offset;
+    job_ptr->crc       = crc;
+    job_ptr->next_in_ptr += input_offset;
+    job_ptr->available_in -= input_offset;
+    job_ptr->next_out_ptr += output_offset;
+    job_ptr->available_out -= output_offset;
+
+    return QPL_STS_OK;
+}
+
+} // namespace qpl
@@ -11,12 +11,119 @@
 
 #include "huffman_table.hpp"
 
+#include <cmath>
+
+#include "compression/deflate/histogram.hpp"
 #include "compression/huffman_table/huffman_table.hpp"
 #include "compression/huffman_table/huffman_table_utils.hpp"
 #include "own_checkers.h"
 #include "simple_memory_ops.hpp"
 #include "util/checkers.hpp"
 
+// core-sw
+#include "qplc_compression_consts.h"
+
+namespace qpl {
+
+constexpr uint32_t table_selection_window_size  = 4096U; /**< Size of an input window taken into the sample */
+constexpr uint32_t table_selection_window_count = 8U;    /**< Maximal number of windows in the sample */
+constexpr double   table_selection_tolerance    = 1.03;  /**< Canned table is kept if it is within 3% of dynamic */
+
+/**
+ * @brief Accumulates the histogram of the input sample: the whole input if it is small enough or windows
+ * evenly spread over it. Returns the sample size.
+ */
+static uint32_t sample_deflate_histogram(const uint8_t* source_ptr, uint32_t source_length,
+                                         qpl_compression_levels level, qpl_histogram& histogram) noexcept {
+    using namespace qpl::ml;
+
+    const uint32_t sample_limit = table_selection_window_size * table_selection_window_count;
+    const uint32_t window_count = (source_length <= sample_limit) ? 1U : table_selection_window_count;
+    const uint32_t window_size  = (source_length <= sample_limit) ? source_length : table_selection_window_size;
+    const uint32_t window_step  = (1U == window_count) ? 0U : (source_length - window_size) / (window_count - 1U);
+
+    for (uint32_t i = 0U; i < window_count; i++) {
+        const uint8_t* const window_ptr = source_ptr + static_cast<size_t>(i) * window_step;
+
+        // The histogram routine replaces zero counters with ones, so every counter starts from one
+        // and the unit is subtracted afterwards to keep the exact symbol counts
+        qpl_histogram window_histogram {};
+        std::fill(std::begin(window_histogram.literal_lengths), std::end(window_histogram.literal_lengths), 1U);
+        std::fill(std::begin(window_histogram.distances), std::end(window_histogram.distances), 1U);
+
+        compression::update_histogram<execution_path_t::software>(window_ptr, window_ptr + window_size,
+                                                                  window_histogram, level);
+
+        for (uint32_t j = 0U; j < QPL_LITERALS_MATCHES_TABLE_SIZE; j++) {
+            histogram.literal_lengths[j] += window_histogram.literal_lengths[j] - 1U;
+        }
+
+        for (uint32_t j = 0U; j < QPL_DEFAULT_OFFSETS_NUMBER; j++) {
+            histogram.distances[j] += window_histogram.distances[j] - 1U;
+        }
+    }
+
+    return window_count * window_size;
+}
+
+/**
+ * @brief Returns the number of bits for the Huffman codes of the sampled symbols, or a negative value
+ * if the table has no code for some of them. Extra bits are the same for any table and are not counted.
+ */
+static double estimate_canned_bits(const qpl_histogram& histogram, const uint32_t* literals_lengths_ptr,
+                                   const uint32_t* offsets_ptr) noexcept {
+    double bits = 0.0;
+
+    const auto accumulate = [&bits](const uint32_t* counts_ptr, const uint32_t* codes_ptr, uint32_t count) {
+        for (uint32_t i = 0U; i < count; i++) {
+            if (0U == counts_ptr[i]) { continue; }
+
+            const uint32_t code_length = (codes_ptr[i] & QPLC_LENGTH_MASK) >> QPLC_HUFFMAN_CODE_LENGTH_OFFSET;
+            if (0U == code_length) { return false; }
+
+            bits += static_cast<double>(counts_ptr[i]) * code_length;
+        }
+
+        return true;
+    };
+
+    if (!accumulate(histogram.literal_lengths, literals_lengths_ptr, QPL_LITERALS_MATCHES_TABLE_SIZE) ||
+        !accumulate(histogram.distances, offsets_ptr, QPL_DEFAULT_OFFSETS_NUMBER)) {
+        return -1.0;
+    }
+
+    return bits;
+}
+
+/**
+ * @brief Returns the entropy of the sampled symbols in bits, the lower bound for the dynamic Huffman codes,
+ * together with the number of symbols present in the sample
+ */
+static double estimate_dynamic_bits(const qpl_histogram& histogram, uint32_t& symbol_count) noexcept {
+    double bits = 0.0;
+
+    const auto accumulate = [&bits, &symbol_count](const uint32_t* counts_ptr, uint32_t count) {
+        uint64_t total = 0U;
+        for (uint32_t i = 0U; i < count; i++) {
+            total += counts_ptr[i];
+        }
+
+        for (uint32_t i = 0U; i < count; i++) {
+            if (0U == counts_ptr[i]) { continue; }
+
+            bits += static_cast<double>(counts_ptr[i]) * std::log2(static_cast<double>(total) / counts_ptr[i]);
+            symbol_count++;
+        }
+    };
+
+    accumulate(histogram.literal_lengths, QPL_LITERALS_MATCHES_TABLE_SIZE);
+    accumulate(histogram.distances, QPL_DEFAULT_OFFSETS_NUMBER);
+
+    return bits;
+}
+
+} // namespace qpl
+
 extern "C" {
 
 qpl_status qpl_deflate_huffman_table_create(const qpl_huffman_table_type_e type, const qpl_path_t path,
@@ -200,6 +307,60 @@ qpl_status qpl_huffman_table_get_type(qpl_huffman_table_t table, qpl_huffman_tab
     return QPL_STS_OK;
 }
 
+qpl_status qpl_huffman_table_select_best(const uint8_t* const source_ptr, const uint32_t source_length,
+                                         const qpl_huffman_table_t* const tables_ptr, const uint32_t table_count,
+                                         const qpl_compression_levels level, uint32_t* const table_index_ptr) {
+    using namespace qpl::ml;
+    using namespace qpl::ml::compression;
+
+    OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(source_ptr, tables_ptr, table_index_ptr))
+    QPL_BADARG_RET(0U == source_length || 0U == table_count, QPL_STS_SIZE_ERR)
+
+    if (level != qpl_default_level && (level < qpl_high_level || level > qpl_level_9)) {
+        return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
+    }
+
+    for (uint32_t i = 0U; i < table_count; i++) {
+        OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(tables_ptr[i]))
+
+        auto meta = reinterpret_cast<huffman_table_meta_t*>(tables_ptr[i]);
+
+        QPL_BADARG_RET(meta->algorithm != compression_algorithm_e::deflate, QPL_STS_HUFFMAN_TABLE_TYPE_ERROR)
+        QPL_BADARG_RET(meta->type == huffman_table_type_e::decompression, QPL_STS_HUFFMAN_TABLE_TYPE_ERROR)
+    }
+
+    qpl_histogram  histogram {};
+    const uint32_t sample_size = qpl::sample_deflate_histogram(source_ptr, source_length, level, histogram);
+
+    // Dynamic Huffman stream carries its own header: 14 bits of counters, 19 3-bit code length codes
+    // and about 4 bits per used symbol, the header is scaled down to the sample. The entropy is the lower
+    // bound of the dynamic codes size, so a table that is slightly worse is still preferred for its speed
+    uint32_t     symbol_count = 0U;
+    const double dynamic_bits = qpl::estimate_dynamic_bits(histogram, symbol_count);
+    const double header_bits  = 14.0 + 19.0 * 3.0 + 4.0 * symbol_count;
+    double       best_bits =
+            (dynamic_bits + header_bits * sample_size / source_length) * qpl::table_selection_tolerance;
+    uint32_t best_table_index = table_count;
+
+    for (uint32_t i = 0U; i < table_count; i++) {
+        auto table_impl = use_as_huffman_table<compression_algorithm_e::deflate>(tables_ptr[i]);
+
+        if (!table_impl->is_initialized()) { continue; }
+
+        const double bits = qpl::estimate_canned_bits(histogram, table_impl->get_literals_lengths_table_ptr(),
+                                                      table_impl->get_offsets_table_ptr());
+
+        if (bits >= 0.0 && bits < best_bits) {
+            best_bits        = bits;
+            best_table_index = i;
+        }
+    }
+
+    *table_index_ptr = best_table_index;
+
+    return QPL_STS_OK;
+}
+
 // Delete after refactoring
 qpl_compression_huffman_table* own_huffman_table_get_compression_table(const qpl_huffman_table_t table) {
     using namespace qpl::ml;
@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Parallel decompression of indexed streams (public C API)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "qpl/qpl.h"
+
+#include "lane_job.hpp"
+
+// Middle layer headers
+#include "dispatcher/sw_executor.hpp"
+
+// Legacy
+#include "own_defs.h"
+
+namespace qpl {
+
+/**
+ * @brief Minimal number of bytes decompressed by a single lane job, smaller groups of mini-blocks do not pay back
+ * the cost of the repeated block header parsing
+ */
+static constexpr uint32_t indexed_group_min_size = 64U * 1024U;
+
+/**
+ * @brief Number of groups per lane, allows lanes that finished earlier to pick up the remaining work
+ */
+static constexpr uint32_t indexed_groups_per_lane = 4U;
+
+/**
+ * @brief Range of mini-blocks of the same deflate block decompressed by a single job
+ */
+struct indexed_group_t {
+    uint32_t header_index;     /**< Index of the block header start in the indexing table */
+    uint32_t first_mini_block; /**< Number of the first mini-block in the stream */
+    uint32_t mini_block_count; /**< Number of mini-blocks in the group */
+};
+
+/**
+ * @brief State shared by all the lanes of a single @ref qpl_decompress_indexed call
+ */
+struct indexed_context_t {
+    const qpl_index_table* table_ptr;
+    const uint8_t*         source_ptr;
+    uint8_t*               destination_ptr;
+    uint32_t               destination_size;
+    uint32_t               mini_block_size;
+    const indexed_group_t* groups_ptr;
+    uint32_t               group_count;
+    std::atomic<uint32_t>  next_group;
+    std::atomic<uint32_t>  status;
+    std::atomic<uint32_t>  last_group_size;
+};
+
+/**
+ * @brief Single worker of @ref qpl_decompress_indexed that owns its own decompression job
+ */
+struct indexed_lane_t {
+    indexed_context_t* context_ptr = nullptr;
+    lane_job           job;
+};
+
+/**
+ * @brief Sets the job input to the bit range [start_bit, end_bit) of the stream
+ */
+static inline void set_indexed_source(qpl_job* job_ptr, const uint8_t* source_ptr, uint32_t start_bit,
+                                      uint32_t end_bit) noexcept {
+    job_ptr->next_in_ptr       = const_cast<uint8_t*>(source_ptr) + start_bit / 8U;
+    job_ptr->available_in      = ((end_bit + 7U) / 8U) - (start_bit / 8U);
+    job_ptr->ignore_start_bits = start_bit & 7U;
+    job_ptr->ignore_end_bits   = 7U & (0U - end_bit);
+}
+
+/**
+ * @brief Decompresses a group of mini-blocks: parses the header of their deflate block, then decompresses
+ * the mini-blocks with a single random access job and checks the result against the cumulative CRC
+ */
+static uint32_t decompress_indexed_group(indexed_context_t& context, const indexed_group_t& group,
+                                         qpl_job* job_ptr) noexcept {
+    const qpl_index* indices_ptr   = context.table_ptr->indices_ptr;
+    const uint64_t   output_offset = static_cast<uint64_t>(group.first_mini_block) * context.mini_block_size;
+
+    if (output_offset >= context.destination_size) { return QPL_STS_DST_IS_SHORT_ERR; }
+
+    const uint64_t group_size = static_cast<uint64_t>(group.mini_block_count) * context.mini_block_size;
+    const auto     output_size =
+            static_cast<uint32_t>(std::min<uint64_t>(group_size, context.destination_size - output_offset));
+
+    // When the destination ends inside the group, the group is decompressed aside, so a short destination
+    // is told apart from the end of the stream
+    std::unique_ptr<uint8_t[]> group_buffer;
+    uint8_t*                   group_output_ptr  = context.destination_ptr + output_offset;
+    auto                       group_output_size = output_size;
+
+    if (output_size < group_size) {
+        group_buffer.reset(new (std::nothrow) uint8_t[group_size]);
+        if (nullptr == group_buffer) { return QPL_STS_NO_MEM_ERR; }
+
+        group_output_ptr  = group_buffer.get();
+        group_output_size = static_cast<uint32_t>(group_size);
+    }
+
+    // FIRST | RND_ACCESS only reads the block header
+    job_ptr->op    = qpl_op_decompress;
+    job_ptr->flags = QPL_FLAG_FIRST | QPL_FLAG_RND_ACCESS;
+    set_indexed_source(job_ptr, context.source_ptr, indices_ptr[group.header_index].bit_offset,
+                       indices_ptr[group.header_index + 1U].bit_offset);
+    job_ptr->next_out_ptr  = group_output_ptr;
+    job_ptr->available_out = group_output_size;
+
+    uint32_t status = qpl_execute_job(job_ptr);
+    if (QPL_STS_OK != status) { return status; }
+
+    const uint32_t mini_block_in_block = group.first_mini_block % context.table_ptr->mini_blocks_per_block;
+    const uint32_t start_index         = group.header_index + 1U + mini_block_in_block;
+    const uint32_t end_index           = start_index + group.mini_block_count;
+
+    job_ptr->flags = QPL_FLAG_RND_ACCESS;
+    set_indexed_source(job_ptr, context.source_ptr, indices_ptr[start_index].bit_offset,
+                       indices_ptr[end_index].bit_offset);
+    job_ptr->crc           = indices_ptr[start_index].crc;
+    job_ptr->next_out_ptr  = group_output_ptr;
+    job_ptr->available_out = group_output_size;
+
+    status = qpl_execute_job(job_ptr);
+    if (QPL_STS_MORE_OUTPUT_NEEDED == status) { return QPL_STS_DST_IS_SHORT_ERR; }
+    if (QPL_STS_OK != status) { return status; }
+
+    // total_out is not reset between random access jobs, so the output size is taken from the output pointer
+    const auto produced_size = static_cast<uint32_t>(job_ptr->next_out_ptr - group_output_ptr);
+
+    if (nullptr != group_buffer) {
+        if (produced_size > output_size) { return QPL_STS_DST_IS_SHORT_ERR; }
+
+        std::memcpy(context.destination_ptr + output_offset, group_buffer.get(), produced_size);
+    }
+
+    if (job_ptr->crc != indices_ptr[end_index].crc) { return QPL_STS_INDEX_CRC_ERR; }
+
+    // Only the last mini-block of the stream may be incomplete
+    const bool is_last_group = (group.first_mini_block + group.mini_block_count == context.table_ptr->mini_block_count);
+
+    if (is_last_group) {
+        if (produced_size <= group_size - context.mini_block_size) { return QPL_STS_INDEX_GENERATION_ERR; }
+
+        context.last_group_size.store(produced_size, std::memory_order_relaxed);
+    } else if (produced_size != group_size) {
+        return QPL_STS_INDEX_GENERATION_ERR;
+    }
+
+    return QPL_STS_OK;
+}
+
+/**
+ * @brief Lane body, takes groups from the shared counter until the work is done or any lane failed
+ */
+static void decompress_indexed_lane(indexed_lane_t& lane) noexcept {
+    auto&       context = *lane.context_ptr;
+    auto* const job_ptr = lane.job.get();
+
+    while (QPL_STS_OK == context.status.load(std::memory_order_relaxed)) {
+        const uint32_t group_index = context.next_group.fetch_add(1U, std::memory_order_relaxed);
+        if (group_index >= context.group_count) { break; }
+
+        const uint32_t status = decompress_indexed_group(context, context.groups_ptr[group_index], job_ptr);
+
+        if (QPL_STS_OK != status) {
+            uint32_t expected = QPL_STS_OK;
+            context.status.compare_exchange_strong(expected, status, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Checks that the table is consistent with the source stream and its mini-block layout
+ */
+static inline uint32_t check_index_table(const qpl_index_table* table_ptr, uint32_t source_size) noexcept {
+    OWN_RETURN_ERROR(nullptr == table_ptr->indices_ptr, QPL_STS_MISSING_INDEX_TABLE_ERR);
+    OWN_RETURN_ERROR(0U == table_ptr->mini_block_count || 0U == table_ptr->mini_blocks_per_block, QPL_STS_SIZE_ERR);
+
+    const uint32_t block_count = (table_ptr->mini_block_count + table_ptr->mini_blocks_per_block - 1U) /
+                                 table_ptr->mini_blocks_per_block;
+    OWN_RETURN_ERROR(block_count != table_ptr->block_count, QPL_STS_SIZE_ERR);
+
+    const uint64_t index_count = 2ULL * block_count + table_ptr->mini_block_count + 1U;
+    const uint64_t bit_limit   = static_cast<uint64_t>(source_size) * 8U;
+
+    for (uint64_t i = 0U; i < index_count; i++) {
+        OWN_RETURN_ERROR(table_ptr->indices_ptr[i].bit_offset > bit_limit, QPL_STS_SRC_IS_SHORT_ERR);
+        OWN_RETURN_ERROR(i > 0U && table_ptr->indices_ptr[i].bit_offset < table_ptr->indices_ptr[i - 1U].bit_offset,
+                         QPL_STS_INVALID_PARAM_ERR);
+    }
+
+    return QPL_STS_OK;
+}
+
+} // namespace qpl
+
+QPL_FUN("C" qpl_status, qpl_decompress_indexed, (qpl_job * job_ptr, const qpl_index_table* table_ptr)) {
+    using namespace qpl;
+
+    QPL_BAD_PTR_RET(job_ptr);
+    QPL_BAD_PTR_RET(table_ptr);
+    QPL_BAD_PTR_RET(job_ptr->next_in_ptr);
+    QPL_BAD_PTR_RET(job_ptr->next_out_ptr);
+    OWN_RETURN_ERROR(qpl_mblk_size_none == job_ptr->mini_block_size || job_ptr->mini_block_size > qpl_mblk_size_32k,
+                     QPL_STS_INVALID_BLOCK_SIZE_ERR);
+
+    const uint32_t table_status = check_index_table(table_ptr, job_ptr->available_in);
+    if (QPL_STS_OK != table_status) { return static_cast<qpl_status>(table_status); }
+
+    const uint32_t mini_block_size       = 1U << (job_ptr->mini_block_size + 8U);
+    const uint32_t mini_block_count      = table_ptr->mini_block_count;
+    const uint32_t mini_blocks_per_block = table_ptr->mini_blocks_per_block;
+
+    auto& executor = ml::dispatcher::sw_executor::get_instance();
+
+    uint32_t lane_count = (0U == job_ptr->num_threads) ? executor.worker_count() : job_ptr->num_threads;
+
+    // Groups never cross deflate block boundaries, so every group is decodable after its block header is parsed
+    const uint32_t min_group_length = std::max(1U, indexed_group_min_size / mini_block_size);
+    const uint32_t target_groups    = std::max(1U, lane_count * indexed_groups_per_lane);
+    const uint32_t group_length =
+            std::max(min_group_length, (mini_block_count + target_groups - 1U) / target_groups);
+
+    uint32_t group_count = 0U;
+    for (uint32_t block = 0U; block < table_ptr->block_count; block++) {
+        const uint32_t block_mini_blocks =
+                std::min(mini_blocks_per_block, mini_block_count - block * mini_blocks_per_block);
+        group_count += (block_mini_blocks + group_length - 1U) / group_length;
+    }
+
+    std::unique_ptr<indexed_group_t[]> groups(new (std::nothrow) indexed_group_t[group_count]);
+    OWN_RETURN_ERROR(nullptr == groups, QPL_STS_NO_MEM_ERR);
+
+    for (uint32_t block = 0U, group = 0U; block < table_ptr->block_count; block++) {
+        const uint32_t first_mini_block  = block * mini_blocks_per_block;
+        const uint32_t block_mini_blocks = std::min(mini_blocks_per_block, mini_block_count - first_mini_block);
+
+        for (uint32_t offset = 0U; offset < block_mini_blocks; offset += group_length) {
+            groups[group++] = {block * (mini_blocks_per_block + 2U), first_mini_block + offset,
+                               std::min(group_length, block_mini_blocks - offset)};
+        }
+    }
+
+    lane_count = std::max(1U, std::min(lane_count, group_count));
+
+    indexed_context_t context {};
+    context.table_ptr        = table_ptr;
+    context.source_ptr       = job_ptr->next_in_ptr;
+    context.destination_ptr  = job_ptr->next_out_ptr;
+    context.destination_size = job_ptr->available_out;
+    context.mini_block_size  = mini_block_size;
+    context.groups_ptr       = groups.get();
+    context.group_count      = group_count;
+
+    uint32_t   job_size = 0U;
+    qpl_status status   = qpl_get_job_size_by_class(qpl_path_software, qpl_op_class_decompression, &job_size);
+    if (QPL_STS_OK != status) { return status; }
+
+    std::unique_ptr<indexed_lane_t[]> lanes(new (std::nothrow) indexed_lane_t[lane_count]);
+    OWN_RETURN_ERROR(nullptr == lanes, QPL_STS_NO_MEM_ERR);
+
+    for (uint32_t i = 0U; i < lane_count; i++) {
+        lanes[i].context_ptr = &context;
+
+        status = lanes[i].job.init(qpl_path_software, qpl_op_class_decompression, job_size);
+        if (QPL_STS_OK != status) { return status; }
+    }
+
+    executor.parallel_for(lanes.get(), lane_count, &decompress_indexed_lane);
+
+    status = static_cast<qpl_status>(context.status.load());
+    if (QPL_STS_OK != status) { return status; }
+
+    // The entry that closes the last deflate block keeps the stream CRC
+    const qpl_index& last_index = table_ptr->indices_ptr[2U * table_ptr->block_count + mini_block_count - 1U];
+
+    const uint64_t last_group_offset =
+            static_cast<uint64_t>(groups[group_count - 1U].first_mini_block) * mini_block_size;
+    const auto total_out = static_cast<uint32_t>(last_group_offset + context.last_group_size.load());
+    const auto total_in  = (last_index.bit_offset + 7U) / 8U;
+
+    job_ptr->total_in  = total_in;
+    job_ptr->total_out = total_out;
+    job_ptr->crc       = last_index.crc;
+    job_ptr->next_in_ptr += total_in;
+    job_ptr->available_in -= total_in;
+    job_ptr->next_out_ptr += total_out;
+    job_ptr->available_out -= total_out;
+
+    return QPL_STS_OK;
+}
@@ -4,10 +4,163 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+
 #include "compression/deflate/histogram.hpp"
+#include "dispatcher/sw_executor.hpp"
+#include "own_checkers.h"
 #include "own_defs.h"
 #include "util/checkers.hpp"
 
+namespace qpl {
+
+/**
+ * @brief Size of the source part processed as a single task by the full and literals methods
+ */
+static constexpr uint32_t statistics_chunk_size = 1024U * 1024U;
+
+/**
+ * @brief Size of the window processed as a single task by the sampled method
+ */
+static constexpr uint32_t statistics_window_size = 64U * 1024U;
+
+/**
+ * @brief Default number of windows per one processed window in the sampled method
+ */
+static constexpr uint32_t statistics_default_sample_period = 16U;
+
+/**
+ * @brief State shared by all the lanes of a single @ref qpl_gather_deflate_statistics_with_options call
+ */
+struct statistics_context_t {
+    const uint8_t*         source_ptr;
+    uint32_t               source_length;
+    uint32_t               chunk_size;
+    uint32_t               chunk_step;
+    uint32_t               chunk_count;
+    qpl_statistics_method  method;
+    qpl_compression_levels level;
+    std::atomic<uint32_t>  next_chunk;
+    std::atomic<uint32_t>  status;
+};
+
+/**
+ * @brief Single worker of @ref qpl_gather_deflate_statistics_with_options with its own histogram
+ */
+struct statistics_lane_t {
+    statistics_context_t* context_ptr = nullptr;
+    qpl_histogram         histogram {};
+};
+
+/**
+ * @brief Lane body, takes chunks from the shared counter until all of them are processed or any lane failed
+ */
+static void gather_statistics_lane(statistics_lane_t& lane) noexcept {
+    using namespace qpl::ml;
+
+    auto& context = *lane.context_ptr;
+
+    while (status_list::ok == context.status.load(std::memory_order_relaxed)) {
+        const uint32_t chunk_index = context.next_chunk.fetch_add(1U, std::memory_order_relaxed);
+        if (chunk_index >= context.chunk_count) { break; }
+
+        const uint32_t       chunk_offset = chunk_index * context.chunk_step;
+        const uint8_t* const begin        = context.source_ptr + chunk_offset;
+        const uint8_t* const end = begin + std::min(context.chunk_size, context.source_length - chunk_offset);
+
+        const qpl_ml_status status =
+                (qpl_statistics_literals == context.method)
+                        ? compression::update_literals_histogram(begin, end, lane.histogram)
+                        : compression::update_histogram<execution_path_t::software>(begin, end, lane.histogram,
+                                                                                    context.level);
+
+        if (status_list::ok != status) {
+            uint32_t expected = status_list::ok;
+            context.status.compare_exchange_strong(expected, status, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Gathers the statistics on the host, the chunks of the source are spread over the executor threads
+ */
+static qpl_status gather_statistics_on_host(const uint8_t* source_ptr, uint32_t source_length,
+                                            qpl_histogram& histogram, qpl_compression_levels level,
+                                            const qpl_statistics_options& options) noexcept {
+    statistics_context_t context {};
+    context.source_ptr    = source_ptr;
+    context.source_length = source_length;
+    context.method        = options.method;
+    context.level         = level;
+
+    if (qpl_statistics_sampled == options.method) {
+        const uint32_t period =
+                (0U == options.sample_period) ? statistics_default_sample_period : options.sample_period;
+
+        context.chunk_size = statistics_window_size;
+        context.chunk_step = static_cast<uint32_t>(
+                std::min<uint64_t>(static_cast<uint64_t>(statistics_window_size) * period, UINT32_MAX));
+    } else {
+        context.chunk_size = statistics_chunk_size;
+        context.chunk_step = statistics_chunk_size;
+    }
+
+    context.chunk_count = static_cast<uint32_t>((static_cast<uint64_t>(source_length) + context.chunk_step - 1U) /
+                                                context.chunk_step);
+
+    auto& executor = ml::dispatcher::sw_executor::get_instance();
+
+    uint32_t lane_count = (0U == options.num_threads) ? executor.worker_count() : options.num_threads;
+    lane_count          = std::max(1U, std::min(lane_count, context.chunk_count));
+
+    std::unique_ptr<statistics_lane_t[]> lanes(new (std::nothrow) statistics_lane_t[lane_count]);
+    OWN_RETURN_ERROR(nullptr == lanes, QPL_STS_NO_MEM_ERR);
+
+    for (uint32_t i = 0U; i < lane_count; i++) {
+        lanes[i].context_ptr = &context;
+
+        // The histogram routines replace zero counters with ones, so every counter starts from one
+        // and the unit is subtracted when the lanes are merged, the sum keeps the exact symbol counts
+        std::fill(std::begin(lanes[i].histogram.literal_lengths), std::end(lanes[i].histogram.literal_lengths), 1U);
+        std::fill(std::begin(lanes[i].histogram.distances), std::end(lanes[i].histogram.distances), 1U);
+    }
+
+    context.next_chunk.store(0U);
+    context.status.store(QPL_STS_OK);
+
+    executor.parallel_for(lanes.get(), lane_count, &gather_statistics_lane);
+
+    const auto status = static_cast<qpl_status>(context.status.load());
+    if (QPL_STS_OK != status) { return status; }
+
+    for (uint32_t i = 0U; i < lane_count; i++) {
+        for (uint32_t j = 0U; j < QPL_LITERALS_MATCHES_TABLE_SIZE; j++) {
+            histogram.literal_lengths[j] += lanes[i].histogram.literal_lengths[j] - 1U;
+        }
+
+        for (uint32_t j = 0U; j < QPL_DEFAULT_OFFSETS_NUMBER; j++) {
+            histogram.distances[j] += lanes[i].histogram.distances[j] - 1U;
+        }
+    }
+
+    // Zero counters are replaced with ones as the single-call routine does
+    for (uint32_t& counter : histogram.literal_lengths) {
+        counter = std::max(counter, 1U);
+    }
+
+    for (uint32_t& counter : histogram.distances) {
+        counter = std::max(counter, 1U);
+    }
+
+    return QPL_STS_OK;
+}
+
+} // namespace qpl
+
 extern "C" {
 
 QPL_FUN(qpl_status, qpl_gather_deflate_statistics,
@@ -17,7 +170,9 @@ QPL_FUN(qpl_status, qpl_gather_deflate_statistics,
 
     OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(source_ptr, histogram_ptr));
 
-    if (level != qpl_high_level && level != qpl_default_level) { return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL; }
+    if (level != qpl_default_level && (level < qpl_high_level || level > qpl_level_9)) {
+        return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
+    }
 
     qpl_ml_status status = status_list::ok;
 
@@ -41,4 +196,39 @@ QPL_FUN(qpl_status, qpl_gather_deflate_statistics,
         default: return QPL_STS_PATH_ERR;
     }
 }
+
+QPL_FUN(qpl_status, qpl_gather_deflate_statistics_with_options,
+        (uint8_t * source_ptr, const uint32_t source_length, qpl_histogram* histogram_ptr,
+         const qpl_compression_levels level, const qpl_path_t path, const qpl_statistics_options* options_ptr)) {
+    using namespace qpl::ml;
+
+    OWN_QPL_CHECK_STATUS(bad_argument::check_for_nullptr(source_ptr, histogram_ptr, options_ptr));
+
+    if (level != qpl_default_level && (level < qpl_high_level || level > qpl_level_9)) {
+        return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
+    }
+
+    QPL_BADARG_RET(options_ptr->method > qpl_statistics_literals, QPL_STS_INVALID_PARAM_ERR)
+
+    const uint8_t* const begin = source_ptr;
+    const uint8_t* const end   = source_ptr + source_length;
+
+    switch (path) {
+        case qpl_path_auto:
+            // Only the full method is supported by HW, other methods and HW errors are processed on the host
+            if (qpl_statistics_full == options_ptr->method) {
+                const qpl_ml_status status =
+                        compression::update_histogram<execution_path_t::hardware>(begin, end, *histogram_ptr);
+                if (status_list::ok == status) { return QPL_STS_OK; }
+            }
+            return qpl::gather_statistics_on_host(source_ptr, source_length, *histogram_ptr, level, *options_ptr);
+        case qpl_path_hardware:
+            OWN_RETURN_ERROR(qpl_statistics_full != options_ptr->method, QPL_STS_NOT_SUPPORTED_MODE_ERR);
+            return static_cast<qpl_status>(
+                    compression::update_histogram<execution_path_t::hardware>(begin, end, *histogram_ptr));
+        case qpl_path_software:
+            return qpl::gather_statistics_on_host(source_ptr, source_length, *histogram_ptr, level, *options_ptr);
+        default: return QPL_STS_PATH_ERR;
+    }
+}
 }
@@ -32,7 +32,8 @@ inline qpl_status validate_analytic_buffers(const qpl_job* const job_ptr) noexce
         return QPL_STS_BUFFER_OVERLAP_ERR;
     }
 
-    if constexpr (operation == qpl_op_expand || operation == qpl_op_select) {
+    if constexpr (operation == qpl_op_expand || operation == qpl_op_select || operation == qpl_op_scan_in_set ||
+                  operation == qpl_op_scan_predicate || operation == qpl_op_bit_and) {
         QPL_BAD_PTR_RET(job_ptr->next_src2_ptr)
         QPL_BAD_SIZE_RET(job_ptr->available_src2)
 
@@ -45,9 +46,10 @@ inline qpl_status validate_analytic_buffers(const qpl_job* const job_ptr) noexce
                                               job_ptr->available_out)) {
             return QPL_STS_BUFFER_OVERLAP_ERR;
         }
+    }
 
+    if constexpr (operation == qpl_op_expand || operation == qpl_op_select) {
         if (job_ptr->drop_initial_bytes) { return QPL_STS_DROP_BYTES_ERR; }
-
     } else {
         if ((job_ptr->available_in < job_ptr->drop_initial_bytes && !(job_ptr->flags & QPL_FLAG_DECOMPRESS_ENABLE)) ||
             job_ptr->drop_initial_bytes > UINT16_MAX) {
@@ -90,10 +92,18 @@ static inline qpl_status bad_arguments_check(const qpl_job* const job_ptr) {
         source_bit_width = static_cast<uint32_t>(job_ptr->next_in_ptr[0]);
     }
 
-    if (!source_bit_width_is_unknown && (source_bit_width < 1U || source_bit_width > 32U)) {
+    const uint32_t max_bit_width = (is_wide_element_supported(job_ptr)) ? ml::limits::max_wide_bit_width
+                                                                         : ml::limits::max_bit_width;
+
+    if (!source_bit_width_is_unknown && (source_bit_width < 1U || source_bit_width > max_bit_width)) {
         return QPL_STS_BIT_WIDTH_ERR;
     }
 
+    // 33..64-bit array output is written as it is, there are no 8, 16 or 32-bit modifications for it
+    if (source_bit_width > ml::limits::max_bit_width && !is_scan(job_ptr) && qpl_ow_nom != job_ptr->out_bit_width) {
+        return QPL_STS_OUT_FORMAT_ERR;
+    }
+
     if (job_ptr->parser > qpl_p_parquet_rle) { return QPL_STS_PARSER_ERR; }
 
     return QPL_STS_OK;
@@ -202,6 +212,79 @@ inline qpl_status bad_arguments_check<qpl_operation::qpl_op_scan_eq>(const qpl_j
     return QPL_STS_OK;
 }
 
+template <>
+inline qpl_status bad_arguments_check<qpl_operation::qpl_op_scan_in_set>(const qpl_job* const job_ptr) noexcept {
+    QPL_BADARG_RET((qpl_op_scan_in_set != job_ptr->op), QPL_STS_OPERATION_ERR)
+    QPL_BADARG_RET((1U != job_ptr->src2_bit_width && 32U != job_ptr->src2_bit_width), QPL_STS_BIT_WIDTH_ERR)
+
+    // Set values are stored in 32u format
+    QPL_BADARG_RET((32U == job_ptr->src2_bit_width && 0U != job_ptr->available_src2 % sizeof(uint32_t)),
+                   QPL_STS_SIZE_ERR)
+
+    return bad_arguments_check<qpl_op_scan_eq>(job_ptr);
+}
+
+template <>
+inline qpl_status bad_arguments_check<qpl_operation::qpl_op_scan_predicate>(const qpl_job* const job_ptr) noexcept {
+    QPL_BADARG_RET((qpl_op_scan_predicate != job_ptr->op), QPL_STS_OPERATION_ERR)
+    QPL_BADARG_RET((0U != job_ptr->available_src2 % sizeof(qpl_scan_predicate)), QPL_STS_SIZE_ERR)
+
+    const auto*    program_ptr    = reinterpret_cast<const qpl_scan_predicate*>(job_ptr->next_src2_ptr);
+    const uint32_t program_length = job_ptr->available_src2 / sizeof(qpl_scan_predicate);
+
+    QPL_BADARG_RET((program_length > QPL_MAX_PREDICATE_LENGTH), QPL_STS_INVALID_PARAM_ERR)
+
+    // Every instruction shall have its operands on the stack, the program shall leave a single result
+    uint32_t depth = 0U;
+
+    for (uint32_t i = 0U; i < program_length; i++) {
+        switch (program_ptr[i].opcode) {
+            case qpl_predicate_compare: {
+                QPL_BADARG_RET((program_ptr[i].comparator < qpl_op_scan_eq ||
+                                program_ptr[i].comparator > qpl_op_scan_not_range),
+                               QPL_STS_INVALID_PARAM_ERR)
+                depth++;
+                break;
+            }
+            case qpl_predicate_and:
+            case qpl_predicate_or: {
+                QPL_BADARG_RET((depth < 2U), QPL_STS_INVALID_PARAM_ERR)
+                depth--;
+                break;
+            }
+            case qpl_predicate_not: {
+                QPL_BADARG_RET((depth < 1U), QPL_STS_INVALID_PARAM_ERR)
+                break;
+            }
+            default: return QPL_STS_INVALID_PARAM_ERR;
+        }
+    }
+
+    QPL_BADARG_RET((1U != depth), QPL_STS_INVALID_PARAM_ERR)
+
+    return bad_arguments_check<qpl_op_scan_eq>(job_ptr);
+}
+
+template <>
+inline qpl_status bad_arguments_check<qpl_operation::qpl_op_bit_and>(const qpl_job* const job_ptr) noexcept {
+    QPL_BADARG_RET((qpl_op_bit_and > job_ptr->op || qpl_op_bit_xor < job_ptr->op), QPL_STS_OPERATION_ERR)
+    QPL_BADARG_RET((1U != job_ptr->src2_bit_width), QPL_STS_BIT_WIDTH_ERR)
+
+    // Bit width of the compressed source is checked after its decompression
+    if (!(QPL_FLAG_DECOMPRESS_ENABLE & job_ptr->flags)) {
+        const uint32_t source_bit_width = (qpl_p_parquet_rle == job_ptr->parser)
+                                                  ? static_cast<uint32_t>(job_ptr->next_in_ptr[0])
+                                                  : job_ptr->src1_bit_width;
+
+        QPL_BADARG_RET((1U != source_bit_width), QPL_STS_BIT_WIDTH_ERR)
+    }
+
+    const uint32_t expected_mask_byte_length = util::bit_to_byte(job_ptr->num_input_elements);
+    QPL_BADARG_RET((expected_mask_byte_length > job_ptr->available_src2), QPL_STS_SRC2_IS_SHORT_ERR)
+
+    return bad_arguments_check<qpl_op_scan_eq>(job_ptr);
+}
+
 template <>
 inline qpl_status validate_operation<qpl_op_scan_eq>(const qpl_job* const job_ptr) noexcept {
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_scan_eq>(job_ptr));
@@ -211,6 +294,33 @@ inline qpl_status validate_operation<qpl_op_scan_eq>(const qpl_job* const job_pt
     return QPL_STS_OK;
 }
 
+template <>
+inline qpl_status validate_operation<qpl_op_scan_in_set>(const qpl_job* const job_ptr) noexcept {
+    OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_scan_in_set>(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::filter::common::bad_arguments_check(job_ptr));
+    OWN_QPL_CHECK_STATUS(bad_arguments_check<qpl_op_scan_in_set>(job_ptr));
+
+    return QPL_STS_OK;
+}
+
+template <>
+inline qpl_status validate_operation<qpl_op_scan_predicate>(const qpl_job* const job_ptr) noexcept {
+    OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_scan_predicate>(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::filter::common::bad_arguments_check(job_ptr));
+    OWN_QPL_CHECK_STATUS(bad_arguments_check<qpl_op_scan_predicate>(job_ptr));
+
+    return QPL_STS_OK;
+}
+
+template <>
+inline qpl_status validate_operation<qpl_op_bit_and>(const qpl_job* const job_ptr) noexcept {
+    OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_bit_and>(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::filter::common::bad_arguments_check(job_ptr));
+    OWN_QPL_CHECK_STATUS(bad_arguments_check<qpl_op_bit_and>(job_ptr));
+
+    return QPL_STS_OK;
+}
+
 template <>
 inline qpl_status validate_operation<qpl_op_extract>(const qpl_job* const job_ptr) noexcept {
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_extract>(job_ptr));
@@ -242,14 +352,20 @@ inline qpl_status validate_operation<qpl_op_expand>(const qpl_job* const job_ptr
 
 namespace qpl::ml::analytics {
 static inline auto validate_input_stream(const input_stream_t& stream, uint32_t low_border_width = 1,
-                                         uint32_t upper_border_width = 32) noexcept -> uint32_t {
+                                         uint32_t upper_border_width = limits::max_wide_bit_width) noexcept
+        -> uint32_t {
     if (stream.is_compressed()) {
         if (stream.decompression_status() != status_list::ok &&
             stream.decompression_status() != status_list::more_output_needed) {
             return stream.decompression_status();
         }
 
-        if (stream.bit_width() < low_border_width || stream.bit_width() > upper_border_width) {
+        // Wider elements of the other formats are checked with the job parameters, PRLE is unpacked up to 32u only
+        const uint32_t max_bit_width = (stream_format_t::prle_format == stream.stream_format())
+                                               ? std::min(upper_border_width, limits::max_bit_width)
+                                               : upper_border_width;
+
+        if (stream.bit_width() < low_border_width || stream.bit_width() > max_bit_width) {
             return status_list::bit_width_error;
         }
     }
@@ -279,12 +395,16 @@ static inline auto update_job(qpl_job* job_ptr, const analytic_operation_result_
     job_ptr->total_in     = job_ptr->available_in;
     job_ptr->available_in = 0;
 
-    job_ptr->first_index_min_value = operation_result.aggregates_.min_value_;
-    job_ptr->last_index_max_value  = operation_result.aggregates_.max_value_;
-    job_ptr->sum_value             = operation_result.aggregates_.sum_;
-    job_ptr->last_bit_offset       = operation_result.last_bit_offset_;
-    job_ptr->xor_checksum          = operation_result.checksums_.xor_;
-    job_ptr->crc                   = operation_result.checksums_.crc32_;
+    job_ptr->first_index_min_value    = static_cast<uint32_t>(operation_result.aggregates_.min_value_);
+    job_ptr->last_index_max_value     = static_cast<uint32_t>(operation_result.aggregates_.max_value_);
+    job_ptr->sum_value                = static_cast<uint32_t>(operation_result.aggregates_.sum_);
+    job_ptr->first_index_min_value_64 = operation_result.aggregates_.min_value_;
+    job_ptr->last_index_max_value_64  = operation_result.aggregates_.max_value_;
+    job_ptr->sum_value_64             = operation_result.aggregates_.sum_;
+    job_ptr->last_bit_offset          = operation_result.last_bit_offset_;
+    job_ptr->xor_checksum             = operation_result.checksums_.xor_;
+    job_ptr->crc                      = operation_result.checksums_.crc32_;
+    job_ptr->num_output_elements      = job::get_output_elements(job_ptr);
 }
 } // namespace qpl::ml::analytics
 
@@ -124,6 +124,118 @@ namespace qpl {
  */
 uint32_t perform_scan(qpl_job* job_ptr, uint8_t* buffer_ptr, uint32_t buffer_size);
 
+/**
+ * @brief Performs scan in set of the `source-1` elements
+ *
+ * @param [in,out] job_ptr             pointer onto user specified @ref qpl_job
+ * @param [in]     unpack_buffer_ptr   pointer to the buffer for the unpacked elements
+ * @param [in]     unpack_buffer_size  size of the unpack buffer
+ * @param [in]     set_buffer_ptr      pointer to the buffer for the bitmap built from the set values
+ * @param [in]     set_buffer_size     size of the set buffer
+ *
+ * @details The set is specified by `source-2`:
+ *      - @ref qpl_job.src2_bit_width == 1  - bitmap with the bit of every accepted value, it shall hold
+ *        at least 2^@ref qpl_job.src1_bit_width bits. Allowed for @ref qpl_job.src1_bit_width up to 16;
+ *      - @ref qpl_job.src2_bit_width == 32 - accepted values in 32u format sorted in ascending order.
+ *
+ *      Elements that are in the set are marked with '1' in the output bit-vector, the output formats
+ *      are the same as for @ref perform_scan. The operation is not supported on @ref qpl_path_hardware.
+ *
+ * @return
+ *    - @ref QPL_STS_OK
+ *    - @ref QPL_STS_NULL_PTR_ERR
+ *    - @ref QPL_STS_SIZE_ERR
+ *    - @ref QPL_STS_BIT_WIDTH_ERR
+ *    - @ref QPL_STS_SRC_IS_SHORT_ERR
+ *    - @ref QPL_STS_SRC2_IS_SHORT_ERR
+ *    - @ref QPL_STS_DST_IS_SHORT_ERR
+ *    - @ref QPL_STS_INVALID_PARAM_ERR
+ *    - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR
+ *    - @ref QPL_STS_OUTPUT_OVERFLOW_ERR
+ *
+ */
+uint32_t perform_scan_in_set(qpl_job* job_ptr, uint8_t* unpack_buffer_ptr, uint32_t unpack_buffer_size,
+                             uint8_t* set_buffer_ptr, uint32_t set_buffer_size);
+
+/**
+ * @brief Performs compound scan of the `source-1` elements by the predicate program
+ *
+ * @param [in,out] job_ptr             pointer onto user specified @ref qpl_job
+ * @param [in]     unpack_buffer_ptr   pointer to the buffer for the unpacked elements
+ * @param [in]     unpack_buffer_size  size of the unpack buffer
+ * @param [in]     results_buffer_ptr  pointer to the buffer for the intermediate comparison results
+ * @param [in]     results_buffer_size size of the results buffer
+ *
+ * @details `source-2` holds the array of @ref qpl_scan_predicate instructions in postfix notation.
+ *      Elements that satisfy the program are marked with '1' in the output bit-vector, the output formats
+ *      are the same as for @ref perform_scan. The operation is not supported on @ref qpl_path_hardware.
+ *
+ * @return
+ *    - @ref QPL_STS_OK
+ *    - @ref QPL_STS_NULL_PTR_ERR
+ *    - @ref QPL_STS_SIZE_ERR
+ *    - @ref QPL_STS_BIT_WIDTH_ERR
+ *    - @ref QPL_STS_SRC_IS_SHORT_ERR
+ *    - @ref QPL_STS_DST_IS_SHORT_ERR
+ *    - @ref QPL_STS_INVALID_PARAM_ERR
+ *    - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR
+ *    - @ref QPL_STS_OUTPUT_OVERFLOW_ERR
+ *
+ */
+uint32_t perform_scan_predicate(qpl_job* job_ptr, uint8_t* unpack_buffer_ptr, uint32_t unpack_buffer_size,
+                                uint8_t* results_buffer_ptr, uint32_t results_buffer_size);
+
+/**
+ * @brief Performs bitwise operation on the `source-1` and `source-2` bit-vectors
+ *
+ * @param [in,out] job_ptr             pointer onto user specified @ref qpl_job
+ * @param [in]     unpack_buffer_ptr   pointer to the buffer for the unpacked `source-1` bits
+ * @param [in]     unpack_buffer_size  size of the unpack buffer
+ * @param [in]     mask_buffer_ptr     pointer to the buffer for the unpacked `source-2` bits
+ * @param [in]     mask_buffer_size    size of the mask buffer
+ *
+ * @details The operation is selected by @ref qpl_job.op: @ref qpl_op_bit_and, @ref qpl_op_bit_or,
+ *      @ref qpl_op_bit_and_not or @ref qpl_op_bit_xor. Both sources hold @ref qpl_job.num_input_elements bits,
+ *      the output formats are the same as for @ref perform_scan. The aggregates report the number of set bits
+ *      of the result and the indices of the first and the last set bits.
+ *      The operation is not supported on @ref qpl_path_hardware.
+ *
+ * @return
+ *    - @ref QPL_STS_OK
+ *    - @ref QPL_STS_NULL_PTR_ERR
+ *    - @ref QPL_STS_SIZE_ERR
+ *    - @ref QPL_STS_BIT_WIDTH_ERR
+ *    - @ref QPL_STS_SRC_IS_SHORT_ERR
+ *    - @ref QPL_STS_SRC2_IS_SHORT_ERR
+ *    - @ref QPL_STS_DST_IS_SHORT_ERR
+ *    - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR
+ *    - @ref QPL_STS_OUTPUT_OVERFLOW_ERR
+ *
+ */
+uint32_t perform_bit_vector(qpl_job* job_ptr, uint8_t* unpack_buffer_ptr, uint32_t unpack_buffer_size,
+                            uint8_t* mask_buffer_ptr, uint32_t mask_buffer_size);
+
+/**
+ * @brief Checks if the scan job is split into segments by @ref perform_parallel_scan
+ *
+ * @details The job shall have @ref QPL_FLAG_PARALLEL set and run on the software or auto path, use uncompressed
+ * little- or big-endian packed input without @ref qpl_job.drop_initial_bytes, produce a nominal bit-vector without
+ * @ref QPL_FLAG_FORCE_ARRAY_OUTPUT or @ref QPL_FLAG_INV_OUT and compute the gzip CRC32. The input shall hold
+ * at least two segments.
+ */
+bool is_parallel_scan(const qpl_job* job_ptr) noexcept;
+
+/**
+ * @brief Scans a large job by segments. The segments are taken in order by the host threads and, on the auto path,
+ *        by the accelerator, so each of them gets a share proportional to its throughput. Segment bit-vectors are
+ *        written in place, aggregates and checksums are merged in the segment order.
+ *
+ * @param [in,out] job_ptr pointer onto user specified @ref qpl_job that passed @ref is_parallel_scan
+ *
+ * @return the same statuses as @ref perform_scan and @ref QPL_STS_NO_MEM_ERR
+ */
+uint32_t perform_parallel_scan(qpl_job* job_ptr);
+
 /**
  * @brief Extracts a sub-vector from the `Source` starting from index param_low and finishing at index param_high
  *
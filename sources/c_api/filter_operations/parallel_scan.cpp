@@ -0,0 +1,433 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Scan of a single job split between the accelerator and the host threads
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+
+#include "qpl/qpl.h"
+
+#include "arguments_check.hpp"
+#include "filter_operations.hpp"
+#include "job.hpp"
+#include "lane_job.hpp"
+
+// Middle layer headers
+#include "dispatcher/sw_executor.hpp"
+#include "util/checksum.hpp"
+
+// Legacy
+#include "own_defs.h"
+
+namespace qpl {
+
+/**
+ * @brief Source size of a segment, segments are taken one by one by the accelerator and the host lanes
+ */
+static constexpr uint32_t parallel_scan_segment_size = 512U * 1024U;
+
+/**
+ * @brief Number of segments kept in flight on the accelerator
+ */
+static constexpr uint32_t parallel_scan_accelerator_depth = 8U;
+
+/**
+ * @brief Segment boundaries are aligned to this number of elements, so every segment starts on a byte boundary
+ * of both the source and the bit-vector and has an even source size for the XOR checksum
+ */
+static constexpr uint32_t parallel_scan_element_alignment = 64U;
+
+/**
+ * @brief Job flags passed to the segments
+ */
+static constexpr uint32_t parallel_scan_segment_flags =
+        QPL_FLAG_OUT_BE | QPL_FLAG_OMIT_CHECKSUMS | QPL_FLAG_OMIT_AGGREGATES;
+
+/**
+ * @brief Results of a segment merged into the job once all segments are done
+ */
+struct scan_segment_result_t {
+    uint32_t total_out;
+    uint32_t first_index;
+    uint32_t last_index;
+    uint32_t sum;
+    uint32_t last_bit_offset;
+    uint32_t crc;
+    uint32_t xor_checksum;
+};
+
+/**
+ * @brief State shared by the accelerator feeder and the host lanes of a single scan
+ */
+struct scan_context_t {
+    const qpl_job*         job_ptr;
+    uint32_t               segment_elements;
+    uint32_t               segment_count;
+    scan_segment_result_t* results_ptr;
+    std::atomic<uint32_t>  next_segment;
+    std::atomic<uint32_t>  host_segments;
+    std::atomic<uint32_t>  status;
+};
+
+/**
+ * @brief Accelerator job of the feeder with the index of the segment it processes
+ */
+struct scan_accelerator_slot_t {
+    lane_job job;
+    uint32_t segment_index = 0U;
+    bool     is_busy       = false;
+};
+
+/**
+ * @brief Single host worker of the scan that owns its own software job, the lane that has accelerator slots
+ * feeds the accelerator before it scans the segments left
+ */
+struct scan_lane_t {
+    scan_context_t*          context_ptr = nullptr;
+    lane_job                 job;
+    scan_accelerator_slot_t* slots_ptr  = nullptr;
+    uint32_t                 slot_count = 0U;
+};
+
+static inline auto get_bit_vector_size(uint32_t element_count) noexcept -> uint32_t {
+    return static_cast<uint32_t>((static_cast<uint64_t>(element_count) + 7U) / 8U);
+}
+
+static inline auto get_source_size(uint32_t element_count, uint32_t bit_width) noexcept -> uint32_t {
+    return static_cast<uint32_t>((static_cast<uint64_t>(element_count) * bit_width + 7U) / 8U);
+}
+
+static inline auto get_segment_elements(uint32_t bit_width) noexcept -> uint32_t {
+    return (parallel_scan_segment_size * 8U / bit_width) & ~(parallel_scan_element_alignment - 1U);
+}
+
+bool is_parallel_scan(const qpl_job* job_ptr) noexcept {
+    // Output inversion is applied by the submitted accelerator jobs only, so the segments would disagree
+    constexpr uint32_t unsupported_flags =
+            QPL_FLAG_DECOMPRESS_ENABLE | QPL_FLAG_CRC32C | QPL_FLAG_FORCE_ARRAY_OUTPUT | QPL_FLAG_INV_OUT;
+
+    if (!(job_ptr->flags & QPL_FLAG_PARALLEL) || !job::is_scan(job_ptr)) { return false; }
+    if (qpl_path_hardware == job_ptr->data_ptr.path) { return false; }
+    if ((job_ptr->flags & unsupported_flags) || qpl_ow_nom != job_ptr->out_bit_width) { return false; }
+    if (qpl_p_le_packed_array != job_ptr->parser && qpl_p_be_packed_array != job_ptr->parser) { return false; }
+    if (0U != job_ptr->drop_initial_bytes || 0U == job_ptr->src1_bit_width || 32U < job_ptr->src1_bit_width) {
+        return false;
+    }
+    if (nullptr == job_ptr->next_in_ptr || nullptr == job_ptr->next_out_ptr) { return false; }
+
+    // Jobs with too small buffers are left to the serial path that reports the error
+    const uint32_t element_count = job_ptr->num_input_elements;
+
+    if (job_ptr->available_in < get_source_size(element_count, job_ptr->src1_bit_width)) { return false; }
+    if (job_ptr->available_out < get_bit_vector_size(element_count)) { return false; }
+
+    return element_count / get_segment_elements(job_ptr->src1_bit_width) >= 2U;
+}
+
+/**
+ * @brief Sets the segment fields of a job, the segment output is written in place into the job bit-vector
+ */
+static void prepare_scan_segment(const scan_context_t& context, uint32_t segment_index, qpl_job* segment_ptr) {
+    const qpl_job* const job_ptr = context.job_ptr;
+
+    const uint32_t first_element = segment_index * context.segment_elements;
+    const bool     is_last       = (segment_index + 1U == context.segment_count);
+    const uint32_t element_count = is_last ? job_ptr->num_input_elements - first_element : context.segment_elements;
+    const uint32_t input_offset  = get_source_size(first_element, job_ptr->src1_bit_width);
+    const uint32_t output_offset = get_bit_vector_size(first_element);
+
+    segment_ptr->op                 = job_ptr->op;
+    segment_ptr->flags              = job_ptr->flags & parallel_scan_segment_flags;
+    segment_ptr->parser             = job_ptr->parser;
+    segment_ptr->src1_bit_width     = job_ptr->src1_bit_width;
+    segment_ptr->out_bit_width      = qpl_ow_nom;
+    segment_ptr->param_low          = job_ptr->param_low;
+    segment_ptr->param_high         = job_ptr->param_high;
+    segment_ptr->next_src2_ptr      = job_ptr->next_src2_ptr;
+    segment_ptr->available_src2     = job_ptr->available_src2;
+    segment_ptr->src2_bit_width     = job_ptr->src2_bit_width;
+    segment_ptr->numa_id            = job_ptr->numa_id;
+    segment_ptr->num_input_elements = element_count;
+    segment_ptr->next_in_ptr        = job_ptr->next_in_ptr + input_offset;
+    segment_ptr->available_in       = is_last ? job_ptr->available_in - input_offset
+                                              : get_source_size(element_count, job_ptr->src1_bit_width);
+    segment_ptr->next_out_ptr       = job_ptr->next_out_ptr + output_offset;
+    segment_ptr->available_out      = is_last ? job_ptr->available_out - output_offset
+                                              : get_bit_vector_size(element_count);
+    segment_ptr->total_in           = 0U;
+    segment_ptr->total_out          = 0U;
+}
+
+static void store_scan_segment(scan_context_t& context, uint32_t segment_index, const qpl_job* segment_ptr) {
+    auto& result = context.results_ptr[segment_index];
+
+    result.total_out       = segment_ptr->total_out;
+    result.first_index     = segment_ptr->first_index_min_value;
+    result.last_index      = segment_ptr->last_index_max_value;
+    result.sum             = segment_ptr->sum_value;
+    result.last_bit_offset = segment_ptr->last_bit_offset;
+    result.crc             = segment_ptr->crc;
+    result.xor_checksum    = segment_ptr->xor_checksum;
+}
+
+static void fail_scan(scan_context_t& context, uint32_t status) {
+    uint32_t expected = QPL_STS_OK;
+    context.status.compare_exchange_strong(expected, status, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Scans the segment with the software job of a lane
+ */
+static void execute_scan_segment(scan_context_t& context, uint32_t segment_index, qpl_job* job_ptr) {
+    prepare_scan_segment(context, segment_index, job_ptr);
+
+    const uint32_t status = qpl_execute_job(job_ptr);
+
+    if (QPL_STS_OK == status) {
+        store_scan_segment(context, segment_index, job_ptr);
+    } else {
+        fail_scan(context, status);
+    }
+}
+
+static auto claim_scan_segment(scan_context_t& context) -> uint32_t {
+    if (QPL_STS_OK != context.status.load(std::memory_order_relaxed)) { return context.segment_count; }
+
+    return std::min(context.next_segment.fetch_add(1U, std::memory_order_relaxed), context.segment_count);
+}
+
+/**
+ * @brief Checks if the accelerator completes one more segment before the host lanes complete all the segments
+ * left. Both rates are measured from the start of the scan, so the elapsed time cancels out.
+ */
+static auto is_accelerator_ahead(const scan_context_t& context, uint32_t in_flight, uint32_t accelerator_segments)
+        -> bool {
+    const uint64_t host_segments = context.host_segments.load(std::memory_order_relaxed);
+    const uint32_t next_segment  = std::min(context.next_segment.load(std::memory_order_relaxed),
+                                            context.segment_count);
+    const uint64_t left_segments = context.segment_count - next_segment;
+
+    // Nothing is measured until the first segments are completed
+    if (0U == accelerator_segments || 0U == host_segments) { return true; }
+
+    return (in_flight + 1U) * host_segments <= left_segments * accelerator_segments;
+}
+
+/**
+ * @brief Keeps the accelerator busy with the segments taken from the shared counter. A segment that the accelerator
+ * can't process is scanned on the host with the lane job, the accelerator is not used for the rest of the scan
+ * after a submission error. Returns once all accelerator jobs are completed.
+ */
+static void feed_scan_accelerator(scan_context_t& context, scan_accelerator_slot_t* slots_ptr, uint32_t slot_count,
+                                  qpl_job* host_job_ptr) {
+    uint32_t in_flight     = 0U;
+    uint32_t completed     = 0U;
+    bool     is_claiming   = true;
+    bool     is_progressed = false;
+
+    while (is_claiming || 0U != in_flight) {
+        is_progressed = false;
+
+        for (uint32_t i = 0U; i < slot_count; ++i) {
+            auto&       slot    = slots_ptr[i];
+            auto* const job_ptr = slot.job.get();
+
+            if (slot.is_busy) {
+                const uint32_t status = qpl_check_job(job_ptr);
+                if (QPL_STS_BEING_PROCESSED == status) { continue; }
+
+                slot.is_busy  = false;
+                is_progressed = true;
+                --in_flight;
+
+                if (QPL_STS_OK == status) {
+                    store_scan_segment(context, slot.segment_index, job_ptr);
+                    ++completed;
+                } else {
+                    execute_scan_segment(context, slot.segment_index, host_job_ptr);
+                }
+            }
+
+            if (!is_claiming) { continue; }
+
+            // The segments left are taken by the host lanes if the accelerator would complete them later
+            if (!is_accelerator_ahead(context, in_flight, completed)) {
+                if (0U == in_flight) { is_claiming = false; }
+                continue;
+            }
+
+            const uint32_t index = claim_scan_segment(context);
+
+            if (index >= context.segment_count) {
+                is_claiming = false;
+                continue;
+            }
+
+            prepare_scan_segment(context, index, job_ptr);
+
+            uint32_t status = QPL_STS_OK;
+
+            do { //NOLINT(cppcoreguidelines-avoid-do-while)
+                status = qpl_submit_job(job_ptr);
+            } while (QPL_STS_QUEUES_ARE_BUSY_ERR == status && 0U == in_flight);
+
+            is_progressed = true;
+
+            if (QPL_STS_OK == status) {
+                slot.segment_index = index;
+                slot.is_busy       = true;
+                ++in_flight;
+            } else {
+                // Busy queues with segments in flight mean that the accelerator is saturated
+                if (QPL_STS_QUEUES_ARE_BUSY_ERR != status) { is_claiming = false; }
+
+                execute_scan_segment(context, index, host_job_ptr);
+            }
+        }
+
+        if (!is_progressed) { std::this_thread::yield(); }
+    }
+}
+
+/**
+ * @brief Lane body, takes segments from the shared counter until all of them are taken or any lane failed
+ */
+static void execute_scan_lane(scan_lane_t& lane) noexcept {
+    auto&       context = *lane.context_ptr;
+    auto* const job_ptr = lane.job.get();
+
+    if (0U != lane.slot_count) { feed_scan_accelerator(context, lane.slots_ptr, lane.slot_count, job_ptr); }
+
+    for (uint32_t index = claim_scan_segment(context); index < context.segment_count;
+         index          = claim_scan_segment(context)) {
+        execute_scan_segment(context, index, job_ptr);
+        context.host_segments.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+uint32_t perform_parallel_scan(qpl_job* job_ptr) {
+    // The segment jobs are valid only if the whole job is, an invalid job fails as the serial scan would
+    OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_scan_eq>(job_ptr))
+
+    auto& executor = ml::dispatcher::sw_executor::get_instance();
+
+    const uint32_t segment_elements = get_segment_elements(job_ptr->src1_bit_width);
+    const uint32_t segment_count    = (job_ptr->num_input_elements + segment_elements - 1U) / segment_elements;
+
+    uint32_t lane_count = (0U == job_ptr->num_threads) ? executor.worker_count() : job_ptr->num_threads;
+    lane_count          = std::max(1U, std::min(lane_count, segment_count));
+
+    std::unique_ptr<scan_segment_result_t[]> results(new (std::nothrow) scan_segment_result_t[segment_count]);
+    OWN_RETURN_ERROR(nullptr == results, QPL_STS_NO_MEM_ERR);
+
+    std::unique_ptr<scan_lane_t[]> lanes(new (std::nothrow) scan_lane_t[lane_count]);
+    OWN_RETURN_ERROR(nullptr == lanes, QPL_STS_NO_MEM_ERR);
+
+    scan_context_t context {};
+    context.job_ptr          = job_ptr;
+    context.segment_elements = segment_elements;
+    context.segment_count    = segment_count;
+    context.results_ptr      = results.get();
+
+    uint32_t   job_size = 0U;
+    qpl_status status   = qpl_get_job_size_by_class(qpl_path_software, qpl_op_class_analytics, &job_size);
+    if (QPL_STS_OK != status) { return status; }
+
+    for (uint32_t i = 0U; i < lane_count; i++) {
+        lanes[i].context_ptr = &context;
+
+        status = lanes[i].job.init(qpl_path_software, qpl_op_class_analytics, job_size);
+        if (QPL_STS_OK != status) { return status; }
+    }
+
+    // The accelerator is used on the auto path only, the jobs are not created if it is not available
+    // or can't perform the operation
+    std::unique_ptr<scan_accelerator_slot_t[]> slots = nullptr;
+    uint32_t                                   slot_count = 0U;
+
+    if (qpl_path_auto == job_ptr->data_ptr.path && !job::is_scan_in_set(job_ptr) &&
+        !job::is_scan_predicate(job_ptr) &&
+        QPL_STS_OK == qpl_get_job_size_by_class(qpl_path_hardware, qpl_op_class_analytics, &job_size)) {
+        slots.reset(new (std::nothrow) scan_accelerator_slot_t[parallel_scan_accelerator_depth]);
+        OWN_RETURN_ERROR(nullptr == slots, QPL_STS_NO_MEM_ERR);
+
+        while (slot_count < parallel_scan_accelerator_depth &&
+               QPL_STS_OK == slots[slot_count].job.init(qpl_path_hardware, qpl_op_class_analytics, job_size)) {
+            slot_count++;
+        }
+    }
+
+    context.next_segment.store(0U);
+    context.host_segments.store(0U);
+    context.status.store(QPL_STS_OK);
+
+    // The calling thread is lane 0, it feeds the accelerator and joins the host lanes once no segments are left for it
+    lanes[0].slots_ptr  = slots.get();
+    lanes[0].slot_count = slot_count;
+
+    executor.parallel_for(lanes.get(), lane_count, &execute_scan_lane);
+
+    status = static_cast<qpl_status>(context.status.load());
+    if (QPL_STS_OK != status) { return status; }
+
+    // Segments are merged in order, so the result does not depend on the segment placement.
+    // The accelerator reports aggregates and checksums even if they are omitted, they are dropped
+    // as on the software path.
+    const bool is_aggregated  = !(job_ptr->flags & QPL_FLAG_OMIT_AGGREGATES);
+    const bool is_checksummed = !(job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS);
+
+    uint32_t first_index = UINT32_MAX;
+    uint32_t last_index  = 0U;
+    uint32_t sum         = 0U;
+    uint32_t crc         = 0U;
+    uint32_t xor_value   = 0U;
+
+    for (uint32_t i = 0U; i < segment_count; i++) {
+        const auto&    result        = results[i];
+        const uint32_t first_element = i * segment_elements;
+        const uint32_t input_offset  = get_source_size(first_element, job_ptr->src1_bit_width);
+        const uint32_t input_size    = (i + 1U == segment_count)
+                                               ? job_ptr->available_in - input_offset
+                                               : get_source_size(segment_elements, job_ptr->src1_bit_width);
+
+        if (is_aggregated && 0U != result.sum) {
+            first_index = std::min(first_index, first_element + result.first_index);
+            last_index  = first_element + result.last_index;
+            sum += result.sum;
+        }
+
+        if (is_checksummed) {
+            crc = ml::util::crc32_gzip_combine(crc, result.crc, input_size);
+            xor_value ^= result.xor_checksum;
+        }
+    }
+
+    const auto&    last_result = results[segment_count - 1U];
+    const uint32_t total_out   = get_bit_vector_size((segment_count - 1U) * segment_elements) + last_result.total_out;
+
+    job_ptr->total_out      = total_out;
+    job_ptr->available_out -= total_out;
+    job_ptr->total_in       = job_ptr->available_in;
+    job_ptr->available_in   = 0U;
+
+    job::update_aggregates(job_ptr, sum, first_index, last_index);
+
+    job_ptr->last_bit_offset     = last_result.last_bit_offset;
+    job_ptr->crc                 = crc;
+    job_ptr->xor_checksum        = xor_value;
+    job_ptr->num_output_elements = job::get_output_elements(job_ptr);
+
+    return QPL_STS_OK;
+}
+
+} // namespace qpl
@@ -165,53 +165,54 @@ uint32_t perform_scan(qpl_job* job_ptr, uint8_t* buffer_ptr, uint32_t buffer_siz
 
             limited_buffer_t temporary_buffer(buffer_ptr, buffer_ptr + buffer_size, input_stream.bit_width());
 
+            // Elements wider than 32 bits are compared against the 64-bit parameters
+            const bool     is_wide    = limits::max_bit_width < job_ptr->src1_bit_width;
+            const uint64_t param_low  = is_wide ? job_ptr->param_low_64 : job_ptr->param_low;
+            const uint64_t param_high = is_wide ? job_ptr->param_high_64 : job_ptr->param_high;
+
             switch (job_ptr->op) {
                 case qpl_op_scan_eq: {
                     scan_result = analytics::call_scan<analytics::comparator_t::equals, execution_path_t::software>(
-                            input_stream, output_stream, job_ptr->param_low, job_ptr->param_high, temporary_buffer);
+                            input_stream, output_stream, param_low, param_high, temporary_buffer);
                     break;
                 }
                 case qpl_op_scan_ne: {
                     scan_result = analytics::call_scan<analytics::comparator_t::not_equals, execution_path_t::software>(
-                            input_stream, output_stream, job_ptr->param_low, job_ptr->param_high, temporary_buffer);
+                            input_stream, output_stream, param_low, param_high, temporary_buffer);
                     break;
                 }
                 case qpl_op_scan_lt: {
                     scan_result = analytics::call_scan<analytics::comparator_t::less_than, execution_path_t::software>(
-                            input_stream, output_stream, job_ptr->param_low, job_ptr->param_high, temporary_buffer);
+                            input_stream, output_stream, param_low, param_high, temporary_buffer);
                     break;
                 }
                 case qpl_op_scan_le: {
                     scan_result =
                             analytics::call_scan<analytics::comparator_t::less_equals, execution_path_t::software>(
-                                    input_stream, output_stream, job_ptr->param_low, job_ptr->param_high,
-                                    temporary_buffer);
+                                    input_stream, output_stream, param_low, param_high, temporary_buffer);
                     break;
                 }
                 case qpl_op_scan_gt: {
                     scan_result =
                             analytics::call_scan<analytics::comparator_t::greater_than, execution_path_t::software>(
-                                    input_stream, output_stream, job_ptr->param_low, job_ptr->param_high,
-                                    temporary_buffer);
+                                    input_stream, output_stream, param_low, param_high, temporary_buffer);
                     break;
                 }
                 case qpl_op_scan_ge: {
                     scan_result =
                             analytics::call_scan<analytics::comparator_t::greater_equals, execution_path_t::software>(
-                                    input_stream, output_stream, job_ptr->param_low, job_ptr->param_high,
-                                    temporary_buffer);
+                                    input_stream, output_stream, param_low, param_high, temporary_buffer);
                     break;
                 }
                 case qpl_op_scan_not_range: {
                     scan_result =
                             analytics::call_scan<analytics::comparator_t::out_of_range, execution_path_t::software>(
-                                    input_stream, output_stream, job_ptr->param_low, job_ptr->param_high,
-                                    temporary_buffer);
+                                    input_stream, output_stream, param_low, param_high, temporary_buffer);
                     break;
                 }
                 case qpl_op_scan_range: {
                     scan_result = analytics::call_scan<analytics::comparator_t::in_range, execution_path_t::software>(
-                            input_stream, output_stream, job_ptr->param_low, job_ptr->param_high, temporary_buffer);
+                            input_stream, output_stream, param_low, param_high, temporary_buffer);
                     break;
                 }
                 default: {
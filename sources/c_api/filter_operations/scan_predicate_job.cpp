@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+
+#include "analytics/scan_predicate.hpp"
+#include "analytics_state_t.h"
+#include "arguments_check.hpp"
+#include "filter_operations.hpp"
+
+namespace qpl {
+
+/**
+ * @brief Converts the validated `source-2` instructions into the program of the analytics layer
+ */
+static inline void build_predicate_program(const qpl_job* job_ptr, ml::analytics::predicate_program_t& program) {
+    using namespace qpl::ml;
+
+    const auto* instructions_ptr = reinterpret_cast<const qpl_scan_predicate*>(job_ptr->next_src2_ptr);
+
+    uint32_t depth = 0U;
+
+    program.length = job_ptr->available_src2 / sizeof(qpl_scan_predicate);
+
+    for (uint32_t i = 0U; i < program.length; i++) {
+        auto& instruction = program.instructions[i];
+
+        instruction.opcode     = static_cast<analytics::predicate_opcode_t>(instructions_ptr[i].opcode);
+        instruction.comparator = static_cast<analytics::comparator_t>(instructions_ptr[i].comparator & 0x1FU);
+        instruction.param_low  = instructions_ptr[i].param_low;
+        instruction.param_high = instructions_ptr[i].param_high;
+
+        if (qpl_predicate_compare == instructions_ptr[i].opcode) {
+            program.depth = std::max(program.depth, ++depth);
+        } else if (qpl_predicate_not != instructions_ptr[i].opcode) {
+            depth--;
+        }
+    }
+}
+
+uint32_t perform_scan_predicate(qpl_job* job_ptr, uint8_t* unpack_buffer_ptr, uint32_t unpack_buffer_size,
+                                uint8_t* results_buffer_ptr, uint32_t results_buffer_size) {
+    using namespace qpl::ml;
+
+    OWN_QPL_CHECK_STATUS(qpl::job::validate_operation<qpl_op_scan_predicate>(job_ptr))
+
+    // The accelerator can't evaluate predicate programs
+    if (qpl_path_hardware == job_ptr->data_ptr.path) { return QPL_STS_NOT_SUPPORTED_MODE_ERR; }
+
+    const auto input_stream_format  = analytics::get_stream_format(job_ptr->parser);
+    const auto out_bit_width_format = static_cast<analytics::output_bit_width_format_t>(job_ptr->out_bit_width);
+    const auto output_stream_format = (job_ptr->flags & QPL_FLAG_OUT_BE) ? analytics::stream_format_t::be_format
+                                                                         : analytics::stream_format_t::le_format;
+    const auto crc_type             = job_ptr->flags & QPL_FLAG_CRC32C ? analytics::input_stream_t::crc_t::iscsi
+                                                                       : analytics::input_stream_t::crc_t::gzip;
+
+    auto* src_begin = const_cast<uint8_t*>(job_ptr->next_in_ptr);
+    auto* src_end   = const_cast<uint8_t*>(job_ptr->next_in_ptr + job_ptr->available_in);
+    auto* dst_begin = const_cast<uint8_t*>(job_ptr->next_out_ptr);
+    auto* dst_end   = const_cast<uint8_t*>(job_ptr->next_out_ptr + job_ptr->available_out);
+
+    auto* analytics_state_ptr     = reinterpret_cast<own_analytics_state_t*>(job_ptr->data_ptr.analytics_state_ptr);
+    auto* decompress_buffer_begin = analytics_state_ptr->inflate_buf_ptr;
+    auto* decompress_buffer_end   = decompress_buffer_begin + analytics_state_ptr->inflate_buf_size;
+
+    const allocation_buffer_t state_buffer(job_ptr->data_ptr.middle_layer_buffer_ptr, job_ptr->data_ptr.hw_state_ptr);
+
+    auto input_stream = analytics::input_stream_t::builder(src_begin, src_end)
+                                .element_count(job_ptr->num_input_elements)
+                                .omit_checksums(job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS)
+                                .omit_aggregates(job_ptr->flags & QPL_FLAG_OMIT_AGGREGATES)
+                                .ignore_bytes(job_ptr->drop_initial_bytes)
+                                .crc_type(crc_type)
+                                .compressed(job_ptr->flags & QPL_FLAG_DECOMPRESS_ENABLE,
+                                            static_cast<qpl_decomp_end_proc>(job_ptr->decomp_end_processing),
+                                            job_ptr->ignore_end_bits)
+                                .decompress_buffer<execution_path_t::auto_detect>(decompress_buffer_begin,
+                                                                                  decompress_buffer_end)
+                                .stream_format(input_stream_format, job_ptr->src1_bit_width)
+                                .build<execution_path_t::auto_detect>(state_buffer);
+
+    auto output_stream = analytics::output_stream_t<analytics::bit_stream>::builder(dst_begin, dst_end)
+                                 .stream_format(output_stream_format)
+                                 .bit_format(out_bit_width_format, bit_bits_size)
+                                 .nominal(true)
+                                 .initial_output_index(job_ptr->initial_output_index)
+                                 .build<execution_path_t::auto_detect>();
+
+    auto bad_arg_status = validate_input_stream(input_stream);
+
+    if (bad_arg_status != status_list::ok) { return bad_arg_status; }
+
+    limited_buffer_t unpack_buffer(unpack_buffer_ptr, unpack_buffer_ptr + unpack_buffer_size,
+                                   input_stream.bit_width());
+    limited_buffer_t results_buffer(results_buffer_ptr, results_buffer_ptr + results_buffer_size, byte_bits_size);
+
+    analytics::predicate_program_t program {};
+    build_predicate_program(job_ptr, program);
+
+    auto scan_result = analytics::call_scan_predicate<execution_path_t::software>(input_stream, output_stream, program,
+                                                                                  unpack_buffer, results_buffer);
+
+    job_ptr->total_out = scan_result.output_bytes_;
+
+    if (QPL_STS_OK == scan_result.status_code_) { update_job(job_ptr, scan_result); }
+
+    return scan_result.status_code_;
+}
+
+} // namespace qpl
@@ -12,6 +12,8 @@
 #ifndef QPL_UTIL_JOB_API_SERVICE_H_
 #define QPL_UTIL_JOB_API_SERVICE_H_
 
+#include <atomic>
+
 #include "qpl/c_api/job.h"
 
 #include "common/defs.hpp"
@@ -62,7 +64,7 @@ static inline bool is_dictionary(const qpl_job* const job_ptr) noexcept {
 }
 
 static inline bool is_high_level_compression(const qpl_job* const job_ptr) noexcept {
-    return (qpl_op_compress == job_ptr->op) && (qpl_high_level == job_ptr->level);
+    return (qpl_op_compress == job_ptr->op) && (qpl_default_level != job_ptr->level);
 }
 
 static inline bool is_canned_mode_compression(const qpl_job* const job_ptr) noexcept {
@@ -101,6 +103,14 @@ static inline bool is_scan(const qpl_job* const job_ptr) noexcept {
     return qpl_op_scan_eq <= job_ptr->op;
 }
 
+static inline bool is_scan_in_set(const qpl_job* const job_ptr) noexcept {
+    return qpl_op_scan_in_set == job_ptr->op;
+}
+
+static inline bool is_scan_predicate(const qpl_job* const job_ptr) noexcept {
+    return qpl_op_scan_predicate == job_ptr->op;
+}
+
 static inline bool is_select(const qpl_job* const job_ptr) noexcept {
     return qpl_op_select == job_ptr->op;
 }
@@ -109,12 +119,48 @@ static inline bool is_expand(const qpl_job* const job_ptr) noexcept {
     return qpl_op_expand == job_ptr->op;
 }
 
+static inline bool is_bit_vector(const qpl_job* const job_ptr) noexcept {
+    return qpl_op_bit_and <= job_ptr->op && qpl_op_bit_xor >= job_ptr->op;
+}
+
+/**
+ * @brief Checks that the operation accepts 33..64-bit elements, they are unpacked to 64u on the host
+ */
+static inline bool is_wide_element_supported(const qpl_job* const job_ptr) noexcept {
+    const bool is_plain_scan = qpl_op_scan_eq <= job_ptr->op && qpl_op_scan_not_range >= job_ptr->op;
+
+    return (is_plain_scan || is_extract(job_ptr) || is_select(job_ptr) || is_expand(job_ptr)) &&
+           qpl_p_parquet_rle != job_ptr->parser;
+}
+
 static inline bool is_crc64(const qpl_job* const job_ptr) noexcept {
     return qpl_op_crc64 == job_ptr->op;
 }
 
 static inline bool is_filter(const qpl_job* const job_ptr) noexcept {
-    return (is_scan(job_ptr) || is_extract(job_ptr) || is_select(job_ptr) || is_expand(job_ptr));
+    return (is_scan(job_ptr) || is_extract(job_ptr) || is_select(job_ptr) || is_expand(job_ptr) ||
+            is_bit_vector(job_ptr));
+}
+
+/**
+ * @brief Checks that the job was initialized with the buffers required for its operation,
+ * see @ref qpl_init_job_by_class
+ */
+static inline bool is_op_class_initialized(const qpl_job* const job_ptr) noexcept {
+    uint32_t op_class = qpl_op_class_crc;
+
+    if (is_compression(job_ptr)) {
+        // Tables of the software-only levels are reserved on request, the hardware path rejects such levels later
+        const bool is_high_ratio = job_ptr->level > qpl_high_level && qpl_path_hardware != job_ptr->data_ptr.path;
+
+        op_class = is_high_ratio ? qpl_op_class_high_ratio_compression : qpl_op_class_compression;
+    } else if (is_decompression(job_ptr)) {
+        op_class = qpl_op_class_decompression;
+    } else if (is_filter(job_ptr)) {
+        op_class = qpl_op_class_analytics;
+    }
+
+    return job_ptr->data_ptr.op_classes & op_class;
 }
 
 /**
@@ -233,9 +279,30 @@ static inline void update_adler32(qpl_job* const qpl_job_ptr, uint32_t adler32_i
 
 static inline void update_aggregates(qpl_job* const qpl_job_ptr, const uint32_t sum_agg, const uint32_t min_first_agg,
                                      const uint32_t max_last_agg) noexcept {
-    qpl_job_ptr->sum_value             = sum_agg;
-    qpl_job_ptr->first_index_min_value = min_first_agg;
-    qpl_job_ptr->last_index_max_value  = max_last_agg;
+    qpl_job_ptr->sum_value                = sum_agg;
+    qpl_job_ptr->first_index_min_value    = min_first_agg;
+    qpl_job_ptr->last_index_max_value     = max_last_agg;
+    qpl_job_ptr->sum_value_64             = sum_agg;
+    qpl_job_ptr->first_index_min_value_64 = min_first_agg;
+    qpl_job_ptr->last_index_max_value_64  = max_last_agg;
+}
+
+/**
+ * @brief Number of elements in the output of a filter operation, derived from the output size,
+ * bit-vector output consists of 1-bit elements
+ */
+static inline uint32_t get_output_elements(const qpl_job* const qpl_job_ptr) noexcept {
+    if (qpl_ow_nom != qpl_job_ptr->out_bit_width) {
+        // Output of 8, 16 or 32-bit elements
+        return qpl_job_ptr->total_out >> (static_cast<uint32_t>(qpl_job_ptr->out_bit_width) - 1U);
+    }
+
+    const bool     is_array_output = is_extract(qpl_job_ptr) || is_select(qpl_job_ptr) || is_expand(qpl_job_ptr);
+    const uint32_t element_bits    = (is_array_output) ? qpl_job_ptr->src1_bit_width : 1U;
+    const uint32_t padding_bits    = (0U != qpl_job_ptr->last_bit_offset) ? 8U - qpl_job_ptr->last_bit_offset : 0U;
+    const uint64_t output_bits     = static_cast<uint64_t>(qpl_job_ptr->total_out) * 8U - padding_bits;
+
+    return (0U != element_bits) ? static_cast<uint32_t>(output_bits / element_bits) : 0U;
 }
 
 static inline void update_input_stream(qpl_job* const qpl_job_ptr, const uint32_t size) noexcept {
@@ -263,6 +330,26 @@ static inline void update_is_sw_fallback(qpl_job* const qpl_job_ptr, bool is_sw_
     state_ptr->is_sw_fallback = is_sw_fallback;
 }
 
+// ------ ASYNCHRONOUS SOFTWARE PATH ------ //
+
+// The status is written by a worker thread of the host executor and polled by the application thread
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free,
+              "qpl_data::sw_status can't be accessed atomically");
+
+static inline auto get_sw_status(const qpl_job* const qpl_job_ptr) noexcept -> qpl_status {
+    const auto* status_ptr = reinterpret_cast<const std::atomic<uint32_t>*>(&qpl_job_ptr->data_ptr.sw_status);
+    return static_cast<qpl_status>(status_ptr->load(std::memory_order_acquire));
+}
+
+static inline void update_sw_status(qpl_job* const qpl_job_ptr, const uint32_t status) noexcept {
+    auto* status_ptr = reinterpret_cast<std::atomic<uint32_t>*>(&qpl_job_ptr->data_ptr.sw_status);
+    status_ptr->store(status, std::memory_order_release);
+}
+
+static inline bool is_sw_job_in_progress(const qpl_job* const qpl_job_ptr) noexcept {
+    return QPL_STS_BEING_PROCESSED == get_sw_status(qpl_job_ptr);
+}
+
 template <class result_t>
 void inline update(qpl_job* job_ptr, result_t& result) noexcept;
 } // namespace qpl::job
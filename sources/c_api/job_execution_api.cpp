@@ -9,6 +9,8 @@
  *  Job API (public C API)
  */
 
+#include <thread>
+
 // C_API headers
 #include "qpl/qpl.h"
 
@@ -32,6 +34,7 @@
 
 // dispatchers
 #include "dispatcher/hw_dispatcher.hpp"
+#include "dispatcher/sw_executor.hpp"
 
 static inline qpl_status sw_execute_job(qpl_job* const qpl_job_ptr) {
     using namespace qpl;
@@ -39,8 +42,10 @@ static inline qpl_status sw_execute_job(qpl_job* const qpl_job_ptr) {
     // add with different verbosity level to not crowd output
     DIAG("Job is executed on qpl_path_software\n");
 
-    uint32_t status                    = QPL_STS_OK;
-    qpl_job_ptr->first_index_min_value = UINT32_MAX;
+    uint32_t status                       = QPL_STS_OK;
+    qpl_job_ptr->first_index_min_value    = UINT32_MAX;
+    qpl_job_ptr->first_index_min_value_64 = UINT32_MAX;
+    qpl_job_ptr->num_output_elements      = 0U;
 
     auto* const analytics_state_ptr =
             reinterpret_cast<own_analytics_state_t*>(qpl_job_ptr->data_ptr.analytics_state_ptr);
@@ -78,9 +83,31 @@ static inline qpl_status sw_execute_job(qpl_job* const qpl_job_ptr) {
                                   analytics_state_ptr->unpack_buf_size);
             break;
         }
+        case qpl_op_scan_in_set: {
+            status = perform_scan_in_set(qpl_job_ptr, analytics_state_ptr->unpack_buf_ptr,
+                                         analytics_state_ptr->unpack_buf_size, analytics_state_ptr->set_buf_ptr,
+                                         analytics_state_ptr->set_buf_size);
+            break;
+        }
+        case qpl_op_scan_predicate: {
+            status = perform_scan_predicate(qpl_job_ptr, analytics_state_ptr->unpack_buf_ptr,
+                                            analytics_state_ptr->unpack_buf_size, analytics_state_ptr->set_buf_ptr,
+                                            analytics_state_ptr->set_buf_size);
+            break;
+        }
+        case qpl_op_bit_and:
+        case qpl_op_bit_or:
+        case qpl_op_bit_and_not:
+        case qpl_op_bit_xor: {
+            status = perform_bit_vector(qpl_job_ptr, analytics_state_ptr->unpack_buf_ptr,
+                                        analytics_state_ptr->unpack_buf_size, analytics_state_ptr->set_buf_ptr,
+                                        analytics_state_ptr->set_buf_size);
+            break;
+        }
         case qpl_op_extract: {
             if (qpl_job_ptr->param_low > qpl_job_ptr->param_high) {
-                qpl_job_ptr->first_index_min_value = 0U;
+                qpl_job_ptr->first_index_min_value    = 0U;
+                qpl_job_ptr->first_index_min_value_64 = 0U;
 
                 return QPL_STS_OK;
             }
@@ -110,20 +137,104 @@ static inline qpl_status sw_execute_job(qpl_job* const qpl_job_ptr) {
     return static_cast<qpl_status>(status);
 }
 
-QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
+/**
+ * @brief Executes the job on the host, the original path of the job is restored afterwards
+ */
+static inline qpl_status sw_execute_job_on_host(qpl_job* const qpl_job_ptr) {
+    const qpl_path_t path      = qpl_job_ptr->data_ptr.path;
+    qpl_job_ptr->data_ptr.path = qpl_path_software;
+    const qpl_status status    = sw_execute_job(qpl_job_ptr);
+    qpl_job_ptr->data_ptr.path = path;
+
+    return status;
+}
+
+/**
+ * @brief Task executed by a worker of the host executor for the job submitted with @ref qpl_submit_job
+ */
+static void sw_execute_job_task(void* job_ptr) noexcept {
+    auto* qpl_job_ptr = static_cast<qpl_job*>(job_ptr);
+
+    qpl::job::update_sw_status(qpl_job_ptr, sw_execute_job_on_host(qpl_job_ptr));
+}
+
+/**
+ * @brief Waits for the job submitted to the host executor, the calling thread runs other pending tasks meanwhile
+ */
+static inline qpl_status sw_wait_job(qpl_job* const qpl_job_ptr) {
+    auto& executor = qpl::ml::dispatcher::sw_executor::get_instance();
+
+    while (qpl::job::is_sw_job_in_progress(qpl_job_ptr)) {
+        if (!executor.run_pending_task()) { std::this_thread::yield(); }
+    }
+
+    return qpl::job::get_sw_status(qpl_job_ptr);
+}
+
+/**
+ * @brief Checks the buffers of the job before the submission
+ */
+static qpl_status own_validate_job_buffers(const qpl_job* const qpl_job_ptr) {
     using namespace qpl;
 
     QPL_BAD_PTR_RET(qpl_job_ptr);
+
+    // Jobs initialized for other operations don't have the internal buffers of this one
+    if (!job::is_op_class_initialized(qpl_job_ptr)) { return QPL_STS_OPERATION_ERR; }
+
     QPL_BAD_PTR_RET(qpl_job_ptr->next_in_ptr);
     QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.compress_state_ptr);
     QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.decompress_state_ptr);
     QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.analytics_state_ptr);
     QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.hw_state_ptr);
-    QPL_BAD_OP_RET(qpl_job_ptr->op);
 
     if ((qpl_job_ptr->flags & QPL_FLAG_CANNED_MODE) && (qpl_job_ptr->huffman_table == nullptr))
         return QPL_STS_NULL_PTR_ERR;
 
+    return QPL_STS_OK;
+}
+
+/**
+ * @brief Checks the operation of the job, the result is the same for the jobs with the same op and flags
+ */
+static qpl_status own_validate_job_operation(const qpl_job* const qpl_job_ptr) {
+    QPL_BAD_OP_RET(qpl_job_ptr->op);
+
+    return QPL_STS_OK;
+}
+
+/**
+ * @brief Checks the job fields that are common for all operations before the submission
+ */
+static qpl_status own_validate_job(const qpl_job* const qpl_job_ptr) {
+    const qpl_status status = own_validate_job_buffers(qpl_job_ptr);
+    if (QPL_STS_OK != status) { return status; }
+
+    return own_validate_job_operation(qpl_job_ptr);
+}
+
+/**
+ * @brief Returns QPL_STS_OK if the accelerator is available and the status of the failed initialization otherwise
+ */
+static qpl_status own_get_hw_availability() {
+    static auto& dispatcher = qpl::ml::dispatcher::hw_dispatcher::get_instance();
+
+    if (dispatcher.is_hw_support()) { return QPL_STS_OK; }
+
+    return qpl::ml::util::convert_hw_accelerator_status_to_qpl_status(dispatcher.get_hw_init_status());
+}
+
+static inline bool own_is_accelerator_path(const qpl_job* const qpl_job_ptr) {
+    return qpl_path_hardware == qpl_job_ptr->data_ptr.path || qpl_path_auto == qpl_job_ptr->data_ptr.path;
+}
+
+/**
+ * @brief Submits the job that passed @ref own_validate_job, hw_availability is the result
+ * of @ref own_get_hw_availability and is used only for the accelerator paths
+ */
+static qpl_status own_submit_validated_job(qpl_job* const qpl_job_ptr, bool is_async, qpl_status hw_availability) {
+    using namespace qpl;
+
     qpl_status status         = QPL_STS_OK;
     bool       is_sw_fallback = false;
 
@@ -135,7 +246,7 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
         // Reset is_sw_fallback for the first job
         if (qpl_job_ptr->flags & QPL_FLAG_FIRST) { job::update_is_sw_fallback(qpl_job_ptr, false); }
 
-        if ((qpl_op_compress == qpl_job_ptr->op) && (qpl_high_level == qpl_job_ptr->level)) {
+        if (job::is_high_level_compression(qpl_job_ptr)) {
             if (qpl_path_hardware == path) {
                 return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
             } else if (qpl_path_auto == path) {
@@ -145,12 +256,7 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
 
         // Execute job on HW path
         if (!state_ptr->is_sw_fallback) {
-            // check that HW is available
-            static auto& dispatcher = ml::dispatcher::hw_dispatcher::get_instance();
-            if (!dispatcher.is_hw_support()) {
-                const hw_accelerator_status hw_status = dispatcher.get_hw_init_status();
-                status = ml::util::convert_hw_accelerator_status_to_qpl_status(hw_status);
-            }
+            status = hw_availability;
 
             if (status == QPL_STS_OK) {
                 status = hw_submit_job(qpl_job_ptr);
@@ -175,29 +281,61 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
 
     if (qpl_path_software == path || is_sw_fallback) {
         // Execute job on SW path
-        qpl_job_ptr->data_ptr.path = qpl_path_software;
-        status                     = sw_execute_job(qpl_job_ptr);
-        qpl_job_ptr->data_ptr.path = path;
+        auto* state_ptr = (qpl_path_auto == path) ? reinterpret_cast<qpl_hw_state*>(job::get_state(qpl_job_ptr))
+                                                  : nullptr;
+
+        job::update_sw_status(qpl_job_ptr, QPL_STS_BEING_PROCESSED);
+
+        // The job can't be touched by this thread once it is enqueued, so it is marked as submitted in advance
+        if (state_ptr) { state_ptr->job_is_submitted = is_async; }
 
-        if (QPL_STS_OK == status && qpl_path_auto == path) {
-            auto* state_ptr             = reinterpret_cast<qpl_hw_state*>(job::get_state(qpl_job_ptr));
-            state_ptr->job_is_submitted = true;
+        if (is_async && ml::dispatcher::sw_executor::get_instance().submit({&sw_execute_job_task, qpl_job_ptr})) {
+            return QPL_STS_OK;
         }
+
+        // Host executor is not used or its queues are full, execute the job in place
+        status = sw_execute_job_on_host(qpl_job_ptr);
+        job::update_sw_status(qpl_job_ptr, status);
+
+        if (state_ptr) { state_ptr->job_is_submitted = (QPL_STS_OK == status); }
     }
 
     return status;
 }
 
+/**
+ * @brief Common part of @ref qpl_submit_job and @ref qpl_execute_job,
+ * software path jobs are passed to the host executor if is_async is set and executed in place otherwise
+ */
+static qpl_status own_submit_job(qpl_job* const qpl_job_ptr, bool is_async) {
+    const qpl_status status = own_validate_job(qpl_job_ptr);
+    if (QPL_STS_OK != status) { return status; }
+
+    // The dispatcher is not touched by the software path jobs
+    const qpl_status hw_availability = own_is_accelerator_path(qpl_job_ptr) ? own_get_hw_availability() : QPL_STS_OK;
+
+    return own_submit_validated_job(qpl_job_ptr, is_async, hw_availability);
+}
+
+QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
+    return own_submit_job(qpl_job_ptr, true);
+}
+
 QPL_FUN("C" qpl_status, qpl_check_job, (qpl_job * qpl_job_ptr)) {
     using namespace qpl;
 
     QPL_BAD_PTR_RET(qpl_job_ptr);
     uint32_t status = QPL_STS_OK;
 
-    // If job was submitted on the Auto Path, and fell back to SW, return OK
+    // The job is owned by the host executor until its status is published
+    if (job::is_sw_job_in_progress(qpl_job_ptr)) { return QPL_STS_BEING_PROCESSED; }
+
+    if (qpl_path_software == qpl_job_ptr->data_ptr.path) { return job::get_sw_status(qpl_job_ptr); }
+
+    // If job was submitted on the Auto Path, and fell back to SW, return the status of the SW execution
     if (qpl_path_auto == qpl_job_ptr->data_ptr.path) {
         auto* state_ptr = reinterpret_cast<qpl_hw_state*>(job::get_state(qpl_job_ptr));
-        if (state_ptr->is_sw_fallback) { return QPL_STS_OK; }
+        if (state_ptr->is_sw_fallback) { return job::get_sw_status(qpl_job_ptr); }
     }
 
     if (job::is_supported_on_hardware(qpl_job_ptr)) { status = hw_check_job(qpl_job_ptr); }
@@ -210,10 +348,8 @@ QPL_FUN("C" qpl_status, qpl_check_job, (qpl_job * qpl_job_ptr)) {
         job::update_is_sw_fallback(qpl_job_ptr, true);
 
         // Execute job on SW path
-        const qpl_path_t path      = qpl_job_ptr->data_ptr.path;
-        qpl_job_ptr->data_ptr.path = qpl_path_software;
-        status                     = sw_execute_job(qpl_job_ptr);
-        qpl_job_ptr->data_ptr.path = path;
+        status = sw_execute_job_on_host(qpl_job_ptr);
+        job::update_sw_status(qpl_job_ptr, status);
     }
 
     return static_cast<qpl_status>(status);
@@ -226,10 +362,14 @@ QPL_FUN("C" qpl_status, qpl_wait_job, (qpl_job * qpl_job_ptr)) {
 
     uint32_t status = QPL_STS_OK;
 
-    // If job was submitted on the Auto Path, and fell back to SW, return OK
+    if (job::is_sw_job_in_progress(qpl_job_ptr)) { return sw_wait_job(qpl_job_ptr); }
+
+    if (qpl_path_software == qpl_job_ptr->data_ptr.path) { return job::get_sw_status(qpl_job_ptr); }
+
+    // If job was submitted on the Auto Path, and fell back to SW, return the status of the SW execution
     if (qpl_path_auto == qpl_job_ptr->data_ptr.path) {
         auto* state_ptr = reinterpret_cast<qpl_hw_state*>(job::get_state(qpl_job_ptr));
-        if (state_ptr->is_sw_fallback) { return QPL_STS_OK; }
+        if (state_ptr->is_sw_fallback) { return job::get_sw_status(qpl_job_ptr); }
     }
 
     // HW path doesn't support qpl_high_level compression ratio and ZLIB headers/trailers
@@ -244,25 +384,114 @@ QPL_FUN("C" qpl_status, qpl_wait_job, (qpl_job * qpl_job_ptr)) {
         job::update_is_sw_fallback(qpl_job_ptr, true);
 
         // Execute job on SW path
-        const qpl_path_t path      = qpl_job_ptr->data_ptr.path;
-        qpl_job_ptr->data_ptr.path = qpl_path_software;
-        status                     = sw_execute_job(qpl_job_ptr);
-        qpl_job_ptr->data_ptr.path = path;
+        status = sw_execute_job_on_host(qpl_job_ptr);
+        job::update_sw_status(qpl_job_ptr, status);
     }
 
     return static_cast<qpl_status>(status);
 }
 
+/**
+ * @brief Number of submission attempts of a batch job while the work queues are busy
+ */
+static constexpr uint32_t own_busy_submission_retry_limit = 1024U;
+
+QPL_FUN("C" qpl_status, qpl_submit_jobs, (qpl_job** jobs_ptr, uint32_t job_count)) {
+    QPL_BAD_PTR_RET(jobs_ptr);
+
+    // The whole batch is checked before the first submission, so a rejected batch has no jobs in flight
+    bool is_accelerator_batch = false;
+
+    for (uint32_t i = 0U; i < job_count; ++i) {
+        qpl_status status = own_validate_job_buffers(jobs_ptr[i]);
+        if (QPL_STS_OK != status) { return status; }
+
+        // The operation is checked once for every run of jobs with the same op and flags
+        const bool is_new_operation = (0U == i) || jobs_ptr[i]->op != jobs_ptr[i - 1U]->op ||
+                                      jobs_ptr[i]->flags != jobs_ptr[i - 1U]->flags;
+
+        if (is_new_operation) {
+            status = own_validate_job_operation(jobs_ptr[i]);
+            if (QPL_STS_OK != status) { return status; }
+        }
+
+        is_accelerator_batch |= own_is_accelerator_path(jobs_ptr[i]);
+    }
+
+    const qpl_status hw_availability = is_accelerator_batch ? own_get_hw_availability() : QPL_STS_OK;
+
+    for (uint32_t i = 0U; i < job_count; ++i) {
+        qpl_status status = own_submit_validated_job(jobs_ptr[i], true, hw_availability);
+
+        // The work queues are drained by the jobs submitted before, so the submission is retried in place
+        for (uint32_t retry = 0U; QPL_STS_QUEUES_ARE_BUSY_ERR == status && retry < own_busy_submission_retry_limit;
+             ++retry) {
+            status = own_submit_validated_job(jobs_ptr[i], true, hw_availability);
+        }
+
+        if (QPL_STS_OK != status) {
+            // Jobs in flight are completed to return the batch to the caller as a whole
+            static_cast<void>(qpl_wait_jobs(jobs_ptr, i));
+
+            return status;
+        }
+    }
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN("C" qpl_status, qpl_check_jobs, (qpl_job** jobs_ptr, uint32_t job_count, uint32_t* completed_count_ptr)) {
+    QPL_BAD_PTR_RET(jobs_ptr);
+    QPL_BAD_PTR_RET(completed_count_ptr);
+
+    // Completed jobs are never checked again, completion processing updates the job fields
+    while (*completed_count_ptr < job_count) {
+        const qpl_status status = qpl_check_job(jobs_ptr[*completed_count_ptr]);
+        if (QPL_STS_BEING_PROCESSED == status) { return status; }
+
+        *completed_count_ptr += 1U;
+
+        if (QPL_STS_OK != status) { return status; }
+    }
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN("C" qpl_status, qpl_wait_jobs, (qpl_job** jobs_ptr, uint32_t job_count)) {
+    QPL_BAD_PTR_RET(jobs_ptr);
+
+    qpl_status result = QPL_STS_OK;
+
+    for (uint32_t i = 0U; i < job_count; ++i) {
+        const qpl_status status = qpl_wait_job(jobs_ptr[i]);
+
+        if (QPL_STS_OK == result) { result = status; }
+    }
+
+    return result;
+}
+
 QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
     using namespace qpl;
 
     QPL_BAD_PTR_RET(qpl_job_ptr);
 
+    // Checked before any dispatch, the operation may need buffers the job doesn't have
+    if (!job::is_op_class_initialized(qpl_job_ptr)) { return QPL_STS_OPERATION_ERR; }
+
     if ((qpl_job_ptr->flags & QPL_FLAG_CANNED_MODE) && (qpl_job_ptr->huffman_table == nullptr))
         return QPL_STS_NULL_PTR_ERR;
 
-    qpl_status status = QPL_STS_OK;
-    qpl_path_t path   = qpl_job_ptr->data_ptr.path;
+    // Large scans are split between the accelerator and the host threads, the job is checked before it is split
+    if ((qpl_job_ptr->flags & QPL_FLAG_PARALLEL) && job::is_scan(qpl_job_ptr)) {
+        const qpl_status validation_status = own_validate_job(qpl_job_ptr);
+        if (QPL_STS_OK != validation_status) { return validation_status; }
+
+        if (is_parallel_scan(qpl_job_ptr)) { return static_cast<qpl_status>(perform_parallel_scan(qpl_job_ptr)); }
+    }
+
+    qpl_status       status = QPL_STS_OK;
+    const qpl_path_t path   = qpl_job_ptr->data_ptr.path;
 
     if ((qpl_path_hardware == path || qpl_path_auto == path)) {
         auto* state_ptr = reinterpret_cast<qpl_hw_state*>(job::get_state(qpl_job_ptr));
@@ -270,7 +499,7 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
         // Reset is_sw_fallback for the first job
         if (qpl_job_ptr->flags & QPL_FLAG_FIRST) { job::update_is_sw_fallback(qpl_job_ptr, false); }
 
-        if ((qpl_op_compress == qpl_job_ptr->op) && (qpl_high_level == qpl_job_ptr->level)) {
+        if (job::is_high_level_compression(qpl_job_ptr)) {
             if (qpl_path_hardware == path) {
                 return QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL;
             } else if (qpl_path_auto == path) {
@@ -293,6 +522,18 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
                 if (job::is_extract(qpl_job_ptr)) {
                     status = static_cast<qpl_status>(perform_extract(qpl_job_ptr, analytics_state_ptr->unpack_buf_ptr,
                                                                      analytics_state_ptr->unpack_buf_size));
+                } else if (job::is_scan_in_set(qpl_job_ptr)) {
+                    status = static_cast<qpl_status>(perform_scan_in_set(
+                            qpl_job_ptr, analytics_state_ptr->unpack_buf_ptr, analytics_state_ptr->unpack_buf_size,
+                            analytics_state_ptr->set_buf_ptr, analytics_state_ptr->set_buf_size));
+                } else if (job::is_scan_predicate(qpl_job_ptr)) {
+                    status = static_cast<qpl_status>(perform_scan_predicate(
+                            qpl_job_ptr, analytics_state_ptr->unpack_buf_ptr, analytics_state_ptr->unpack_buf_size,
+                            analytics_state_ptr->set_buf_ptr, analytics_state_ptr->set_buf_size));
+                } else if (job::is_bit_vector(qpl_job_ptr)) {
+                    status = static_cast<qpl_status>(perform_bit_vector(
+                            qpl_job_ptr, analytics_state_ptr->unpack_buf_ptr, analytics_state_ptr->unpack_buf_size,
+                            analytics_state_ptr->set_buf_ptr, analytics_state_ptr->set_buf_size));
                 } else if (job::is_scan(qpl_job_ptr)) {
                     status = static_cast<qpl_status>(perform_scan(qpl_job_ptr, analytics_state_ptr->unpack_buf_ptr,
                                                                   analytics_state_ptr->unpack_buf_size));
@@ -330,10 +571,8 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
 
         // Fallback to qpl_path_software
         if (state_ptr->is_sw_fallback) {
-            path                       = qpl_job_ptr->data_ptr.path;
-            qpl_job_ptr->data_ptr.path = qpl_path_software;
-            status                     = sw_execute_job(qpl_job_ptr);
-            qpl_job_ptr->data_ptr.path = path;
+            status = sw_execute_job_on_host(qpl_job_ptr);
+            job::update_sw_status(qpl_job_ptr, status);
 
             if (QPL_STS_OK == status && qpl_path_auto == qpl_job_ptr->data_ptr.path) {
                 auto* state_ptr             = reinterpret_cast<qpl_hw_state*>(job::get_state(qpl_job_ptr));
@@ -345,5 +584,5 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
     }
 
     // For qpl_path_software
-    return qpl_submit_job(qpl_job_ptr);
+    return own_submit_job(qpl_job_ptr, false);
 }
@@ -20,6 +20,7 @@
 #include "compression_operations/compression_state_t.h"
 #include "compression_operations/own_deflate_job.h" // @todo check if could be removed
 #include "filter_operations/analytics_state_t.h"
+#include "job.hpp"
 #include "legacy_hw_path/async_hw_api.h"
 #include "legacy_hw_path/hardware_state.h"
 #include "own_defs.h"
@@ -32,33 +33,102 @@
 #include "compression/inflate/inflate_state.hpp"
 #include "compression/verification/verification_state.hpp"
 
+/**
+ * @brief Returns size of the middle-layer states used by the given operation classes on the given path
+ *
+ * @note Compression verification decodes with its own state, so inflate_state is required only for
+ * decompression and analytics with @ref QPL_FLAG_DECOMPRESS_ENABLE. Operations of a job are executed one at
+ * a time, so all the classes share the same buffer. Match search tables of the levels 4-9 are reserved
+ * with @ref qpl_op_class_high_ratio_compression only.
+ */
+template <qpl::ml::execution_path_t path>
+static inline uint32_t own_get_middle_layer_buffer_size(uint32_t op_classes) noexcept {
+    namespace compression = qpl::ml::compression;
+
+    uint32_t size = 0U;
+
+    if (op_classes & qpl_op_class_compression) {
+        uint32_t deflate_size = compression::deflate_state<path>::get_buffer_size() +
+                                compression::verify_state<path>::get_buffer_size();
+
+        if constexpr (path == qpl::ml::execution_path_t::software) {
+            if (op_classes & qpl_op_class_high_ratio_compression) {
+                deflate_size += compression::deflate_state<path>::get_high_ratio_buffer_size();
+            }
+        }
+
+        const uint32_t huffman_only_size = compression::huffman_only_state<path>::get_buffer_size() +
+                                           compression::huffman_only_decompression_state<path>::get_buffer_size();
+
+        size = std::max(size, std::max(deflate_size, huffman_only_size));
+    }
+
+    if (op_classes & qpl_op_class_decompression) {
+        size = std::max(size, std::max(compression::inflate_state<path>::get_buffer_size(),
+                                       compression::huffman_only_decompression_state<path>::get_buffer_size()));
+    }
+
+    if (op_classes & qpl_op_class_analytics) {
+        size = std::max(size, compression::inflate_state<path>::get_buffer_size());
+    }
+
+    return size;
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t qpl_path);
-QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t qpl_path);
-QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t qpl_path);
-uint32_t            own_get_job_size_middle_layer_buffer(qpl_path_t qpl_path);
+QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t qpl_path, uint32_t op_classes);
+QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t qpl_path, uint32_t op_classes);
+QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t qpl_path, uint32_t op_classes);
+uint32_t            own_get_job_size_middle_layer_buffer(qpl_path_t qpl_path, uint32_t op_classes);
 
 QPL_INLINE void own_init_compress(qpl_job* qpl_job_ptr);
 QPL_INLINE void own_init_analytics(qpl_job* qpl_job_ptr);
 
+QPL_INLINE bool own_are_op_classes_valid(uint32_t op_classes) {
+    constexpr uint32_t known_op_classes = qpl_op_class_all | qpl_op_class_high_ratio_compression;
+
+    return 0U != op_classes && 0U == (op_classes & ~known_op_classes);
+}
+
+/**
+ * @brief High-ratio compression is the compression class with additional tables
+ */
+QPL_INLINE uint32_t own_expand_op_classes(uint32_t op_classes) {
+    if (op_classes & qpl_op_class_high_ratio_compression) { op_classes |= qpl_op_class_compression; }
+
+    return op_classes;
+}
+
 QPL_FUN(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t* job_size_ptr)) {
+    return qpl_get_job_size_by_class(qpl_path, qpl_op_class_all, job_size_ptr);
+}
+
+QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job* qpl_job_ptr)) {
+    return qpl_init_job_by_class(qpl_path, qpl_op_class_all, qpl_job_ptr);
+}
+
+QPL_FUN(qpl_status, qpl_get_job_size_by_class, (qpl_path_t qpl_path, uint32_t op_classes, uint32_t* job_size_ptr)) {
     using namespace qpl;
 
     QPL_BAD_PTR_RET(job_size_ptr);
     QPL_BADARG_RET(qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BADARG_RET(!own_are_op_classes_valid(op_classes), QPL_STS_INVALID_PARAM_ERR);
+
+    op_classes = own_expand_op_classes(op_classes);
 
     // qpl_job_ptr can have any alignment,
     // therefore need to add additional bytes to be able to align pointers
     *job_size_ptr = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT) + QPL_DEFAULT_ALIGNMENT;
 
     // add storage required for internal structures
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path, op_classes), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path, op_classes), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path, op_classes), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr +=
+            QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path, op_classes), QPL_DEFAULT_ALIGNMENT);
 
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
         *job_size_ptr += QPL_ALIGNED_SIZE(hw_get_job_size(), QPL_DEFAULT_ALIGNMENT);
@@ -67,19 +137,24 @@ QPL_FUN(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t* job_size_p
     return QPL_STS_OK;
 }
 
-QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job* qpl_job_ptr)) {
+QPL_FUN(qpl_status, qpl_init_job_by_class, (qpl_path_t qpl_path, uint32_t op_classes, qpl_job* qpl_job_ptr)) {
     using namespace qpl;
 
     QPL_BADARG_RET(qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
     QPL_BAD_PTR_RET(qpl_job_ptr);
+    QPL_BADARG_RET(!own_are_op_classes_valid(op_classes), QPL_STS_INVALID_PARAM_ERR);
+
+    op_classes = own_expand_op_classes(op_classes);
 
-    uint32_t       status         = QPL_STS_OK;
-    const uint32_t job_size       = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t comp_size      = QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t decomp_size    = QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t analytics_size = QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path), QPL_DEFAULT_ALIGNMENT);
+    uint32_t       status    = QPL_STS_OK;
+    const uint32_t job_size  = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT);
+    const uint32_t comp_size = QPL_ALIGNED_SIZE(own_get_job_size_compress(qpl_path, op_classes), QPL_DEFAULT_ALIGNMENT);
+    const uint32_t decomp_size =
+            QPL_ALIGNED_SIZE(own_get_job_size_decompress(qpl_path, op_classes), QPL_DEFAULT_ALIGNMENT);
+    const uint32_t analytics_size =
+            QPL_ALIGNED_SIZE(own_get_job_size_analytics(qpl_path, op_classes), QPL_DEFAULT_ALIGNMENT);
     const uint32_t middle_layer_buffer_size =
-            QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path), QPL_DEFAULT_ALIGNMENT);
+            QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(qpl_path, op_classes), QPL_DEFAULT_ALIGNMENT);
 
     core_sw::util::set_zeros((uint8_t*)qpl_job_ptr, job_size);
 
@@ -92,6 +167,7 @@ QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job* qpl_job_ptr)) {
     qpl_job_ptr->data_ptr.middle_layer_buffer_ptr = qpl_job_ptr->data_ptr.analytics_state_ptr + analytics_size;
     qpl_job_ptr->data_ptr.hw_state_ptr = qpl_job_ptr->data_ptr.middle_layer_buffer_ptr + middle_layer_buffer_size;
     qpl_job_ptr->data_ptr.path         = qpl_path;
+    qpl_job_ptr->data_ptr.op_classes   = op_classes;
 
 #ifdef __linux__
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
@@ -121,10 +197,10 @@ QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job* qpl_job_ptr)) {
     core_sw::util::set_zeros((uint8_t*)qpl_job_ptr->data_ptr.analytics_state_ptr, analytics_size);
     core_sw::util::set_zeros((uint8_t*)qpl_job_ptr->data_ptr.middle_layer_buffer_ptr, middle_layer_buffer_size);
 
-    // initialize internal structures
+    // initialize internal structures of the requested operations only
     // note: ml is just a raw buffer, so no need
-    own_init_compress(qpl_job_ptr);
-    own_init_analytics(qpl_job_ptr);
+    if (op_classes & qpl_op_class_compression) { own_init_compress(qpl_job_ptr); }
+    if (op_classes & qpl_op_class_analytics) { own_init_analytics(qpl_job_ptr); }
 
     return static_cast<qpl_status>(status);
 }
@@ -133,6 +209,9 @@ QPL_FUN(qpl_status, qpl_fini_job, (qpl_job * qpl_job_ptr)) {
     QPL_BAD_PTR_RET(qpl_job_ptr);
     uint32_t status = QPL_STS_OK;
 
+    // The job can't be released while it is executed asynchronously on the software path
+    if (qpl::job::is_sw_job_in_progress(qpl_job_ptr)) { qpl_wait_job(qpl_job_ptr); }
+
     if (qpl_path_software != qpl_job_ptr->data_ptr.path) {
         status = hw_accelerator_finalize(&((qpl_hw_state*)qpl_job_ptr->data_ptr.hw_state_ptr)->accel_context);
     }
@@ -145,16 +224,19 @@ QPL_FUN(qpl_status, qpl_fini_job, (qpl_job * qpl_job_ptr)) {
  *
  * @note Currently not in use
  */
-QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+QPL_INLINE uint32_t own_get_job_size_decompress(qpl_path_t UNREFERENCED_PARAMETER(qpl_path),
+                                                uint32_t UNREFERENCED_PARAMETER(op_classes)) {
     return 0;
 }
 
 /**
  * @brief Returns size of the legacy compression state
  *
- * @note Currently only stores middle_layer_compression_style
+ * @note Currently only stores middle_layer_compression_style and adler32, which are used by compression only
  */
-QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t UNREFERENCED_PARAMETER(qpl_path), uint32_t op_classes) {
+    if (!(op_classes & qpl_op_class_compression)) { return 0U; }
+
     return QPL_ALIGNED_SIZE(sizeof(own_compression_state_t), QPL_DEFAULT_ALIGNMENT);
 }
 
@@ -163,9 +245,11 @@ QPL_INLINE uint32_t own_get_job_size_compress(qpl_path_t UNREFERENCED_PARAMETER(
  *
  * @note Holds allocations required for performing various analytics operations.
  */
-QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER(qpl_path), uint32_t op_classes) {
     uint32_t size = 0U;
 
+    if (!(op_classes & qpl_op_class_analytics)) { return size; }
+
     size += QPL_ALIGNED_SIZE(sizeof(own_analytics_state_t), QPL_DEFAULT_ALIGNMENT);
     size += QPL_ALIGNED_SIZE(OWN_INFLATE_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
     size += QPL_ALIGNED_SIZE(OWN_UNPACK_BUF_SIZE, QPL_DEFAULT_ALIGNMENT);
@@ -183,41 +267,19 @@ QPL_INLINE uint32_t own_get_job_size_analytics(qpl_path_t UNREFERENCED_PARAMETER
  * inflate_state store internal structures needed for decompression with defaltes, etc.
  * Job structure currently is supposed to be used for either deflate or huffman only mode,
  * and not both at the same time, so it is not necessary to allocate memory required for both states,
- * hence the std::max usage below.
+ * hence the std::max usage in own_get_middle_layer_buffer_size.
  */
-uint32_t own_get_job_size_middle_layer_buffer(qpl_path_t UNREFERENCED_PARAMETER(qpl_path)) {
+uint32_t own_get_job_size_middle_layer_buffer(qpl_path_t qpl_path, uint32_t op_classes) {
     using namespace qpl;
 
     uint32_t size = 0U;
 
     if (qpl_path_software == qpl_path || qpl_path_auto == qpl_path) {
-        uint32_t deflate_size      = 0;
-        uint32_t huffman_only_size = 0;
-
-        deflate_size += ml::compression::deflate_state<ml::execution_path_t::software>::get_buffer_size();
-        deflate_size += ml::compression::verify_state<ml::execution_path_t::software>::get_buffer_size();
-        deflate_size += ml::compression::inflate_state<ml::execution_path_t::software>::get_buffer_size();
-
-        huffman_only_size += ml::compression::huffman_only_state<ml::execution_path_t::software>::get_buffer_size();
-        huffman_only_size +=
-                ml::compression::huffman_only_decompression_state<ml::execution_path_t::software>::get_buffer_size();
-
-        size += std::max(deflate_size, huffman_only_size);
+        size += own_get_middle_layer_buffer_size<ml::execution_path_t::software>(op_classes);
     }
 
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
-        uint32_t deflate_size      = 0;
-        uint32_t huffman_only_size = 0;
-
-        deflate_size += ml::compression::deflate_state<ml::execution_path_t::hardware>::get_buffer_size();
-        deflate_size += ml::compression::verify_state<ml::execution_path_t::hardware>::get_buffer_size();
-        deflate_size += ml::compression::inflate_state<ml::execution_path_t::hardware>::get_buffer_size();
-
-        huffman_only_size += ml::compression::huffman_only_state<ml::execution_path_t::hardware>::get_buffer_size();
-        huffman_only_size +=
-                ml::compression::huffman_only_decompression_state<ml::execution_path_t::hardware>::get_buffer_size();
-
-        size += std::max(deflate_size, huffman_only_size);
+        size += own_get_middle_layer_buffer_size<ml::execution_path_t::hardware>(op_classes);
     }
 
     return size;
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (private C++ API)
+ */
+
+#ifndef QPL_SOURCES_C_API_LANE_JOB_HPP_
+#define QPL_SOURCES_C_API_LANE_JOB_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#include "qpl/c_api/job.h"
+
+namespace qpl {
+
+/**
+ * @brief Job owned by a single lane of an operation that is split between the executor threads
+ *
+ * The job is finalized on destruction, so the lanes that are already initialized are released
+ * on any early return of the operation.
+ */
+class lane_job final {
+public:
+    lane_job() noexcept = default;
+
+    lane_job(const lane_job&) = delete;
+
+    auto operator=(const lane_job&) -> lane_job& = delete;
+
+    ~lane_job() noexcept { reset(); }
+
+    /**
+     * @brief Allocates the job of the given size and initializes it for the given operation classes
+     */
+    auto init(qpl_path_t path, uint32_t op_classes, uint32_t job_size) noexcept -> qpl_status {
+        reset();
+
+        buffer_.reset(new (std::nothrow) uint8_t[job_size]);
+        if (nullptr == buffer_) { return QPL_STS_NO_MEM_ERR; }
+
+        const qpl_status status = qpl_init_job_by_class(path, op_classes, get());
+
+        // A job that failed to get an accelerator context falls back to the software path and holds no resources
+        is_initialized_ = (QPL_STS_OK == status);
+
+        return status;
+    }
+
+    [[nodiscard]] auto get() const noexcept -> qpl_job* { return reinterpret_cast<qpl_job*>(buffer_.get()); }
+
+private:
+    void reset() noexcept {
+        if (is_initialized_) { qpl_fini_job(get()); }
+
+        is_initialized_ = false;
+    }
+
+    std::unique_ptr<uint8_t[]> buffer_         = nullptr;
+    bool                       is_initialized_ = false;
+};
+
+} // namespace qpl
+
+#endif //QPL_SOURCES_C_API_LANE_JOB_HPP_
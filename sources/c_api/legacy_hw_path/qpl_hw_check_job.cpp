@@ -483,6 +483,8 @@ extern "C" qpl_status hw_check_job(qpl_job* qpl_job_ptr) {
 
     job::update_output_stream(qpl_job_ptr, bytes_written, comp_ptr->output_bits);
 
+    if (job::is_filter(qpl_job_ptr)) { qpl_job_ptr->num_output_elements = job::get_output_elements(qpl_job_ptr); }
+
     // Update input stream
     uint32_t size = 0U;
     if (AD_STATUS_SUCCESS == comp_ptr->status) {
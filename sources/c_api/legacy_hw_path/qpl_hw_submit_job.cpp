@@ -238,7 +238,18 @@ static inline qpl_status own_bad_argument_validation(qpl_job* const job_ptr) {
         case qpl_op_scan_gt:
         case qpl_op_scan_ge:
         case qpl_op_scan_range:
-        case qpl_op_scan_not_range: OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_scan_eq>(job_ptr))
+        case qpl_op_scan_not_range: OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_scan_eq>(job_ptr)) break;
+
+        case qpl_op_scan_in_set: OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_scan_in_set>(job_ptr)) break;
+
+        case qpl_op_scan_predicate:
+            OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_scan_predicate>(job_ptr))
+            break;
+
+        case qpl_op_bit_and:
+        case qpl_op_bit_or:
+        case qpl_op_bit_and_not:
+        case qpl_op_bit_xor: OWN_QPL_CHECK_STATUS(job::validate_operation<qpl_op_bit_and>(job_ptr)) break;
 
         default: break;
     }
@@ -334,6 +345,15 @@ extern "C" qpl_status hw_submit_job(qpl_job* qpl_job_ptr) {
     own_job_fix_task_properties(qpl_job_ptr);
 
     switch (qpl_job_ptr->op) {
+        // The accelerator has no set lookup and bit-vector operations and can't evaluate predicate programs,
+        // the auto path executes such jobs on the host
+        case qpl_op_scan_in_set:
+        case qpl_op_scan_predicate:
+        case qpl_op_bit_and:
+        case qpl_op_bit_or:
+        case qpl_op_bit_and_not:
+        case qpl_op_bit_xor: return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+
         case qpl_op_extract:
             if (qpl_job_ptr->param_low > qpl_job_ptr->param_high) {
                 hw_iaa_completion_record_init_trivial_completion(&state_ptr->comp_ptr, 0U);
@@ -351,6 +371,9 @@ extern "C" qpl_status hw_submit_job(qpl_job* qpl_job_ptr) {
         case qpl_op_scan_ge:
         case qpl_op_scan_range:
         case qpl_op_scan_not_range:
+            // Elements wider than 32 bits are processed on the host only
+            HW_IMMEDIATELY_RET((ml::limits::max_bit_width < qpl_job_ptr->src1_bit_width),
+                               QPL_STS_NOT_SUPPORTED_MODE_ERR)
             HW_IMMEDIATELY_RET((std::max(qpl_job_ptr->available_in, qpl_job_ptr->available_out) > MAX_BUF_SIZE),
                                QPL_STS_BUFFER_TOO_LARGE_ERR);
             HW_IMMEDIATELY_RET((qpl_job_ptr->flags & QPL_FLAG_NO_HDRS) || (qpl_job_ptr->flags & QPL_FLAG_RND_ACCESS),
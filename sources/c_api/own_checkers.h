@@ -52,7 +52,9 @@ extern "C" {
     ((1ULL << qpl_op_decompress) | (1ULL << qpl_op_compress) | (1ULL << qpl_op_crc64) | (1ULL << qpl_op_extract) | \
      (1ULL << qpl_op_select) | (1ULL << qpl_op_expand) | (1ULL << qpl_op_scan_eq) | (1ULL << qpl_op_scan_ne) |     \
      (1ULL << qpl_op_scan_lt) | (1ULL << qpl_op_scan_le) | (1ULL << qpl_op_scan_gt) | (1ULL << qpl_op_scan_ge) |   \
-     (1ULL << qpl_op_scan_range) | (1ULL << qpl_op_scan_not_range))
+     (1ULL << qpl_op_scan_range) | (1ULL << qpl_op_scan_not_range) | (1ULL << qpl_op_scan_in_set) |                \
+     (1ULL << qpl_op_scan_predicate) | (1ULL << qpl_op_bit_and) | (1ULL << qpl_op_bit_or) |                        \
+     (1ULL << qpl_op_bit_and_not) | (1ULL << qpl_op_bit_xor))
 
 #define QPL_BAD_OP_RET(op) {QPL_BADARG_RET((0 == (((uint64_t)QPL_VALID_OP >> (op)) & 1)), QPL_STS_OPERATION_ERR)};
 
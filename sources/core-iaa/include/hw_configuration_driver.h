@@ -97,6 +97,8 @@ typedef uint64_t (*accfg_device_get_max_transfer_size_ptr)(accfg_dev* device);
 
 typedef uint64_t (*accfg_wq_get_max_transfer_size_ptr)(accfg_wq* wq);
 
+typedef uint64_t (*accfg_wq_get_size_ptr)(accfg_wq* wq);
+
 #ifdef __cplusplus
 }
 #endif
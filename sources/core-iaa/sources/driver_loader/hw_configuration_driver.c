@@ -42,6 +42,7 @@ static qpl_desc_t functions_table[] = {{NULL, "accfg_new"},
                                        {NULL, "accfg_wq_get_op_config"},
                                        {NULL, "accfg_device_get_max_transfer_size"},
                                        {NULL, "accfg_wq_get_max_transfer_size"},
+                                       {NULL, "accfg_wq_get_size"},
 
                                        // Terminate list/init
                                        {NULL, NULL}};
@@ -172,6 +173,10 @@ uint64_t accfg_wq_get_max_transfer_size(accfg_wq* wq) {
     return ((accfg_wq_get_max_transfer_size_ptr)functions_table[21].function)(wq);
 }
 
+uint64_t accfg_wq_get_size(accfg_wq* wq) {
+    return ((accfg_wq_get_size_ptr)functions_table[22].function)(wq);
+}
+
 /* ------ Internal functions implementation ------ */
 
 bool own_load_configuration_functions(void* driver_instance_ptr) {
@@ -35,11 +35,26 @@ unsigned long long _xgetbv(unsigned int index) { //NOLINT(bugprone-reserved-iden
 #define CPUID_AVX512DQ 0x00020000
 #define EXC_OSXSAVE    0x08000000 // 27th  bit
 
+#define CPUID_AVX2   0x00000020 // leaf 7, EBX
+#define CPUID_BMI1   0x00000008 // leaf 7, EBX
+#define CPUID_BMI2   0x00000100 // leaf 7, EBX
+#define CPUID_PCLMUL 0x00000002 // leaf 1, ECX
+#define CPUID_FMA    0x00001000 // leaf 1, ECX
+#define CPUID_MOVBE  0x00400000 // leaf 1, ECX
+#define CPUID_POPCNT 0x00800000 // leaf 1, ECX
+#define CPUID_AVX    0x10000000 // leaf 1, ECX
+#define CPUID_F16C   0x20000000 // leaf 1, ECX
+#define CPUID_LZCNT  0x00000020 // leaf 0x80000001, ECX
+
 // CPUID_AVX512_MASK covers all the instructions used in middle-layer.
 // Intel® Intelligent Storage Acceleration Library (Intel® ISA-L) component has
 // a standalone dispatching logic and has its own masks.
 #define CPUID_AVX512_MASK (CPUID_AVX512F | CPUID_AVX512CD | CPUID_AVX512VL | CPUID_AVX512BW | CPUID_AVX512DQ)
 
+// avx2 kernels are compiled for Haswell, so every extension the compiler may emit for that target is required
+#define CPUID_AVX2_LEAF7_MASK (CPUID_AVX2 | CPUID_BMI1 | CPUID_BMI2)
+#define CPUID_AVX2_LEAF1_MASK (CPUID_PCLMUL | CPUID_FMA | CPUID_MOVBE | CPUID_POPCNT | CPUID_AVX | CPUID_F16C)
+
 namespace qpl::core_sw::dispatcher {
 class kernel_dispatcher_singleton {
 public:
@@ -48,63 +63,99 @@ public:
 static kernel_dispatcher_singleton g_kernel_dispatcher_singleton;
 
 extern unpack_table_t px_unpack_table;
+extern unpack_table_t avx2_unpack_table;
 extern unpack_table_t avx512_unpack_table;
 
 extern pack_index_table_t px_pack_index_table;
+extern pack_index_table_t avx2_pack_index_table;
 extern pack_index_table_t avx512_pack_index_table;
 
 extern unpack_prle_table_t px_unpack_prle_table;
+extern unpack_prle_table_t avx2_unpack_prle_table;
 extern unpack_prle_table_t avx512_unpack_prle_table;
 
 extern scan_i_table_t px_scan_i_table;
+extern scan_i_table_t avx2_scan_i_table;
 extern scan_i_table_t avx512_scan_i_table;
 
 extern scan_table_t px_scan_table;
+extern scan_table_t avx2_scan_table;
 extern scan_table_t avx512_scan_table;
 
+extern scan_64u_i_table_t px_scan_64u_i_table;
+extern scan_64u_i_table_t avx2_scan_64u_i_table;
+extern scan_64u_i_table_t avx512_scan_64u_i_table;
+
+extern scan_bits_table_t px_scan_bits_table;
+extern scan_bits_table_t avx2_scan_bits_table;
+extern scan_bits_table_t avx512_scan_bits_table;
+
+extern scan_in_set_i_table_t px_scan_in_set_i_table;
+extern scan_in_set_i_table_t avx2_scan_in_set_i_table;
+extern scan_in_set_i_table_t avx512_scan_in_set_i_table;
+
+extern bit_vector_table_t px_bit_vector_table;
+extern bit_vector_table_t avx2_bit_vector_table;
+extern bit_vector_table_t avx512_bit_vector_table;
+
 extern pack_table_t px_pack_table;
+extern pack_table_t avx2_pack_table;
 extern pack_table_t avx512_pack_table;
 
 extern extract_table_t px_extract_table;
+extern extract_table_t avx2_extract_table;
 extern extract_table_t avx512_extract_table;
 
 extern extract_i_table_t px_extract_i_table;
+extern extract_i_table_t avx2_extract_i_table;
 extern extract_i_table_t avx512_extract_i_table;
 
 extern aggregates_table_t px_aggregates_table;
+extern aggregates_table_t avx2_aggregates_table;
 extern aggregates_table_t avx512_aggregates_table;
 
 extern select_table_t px_select_table;
+extern select_table_t avx2_select_table;
 extern select_table_t avx512_select_table;
 
 extern select_i_table_t px_select_i_table;
+extern select_i_table_t avx2_select_i_table;
 extern select_i_table_t avx512_select_i_table;
 
 extern expand_table_t px_expand_table;
+extern expand_table_t avx2_expand_table;
 extern expand_table_t avx512_expand_table;
 
 extern memory_copy_table_t px_memory_copy_table;
+extern memory_copy_table_t avx2_memory_copy_table;
 extern memory_copy_table_t avx512_memory_copy_table;
 
 extern zero_table_t px_zero_table;
+extern zero_table_t avx2_zero_table;
 extern zero_table_t avx512_zero_table;
 
 extern move_table_t px_move_table;
+extern move_table_t avx2_move_table;
 extern move_table_t avx512_move_table;
 
 extern crc64_table_t px_crc64_table;
+extern crc64_table_t avx2_crc64_table;
 extern crc64_table_t avx512_crc64_table;
 
 extern xor_checksum_table_t px_xor_checksum_table;
+extern xor_checksum_table_t avx2_xor_checksum_table;
 extern xor_checksum_table_t avx512_xor_checksum_table;
 
 extern deflate_table_t px_deflate_table;
+extern deflate_table_t avx2_deflate_table;
 extern deflate_table_t avx512_deflate_table;
 
 extern deflate_fix_table_t px_deflate_fix_table;
+extern deflate_fix_table_t avx2_deflate_fix_table;
 extern deflate_fix_table_t avx512_deflate_fix_table;
 
 extern setup_dictionary_table_t px_setup_dictionary_table;
+extern setup_dictionary_table_t avx2_setup_dictionary_table;
 extern setup_dictionary_table_t avx512_setup_dictionary_table;
 
 auto detect_platform() -> arch_t {
@@ -112,17 +163,25 @@ auto detect_platform() -> arch_t {
     int    cpu_info[4];
     cpuid(cpu_info, 7);
     const bool avx512_support_cpu = ((cpu_info[1] & CPUID_AVX512_MASK) == CPUID_AVX512_MASK);
+    const bool avx2_leaf7_support = ((cpu_info[1] & CPUID_AVX2_LEAF7_MASK) == CPUID_AVX2_LEAF7_MASK);
+
+    cpuid(cpu_info, static_cast<int>(0x80000001U));
+    const bool lzcnt_support = cpu_info[2] & CPUID_LZCNT;
 
     cpuid(cpu_info, 1);
     const bool os_uses_XSAVE_XSTORE = cpu_info[2] & EXC_OSXSAVE;
+    const bool avx2_leaf1_support   = ((cpu_info[2] & CPUID_AVX2_LEAF1_MASK) == CPUID_AVX2_LEAF1_MASK);
+    const bool avx2_support_cpu     = avx2_leaf7_support && avx2_leaf1_support && lzcnt_support;
 
     // Check if XGETBV enabled for application use
     if (os_uses_XSAVE_XSTORE) {
         const unsigned long long xcr_feature_mask = _xgetbv(0); //NOLINT(bugprone-reserved-identifier)
-        // Check if OPMASK state and ZMM state are enabled
-        if ((xcr_feature_mask & 0xe0) == 0xe0) {
-            // Check if XMM state and YMM state are enabled
-            if ((xcr_feature_mask & 0x6) == 0x6) {
+        // Check if XMM state and YMM state are enabled
+        if ((xcr_feature_mask & 0x6) == 0x6) {
+            // Check if AVX2 features are supported
+            if (avx2_support_cpu) { detected_platform = arch_t::avx2_arch; }
+            // Check if OPMASK state and ZMM state are enabled
+            if ((xcr_feature_mask & 0xe0) == 0xe0) {
                 // Check if AVX512 features are supported
                 if (avx512_support_cpu) { detected_platform = arch_t::avx512_arch; }
             }
@@ -134,8 +193,10 @@ auto detect_platform() -> arch_t {
 
 auto get_unpack_index(const uint32_t flag_be, const uint32_t bit_width) -> uint32_t {
     const uint32_t input_be_shift = (flag_be) ? 32U : 0U;
-    // Unpack function table contains 64 entries - starts from 1-32 bit-width for le_format, then 1-32 for BE input
-    const uint32_t unpack_index = input_be_shift + bit_width - 1U;
+    // Unpack function table contains 128 entries - starts from 1-32 bit-width for le_format, then 1-32 for BE input,
+    // then the same for 33-64 bit-width unpacked to 64u
+    const uint32_t unpack_index = (32U < bit_width) ? 64U + input_be_shift + bit_width - 33U
+                                                    : input_be_shift + bit_width - 1U;
 
     return unpack_index;
 }
@@ -168,23 +229,38 @@ auto get_scan_index(const uint32_t bit_width, const uint32_t scan_flavor_index)
     return scan_index;
 }
 
+auto get_scan_bits_index(const uint32_t flag_be, const uint32_t bit_width) -> uint32_t {
+    const uint32_t input_be_shift = (flag_be) ? 32U : 0U;
+    // Scan bits function table contains 64 entries - starts from 1-32 bit-width for le_format, then 1-32 for BE input
+    const uint32_t scan_bits_index = input_be_shift + bit_width - 1U;
+
+    return scan_bits_index;
+}
+
+auto get_scan_in_set_index(const uint32_t bit_width) -> uint32_t {
+    // Scan in set function table contains 3 entries for 8u, 16u & 32u unpacked data;
+    const uint32_t scan_in_set_index = BITS_2_DATA_TYPE_INDEX(bit_width);
+
+    return scan_in_set_index;
+}
+
 auto get_extract_index(const uint32_t bit_width) -> uint32_t {
-    // Extract function table contains 3 entries for 8u, 16u & 32u unpacked data;
-    const uint32_t extract_index = BITS_2_DATA_TYPE_INDEX(bit_width);
+    // Extract function table contains 4 entries for 8u, 16u, 32u & 64u unpacked data;
+    const uint32_t extract_index = BITS_2_WIDE_DATA_TYPE_INDEX(bit_width);
 
     return extract_index;
 }
 
 auto get_select_index(const uint32_t bit_width) -> uint32_t {
-    // Select function table contains 3 entries for 8u, 16u & 32u unpacked data;
-    const uint32_t select_index = BITS_2_DATA_TYPE_INDEX(bit_width);
+    // Select function table contains 4 entries for 8u, 16u, 32u & 64u unpacked data;
+    const uint32_t select_index = BITS_2_WIDE_DATA_TYPE_INDEX(bit_width);
 
     return select_index;
 }
 
 auto get_expand_index(const uint32_t bit_width) -> uint32_t {
-    // Expand function table contains 3 entries for 8u, 16u & 32u unpacked data;
-    const uint32_t expand_index = BITS_2_DATA_TYPE_INDEX(bit_width);
+    // Expand function table contains 4 entries for 8u, 16u, 32u & 64u unpacked data;
+    const uint32_t expand_index = BITS_2_WIDE_DATA_TYPE_INDEX(bit_width);
 
     return expand_index;
 }
@@ -200,8 +276,13 @@ auto get_pack_bits_index(const uint32_t flag_be, const uint32_t src_bit_width, c
         -> uint32_t {
     uint32_t       pack_array_index = src_bit_width - 1U;
     const uint32_t input_be_shift   = (flag_be) ? 35 : 0U; // 35
-    // Unpack function table contains 70 (2 * 35) entries - starts from 1-32 bit-width
-    // for le_format + 8u16u|8u32u|16u32u cases, then the same for BE input
+    // Unpack function table contains 134 (2 * 35 + 2 * 32) entries - starts from 1-32 bit-width
+    // for le_format + 8u16u|8u32u|16u32u cases, then the same for BE input,
+    // then 33-64 bit-width for le_format and BE input
+    if (32U < src_bit_width) {
+        // 64u elements have no nominal array output modification
+        return 70U + ((flag_be) ? 32U : 0U) + src_bit_width - 33U;
+    }
     if (out_bit_width) {
         // Apply output modification for nominal array output
         if (8U >= src_bit_width) {
@@ -250,7 +331,7 @@ auto get_pack_bits_index(const uint32_t flag_be, const uint32_t src_bit_width, c
 }
 
 auto get_aggregates_index(const uint32_t src_bit_width) -> uint32_t {
-    uint32_t aggregates_index = BITS_2_DATA_TYPE_INDEX(src_bit_width);
+    uint32_t aggregates_index = BITS_2_WIDE_DATA_TYPE_INDEX(src_bit_width);
     aggregates_index          = (1U == src_bit_width) ? 0U : aggregates_index + 1U;
 
     return aggregates_index;
@@ -280,6 +361,22 @@ auto kernels_dispatcher::get_scan_table() const noexcept -> const scan_table_t&
     return *scan_table_ptr_;
 }
 
+auto kernels_dispatcher::get_scan_64u_i_table() const noexcept -> const scan_64u_i_table_t& {
+    return *scan_64u_i_table_ptr_;
+}
+
+auto kernels_dispatcher::get_scan_bits_table() const noexcept -> const scan_bits_table_t& {
+    return *scan_bits_table_ptr_;
+}
+
+auto kernels_dispatcher::get_scan_in_set_i_table() const noexcept -> const scan_in_set_i_table_t& {
+    return *scan_in_set_i_table_ptr_;
+}
+
+auto kernels_dispatcher::get_bit_vector_table() const noexcept -> const bit_vector_table_t& {
+    return *bit_vector_table_ptr_;
+}
+
 auto kernels_dispatcher::get_aggregates_table() const noexcept -> const aggregates_table_t& {
     return *aggregates_table_ptr_;
 }
@@ -347,6 +444,10 @@ kernels_dispatcher::kernels_dispatcher() noexcept : arch_(detect_platform()) {
             pack_table_ptr_             = &avx512_pack_table;
             scan_i_table_ptr_           = &avx512_scan_i_table;
             scan_table_ptr_             = &avx512_scan_table;
+            scan_64u_i_table_ptr_       = &avx512_scan_64u_i_table;
+            scan_bits_table_ptr_        = &avx512_scan_bits_table;
+            scan_in_set_i_table_ptr_    = &avx512_scan_in_set_i_table;
+            bit_vector_table_ptr_       = &avx512_bit_vector_table;
             extract_table_ptr_          = &avx512_extract_table;
             extract_i_table_ptr_        = &avx512_extract_i_table;
             aggregates_table_ptr_       = &avx512_aggregates_table;
@@ -363,6 +464,37 @@ kernels_dispatcher::kernels_dispatcher() noexcept : arch_(detect_platform()) {
             setup_dictionary_table_ptr_ = &avx512_setup_dictionary_table;
             break;
         }
+        case arch_t::avx2_arch: {
+            // Hand-written AVX2 kernels cover scan, scan bits, scan in set, bit vector, 1..32-bit aggregates,
+            // LE unpack of 1..31-bit elements, memory operations and checksums. Pack, BE and 33..64-bit unpack,
+            // PRLE unpack, 64-bit scan and aggregates, extract, select, expand and deflate entries are the scalar
+            // px kernels compiled for Haswell.
+            unpack_table_ptr_           = &avx2_unpack_table;
+            unpack_prle_table_ptr_      = &avx2_unpack_prle_table;
+            pack_index_table_ptr_       = &avx2_pack_index_table;
+            pack_table_ptr_             = &avx2_pack_table;
+            scan_i_table_ptr_           = &avx2_scan_i_table;
+            scan_table_ptr_             = &avx2_scan_table;
+            scan_64u_i_table_ptr_       = &avx2_scan_64u_i_table;
+            scan_bits_table_ptr_        = &avx2_scan_bits_table;
+            scan_in_set_i_table_ptr_    = &avx2_scan_in_set_i_table;
+            bit_vector_table_ptr_       = &avx2_bit_vector_table;
+            extract_table_ptr_          = &avx2_extract_table;
+            extract_i_table_ptr_        = &avx2_extract_i_table;
+            aggregates_table_ptr_       = &avx2_aggregates_table;
+            select_table_ptr_           = &avx2_select_table;
+            select_i_table_ptr_         = &avx2_select_i_table;
+            expand_table_ptr_           = &avx2_expand_table;
+            memory_copy_table_ptr_      = &avx2_memory_copy_table;
+            zero_table_ptr_             = &avx2_zero_table;
+            move_table_ptr_             = &avx2_move_table;
+            crc64_table_ptr_            = &avx2_crc64_table;
+            xor_checksum_table_ptr_     = &avx2_xor_checksum_table;
+            deflate_table_ptr_          = &avx2_deflate_table;
+            deflate_fix_table_ptr_      = &avx2_deflate_fix_table;
+            setup_dictionary_table_ptr_ = &avx2_setup_dictionary_table;
+            break;
+        }
         default: {
             unpack_table_ptr_           = &px_unpack_table;
             unpack_prle_table_ptr_      = &px_unpack_prle_table;
@@ -370,6 +502,10 @@ kernels_dispatcher::kernels_dispatcher() noexcept : arch_(detect_platform()) {
             pack_table_ptr_             = &px_pack_table;
             scan_i_table_ptr_           = &px_scan_i_table;
             scan_table_ptr_             = &px_scan_table;
+            scan_64u_i_table_ptr_       = &px_scan_64u_i_table;
+            scan_bits_table_ptr_        = &px_scan_bits_table;
+            scan_in_set_i_table_ptr_    = &px_scan_in_set_i_table;
+            bit_vector_table_ptr_       = &px_bit_vector_table;
             extract_table_ptr_          = &px_extract_table;
             extract_i_table_ptr_        = &px_extract_i_table;
             aggregates_table_ptr_       = &px_aggregates_table;
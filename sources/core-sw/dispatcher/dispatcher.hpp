@@ -12,6 +12,7 @@
 #include <cstdint>
 
 #include "qplc_aggregates.h"
+#include "qplc_bit_vector.h"
 #include "qplc_checksum.h"
 #include "qplc_expand.h"
 #include "qplc_extract.h"
@@ -25,6 +26,8 @@
 
 #define BITS_2_DATA_TYPE_INDEX(x) (OWN_MIN_((((x)-1U) >> 3U), 2U))
 
+#define BITS_2_WIDE_DATA_TYPE_INDEX(x) ((32U < (x)) ? 3U : BITS_2_DATA_TYPE_INDEX(x))
+
 namespace qpl::core_sw::dispatcher {
 enum arch_t { px_arch = 0, avx2_arch = 1, avx512_arch = 2 };
 
@@ -38,6 +41,10 @@ auto get_unpack_prle_index(const uint32_t bit_width) -> uint32_t;
 
 auto get_scan_index(const uint32_t bit_width, const uint32_t scan_flavor_index) -> uint32_t;
 
+auto get_scan_bits_index(const uint32_t flag_be, const uint32_t bit_width) -> uint32_t;
+
+auto get_scan_in_set_index(const uint32_t bit_width) -> uint32_t;
+
 auto get_extract_index(const uint32_t bit_width) -> uint32_t;
 
 auto get_select_index(const uint32_t bit_width) -> uint32_t;
@@ -51,7 +58,7 @@ auto get_aggregates_index(const uint32_t src_bit_width) -> uint32_t;
 
 auto get_memory_copy_index(const uint32_t bit_width) -> uint32_t;
 
-using unpack_table_t = std::array<qplc_unpack_bits_t_ptr, 64>;
+using unpack_table_t = std::array<qplc_unpack_bits_t_ptr, 128>;
 
 using pack_index_table_t = std::array<qplc_pack_index_t_ptr, 8>;
 
@@ -60,26 +67,34 @@ using unpack_prle_table_t = std::array<qplc_unpack_prle_t_ptr, 3>;
 using scan_i_table_t = std::array<qplc_scan_i_t_ptr, 24>;
 using scan_table_t   = std::array<qplc_scan_t_ptr, 24>;
 
-using pack_table_t = std::array<qplc_pack_bits_t_ptr, 70>;
+using scan_64u_i_table_t = std::array<qplc_scan_64u_i_t_ptr, 8>;
+
+using scan_bits_table_t = std::array<qplc_scan_bits_t_ptr, 64>;
+
+using scan_in_set_i_table_t = std::array<qplc_scan_in_set_i_t_ptr, 3>;
+
+using bit_vector_table_t = std::array<qplc_bit_vector_t_ptr, 4>;
 
-using extract_table_t   = std::array<qplc_extract_t_ptr, 3>;
-using extract_i_table_t = std::array<qplc_extract_i_t_ptr, 3>;
+using pack_table_t = std::array<qplc_pack_bits_t_ptr, 134>;
 
-using aggregates_table_t = std::array<qplc_aggregates_t_ptr, 4>;
+using extract_table_t   = std::array<qplc_extract_t_ptr, 4>;
+using extract_i_table_t = std::array<qplc_extract_i_t_ptr, 4>;
 
-using select_table_t   = std::array<qplc_select_t_ptr, 3>;
-using select_i_table_t = std::array<qplc_select_i_t_ptr, 3>;
+using aggregates_table_t = std::array<qplc_aggregates_t_ptr, 5>;
 
-using expand_table_t = std::array<qplc_expand_t_ptr, 3>;
+using select_table_t   = std::array<qplc_select_t_ptr, 4>;
+using select_i_table_t = std::array<qplc_select_i_t_ptr, 4>;
+
+using expand_table_t = std::array<qplc_expand_t_ptr, 4>;
 
 using memory_copy_table_t = std::array<qplc_copy_t_ptr, 3>;
 using zero_table_t        = std::array<qplc_zero_t_ptr, 1>;
 using move_table_t        = std::array<qplc_move_t_ptr, 1>;
 
-using crc64_table_t        = std::array<qplc_crc64_t_ptr, 1>;
+using crc64_table_t        = std::array<void*, 2U>;
 using xor_checksum_table_t = std::array<qplc_xor_checksum_t_ptr, 1>;
 
-using deflate_table_t = std::array<void*, 3U>;
+using deflate_table_t = std::array<void*, 4U>;
 
 using deflate_fix_table_t = std::array<void*, 1U>;
 
@@ -111,6 +126,14 @@ public:
 
     [[nodiscard]] auto get_scan_table() const noexcept -> const scan_table_t&;
 
+    [[nodiscard]] auto get_scan_64u_i_table() const noexcept -> const scan_64u_i_table_t&;
+
+    [[nodiscard]] auto get_scan_bits_table() const noexcept -> const scan_bits_table_t&;
+
+    [[nodiscard]] auto get_scan_in_set_i_table() const noexcept -> const scan_in_set_i_table_t&;
+
+    [[nodiscard]] auto get_bit_vector_table() const noexcept -> const bit_vector_table_t&;
+
     [[nodiscard]] auto get_extract_table() const noexcept -> const extract_table_t&;
 
     [[nodiscard]] auto get_extract_i_table() const noexcept -> const extract_i_table_t&;
@@ -147,6 +170,10 @@ private:
     pack_table_t*             pack_table_ptr_             = nullptr;
     scan_i_table_t*           scan_i_table_ptr_           = nullptr;
     scan_table_t*             scan_table_ptr_             = nullptr;
+    scan_64u_i_table_t*       scan_64u_i_table_ptr_       = nullptr;
+    scan_bits_table_t*        scan_bits_table_ptr_        = nullptr;
+    scan_in_set_i_table_t*    scan_in_set_i_table_ptr_    = nullptr;
+    bit_vector_table_t*       bit_vector_table_ptr_       = nullptr;
     extract_table_t*          extract_table_ptr_          = nullptr;
     extract_i_table_t*        extract_i_table_ptr_        = nullptr;
     aggregates_table_t*       aggregates_table_ptr_       = nullptr;
@@ -12,6 +12,10 @@
  *
  * @details Function list:
  *          - @ref qplc_bit_aggregates_8u
+ *          - @ref qplc_aggregates_8u
+ *          - @ref qplc_aggregates_16u
+ *          - @ref qplc_aggregates_32u
+ *          - @ref qplc_aggregates_64u
  */
 
 /**
@@ -29,8 +33,8 @@
 extern "C" {
 #endif
 
-typedef void (*qplc_aggregates_t_ptr)(const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr,
-                                      uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr);
+typedef void (*qplc_aggregates_t_ptr)(const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr,
+                                      uint64_t* max_value_ptr, uint64_t* sum_ptr, uint32_t* index_ptr);
 
 /**
  * @name qplc_bit_aggregates_8u
@@ -51,8 +55,8 @@ typedef void (*qplc_aggregates_t_ptr)(const uint8_t* src_ptr, uint32_t length, u
  * @{
  */
 OWN_QPLC_API(void, qplc_bit_aggregates_8u,
-             (const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-              uint32_t* sum_ptr, uint32_t* index_ptr))
+             (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+              uint64_t* sum_ptr, uint32_t* index_ptr))
 /** @} */
 
 /**
@@ -67,21 +71,27 @@ OWN_QPLC_API(void, qplc_bit_aggregates_8u,
  * @param[in,out]  sum_ptr        pointer to the sum of all elements in the source vector
  * @param[in,out]  index_ptr      is not used (unreferenced parameter)
  *
+ * @note The sum is accumulated in 64 bits and wraps around only for 64-bit elements
+ *
  * @return
  *      - n/a (void).
  * @{
  */
 OWN_QPLC_API(void, qplc_aggregates_8u,
-             (const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-              uint32_t* sum_ptr, uint32_t* index_ptr))
+             (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+              uint64_t* sum_ptr, uint32_t* index_ptr))
 
 OWN_QPLC_API(void, qplc_aggregates_16u,
-             (const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-              uint32_t* sum_ptr, uint32_t* index_ptr))
+             (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+              uint64_t* sum_ptr, uint32_t* index_ptr))
 
 OWN_QPLC_API(void, qplc_aggregates_32u,
-             (const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-              uint32_t* sum_ptr, uint32_t* index_ptr))
+             (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+              uint64_t* sum_ptr, uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_aggregates_64u,
+             (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+              uint64_t* sum_ptr, uint32_t* index_ptr))
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @date 10/18/2026
+ *
+ * @defgroup SW_KERNELS_BIT_VECTOR_API Bit-Vector API
+ * @ingroup  SW_KERNELS_PRIVATE_API
+ * @{
+ * @brief Contains Intel® Query Processing Library (Intel® QPL) Core API for bit-vector operations
+ *
+ * @details Core APIs implement the following functionalities:
+ *      -   Bitwise AND, OR, AND NOT and XOR kernels for two LE bit-vectors with aggregates calculation.
+ *
+ */
+
+#include "qplc_defines.h"
+
+#ifndef QPLC_BIT_VECTOR_H__
+#define QPLC_BIT_VECTOR_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*qplc_bit_vector_t_ptr)(const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length,
+                                      uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
+                                      uint32_t* sum_ptr, uint32_t* index_ptr);
+
+/**
+ * @name qplc_bit_vector_<operation>
+ *
+ * @brief Bitwise operation kernels for two LE bit-vectors and bit-vector output
+ *
+ * @param[in]      src1_ptr       pointer to the first bit-vector
+ * @param[in]      src2_ptr       pointer to the second bit-vector
+ * @param[in]      length         length of the bit-vectors in bits
+ * @param[out]     dst_ptr        pointer to the resulting bit-vector, the bits of the last byte beyond length
+ *                                are cleared
+ * @param[in,out]  min_value_ptr  index of the first set bit of the result, updated if it is OWN_MAX_32U
+ * @param[in,out]  max_value_ptr  index of the last set bit of the result
+ * @param[in,out]  sum_ptr        number of the set bits of the result
+ * @param[in,out]  index_ptr      index of the first bit, advanced by length
+ *
+ * @note `and_not` kernel computes src1 & ~src2
+ * @note Index table: 0 - and, 1 - or, 2 - and_not, 3 - xor
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_bit_vector_and,
+             (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+              uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_bit_vector_or,
+             (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+              uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_bit_vector_and_not,
+             (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+              uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_bit_vector_xor,
+             (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+              uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr))
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QPLC_BIT_VECTOR_H__
+/** @} */
@@ -13,6 +13,8 @@
  *          - @ref qplc_crc32_byte_8u
  *          - @ref qplc_crc32_with_polynomial_32u
  *          - @ref qplc_xor_checksum_8u
+ *          - @ref qplc_crc64_init
+ *          - @ref qplc_crc64
  *
  */
 
@@ -25,8 +27,21 @@
 extern "C" {
 #endif
 
-typedef uint64_t (*qplc_crc64_t_ptr)(const uint8_t* src_ptr, uint32_t length, uint64_t polynomial, uint8_t be_flag,
-                                     uint8_t inversion_flag);
+/**
+ * @brief Constants of the CRC64 polynomial that don't depend on the data
+ */
+typedef struct {
+    uint64_t polynomial;           /**< CRC64 polynomial the constants are calculated for */
+    uint8_t  be_flag;              /**< Bit order the constants are calculated for */
+    uint64_t fold_constants[4];    /**< Remainders x^T mod P(x) used for 128-bit and 512-bit folding */
+    uint64_t barrett_constant;     /**< Quotient floor(x^128 / P(x)) used for Barrett reduction */
+    uint64_t lookup_table[8][256]; /**< Slicing-by-8 lookup tables, the first one is the byte lookup table */
+} qplc_crc64_constants_t;
+
+typedef void (*qplc_crc64_init_t_ptr)(uint64_t polynomial, uint8_t be_flag, qplc_crc64_constants_t* constants_ptr);
+
+typedef uint64_t (*qplc_crc64_t_ptr)(const uint8_t* src_ptr, uint32_t length,
+                                     const qplc_crc64_constants_t* constants_ptr, uint8_t inversion_flag);
 
 typedef uint32_t (*qplc_xor_checksum_t_ptr)(const uint8_t* buf, uint32_t len, uint32_t init_xor);
 
@@ -42,14 +57,22 @@ typedef uint32_t (*qplc_xor_checksum_t_ptr)(const uint8_t* buf, uint32_t len, ui
 OWN_QPLC_API(uint32_t, qplc_xor_checksum_8u, (const uint8_t* buf, uint32_t len, uint32_t init_xor))
 
 /*
- * @brief CRC64 checksum calculation for data buffer
+ * @brief Calculates the constants of CRC64 polynomial, the result can be reused by any number of @ref qplc_crc64 calls
  *
- * @param[in]  src_ptr          - pointer to the data buffer
- * @param[in]  length           - length of the buffer
  * @param[in]  polynomial       - 64-bit CRC polynomial
  * @param[in]  be_flag          - endianness flag:
  *                                  0 - little endian format;
  *                                  1 - big endian format;
+ * @param[out] constants_ptr    - pointer to the constants
+ */
+OWN_QPLC_API(void, qplc_crc64_init, (uint64_t polynomial, uint8_t be_flag, qplc_crc64_constants_t* constants_ptr))
+
+/*
+ * @brief CRC64 checksum calculation for data buffer
+ *
+ * @param[in]  src_ptr          - pointer to the data buffer
+ * @param[in]  length           - length of the buffer
+ * @param[in]  constants_ptr    - constants of the polynomial and endianness calculated by @ref qplc_crc64_init
  * @param[in]  inversion_flag   - bitwise inversion flag:
  *                                  0 - no inversion;
  *                                  1 - bitwise inversion of the initial and final CRC;
@@ -57,7 +80,8 @@ OWN_QPLC_API(uint32_t, qplc_xor_checksum_8u, (const uint8_t* buf, uint32_t len,
  * @return CRC64 checksum value
  */
 OWN_QPLC_API(uint64_t, qplc_crc64,
-             (const uint8_t* src_ptr, uint32_t length, uint64_t polynomial, uint8_t be_flag, uint8_t inversion_flag))
+             (const uint8_t* src_ptr, uint32_t length, const qplc_crc64_constants_t* constants_ptr,
+              uint8_t inversion_flag))
 
 #ifdef __cplusplus
 }
@@ -13,7 +13,7 @@
  * @brief Contains Intel® Query Processing Library (Intel® QPL) Core API for `Expand` operation
  *
  * @details Core APIs implement the following functionalities:
- *      -   Expand analytics operation out-of-place kernels for 8u, 16u and 32u input/output data.
+ *      -   Expand analytics operation out-of-place kernels for 8u, 16u, 32u and 64u input/output data.
  *
  */
 
@@ -32,7 +32,7 @@ typedef qplc_status_t (*qplc_expand_t_ptr)(const uint8_t* src1_ptr, uint32_t len
 /**
  * @name qplc_expand_<input bit-width>
  *
- * @brief Expand analytics operation out-of-place kernels for 8u, 16u and 32u input data
+ * @brief Expand analytics operation out-of-place kernels for 8u, 16u, 32u and 64u input data
  *
  * @param[in]      src1_ptr      pointer to source vector #1
  * @param[in]      length_1      length of source #1 vector in elements
@@ -57,6 +57,10 @@ OWN_QPLC_API(qplc_status_t, qplc_expand_16u,
 OWN_QPLC_API(qplc_status_t, qplc_expand_32u,
              (const uint8_t* src1_ptr, uint32_t length_1, const uint8_t* src2_ptr, uint32_t* length_2_ptr,
               uint8_t* dst_ptr))
+
+OWN_QPLC_API(qplc_status_t, qplc_expand_64u,
+             (const uint8_t* src1_ptr, uint32_t length_1, const uint8_t* src2_ptr, uint32_t* length_2_ptr,
+              uint8_t* dst_ptr))
 /** @} */
 
 #ifdef __cplusplus
@@ -15,8 +15,8 @@
  * @brief Contains Intel® Query Processing Library (Intel® QPL) Core API for `Extract` operation
  *
  * @details Core APIs implement the following functionalities:
- *      -   Extract analytics operation in-place kernels for 8u, 16u and 32u input data and 8u output.
- *      -   Extract analytics operation out-of-place kernels for 8u, 16u and 32u input data and 8u output.
+ *      -   Extract analytics operation in-place kernels for 8u, 16u, 32u and 64u input data and 8u output.
+ *      -   Extract analytics operation out-of-place kernels for 8u, 16u, 32u and 64u input data and 8u output.
  *
  */
 
@@ -38,7 +38,7 @@ typedef qplc_status_t (*qplc_extract_t_ptr)(const uint8_t* src_ptr, uint8_t* dst
 /**
  * @name qplc_extract_<input bit-width><output bit-width>_i
  *
- * @brief Extract analytics operation in-place kernels for 8u, 16u and 32u input data
+ * @brief Extract analytics operation in-place kernels for 8u, 16u, 32u and 64u input data
  *
  * @param[in,out]  src_dst_ptr  pointer to source and destination vector (in-place operation)
  * @param[in]      length       length of source and destination vector in elements
@@ -60,12 +60,15 @@ OWN_QPLC_API(qplc_status_t, qplc_extract_16u_i,
 
 OWN_QPLC_API(qplc_status_t, qplc_extract_32u_i,
              (uint8_t * src_dst_ptr, uint32_t length, uint32_t* index_ptr, uint32_t low_value, uint32_t high_value))
+
+OWN_QPLC_API(qplc_status_t, qplc_extract_64u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint32_t* index_ptr, uint32_t low_value, uint32_t high_value))
 /** @} */
 
 /**
  * @name qplc_extract_<input bit-width><output bit-width>
  *
- * @brief Extract analytics operation out-of-place kernels for 8u, 16u and 32u input data
+ * @brief Extract analytics operation out-of-place kernels for 8u, 16u, 32u and 64u input data
  *
  * @param[in]      src_ptr     pointer to source vector
  * @param[out]     dst_ptr     pointer to destination vector
@@ -91,6 +94,10 @@ OWN_QPLC_API(qplc_status_t, qplc_extract_16u,
 OWN_QPLC_API(qplc_status_t, qplc_extract_32u,
              (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t* index_ptr, uint32_t low_value,
               uint32_t high_value))
+
+OWN_QPLC_API(qplc_status_t, qplc_extract_64u,
+             (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t* index_ptr, uint32_t low_value,
+              uint32_t high_value))
 /** @} */
 
 #ifdef __cplusplus
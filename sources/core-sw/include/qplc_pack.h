@@ -19,6 +19,7 @@
  * @details Core pack APIs implement the following functionalities:
  *      -   Packing kernels for 8u, 16u and 32u input data and 1..32u output data;
  *      -   Packing kernels for 8u, 16u and 32u input data and 1..32u output data in BE format;
+ *      -   Packing kernels for 64u input data and 33..64u output data, LE or BE;
  *      -   Packing kernels for 8u input data and index output data in 8u, 16u or 32u representation;
  *      -   Packing kernels for 8u input data and index output data in 8u, 16u or 32u representation in BE format.
  *
@@ -45,15 +46,15 @@ typedef qplc_status_t (*qplc_pack_index_t_ptr)(const uint8_t* src_ptr, uint32_t
 /**
  * @name qplc_pack_<byte order><input bit-width><output bit-width>
  *
- * @brief Packing input data in 8u, 16u or 32u integers format to integers of any-bit-width, LE or BE.
+ * @brief Packing input data in 8u, 16u, 32u or 64u integers format to integers of any-bit-width, LE or BE.
  *
- * @param[in]     src_ptr        pointer to source vector in 8u, 16u or 32u integers format
+ * @param[in]     src_ptr        pointer to source vector in 8u, 16u, 32u or 64u integers format
  * @param[in]     num_elements number of source integers to pack
  * @param[out]    dst_ptr        pointer to packed data in any-bit-width format (LE or BE)
  * @param[in]     start_bit    bit position in the first byte of destination to start from
  *
- * @note Pack function table contains 70 (2 * 35) entries - starts from 1-32 bit-width for LE + [8u16u|8u32u|16u32u],
- *       then the same for BE output
+ * @note Pack function table contains 134 (2 * 35 + 2 * 32) entries - starts from 1-32 bit-width for LE
+ *       + [8u16u|8u32u|16u32u], then the same for BE output, then 33-64 bit-width for LE and BE output
  *
  * @return
  *      - n/a (void).
@@ -280,6 +281,198 @@ OWN_QPLC_API(void, qplc_pack_be_8u32u,
 
 OWN_QPLC_API(void, qplc_pack_be_16u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u33u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u34u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u35u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u36u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u37u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u38u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u39u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u40u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u41u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u42u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u43u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u44u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u45u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u46u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u47u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u48u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u49u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u50u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u51u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u52u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u53u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u54u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u55u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u56u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u57u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u58u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u59u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u60u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u61u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u62u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u63u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_64u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u33u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u34u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u35u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u36u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u37u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u38u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u39u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u40u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u41u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u42u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u43u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u44u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u45u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u46u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u47u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u48u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u49u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u50u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u51u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u52u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u53u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u54u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u55u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u56u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u57u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u58u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u59u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u60u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u61u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u62u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u63u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
+
+OWN_QPLC_API(void, qplc_pack_be_64u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit))
 /** @} */
 
 /**
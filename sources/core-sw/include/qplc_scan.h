@@ -17,6 +17,9 @@
  * @details Scan Core APIs implement the following functionalities:
  *      -   Scan analytics operation in-place kernels for 8u, 16u and 32u input data and 8u output.
  *      -   Scan analytics operation out-of-place kernels for 8u, 16u and 32u input data and 8u output.
+ *      -   Scan analytics operation in-place kernels for 64u input data and 8u output.
+ *      -   Fused scan kernels for packed LE or BE input data of any bit width and bit-vector output.
+ *      -   Scan in set analytics operation in-place kernels for 8u, 16u and 32u input data and 8u output.
  *
  */
 
@@ -31,9 +34,18 @@ extern "C" {
 
 typedef void (*qplc_scan_i_t_ptr)(uint8_t* src_dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value);
 
+typedef void (*qplc_scan_64u_i_t_ptr)(uint8_t* src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value);
+
 typedef void (*qplc_scan_t_ptr)(const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value,
                                 uint32_t high_value);
 
+typedef void (*qplc_scan_bits_t_ptr)(const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value,
+                                     uint8_t inversion_flag, uint8_t* dst_ptr, uint32_t* min_value_ptr,
+                                     uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr);
+
+typedef void (*qplc_scan_in_set_i_t_ptr)(uint8_t* src_dst_ptr, uint32_t length, const uint8_t* set_ptr,
+                                         uint32_t set_size);
+
 /**
  * @name qplc_scan_<comparison type><input bit-width><output bit-width>_i
  *
@@ -119,6 +131,48 @@ OWN_QPLC_API(void, qplc_scan_not_range_32u8u_i,
              (uint8_t * src_dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value))
 /** @} */
 
+/**
+ * @name qplc_scan_<comparison type>_64u8u_i
+ *
+ * @brief Scan analytics operation in-place kernels for 64u input data and 8u output.
+ *
+ * @param[in,out]  src_dst_ptr  pointer to source and destination vector (in-place operation)
+ * @param[in]      length       length of source and destination vector in elements
+ * @param[in]      low_value    low value for scan operation
+ * @param[in]      high_value   high value for scan operation
+ *
+ * @note Source-destination vector always contains result data in 8u format: 1 - condition is met,
+ *       0 - condition is not met
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_scan_eq_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_ne_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_lt_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_le_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_gt_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_ge_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_range_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_not_range_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value))
+/** @} */
+
 /**
  * @name qplc_scan_<comparison type><input bit-width><output bit-width>
  *
@@ -210,6 +264,384 @@ OWN_QPLC_API(void, qplc_scan_not_range_32u8u,
              (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value))
 /** @} */
 
+/**
+ * @name qplc_scan_bits_<input format><input bit-width>
+ *
+ * @brief Fused scan kernels: packed LE or BE input data of any bit width is compared directly and the result is
+ *        written as a bit-vector, bit-vector aggregates are accumulated at the same time.
+ *
+ * @param[in]      src_ptr         pointer to source vector in packed any-bit-width integers format
+ * @param[in]      length          length of source vector in elements
+ * @param[in]      low_value       low boundary of the range (inclusive)
+ * @param[in]      high_value      high boundary of the range (inclusive)
+ * @param[in]      inversion_flag  if set, the elements outside of the range are marked with '1'
+ * @param[out]     dst_ptr         pointer to destination bit-vector, must have space for length bits
+ * @param[in,out]  min_value_ptr   index of the first '1' element
+ * @param[in,out]  max_value_ptr   index of the last '1' element
+ * @param[in,out]  sum_ptr         number of '1' elements
+ * @param[in,out]  index_ptr       index of the first element, increased by length
+ *
+ * @note All scan operations are expressed as a range check: lt, le, gt, ge, eq and range mark the elements
+ *       low_value <= x <= high_value, ne and not range use the inverted result.
+ *       An empty range (low_value > high_value) gives no '1' elements.
+ * @note Source vector is read strictly within OWN_BITS_2_BYTE(length * bit-width) bytes.
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_scan_bits_1u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_2u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_3u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_4u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_5u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_6u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_7u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_8u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_9u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_10u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_11u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_12u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_13u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_14u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_15u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_16u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_17u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_18u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_19u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_20u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_21u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_22u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_23u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_24u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_25u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_26u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_27u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_28u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_29u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_30u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_31u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_32u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_1u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_2u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_3u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_4u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_5u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_6u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_7u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_8u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_9u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_10u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_11u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_12u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_13u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_14u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_15u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_16u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_17u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_18u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_19u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_20u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_21u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_22u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_23u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_24u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_25u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_26u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_27u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_28u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_29u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_30u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_31u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+
+OWN_QPLC_API(void, qplc_scan_bits_be_32u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr))
+/** @} */
+
+/**
+ * @name qplc_scan_in_set_<input bit-width><output bit-width>_i
+ *
+ * @brief Scan in set analytics operation in-place kernels for 8u, 16u and 32u input data and 8u output.
+ *
+ * @param[in,out]  src_dst_ptr  pointer to source and destination vector (in-place operation)
+ * @param[in]      length       length of source and destination vector in elements
+ * @param[in]      set_ptr      8u and 16u kernels: bitmap of the accepted values, bit (value % 8) of byte (value / 8)
+ *                              is set for every accepted value;
+ *                              32u kernel: accepted values in 32u format sorted in ascending order
+ * @param[in]      set_size     32u kernel: number of the accepted values, not used by 8u and 16u kernels
+ *
+ * @note The bitmap of 8u kernel covers all 256 values, the bitmap of 16u kernel covers all values of the source
+ *       and its size is a multiple of 4 bytes
+ * @note Source-destination vector always contains result data in 8u format: 1 - value is in the set,
+ *       0 - value is not in the set
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_scan_in_set_8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, const uint8_t* set_ptr, uint32_t set_size))
+
+OWN_QPLC_API(void, qplc_scan_in_set_16u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, const uint8_t* set_ptr, uint32_t set_size))
+
+OWN_QPLC_API(void, qplc_scan_in_set_32u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, const uint8_t* set_ptr, uint32_t set_size))
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
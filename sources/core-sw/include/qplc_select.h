@@ -13,8 +13,8 @@
  * @brief Contains Intel® Query Processing Library (Intel® QPL) Core API for `Select` operation
  *
  * @details Core APIs implement the following functionalities:
- *      -   Select analytics operation in-place kernels for 8u, 16u and 32u input/output data.
- *      -   Select analytics operation out-of-place kernels for 8u, 16u and 32u input/output data.
+ *      -   Select analytics operation in-place kernels for 8u, 16u, 32u and 64u input/output data.
+ *      -   Select analytics operation out-of-place kernels for 8u, 16u, 32u and 64u input/output data.
  *
  */
 
@@ -34,7 +34,7 @@ typedef qplc_status_t (*qplc_select_t_ptr)(const uint8_t* src_ptr, const uint8_t
 /**
  * @name qplc_select_<input bit-width>_i
  *
- * @brief Select analytics operation in-place kernels for 8u, 16u and 32u input data
+ * @brief Select analytics operation in-place kernels for 8u, 16u, 32u and 64u input data
  *
  * @param[in,out]  src_dst_ptr  pointer to source and destination vector (in-place operation)
  * @param[in]      src2_ptr     pointer to the source #2 vector (mask)
@@ -51,12 +51,14 @@ OWN_QPLC_API(qplc_status_t, qplc_select_8u_i, (uint8_t * src_dst_ptr, const uint
 OWN_QPLC_API(qplc_status_t, qplc_select_16u_i, (uint8_t * src_dst_ptr, const uint8_t* src2_ptr, uint32_t length))
 
 OWN_QPLC_API(qplc_status_t, qplc_select_32u_i, (uint8_t * src_dst_ptr, const uint8_t* src2_ptr, uint32_t length))
+
+OWN_QPLC_API(qplc_status_t, qplc_select_64u_i, (uint8_t * src_dst_ptr, const uint8_t* src2_ptr, uint32_t length))
 /** @} */
 
 /**
  * @name qplc_select_<input bit-width>
  *
- * @brief Select analytics operation out-of-place kernels for 8u, 16u and 32u input data
+ * @brief Select analytics operation out-of-place kernels for 8u, 16u, 32u and 64u input data
  *
  * @param[in]   src_ptr   pointer to source vector
  * @param[in]   src2_ptr  pointer to the source #2 vector (mask)
@@ -78,6 +80,9 @@ OWN_QPLC_API(qplc_status_t, qplc_select_16u,
 
 OWN_QPLC_API(qplc_status_t, qplc_select_32u,
              (const uint8_t* src_ptr, const uint8_t* src2_ptr, uint8_t* dst_ptr, uint32_t length))
+
+OWN_QPLC_API(qplc_status_t, qplc_select_64u,
+             (const uint8_t* src_ptr, const uint8_t* src2_ptr, uint8_t* dst_ptr, uint32_t length))
 /** @} */
 
 #ifdef __cplusplus
@@ -22,6 +22,7 @@
 #include "immintrin.h"
 #include "own_qplc_data.h"
 #include "own_qplc_defs.h"
+#include "qplc_checksum.h"
 
 #if defined _MSC_VER
 #if _MSC_VER <= 1916
@@ -140,74 +141,6 @@ OWN_OPT_FUN(uint32_t, k0_qplc_xor_checksum_8u, (const uint8_t* src_ptr, uint32_t
 #endif
 #endif
 
-OWN_QPLC_INLINE(void, k0_qplc_crc64_init, (uint64_t polynomial, uint64_t* remainders, uint64_t* barrett)) {
-    // 1. calculating lookup table
-    uint64_t lookup_table[256];
-    lookup_table[0] = 0U;
-    lookup_table[1] = polynomial;
-    uint64_t crc    = polynomial;
-
-    for (uint32_t major_idx = 2U; major_idx <= 128U; major_idx <<= 1U) {
-        // calculating powers of 2
-        crc                     = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-        lookup_table[major_idx] = crc;
-        // calculating other numbers based on rule:
-        // table[a ^ b] = table[a] ^ table[b]
-        for (uint32_t minor_idx = 1U; minor_idx < major_idx; ++minor_idx) {
-            lookup_table[major_idx + minor_idx] = crc ^ lookup_table[minor_idx];
-        }
-    }
-
-    // 2. calculating folding constants (x^T mod poly and x^(T + 64) mod poly)
-    // and constant for Barrett reduction (floor(x^128 / poly))
-    crc                    = polynomial;
-    uint64_t crc64_barrett = 0U;
-    for (uint32_t idx = 0; idx < 8U; ++idx) {
-        for (uint32_t j = 0; j < 8U; ++j) {
-            crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63U);
-            crc           = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-        }
-    }
-    *barrett      = crc64_barrett;
-    remainders[0] = crc; // x^128 mod poly
-
-    for (uint32_t idx = 8; idx < 16U; ++idx) {
-        crc = (crc << 8) ^ lookup_table[crc >> 56U];
-    }
-    remainders[1] = crc; // x^192 mod poly
-
-    for (uint32_t idx = 16; idx < 56U; ++idx) {
-        crc = (crc << 8) ^ lookup_table[crc >> 56U];
-    }
-    remainders[2] = crc; // x^512 mod poly
-
-    for (uint32_t idx = 56; idx < 64U; ++idx) {
-        crc = (crc << 8) ^ lookup_table[crc >> 56U];
-    }
-    remainders[3] = crc; // x^576 mod poly
-}
-
-OWN_QPLC_INLINE(void, k0_qplc_crc64_init_no_unroll, (uint64_t polynomial, uint64_t* remainders, uint64_t* barrett)) {
-    uint64_t crc = polynomial;
-
-    uint64_t crc64_barrett = 0U;
-    for (uint32_t idx = 0; idx < 8U; ++idx) {
-        for (uint32_t j = 0; j < 8U; ++j) {
-            crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63U);
-            crc           = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-        }
-    }
-    *barrett      = crc64_barrett;
-    remainders[0] = crc; // x^128 mod poly
-
-    for (uint32_t idx = 8; idx < 16U; ++idx) {
-        for (uint32_t j = 0; j < 8U; ++j) {
-            crc = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-        }
-    }
-    remainders[1] = crc; // x^192 mod poly
-}
-
 OWN_QPLC_INLINE(void, own_shift_two_lanes, (int offset, __m128i* _xmm0, __m128i* _xmm1)) {
     __m128i xmm0 = *_xmm0;
     __m128i xmm1 = *_xmm1;
@@ -298,7 +231,11 @@ OWN_QPLC_INLINE(uint64_t, own_get_inversion, (uint64_t polynomial)) {
 #endif
 #endif
 OWN_OPT_FUN(uint64_t, k0_qplc_crc64,
-            (const uint8_t* src_ptr, uint32_t length, uint64_t polynomial, uint8_t inversion_flag)) {
+            (const uint8_t* src_ptr, uint32_t length, const qplc_crc64_constants_t* constants_ptr,
+             uint8_t inversion_flag)) {
+    const uint64_t  polynomial = constants_ptr->polynomial;
+    const uint64_t* crc64_k    = constants_ptr->fold_constants;
+
     uint64_t crc            = 0U;
     uint64_t inversion_mask = 0U;
 
@@ -308,18 +245,11 @@ OWN_OPT_FUN(uint64_t, k0_qplc_crc64,
     }
 
     if (length >= 16U) {
-        uint64_t crc64_k[4];
-        uint64_t crc64_barrett = 0U;
-        if (length > 512U) {
-            k0_qplc_crc64_init(polynomial, crc64_k, &crc64_barrett);
-        } else {
-            k0_qplc_crc64_init_no_unroll(polynomial, crc64_k, &crc64_barrett);
-        }
         uint32_t tail = length % 16U;
 
         __m128i xmm0, xmm1, xmm2, srcmm;
         __m128i polymm          = _mm_set1_epi64x(polynomial);
-        __m128i barrett         = _mm_set1_epi64x(crc64_barrett);
+        __m128i barrett         = _mm_set1_epi64x(constants_ptr->barrett_constant);
         __m128i k8              = _mm_set1_epi64x(crc64_k[0]);
         __m128i k16             = _mm_set_epi64x(crc64_k[1], crc64_k[0]);
         __m128i inversion       = _mm_set_epi64x(inversion_mask, 0);
@@ -459,11 +389,10 @@ OWN_OPT_FUN(uint64_t, k0_qplc_crc64,
 
         crc ^= _mm_cvtsi128_si64(xmm0);
     } else {
+        const uint64_t* lookup_table = constants_ptr->lookup_table[0];
+
         for (uint32_t i = 0; i < length; ++i) {
-            crc ^= (uint64_t)(*src_ptr++) << 56U;
-            for (uint32_t j = 0; j < 8U; ++j) {
-                crc = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-            }
+            crc = lookup_table[src_ptr[i] ^ (crc >> 56U)] ^ (crc << 8U);
         }
         crc ^= inversion_mask;
     }
@@ -490,84 +419,6 @@ OWN_QPLC_INLINE(uint64_t, bit_reflect, (uint64_t x)) {
     return y;
 }
 
-OWN_QPLC_INLINE(void, k0_qplc_crc64_init_be, (uint64_t polynomial, uint64_t* remainders, uint64_t* barrett)) {
-    // 1. calculating lookup table
-    uint64_t lookup_table[256];
-    lookup_table[0] = 0U;
-    lookup_table[1] = polynomial;
-    uint64_t crc    = polynomial;
-
-    for (uint32_t major_idx = 2U; major_idx <= 128U; major_idx <<= 1U) {
-        // calculating powers of 2
-        crc                     = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-        lookup_table[major_idx] = crc;
-        // calculating other numbers based on rule:
-        // table[a ^ b] = table[a] ^ table[b]
-        for (uint32_t minor_idx = 1U; minor_idx < major_idx; ++minor_idx) {
-            lookup_table[major_idx + minor_idx] = crc ^ lookup_table[minor_idx];
-        }
-    }
-
-    // 2. calculating folding constants (x^T mod poly and x^(T + 64) mod poly)
-    // and constant for Barrett reduction (floor(x^128 / poly))
-    crc                    = polynomial;
-    uint64_t crc64_barrett = 0U;
-    for (uint32_t idx = 0; idx < 7U; ++idx) {
-        for (uint32_t j = 0; j < 8U; ++j) {
-            crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63U);
-            crc           = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-        }
-    }
-    for (uint32_t j = 0; j < 7U; ++j) {
-        crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63U);
-        crc           = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-    }
-
-    *barrett      = (crc64_barrett << 1) ^ (crc >> 63U);
-    remainders[0] = bit_reflect(crc); // x^(128-1) mod poly
-
-    for (uint32_t idx = 8; idx < 16U; ++idx) {
-        crc = (crc << 8) ^ lookup_table[crc >> 56U];
-    }
-    remainders[1] = bit_reflect(crc); // x^(192-1) mod poly
-
-    for (uint32_t idx = 16; idx < 56U; ++idx) {
-        crc = (crc << 8) ^ lookup_table[crc >> 56U];
-    }
-    remainders[2] = bit_reflect(crc); // x^(512-1) mod poly
-
-    for (uint32_t idx = 56; idx < 64U; ++idx) {
-        crc = (crc << 8) ^ lookup_table[crc >> 56U];
-    }
-    remainders[3] = bit_reflect(crc); // x^(576-1) mod poly
-}
-
-OWN_QPLC_INLINE(void, k0_qplc_crc64_init_no_unroll_be, (uint64_t polynomial, uint64_t* remainders, uint64_t* barrett)) {
-    uint64_t crc = polynomial;
-
-    uint64_t crc64_barrett = 0U;
-    for (uint32_t idx = 0; idx < 7U; ++idx) {
-        for (uint32_t j = 0; j < 8U; ++j) {
-            crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63U);
-            crc           = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-        }
-    }
-    for (uint32_t j = 0; j < 7U; ++j) {
-        crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63U);
-        crc           = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-    }
-
-    *barrett      = (crc64_barrett << 1) ^ (crc >> 63U);
-    remainders[0] = bit_reflect(crc); // x^(128-1) mod poly
-
-    for (uint32_t idx = 8; idx < 16U; ++idx) {
-        for (uint32_t j = 0; j < 8U; ++j) {
-            crc = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
-        }
-    }
-    remainders[1] = bit_reflect(crc); // x^192 mod poly
-}
-
 OWN_QPLC_INLINE(void, own_shift_two_lanes_be, (int offset, __m128i* _xmm0, __m128i* _xmm1)) {
     __m128i xmm0 = *_xmm0;
     __m128i xmm1 = *_xmm1;
@@ -647,7 +498,11 @@ OWN_QPLC_INLINE(void, own_shift_two_lanes_be, (int offset, __m128i* _xmm0, __m12
 #endif
 #endif
 OWN_OPT_FUN(uint64_t, k0_qplc_crc64_be,
-            (const uint8_t* src_ptr, uint32_t length, uint64_t polynomial, uint8_t inversion_flag)) {
+            (const uint8_t* src_ptr, uint32_t length, const qplc_crc64_constants_t* constants_ptr,
+             uint8_t inversion_flag)) {
+    const uint64_t  polynomial = constants_ptr->polynomial;
+    const uint64_t* crc64_k    = constants_ptr->fold_constants;
+
     uint64_t crc            = 0U;
     uint64_t inversion_mask = 0U;
 
@@ -658,19 +513,12 @@ OWN_OPT_FUN(uint64_t, k0_qplc_crc64_be,
     }
 
     if (length >= 16U) {
-        uint64_t crc64_k[4];
-        uint64_t crc64_barrett = 0U;
-        if (length > 512U) {
-            k0_qplc_crc64_init_be(polynomial, crc64_k, &crc64_barrett);
-        } else {
-            k0_qplc_crc64_init_no_unroll_be(polynomial, crc64_k, &crc64_barrett);
-        }
         uint32_t tail = length % 16U;
 
         __m128i xmm0, xmm1, xmm2, srcmm;
         uint8_t poly_ending = polynomial & 1U;
         __m128i polymm      = _mm_set1_epi64x(bit_reflect(polynomial) << 1);
-        __m128i barrett     = _mm_set1_epi64x((bit_reflect(crc64_barrett) << 1) | 1);
+        __m128i barrett     = _mm_set1_epi64x((bit_reflect(constants_ptr->barrett_constant) << 1) | 1);
         __m128i k8          = _mm_set1_epi64x(crc64_k[0]);
         __m128i k16         = _mm_set_epi64x(crc64_k[0], crc64_k[1]);
         __m128i inversion   = _mm_set_epi64x(0, inversion_mask);
@@ -795,12 +643,10 @@ OWN_OPT_FUN(uint64_t, k0_qplc_crc64_be,
 
         crc ^= _mm_extract_epi64(xmm0, 0x1);
     } else {
-        polynomial = bit_reflect(polynomial);
+        const uint64_t* lookup_table = constants_ptr->lookup_table[0];
+
         for (uint32_t i = 0; i < length; ++i) {
-            crc ^= (uint64_t)(*src_ptr++);
-            for (uint32_t j = 0; j < 8U; ++j) {
-                crc = (crc >> 1) ^ (-(int64_t)(crc & 1U) & polynomial);
-            }
+            crc = lookup_table[src_ptr[i] ^ (crc & 0xFFU)] ^ (crc >> 8U);
         }
         crc ^= inversion_mask;
     }
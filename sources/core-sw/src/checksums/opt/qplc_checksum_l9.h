@@ -0,0 +1,281 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+* @brief Contains AVX2 implementation of functions for checksum
+* @date 10/17/2026
+*
+*@details Function list :
+*               -@ref l9_qplc_xor_checksum_8u
+*               -@ref l9_qplc_crc64
+*               -@ref l9_qplc_crc64_be
+*/
+
+#ifndef OWN_CHECKSUM_L9_H
+#define OWN_CHECKSUM_L9_H
+
+#include "immintrin.h"
+#include "own_qplc_data.h"
+#include "own_qplc_defs.h"
+#include "qplc_checksum.h"
+
+OWN_OPT_FUN(uint32_t, l9_qplc_xor_checksum_8u, (const uint8_t* src_ptr, uint32_t length, uint32_t init_xor)) {
+    __m256i  ymm_sum_0 = _mm256_setzero_si256();
+    __m256i  ymm_sum_1 = _mm256_setzero_si256();
+    __m128i  xmm0;
+    uint64_t sum0     = 0U;
+    uint32_t checksum = 0U;
+    uint32_t len_crn  = length & (~63U);
+    uint32_t idx      = 0U;
+
+    for (; idx < len_crn; idx += 64U) {
+        ymm_sum_0 = _mm256_xor_si256(ymm_sum_0, _mm256_loadu_si256((__m256i const*)(src_ptr + idx)));
+        ymm_sum_1 = _mm256_xor_si256(ymm_sum_1, _mm256_loadu_si256((__m256i const*)(src_ptr + idx + 32U)));
+    }
+
+    if (length & 32U) {
+        ymm_sum_0 = _mm256_xor_si256(ymm_sum_0, _mm256_loadu_si256((__m256i const*)(src_ptr + idx)));
+        idx += 32U;
+    }
+
+    ymm_sum_0 = _mm256_xor_si256(ymm_sum_0, ymm_sum_1);
+    xmm0      = _mm_xor_si128(_mm256_extracti128_si256(ymm_sum_0, 1), _mm256_castsi256_si128(ymm_sum_0));
+    sum0      = (uint64_t)_mm_extract_epi64(xmm0, 1) ^ (uint64_t)_mm_cvtsi128_si64(xmm0);
+    checksum  = (uint32_t)(sum0 ^ (sum0 >> 32));
+    checksum ^= (checksum >> 16);
+    checksum = init_xor ^ (checksum & 0xffff);
+
+    for (; idx < (length & ~1U); idx += 2U) {
+        checksum ^= (uint32_t)(*(uint16_t*)(src_ptr + idx));
+    }
+
+    if (length & 1U) { checksum ^= (uint32_t)src_ptr[length - 1U]; }
+
+    return checksum;
+}
+
+OWN_QPLC_INLINE(uint64_t, l9_own_get_inversion, (uint64_t polynomial)) {
+    polynomial |= (polynomial << 1);
+    polynomial |= (polynomial << 2);
+    polynomial |= (polynomial << 4);
+    polynomial |= (polynomial << 8);
+    polynomial |= (polynomial << 16);
+    polynomial |= (polynomial << 32);
+
+    return polynomial;
+}
+
+OWN_QPLC_INLINE(uint64_t, l9_own_bit_reflect, (uint64_t x)) {
+    uint64_t y = bit_reverse_table[x >> 56];
+    y |= ((uint64_t)bit_reverse_table[(x >> 48) & 0xFF]) << 8;
+    y |= ((uint64_t)bit_reverse_table[(x >> 40) & 0xFF]) << 16;
+    y |= ((uint64_t)bit_reverse_table[(x >> 32) & 0xFF]) << 24;
+    y |= ((uint64_t)bit_reverse_table[(x >> 24) & 0xFF]) << 32;
+    y |= ((uint64_t)bit_reverse_table[(x >> 16) & 0xFF]) << 40;
+    y |= ((uint64_t)bit_reverse_table[(x >> 8) & 0xFF]) << 48;
+    y |= ((uint64_t)bit_reverse_table[(x >> 0) & 0xFF]) << 56;
+
+    return y;
+}
+
+/**
+ * @brief Folds the accumulator with the next 128 bits of data
+ */
+OWN_QPLC_INLINE(__m128i, l9_own_fold_128, (__m128i accumulator, __m128i data, __m128i constants)) {
+    const __m128i low  = _mm_clmulepi64_si128(accumulator, constants, 0x00);
+    const __m128i high = _mm_clmulepi64_si128(accumulator, constants, 0x11);
+
+    return _mm_xor_si128(_mm_xor_si128(low, data), high);
+}
+
+/**
+ * @brief CRC64 calculation with the most significant bit first, the data is folded with PCLMULQDQ
+ * 16 bytes at a time and the bytes that remain after the last 16-byte block are processed with the lookup table
+ */
+OWN_OPT_FUN(uint64_t, l9_qplc_crc64,
+            (const uint8_t* src_ptr, uint32_t length, const qplc_crc64_constants_t* constants_ptr,
+             uint8_t inversion_flag)) {
+    const uint64_t* crc64_k        = constants_ptr->fold_constants;
+    const uint64_t* lookup_table   = constants_ptr->lookup_table[0];
+    const uint64_t  inversion_mask = inversion_flag ? l9_own_get_inversion(constants_ptr->polynomial) : 0U;
+
+    uint64_t crc = inversion_mask;
+
+    if (length >= 16U) {
+        const uint32_t tail = length % 16U;
+
+        __m128i xmm0, xmm1, xmm2;
+        __m128i polymm          = _mm_set1_epi64x(constants_ptr->polynomial);
+        __m128i barrett         = _mm_set1_epi64x(constants_ptr->barrett_constant);
+        __m128i k8              = _mm_set1_epi64x(crc64_k[0]);
+        __m128i k16             = _mm_set_epi64x(crc64_k[1], crc64_k[0]);
+        __m128i high_lane_mask  = _mm_set_epi64x(-1, 0);
+        __m128i shuffle_le_mask = _mm_set_epi8(0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+                                               0x0C, 0x0D, 0x0E, 0x0F);
+
+        xmm0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src_ptr), shuffle_le_mask);
+        xmm0 = _mm_xor_si128(xmm0, _mm_set_epi64x(inversion_mask, 0));
+        src_ptr += 16U;
+
+        // 1. fold by 512bit until remaining length < 2 * 512bits.
+
+        if (length > 512U) {
+            __m128i k64 = _mm_set_epi64x(crc64_k[3], crc64_k[2]);
+            __m128i xmm4, xmm6;
+
+            xmm2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src_ptr), shuffle_le_mask);
+            xmm4 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src_ptr + 16U)), shuffle_le_mask);
+            xmm6 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src_ptr + 32U)), shuffle_le_mask);
+            src_ptr += 48U;
+
+            while (length >= 128U) {
+                xmm0 = l9_own_fold_128(
+                        xmm0, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src_ptr), shuffle_le_mask), k64);
+                xmm2 = l9_own_fold_128(
+                        xmm2, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src_ptr + 16U)), shuffle_le_mask),
+                        k64);
+                xmm4 = l9_own_fold_128(
+                        xmm4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src_ptr + 32U)), shuffle_le_mask),
+                        k64);
+                xmm6 = l9_own_fold_128(
+                        xmm6, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src_ptr + 48U)), shuffle_le_mask),
+                        k64);
+
+                src_ptr += 64U;
+                length -= 64U;
+            }
+
+            xmm0 = l9_own_fold_128(xmm0, xmm2, k16);
+            xmm0 = l9_own_fold_128(xmm0, xmm4, k16);
+            xmm0 = l9_own_fold_128(xmm0, xmm6, k16);
+
+            length -= 48U;
+        }
+
+        // 2. fold by 128bit until remaining length < 2 * 128bits.
+
+        while (length >= 32U) {
+            xmm0 = l9_own_fold_128(xmm0, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src_ptr), shuffle_le_mask),
+                                   k16);
+
+            src_ptr += 16U;
+            length -= 16U;
+        }
+
+        // 3. Apply 64 bits fold to 64 bits + 64 bits crc(64 zero bits)
+
+        xmm1 = _mm_clmulepi64_si128(xmm0, k8, 0x11);
+        xmm0 = _mm_slli_si128(xmm0, 8);
+        xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+        // 4. Barrett Reduction, the 65th bits of u and P(x) are applied by xor with the high lane
+        xmm1 = _mm_clmulepi64_si128(xmm0, barrett, 0x11);
+        xmm1 = _mm_xor_si128(xmm1, _mm_and_si128(xmm0, high_lane_mask));
+
+        xmm2 = _mm_clmulepi64_si128(xmm1, polymm, 0x11);
+        xmm2 = _mm_xor_si128(xmm2, _mm_and_si128(xmm1, high_lane_mask));
+
+        xmm0 = _mm_xor_si128(xmm0, xmm2);
+
+        crc    = (uint64_t)_mm_cvtsi128_si64(xmm0);
+        length = tail;
+    }
+
+    for (uint32_t i = 0U; i < length; ++i) {
+        crc = lookup_table[src_ptr[i] ^ (crc >> 56U)] ^ (crc << 8U);
+    }
+
+    return crc ^ inversion_mask;
+}
+
+/**
+ * @brief CRC64 calculation with the least significant bit first (reflected), the data is folded with PCLMULQDQ
+ * 16 bytes at a time and the bytes that remain after the last 16-byte block are processed with the lookup table
+ */
+OWN_OPT_FUN(uint64_t, l9_qplc_crc64_be,
+            (const uint8_t* src_ptr, uint32_t length, const qplc_crc64_constants_t* constants_ptr,
+             uint8_t inversion_flag)) {
+    const uint64_t* crc64_k        = constants_ptr->fold_constants;
+    const uint64_t* lookup_table   = constants_ptr->lookup_table[0];
+    const uint64_t  polynomial     = constants_ptr->polynomial;
+    const uint64_t  inversion_mask = inversion_flag ? l9_own_bit_reflect(l9_own_get_inversion(polynomial)) : 0U;
+
+    uint64_t crc = inversion_mask;
+
+    if (length >= 16U) {
+        const uint32_t tail = length % 16U;
+
+        __m128i xmm0, xmm1, xmm2;
+        __m128i polymm  = _mm_set1_epi64x(l9_own_bit_reflect(polynomial) << 1);
+        __m128i barrett = _mm_set1_epi64x((l9_own_bit_reflect(constants_ptr->barrett_constant) << 1) | 1);
+        __m128i k8      = _mm_set1_epi64x(crc64_k[0]);
+        __m128i k16     = _mm_set_epi64x(crc64_k[0], crc64_k[1]);
+
+        xmm0 = _mm_loadu_si128((const __m128i*)src_ptr);
+        xmm0 = _mm_xor_si128(xmm0, _mm_set_epi64x(0, inversion_mask));
+        src_ptr += 16U;
+
+        // 1. fold by 512bit until remaining length < 2 * 512bits.
+
+        if (length > 512U) {
+            __m128i k64 = _mm_set_epi64x(crc64_k[2], crc64_k[3]);
+            __m128i xmm4, xmm6;
+
+            xmm2 = _mm_loadu_si128((const __m128i*)src_ptr);
+            xmm4 = _mm_loadu_si128((const __m128i*)(src_ptr + 16U));
+            xmm6 = _mm_loadu_si128((const __m128i*)(src_ptr + 32U));
+            src_ptr += 48U;
+
+            while (length >= 128U) {
+                xmm0 = l9_own_fold_128(xmm0, _mm_loadu_si128((const __m128i*)src_ptr), k64);
+                xmm2 = l9_own_fold_128(xmm2, _mm_loadu_si128((const __m128i*)(src_ptr + 16U)), k64);
+                xmm4 = l9_own_fold_128(xmm4, _mm_loadu_si128((const __m128i*)(src_ptr + 32U)), k64);
+                xmm6 = l9_own_fold_128(xmm6, _mm_loadu_si128((const __m128i*)(src_ptr + 48U)), k64);
+
+                src_ptr += 64U;
+                length -= 64U;
+            }
+
+            xmm0 = l9_own_fold_128(xmm0, xmm2, k16);
+            xmm0 = l9_own_fold_128(xmm0, xmm4, k16);
+            xmm0 = l9_own_fold_128(xmm0, xmm6, k16);
+
+            length -= 48U;
+        }
+
+        // 2. fold by 128bit until remaining length < 2 * 128bits.
+
+        while (length >= 32U) {
+            xmm0 = l9_own_fold_128(xmm0, _mm_loadu_si128((const __m128i*)src_ptr), k16);
+
+            src_ptr += 16U;
+            length -= 16U;
+        }
+
+        // 3. Apply 64 bits fold to 64 bits + 64 bits crc(64 zero bits)
+
+        xmm1 = _mm_clmulepi64_si128(xmm0, k8, 0x00);
+        xmm0 = _mm_srli_si128(xmm0, 8);
+        xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+        // 4. Barrett Reduction of the reflected value
+        xmm1 = _mm_clmulepi64_si128(xmm0, barrett, 0x00);
+        xmm2 = _mm_clmulepi64_si128(xmm1, polymm, 0x00);
+        if (polynomial & 1U) { xmm2 = _mm_xor_si128(xmm2, _mm_slli_si128(xmm1, 8)); }
+        xmm0 = _mm_xor_si128(xmm0, xmm2);
+
+        crc    = (uint64_t)_mm_extract_epi64(xmm0, 0x1);
+        length = tail;
+    }
+
+    for (uint32_t i = 0U; i < length; ++i) {
+        crc = lookup_table[src_ptr[i] ^ (crc & 0xFFU)] ^ (crc >> 8U);
+    }
+
+    return crc ^ inversion_mask;
+}
+
+#endif // OWN_CHECKSUM_L9_H
@@ -13,16 +13,23 @@
  *          - @ref qplc_crc32_byte_8u
  *          - @ref qplc_crc32_with_polynomial_32u
  *          - @ref qplc_xor_checksum_8u
+ *          - @ref qplc_crc64_init
+ *          - @ref qplc_crc64
  *
  */
 
 #include "own_qplc_data.h"
 #include "own_qplc_defs.h"
+#include "qplc_checksum.h"
 
 #if PLATFORM >= K0
 
 #include "opt/qplc_checksum_k0.h"
 
+#elif PLATFORM >= L9
+
+#include "opt/qplc_checksum_l9.h"
+
 #endif
 
 /**
@@ -39,6 +46,8 @@ OWN_QPLC_FUN(uint32_t, qplc_xor_checksum_8u, (const uint8_t* src_ptr, uint32_t l
 #if !(defined _MSC_VER)
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_xor_checksum_8u)(src_ptr, length, init_xor);
+#elif PLATFORM >= L9
+    return CALL_OPT_FUNCTION(l9_qplc_xor_checksum_8u)(src_ptr, length, init_xor);
 #else
     uint32_t checksum = init_xor;
 
@@ -64,6 +73,8 @@ OWN_QPLC_FUN(uint32_t, qplc_xor_checksum_8u, (const uint8_t* src_ptr, uint32_t l
 #else
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_xor_checksum_8u)(src_ptr, length, init_xor);
+#elif PLATFORM >= L9
+    return CALL_OPT_FUNCTION(l9_qplc_xor_checksum_8u)(src_ptr, length, init_xor);
 #else
     uint32_t checksum = init_xor;
 
@@ -79,8 +90,6 @@ OWN_QPLC_FUN(uint32_t, qplc_xor_checksum_8u, (const uint8_t* src_ptr, uint32_t l
 #endif
 }
 
-#if PLATFORM < K0
-
 /**
  * @brief helper for bits/bytes reflecting
  */
@@ -100,43 +109,121 @@ static uint64_t own_bit_byte_swap_64(uint64_t x) {
 }
 
 /**
- * @brief table initializer
+ * @brief Slicing-by-8 tables initializer, table[k][i] is the CRC of the byte i followed by k zero bytes
  */
-static void own_crc64_init_lookup_table(uint64_t* table, uint64_t polynomial, uint8_t be_flag) {
+static void own_crc64_init_lookup_tables(uint64_t (*table)[256], uint64_t polynomial, uint8_t be_flag) {
     uint64_t crc = 0U;
-    uint64_t i   = 0U;
-    uint32_t j   = 0U;
 
-    table[0] = 0;
+    table[0][0] = 0;
 
     if (be_flag) {
         polynomial = own_bit_byte_swap_64(polynomial);
-        for (i = 1; i < 256; i++) {
+        for (uint32_t i = 1; i < 256; i++) {
             crc = i;
-            for (j = 0; j < 8; j++) {
-                if (crc & 0x0000000000000001ULL) {
-                    crc = (crc >> 1) ^ polynomial;
-                } else {
-                    crc = (crc >> 1);
-                }
+            for (uint32_t j = 0; j < 8; j++) {
+                crc = (crc >> 1) ^ (-(int64_t)(crc & 1U) & polynomial);
+            }
+            table[0][i] = crc;
+        }
+
+        for (uint32_t k = 1; k < 8; k++) {
+            for (uint32_t i = 0; i < 256; i++) {
+                table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF];
             }
-            table[i] = crc;
         }
     } else {
-        for (i = 1; i < 256; i++) {
-            crc = i << 56;
-            for (j = 0; j < 8; j++) {
-                if (crc & 0x8000000000000000ULL) {
-                    crc = (crc << 1) ^ polynomial;
-                } else {
-                    crc = (crc << 1);
-                }
+        for (uint32_t i = 1; i < 256; i++) {
+            crc = (uint64_t)i << 56;
+            for (uint32_t j = 0; j < 8; j++) {
+                crc = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
+            }
+            table[0][i] = crc;
+        }
+
+        for (uint32_t k = 1; k < 8; k++) {
+            for (uint32_t i = 0; i < 256; i++) {
+                table[k][i] = (table[k - 1][i] << 8) ^ table[0][table[k - 1][i] >> 56];
             }
-            table[i] = crc;
         }
     }
 }
 
+/**
+ * @brief Folding and Barrett reduction constants initializer
+ *
+ * @details Calculates x^T mod P(x) for T = 128, 192, 512, 576 and floor(x^128 / P(x)). In case of the reflected
+ *          (big endian) bit order the remainders are calculated for T - 1 and reflected.
+ */
+static void own_crc64_init_fold_constants(uint64_t polynomial, uint8_t be_flag, uint64_t* remainders,
+                                          uint64_t* barrett) {
+    // 1. calculating lookup table
+    uint64_t lookup_table[256];
+    lookup_table[0] = 0U;
+    lookup_table[1] = polynomial;
+    uint64_t crc    = polynomial;
+
+    for (uint32_t major_idx = 2U; major_idx <= 128U; major_idx <<= 1U) {
+        // calculating powers of 2
+        crc                     = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
+        lookup_table[major_idx] = crc;
+        // calculating other numbers based on rule:
+        // table[a ^ b] = table[a] ^ table[b]
+        for (uint32_t minor_idx = 1U; minor_idx < major_idx; ++minor_idx) {
+            lookup_table[major_idx + minor_idx] = crc ^ lookup_table[minor_idx];
+        }
+    }
+
+    // 2. calculating folding constants (x^T mod poly and x^(T + 64) mod poly)
+    // and constant for Barrett reduction (floor(x^128 / poly))
+    const uint32_t bit_steps     = be_flag ? 63U : 64U;
+    uint64_t       crc64_barrett = 0U;
+
+    crc = polynomial;
+    for (uint32_t idx = 0; idx < bit_steps; ++idx) {
+        crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63U);
+        crc           = (crc << 1) ^ (-(int64_t)(crc >> 63U) & polynomial);
+    }
+    if (be_flag) { crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63U); }
+
+    *barrett      = crc64_barrett;
+    remainders[0] = be_flag ? own_bit_byte_swap_64(crc) : crc; // x^128 mod poly
+
+    for (uint32_t idx = 8; idx < 16U; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56U];
+    }
+    remainders[1] = be_flag ? own_bit_byte_swap_64(crc) : crc; // x^192 mod poly
+
+    for (uint32_t idx = 16; idx < 56U; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56U];
+    }
+    remainders[2] = be_flag ? own_bit_byte_swap_64(crc) : crc; // x^512 mod poly
+
+    for (uint32_t idx = 56; idx < 64U; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56U];
+    }
+    remainders[3] = be_flag ? own_bit_byte_swap_64(crc) : crc; // x^576 mod poly
+}
+
+/*
+ * @brief Calculation of the constants of CRC64 polynomial
+ *
+ * @param[in]  polynomial       - 64-bit CRC polynomial
+ * @param[in]  be_flag          - endianness flag:
+ *                                  0 - little endian format;
+ *                                  1 - big endian format;
+ * @param[out] constants_ptr    - pointer to the constants
+ */
+OWN_QPLC_FUN(void, qplc_crc64_init, (uint64_t polynomial, uint8_t be_flag, qplc_crc64_constants_t* constants_ptr)) {
+    constants_ptr->polynomial = polynomial;
+    constants_ptr->be_flag    = be_flag;
+
+    own_crc64_init_lookup_tables(constants_ptr->lookup_table, polynomial, be_flag);
+    own_crc64_init_fold_constants(polynomial, be_flag, constants_ptr->fold_constants,
+                                  &constants_ptr->barrett_constant);
+}
+
+#if PLATFORM < L9
+
 /**
  * @brief CRC64 initializer
  */
@@ -156,30 +243,47 @@ static uint64_t own_crc64_init_crc(uint64_t polynomial, uint8_t be_flag, uint8_t
 }
 
 /**
- * @brief CRC64 calculator
+ * @brief Loads 8 bytes so that the first byte becomes the most significant one
  */
-static uint64_t own_crc64_update(uint8_t data, uint64_t* lookup_table, uint64_t crc, uint8_t be_flag) {
-    if (be_flag) {
-        return lookup_table[data ^ (crc & 0xFF)] ^ (crc >> 8);
-    } else {
-        return lookup_table[data ^ (crc >> 56)] ^ (crc << 8);
-    }
+static inline uint64_t own_load_be_64u(const uint8_t* src_ptr) {
+    const uint64_t low  = qplc_swap_bytes_32u(*(const uint32_t*)src_ptr);
+    const uint64_t high = qplc_swap_bytes_32u(*(const uint32_t*)(src_ptr + 4U));
+
+    return (low << 32U) | high;
 }
 
 /**
- * @brief Final CRC64 step
+ * @brief Slicing-by-8 CRC64 calculator
  */
-static uint64_t own_crc64_finalize(uint64_t crc, uint64_t polynomial, uint8_t be_flag, uint8_t inversion_flag) {
-    if (!inversion_flag) { return crc; }
-    polynomial |= (polynomial << 1);
-    polynomial |= (polynomial << 2);
-    polynomial |= (polynomial << 4);
-    polynomial |= (polynomial << 8);
-    polynomial |= (polynomial << 16);
-    polynomial |= (polynomial << 32);
-    if (!be_flag) { return crc ^ polynomial; }
+static uint64_t own_crc64_update(const uint8_t* src_ptr, uint32_t length, const uint64_t (*table)[256], uint64_t crc,
+                                 uint8_t be_flag) {
+    if (be_flag) {
+        for (; length >= 8U; length -= 8U, src_ptr += 8U) {
+            const uint64_t data = crc ^ *(const uint64_t*)src_ptr;
+
+            crc = table[7][data & 0xFF] ^ table[6][(data >> 8) & 0xFF] ^ table[5][(data >> 16) & 0xFF] ^
+                  table[4][(data >> 24) & 0xFF] ^ table[3][(data >> 32) & 0xFF] ^ table[2][(data >> 40) & 0xFF] ^
+                  table[1][(data >> 48) & 0xFF] ^ table[0][data >> 56];
+        }
+
+        for (uint32_t i = 0; i < length; i++) {
+            crc = table[0][src_ptr[i] ^ (crc & 0xFF)] ^ (crc >> 8);
+        }
+    } else {
+        for (; length >= 8U; length -= 8U, src_ptr += 8U) {
+            const uint64_t data = crc ^ own_load_be_64u(src_ptr);
 
-    return crc ^ own_bit_byte_swap_64(polynomial);
+            crc = table[7][data >> 56] ^ table[6][(data >> 48) & 0xFF] ^ table[5][(data >> 40) & 0xFF] ^
+                  table[4][(data >> 32) & 0xFF] ^ table[3][(data >> 24) & 0xFF] ^ table[2][(data >> 16) & 0xFF] ^
+                  table[1][(data >> 8) & 0xFF] ^ table[0][data & 0xFF];
+        }
+
+        for (uint32_t i = 0; i < length; i++) {
+            crc = table[0][src_ptr[i] ^ (crc >> 56)] ^ (crc << 8);
+        }
+    }
+
+    return crc;
 }
 
 #endif
@@ -189,10 +293,7 @@ static uint64_t own_crc64_finalize(uint64_t crc, uint64_t polynomial, uint8_t be
  *
  * @param[in]  src_ptr          - pointer to the data buffer
  * @param[in]  length           - length of the buffer
- * @param[in]  polynomial       - 64-bit CRC polynomial
- * @param[in]  be_flag          - endianness flag:
- *                                  0 - little endian format;
- *                                  1 - big endian format;
+ * @param[in]  constants_ptr    - constants of the polynomial and endianness calculated by @ref qplc_crc64_init
  * @param[in]  inversion_flag   - bitwise inversion flag:
  *                                  0 - no inversion;
  *                                  1 - bitwise inversion of the initial and final CRC;
@@ -200,27 +301,26 @@ static uint64_t own_crc64_finalize(uint64_t crc, uint64_t polynomial, uint8_t be
  * @return CRC64 checksum value
  */
 OWN_QPLC_FUN(uint64_t, qplc_crc64,
-             (const uint8_t* src_ptr, uint32_t length, uint64_t polynomial, uint8_t be_flag, uint8_t inversion_flag)) {
-    uint64_t crc = 0U;
+             (const uint8_t* src_ptr, uint32_t length, const qplc_crc64_constants_t* constants_ptr,
+              uint8_t inversion_flag)) {
 #if PLATFORM >= K0
-    if (be_flag) {
-        crc = CALL_OPT_FUNCTION(k0_qplc_crc64_be)(src_ptr, length, polynomial, inversion_flag);
-        return crc;
+    if (constants_ptr->be_flag) {
+        return CALL_OPT_FUNCTION(k0_qplc_crc64_be)(src_ptr, length, constants_ptr, inversion_flag);
+    } else {
+        return CALL_OPT_FUNCTION(k0_qplc_crc64)(src_ptr, length, constants_ptr, inversion_flag);
+    }
+#elif PLATFORM >= L9
+    if (constants_ptr->be_flag) {
+        return CALL_OPT_FUNCTION(l9_qplc_crc64_be)(src_ptr, length, constants_ptr, inversion_flag);
     } else {
-        crc = CALL_OPT_FUNCTION(k0_qplc_crc64)(src_ptr, length, polynomial, inversion_flag);
-        return crc;
+        return CALL_OPT_FUNCTION(l9_qplc_crc64)(src_ptr, length, constants_ptr, inversion_flag);
     }
 #else
-    uint64_t lookup_table[256];
-
-    own_crc64_init_lookup_table(lookup_table, polynomial, be_flag);
-    crc = own_crc64_init_crc(polynomial, be_flag, inversion_flag);
+    const uint8_t  be_flag        = constants_ptr->be_flag;
+    const uint64_t inversion_mask = own_crc64_init_crc(constants_ptr->polynomial, be_flag, inversion_flag);
 
-    for (uint32_t i = 0; i < length; i++) {
-        crc = own_crc64_update(src_ptr[i], lookup_table, crc, be_flag);
-    }
+    uint64_t crc = own_crc64_update(src_ptr, length, constants_ptr->lookup_table, inversion_mask, be_flag);
 
-    crc = own_crc64_finalize(crc, polynomial, be_flag, inversion_flag);
-    return crc;
+    return crc ^ inversion_mask;
 #endif
 }
@@ -22,20 +22,16 @@
 #define OWN_UNINITIALIZED_INDEX     0xFFFFFFFFU
 #define OWN_UNINITIALIZED_INDEX_32u 0x80000000U
 
-/**
- * Size of hash table that is used during match searching
- */
-
 /* ------ Own functions implementation ------ */
 
 OWN_QPLC_FUN(void, deflate_hash_table_reset, (deflate_hash_table_t* const hash_table_ptr)) {
     CALL_CORE_FUN(qplc_set_32u)
-    ((uint32_t)OWN_UNINITIALIZED_INDEX_32u, (uint32_t*)hash_table_ptr->hash_table_ptr, OWN_HIGH_HASH_TABLE_SIZE);
+    ((uint32_t)OWN_UNINITIALIZED_INDEX_32u, (uint32_t*)hash_table_ptr->hash_table_ptr, hash_table_ptr->hash_mask + 1U);
 
-    CALL_CORE_FUN(qplc_zero_8u)((uint8_t*)hash_table_ptr->hash_story_ptr, OWN_HIGH_HASH_TABLE_SIZE * 4U);
+    CALL_CORE_FUN(qplc_zero_8u)((uint8_t*)hash_table_ptr->hash_story_ptr, hash_table_ptr->window_size * 4U);
 }
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 void own_deflate_hash_table_update(deflate_hash_table_t* const hash_table_ptr, const uint32_t new_index,
                                    const uint32_t hash_value) {
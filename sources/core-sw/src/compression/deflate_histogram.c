@@ -20,7 +20,7 @@
 
 /* ------ Internal functions implementation ------ */
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 static inline uint32_t own_get_match_length_table_index(const uint32_t match_length) {
     // Based on tables on page 11 in RFC 1951
@@ -88,11 +88,12 @@ OWN_QPLC_FUN(void, deflate_histogram_reset, (deflate_histogram_t* const histogra
     // TODO make the logic of an assignment dependent on compression level
 
     // Simple assignment
-    histogram_ptr->table.hash_mask  = OWN_BUILD_MASK(12U);
-    histogram_ptr->table.attempts   = 4096U;
-    histogram_ptr->table.good_match = 32U;
-    histogram_ptr->table.nice_match = 258U;
-    histogram_ptr->table.lazy_match = 258U;
+    histogram_ptr->table.hash_mask   = OWN_BUILD_MASK(12U);
+    histogram_ptr->table.attempts    = 4096U;
+    histogram_ptr->table.good_match  = 32U;
+    histogram_ptr->table.nice_match  = 258U;
+    histogram_ptr->table.lazy_match  = 258U;
+    histogram_ptr->table.window_size = OWN_HIGH_HASH_TABLE_SIZE;
 
     CALL_CORE_FUN(deflate_hash_table_reset(&histogram_ptr->table));
 
@@ -100,7 +101,7 @@ OWN_QPLC_FUN(void, deflate_histogram_reset, (deflate_histogram_t* const histogra
     histogram_ptr->literals_matches[256U] = 1U;
 }
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 void deflate_histogram_update_match(deflate_histogram_t* const histogram_ptr, const deflate_match_t match) {
     // Histogram update
@@ -131,4 +132,32 @@ void deflate_histogram_set_statistics(deflate_histogram_t* deflate_histogram_ptr
     }
 }
 
+void deflate_histogram_count_literals(const uint8_t* source_ptr, uint32_t source_size,
+                                      uint32_t* literals_histogram_ptr) {
+    uint32_t banks[4U][QPLC_LITERALS_COUNT] = {{0U}};
+    uint32_t index                           = 0U;
+
+    // 8 bytes per iteration, the neighbouring bytes go to different banks
+    for (; index + 8U <= source_size; index += 8U) {
+        const uint64_t value = *(const uint64_t*)(source_ptr + index);
+
+        banks[0U][value & 0xFFU]++;
+        banks[1U][(value >> 8U) & 0xFFU]++;
+        banks[2U][(value >> 16U) & 0xFFU]++;
+        banks[3U][(value >> 24U) & 0xFFU]++;
+        banks[0U][(value >> 32U) & 0xFFU]++;
+        banks[1U][(value >> 40U) & 0xFFU]++;
+        banks[2U][(value >> 48U) & 0xFFU]++;
+        banks[3U][value >> 56U]++;
+    }
+
+    for (; index < source_size; index++) {
+        banks[0U][source_ptr[index]]++;
+    }
+
+    for (uint32_t i = 0U; i < QPLC_LITERALS_COUNT; i++) {
+        literals_histogram_ptr[i] += banks[0U][i] + banks[1U][i] + banks[2U][i] + banks[3U][i];
+    }
+}
+
 #endif
@@ -0,0 +1,372 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains near-optimal parsing for the highest software compression level
+ *
+ * @details The input is split into segments, for every position of a segment the longest match is
+ *          found with the hash chains, after that the cheapest sequence of literals and matches
+ *          covering the segment is chosen with a shortest path search. Bit costs of the symbols
+ *          are estimated from the histogram of the current deflate block.
+ */
+
+#include "deflate_optimal_icf.h"
+
+#include "deflate_defs.h"
+#include "deflate_slow_utils.h"
+#include "encode_df.h"
+#include "huffman.h"
+#include "igzip_lib.h"
+#include "own_qplc_defs.h"
+#include "stdbool.h"
+
+#define MAX_MATCH  258 // Largest deflate match length
+#define MIN_MATCH  3   // Shortest deflate match length
+#define HASH_BYTES 4   // Number of bytes used for hashing
+
+#define OWN_PARSE_SEGMENT_SIZE   1024U       /**< Number of positions that are parsed at once */
+#define OWN_COST_FRACTION_BITS   4U          /**< Number of fractional bits of the fixed point bit costs */
+#define OWN_COST_INFINITY        0xFFFFFFFFU /**< Cost of a position that is not reached yet */
+#define OWN_STATISTICS_THRESHOLD 1024U       /**< Minimal number of symbols in the block to trust its histogram */
+#define OWN_LENGTH_CODES         29U         /**< Number of deflate match length codes */
+#define OWN_DISTANCE_CODES       30U         /**< Number of deflate distance codes */
+#define OWN_CHAIN_LENGTH_SHIFT   2U          /**< Every position is searched, so the chains are shorter than lazy */
+
+/**
+ * @brief Buffers of a single segment
+ */
+typedef struct {
+    uint16_t match_length[OWN_PARSE_SEGMENT_SIZE + 1U];   /**< Longest match at the position, then the parsed length */
+    uint16_t match_distance[OWN_PARSE_SEGMENT_SIZE + 1U]; /**< Distance of the match at the position */
+    uint32_t cost[OWN_PARSE_SEGMENT_SIZE + 1U];           /**< Cheapest cost to reach the position */
+    uint16_t from_length[OWN_PARSE_SEGMENT_SIZE + 1U];    /**< Length of the last symbol of the cheapest path */
+    uint16_t from_distance[OWN_PARSE_SEGMENT_SIZE + 1U];  /**< Distance of the last symbol of the cheapest path */
+} own_parse_segment_t;
+
+/**
+ * @brief Estimated bit costs of deflate symbols
+ */
+typedef struct {
+    uint32_t literal[256];                 /**< Cost of every literal */
+    uint32_t length[MAX_MATCH + 1];        /**< Cost of every match length including its extra bits */
+    uint32_t distance[OWN_DISTANCE_CODES]; /**< Cost of every distance code excluding its extra bits */
+} own_symbol_costs_t;
+
+static inline uint32_t hash_crc(const uint8_t* p_src) {
+    return compute_hash(*(uint32_t*)(p_src));
+}
+
+static inline uint32_t own_log2_fixed(uint32_t value) {
+    const uint32_t msb = bsr(value) - 1U;
+
+    return (msb << OWN_COST_FRACTION_BITS) |
+           (((value << (31U - msb)) >> (31U - OWN_COST_FRACTION_BITS)) & ((1U << OWN_COST_FRACTION_BITS) - 1U));
+}
+
+static inline uint32_t own_symbol_cost(uint32_t count, uint32_t total_log2) {
+    const uint32_t one_bit = 1U << OWN_COST_FRACTION_BITS;
+
+    if (0U == count) { return total_log2 + one_bit; }
+
+    const uint32_t count_log2 = own_log2_fixed(count);
+
+    return (total_log2 > count_log2 + one_bit) ? total_log2 - count_log2 : one_bit;
+}
+
+static inline uint32_t own_length_code_index(uint32_t length) {
+    const uint32_t value = length - MIN_MATCH;
+
+    if (MAX_MATCH == length) { return OWN_LENGTH_CODES - 1U; }
+    if (value < 8U) { return value; }
+
+    const uint32_t msb = bsr(value) - 1U;
+
+    return 4U * (msb - 1U) + ((value >> (msb - 2U)) & 3U);
+}
+
+static inline uint32_t own_length_extra_bits(uint32_t length) {
+    const uint32_t value = length - MIN_MATCH;
+
+    if (MAX_MATCH == length || value < 8U) { return 0U; }
+
+    return bsr(value) - 3U;
+}
+
+static inline uint32_t own_distance_code_index(uint32_t distance) {
+    const uint32_t value = distance - 1U;
+
+    if (value < 4U) { return value; }
+
+    const uint32_t msb = bsr(value) - 1U;
+
+    return 2U * msb + ((value >> (msb - 1U)) & 1U);
+}
+
+static inline uint32_t own_distance_extra_bits(uint32_t distance) {
+    const uint32_t value = distance - 1U;
+
+    return (value < 4U) ? 0U : bsr(value) - 2U;
+}
+
+/**
+ * @brief Estimates symbol costs from the histogram of the current block, static estimations are used
+ *        until the block has enough symbols
+ */
+static void own_update_costs(const isal_mod_hist* histogram_ptr, own_symbol_costs_t* costs_ptr) {
+    const uint32_t one_bit                        = 1U << OWN_COST_FRACTION_BITS;
+    uint32_t       length_codes[OWN_LENGTH_CODES] = {0U};
+    uint32_t       literals_total                 = 0U;
+    uint32_t       distances_total                = 0U;
+
+    for (uint32_t i = 0U; i < 256U; i++) {
+        literals_total += histogram_ptr->ll_hist[i];
+    }
+
+    for (uint32_t length = MIN_MATCH; length <= MAX_MATCH; length++) {
+        length_codes[own_length_code_index(length)] += histogram_ptr->ll_hist[length + LEN_OFFSET];
+    }
+
+    for (uint32_t i = 0U; i < OWN_LENGTH_CODES; i++) {
+        literals_total += length_codes[i];
+    }
+
+    for (uint32_t i = 0U; i < OWN_DISTANCE_CODES; i++) {
+        distances_total += histogram_ptr->d_hist[i];
+    }
+
+    if (literals_total < OWN_STATISTICS_THRESHOLD || 0U == distances_total) {
+        for (uint32_t i = 0U; i < 256U; i++) {
+            costs_ptr->literal[i] = 8U * one_bit;
+        }
+
+        for (uint32_t length = MIN_MATCH; length <= MAX_MATCH; length++) {
+            costs_ptr->length[length] = (7U + own_length_extra_bits(length)) * one_bit;
+        }
+
+        for (uint32_t i = 0U; i < OWN_DISTANCE_CODES; i++) {
+            costs_ptr->distance[i] = 5U * one_bit;
+        }
+
+        return;
+    }
+
+    const uint32_t literals_log2  = own_log2_fixed(literals_total);
+    const uint32_t distances_log2 = own_log2_fixed(distances_total);
+
+    for (uint32_t i = 0U; i < 256U; i++) {
+        costs_ptr->literal[i] = own_symbol_cost(histogram_ptr->ll_hist[i], literals_log2);
+    }
+
+    for (uint32_t length = MIN_MATCH; length <= MAX_MATCH; length++) {
+        costs_ptr->length[length] = own_symbol_cost(length_codes[own_length_code_index(length)], literals_log2) +
+                                    own_length_extra_bits(length) * one_bit;
+    }
+
+    for (uint32_t i = 0U; i < OWN_DISTANCE_CODES; i++) {
+        costs_ptr->distance[i] = own_symbol_cost(histogram_ptr->d_hist[i], distances_log2);
+    }
+}
+
+static inline uint32_t own_compare_strings(const uint8_t* first_ptr, const uint8_t* second_ptr, uint32_t max_length) {
+    uint32_t length = 0U;
+
+    while (length + 8U <= max_length) {
+        const uint64_t difference = *(const uint64_t*)(first_ptr + length) ^ *(const uint64_t*)(second_ptr + length);
+
+        if (0U != difference) { return length + tzbytecnt(difference); }
+
+        length += 8U;
+    }
+
+    while (length < max_length && first_ptr[length] == second_ptr[length]) {
+        length++;
+    }
+
+    return length;
+}
+
+/**
+ * @brief Inserts the position into the hash chains, returns the previous position with the same hash
+ */
+static inline int own_insert_string(const uint8_t* const p_src, int indx_src, deflate_hash_table_t* hash_table_ptr) {
+    int32_t* p_hash_table = (int32_t*)hash_table_ptr->hash_table_ptr;
+    int32_t* p_hash_story = (int32_t*)hash_table_ptr->hash_story_ptr;
+
+    const uint32_t hash_key = hash_crc(p_src + indx_src) & hash_table_ptr->hash_mask;
+    const int      previous = p_hash_table[hash_key];
+
+    p_hash_story[indx_src & ((int)hash_table_ptr->window_size - 1)] = previous;
+    p_hash_table[hash_key]                                          = indx_src;
+
+    return previous;
+}
+
+/**
+ * @brief Inserts the position into the hash chains and returns the longest match found for it
+ */
+static inline uint32_t own_find_longest_match(const uint8_t* const p_src, int indx_src, int src_end,
+                                              deflate_hash_table_t* hash_table_ptr, uint16_t* distance_ptr) {
+    const int32_t* p_hash_story = (const int32_t*)hash_table_ptr->hash_story_ptr;
+
+    const uint8_t* p_str      = p_src + indx_src;
+    const int      win_mask   = (int)hash_table_ptr->window_size - 1;
+    const int      win_bound  = indx_src - (int)hash_table_ptr->window_size;
+    const uint32_t max_length = (uint32_t)QPL_MIN(src_end - indx_src, MAX_MATCH);
+
+    uint32_t chain_length = QPL_MAX(hash_table_ptr->attempts >> OWN_CHAIN_LENGTH_SHIFT, 1U);
+    bool     is_reduced   = false;
+    uint32_t best_length  = 0U;
+    int      tmp          = own_insert_string(p_src, indx_src, hash_table_ptr);
+
+    for (uint32_t k = 0U; k < chain_length && win_bound < tmp; k++) {
+        const uint8_t* p_src_tmp = p_src + tmp;
+        const int      candidate = tmp;
+
+        tmp = p_hash_story[tmp & win_mask];
+
+        // The candidate can be better only if it matches at the position of the current best match end
+        if (best_length != 0U && p_src_tmp[best_length] != p_str[best_length]) { continue; }
+
+        const uint32_t length = own_compare_strings(p_str, p_src_tmp, max_length);
+
+        if (length > best_length) {
+            best_length   = length;
+            *distance_ptr = (uint16_t)(indx_src - candidate);
+
+            if (best_length >= hash_table_ptr->nice_match || best_length == max_length) { break; }
+            if (best_length >= hash_table_ptr->good_match && !is_reduced) {
+                chain_length >>= 2U;
+                is_reduced = true;
+            }
+        }
+    }
+
+    return (best_length >= MIN_MATCH) ? best_length : 0U;
+}
+
+/**
+ * @brief Main deflate body function for the highest-level dynamic mode compression,
+ * returns number of processed bytes.
+ *
+ * @note Has the same interface and output format as slow_deflate_icf_body, but instead of the lazy
+ * matching chooses the cheapest parse of each segment of the input.
+ **/
+OWN_QPLC_FUN(uint32_t, optimal_deflate_icf_body,
+             (uint8_t * current_ptr, const uint8_t* const lower_bound_ptr, const uint8_t* const upper_bound_ptr,
+              deflate_hash_table_t* hash_table_ptr, isal_mod_hist* histogram_ptr, deflate_icf_stream* icf_stream_ptr)) {
+    own_parse_segment_t segment = {0};
+    own_symbol_costs_t  costs   = {0};
+
+    const uint8_t* const p_src     = lower_bound_ptr;
+    const int            src_start = (int)(current_ptr - lower_bound_ptr);
+    const int            src_end   = (int)(upper_bound_ptr - lower_bound_ptr);
+    int                  indx_src  = src_start;
+
+    // One entry is reserved for the end of block symbol
+    int dst_len = (int)(icf_stream_ptr->end_ptr - icf_stream_ptr->next_ptr) - 1;
+
+    while (indx_src < src_end && dst_len > 0) {
+        // Every position of a segment may become a literal, so the segment can't be longer than the free space
+        const uint32_t segment_size = (uint32_t)QPL_MIN(QPL_MIN(src_end - indx_src, dst_len), (int)OWN_PARSE_SEGMENT_SIZE);
+
+        own_update_costs(histogram_ptr, &costs);
+
+        // Search for the longest match at every position, positions covered by a long match are only inserted
+        for (uint32_t j = 0U, skip_until = 0U; j < segment_size; j++) {
+            const int position = indx_src + (int)j;
+
+            segment.match_length[j] = 0U;
+
+            if (src_end - position < HASH_BYTES) { continue; }
+
+            if (j < skip_until) {
+                own_insert_string(p_src, position, hash_table_ptr);
+                continue;
+            }
+
+            segment.match_length[j] = (uint16_t)own_find_longest_match(p_src, position, src_end, hash_table_ptr,
+                                                                       &segment.match_distance[j]);
+
+            if (segment.match_length[j] >= hash_table_ptr->nice_match) { skip_until = j + segment.match_length[j]; }
+        }
+
+        // Search for the cheapest path through the segment
+        segment.cost[0] = 0U;
+        for (uint32_t j = 1U; j <= segment_size; j++) {
+            segment.cost[j] = OWN_COST_INFINITY;
+        }
+
+        for (uint32_t j = 0U; j < segment_size; j++) {
+            const uint32_t current_cost = segment.cost[j];
+            const uint32_t literal_cost = current_cost + costs.literal[p_src[indx_src + (int)j]];
+
+            if (literal_cost < segment.cost[j + 1U]) {
+                segment.cost[j + 1U]        = literal_cost;
+                segment.from_length[j + 1U] = 1U;
+            }
+
+            const uint32_t max_length = QPL_MIN(segment.match_length[j], segment_size - j);
+
+            if (max_length < MIN_MATCH) { continue; }
+
+            const uint32_t distance      = segment.match_distance[j];
+            const uint32_t distance_cost = current_cost + costs.distance[own_distance_code_index(distance)] +
+                                           (own_distance_extra_bits(distance) << OWN_COST_FRACTION_BITS);
+
+            // Shorter lengths are not worth checking for long matches
+            const uint32_t min_length = (segment.match_length[j] >= hash_table_ptr->nice_match) ? max_length
+                                                                                                 : MIN_MATCH;
+
+            for (uint32_t length = min_length; length <= max_length; length++) {
+                const uint32_t match_cost = distance_cost + costs.length[length];
+
+                if (match_cost < segment.cost[j + length]) {
+                    segment.cost[j + length]          = match_cost;
+                    segment.from_length[j + length]   = (uint16_t)length;
+                    segment.from_distance[j + length] = (uint16_t)distance;
+                }
+            }
+        }
+
+        // Restore the path, the chosen symbol is stored at the position where it starts
+        for (uint32_t j = segment_size; j > 0U;) {
+            const uint16_t length   = segment.from_length[j];
+            const uint16_t distance = segment.from_distance[j];
+
+            j -= length;
+
+            segment.match_length[j]   = length;
+            segment.match_distance[j] = distance;
+        }
+
+        // Write the path to the output
+        for (uint32_t j = 0U; j < segment_size; j += segment.match_length[j]) {
+            const uint32_t length = segment.match_length[j];
+
+            if (1U == length) {
+                const uint8_t literal = p_src[indx_src + (int)j];
+
+                write_deflate_icf(icf_stream_ptr->next_ptr, literal, LITERAL_DISTANCE_IN_ICF, 0U);
+                histogram_ptr->ll_hist[literal]++;
+            } else {
+                uint32_t distance_code = 0U;
+                uint32_t extra_bits    = 0U;
+
+                get_distance_icf_code(segment.match_distance[j], &distance_code, &extra_bits);
+                write_deflate_icf(icf_stream_ptr->next_ptr, length + LEN_OFFSET, distance_code, extra_bits);
+                histogram_ptr->ll_hist[length + LEN_OFFSET]++;
+                histogram_ptr->d_hist[distance_code]++;
+            }
+
+            icf_stream_ptr->next_ptr++;
+            dst_len--;
+        }
+
+        indx_src += (int)segment_size;
+    }
+
+    return (uint32_t)(indx_src - src_start);
+}
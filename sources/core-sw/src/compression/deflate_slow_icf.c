@@ -78,15 +78,15 @@ OWN_QPLC_FUN(uint32_t, slow_deflate_icf_body,
     int      indx_src  = (int)(current_ptr - lower_bound_ptr);
     int      indx_dst  = 0;
     int      hash_mask = hash_table_ptr->hash_mask;
-    int      win_mask  = QPLC_DEFLATE_MAXIMAL_OFFSET - 1;
+    int      win_mask  = (int)hash_table_ptr->window_size - 1;
     int      hash_key  = 0;
     int      bound = 0, win_bound = 0, tmp = 0, candidate = 0, index = 0;
-    uint32_t win_size = QPLC_DEFLATE_MAXIMAL_OFFSET;
+    uint32_t win_size = hash_table_ptr->window_size;
     uint16_t dist     = 0U;
     uint8_t  length   = 0U;
 
     {
-        int chain_length_current = 256;
+        int chain_length_current = (int)hash_table_ptr->attempts;
 
         int good_match   = hash_table_ptr->good_match;
         int nice_match   = hash_table_ptr->nice_match;
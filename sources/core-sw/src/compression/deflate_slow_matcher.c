@@ -9,7 +9,7 @@
 #include "deflate_hash_table.h"
 #include "qplc_checksum.h"
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 static inline uint32_t compare_strings(const uint8_t* const first_ptr, const uint8_t* const second_ptr,
                                        const uint8_t* const upper_bound_ptr) {
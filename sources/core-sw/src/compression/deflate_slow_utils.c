@@ -19,7 +19,7 @@
 
 #endif
 
-#if PLATFORM < K0
+#if PLATFORM == PX
 
 static inline uint32_t bsr(uint32_t val) {
     uint32_t msb = 0;
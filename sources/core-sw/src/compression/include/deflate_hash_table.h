@@ -34,6 +34,7 @@ typedef struct {
     uint32_t  good_match;     /**< Length of the match that stops searching when reached */
     uint32_t  nice_match;     /**< Stop searching when match length is longer or equal to this */
     uint32_t  lazy_match;     /**< Continue search until new match length is less or equal to the previous*/
+    uint32_t  window_size;    /**< Size of the sliding window (power of 2) and of the sub-hash-table */
 } deflate_hash_table_t;
 
 /* ------ Own functions API ------ */
@@ -78,6 +78,20 @@ void deflate_histogram_set_statistics(deflate_histogram_t* deflate_histogram_ptr
                                       const uint32_t*      literal_length_histogram_ptr,
                                       const uint32_t*      offsets_histogram_ptr);
 
+/**
+ * @brief Adds the number of occurrences of every byte of the source to the literals histogram
+ *
+ * @note Counters are kept in several banks, so the consecutive equal bytes do not wait for each other's increment.
+ *
+ * @param[in]      source_ptr              Pointer to the source
+ * @param[in]      source_size             Source size
+ * @param[in,out]  literals_histogram_ptr  Pointer to the histogram with 256 literal counters
+ *
+ * @return this function doesn't return anything
+ */
+void deflate_histogram_count_literals(const uint8_t* source_ptr, uint32_t source_size,
+                                      uint32_t* literals_histogram_ptr);
+
 #ifdef __cplusplus
 }
 #endif
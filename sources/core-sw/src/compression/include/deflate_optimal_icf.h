@@ -0,0 +1,32 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPLC_DEFLATE_OPTIMAL_ICF_H_
+#define QPLC_DEFLATE_OPTIMAL_ICF_H_
+
+#include "bitbuf2.h"
+#include "deflate_defs.h"
+#include "deflate_hash_table.h"
+#include "huff_codes.h"
+#include "igzip_level_buf_structs.h"
+#include "own_qplc_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct isal_mod_hist      isal_mod_hist;
+typedef struct deflate_icf_stream deflate_icf_stream;
+
+OWN_QPLC_FUN(uint32_t, optimal_deflate_icf_body,
+             (uint8_t * current_ptr, const uint8_t* const lower_bound_ptr, const uint8_t* const upper_bound_ptr,
+              deflate_hash_table_t* hash_table_ptr, isal_mod_hist* histogram_ptr, deflate_icf_stream* icf_stream_ptr));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QPLC_DEFLATE_OPTIMAL_ICF_H_
@@ -13,6 +13,7 @@
   *          - @ref qplc_aggregates_8u
   *          - @ref qplc_aggregates_16u
   *          - @ref qplc_aggregates_32u
+  *          - @ref qplc_aggregates_64u
   */
 #ifndef OWN_AGGREGATES_H
 #define OWN_AGGREGATES_H
@@ -23,8 +24,8 @@
 // ********************** bit ****************************** //
 
 OWN_OPT_FUN(void, k0_qplc_bit_aggregates_8u,
-            (const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-             uint32_t* sum_ptr, uint32_t* index_ptr)) {
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr, uint32_t* index_ptr)) {
 
     __m512i z_data;
     __m512i z_zero = _mm512_setzero_si512();
@@ -76,7 +77,9 @@ OWN_OPT_FUN(void, k0_qplc_bit_aggregates_8u,
                 msk64  = _mm512_cmpgt_epu8_mask(z_data, z_zero);
             }
         }
-        if (msk64) idx -= (1 + (uint32_t)_lzcnt_u64((uint64_t)msk64));
+        // No set bits in the whole chunk, the maximum stays in the previous chunks
+        if (!msk64) return;
+        idx -= (1 + (uint32_t)_lzcnt_u64((uint64_t)msk64));
         if ((int32_t)idx < (int32_t)0) return;
         *max_value_ptr = idx + index;
         len_new -= (length - (idx + 1));
@@ -112,8 +115,8 @@ There is the problem with compiler of MSVC2017.
 #endif
 
 OWN_OPT_FUN(void, k0_qplc_aggregates_8u,
-            (const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-             uint32_t* sum_ptr)) {
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr)) {
     uint32_t  min_value = *min_value_ptr;
     uint32_t  max_value = *max_value_ptr;
     __m512i   z_data;
@@ -233,8 +236,8 @@ There is the problem with compiler of MSVC2017.
 // ********************** 16u ****************************** //
 
 OWN_OPT_FUN(void, k0_qplc_aggregates_16u,
-            (const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-             uint32_t* sum_ptr)) {
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr)) {
     const uint16_t* src_16u_ptr = (uint16_t*)src_ptr;
     uint32_t        min_value   = *min_value_ptr;
     uint32_t        max_value   = *max_value_ptr;
@@ -373,9 +376,17 @@ There is the problem with compiler of MSVC2017.
 #endif
 #endif
 
+/**
+ * @brief Adds the even and the odd dwords of z_data to the qword sums, so that the sum of dwords can't overflow
+ */
+OWN_QPLC_INLINE(__m512i, own_k0_add_32u_64u, (__m512i z_sum, __m512i z_data)) {
+    z_sum = _mm512_add_epi64(z_sum, _mm512_and_si512(z_data, _mm512_set1_epi64((int64_t)OWN_MAX_32U)));
+    return _mm512_add_epi64(z_sum, _mm512_srli_epi64(z_data, 32));
+}
+
 OWN_OPT_FUN(void, k0_qplc_aggregates_32u,
-            (const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
-             uint32_t* sum_ptr)) {
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr)) {
     const uint32_t* src_32u_ptr = (uint32_t*)src_ptr;
     uint32_t        min_value   = *min_value_ptr;
     uint32_t        max_value   = *max_value_ptr;
@@ -396,29 +407,30 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_32u,
             uint32_t remind_16 = length & 16;
             length -= remind_16;
             for (uint32_t idx = 0U; idx < length; idx += 32) {
-                z_sum   = _mm512_add_epi32(z_sum, _mm512_loadu_si512((void const*)(src_32u_ptr + idx)));
-                z_sum_1 = _mm512_add_epi32(z_sum_1, _mm512_loadu_si512((void const*)(src_32u_ptr + idx + 16)));
+                z_sum   = own_k0_add_32u_64u(z_sum, _mm512_loadu_si512((void const*)(src_32u_ptr + idx)));
+                z_sum_1 = own_k0_add_32u_64u(z_sum_1, _mm512_loadu_si512((void const*)(src_32u_ptr + idx + 16)));
             }
-            z_sum = _mm512_add_epi32(z_sum, z_sum_1);
+            z_sum = _mm512_add_epi64(z_sum, z_sum_1);
             if (remind_16) {
-                z_sum = _mm512_add_epi32(z_sum, _mm512_loadu_si512((void const*)(src_32u_ptr + length)));
+                z_sum = own_k0_add_32u_64u(z_sum, _mm512_loadu_si512((void const*)(src_32u_ptr + length)));
                 length += 16;
             }
             if (remind) {
-                msk16 = (__mmask16)_bzhi_u32(0xffff, remind);
-                z_sum = _mm512_add_epi32(z_sum, _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length)));
+                msk16  = (__mmask16)_bzhi_u32(0xffff, remind);
+                z_data = _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length));
+                z_sum  = own_k0_add_32u_64u(z_sum, z_data);
             }
         } else {
             for (uint32_t idx = 0U; idx < length; idx += 16) {
                 z_data = _mm512_loadu_si512((void const*)(src_32u_ptr + idx));
                 z_max  = _mm512_max_epu32(z_max, z_data); /* z_max = max */
-                z_sum  = _mm512_add_epi32(z_sum, z_data); /* z_sum = s15 .. s0 */
+                z_sum  = own_k0_add_32u_64u(z_sum, z_data);
             }
             if (remind) {
                 msk16  = (__mmask16)_bzhi_u32(0xffff, remind);
                 z_data = _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length));
                 z_max  = _mm512_max_epu32(z_max, z_data); /* z_max = max */
-                z_sum  = _mm512_add_epi32(z_sum, z_data); /* z_sum = s15 .. s0 */
+                z_sum  = own_k0_add_32u_64u(z_sum, z_data);
             }
         }
     } else {
@@ -426,27 +438,27 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_32u,
             for (uint32_t idx = 0U; idx < length; idx += 16) {
                 z_data = _mm512_loadu_si512((void const*)(src_32u_ptr + idx));
                 z_min  = _mm512_min_epu32(z_min, z_data); /* z_min = min */
-                z_sum  = _mm512_add_epi32(z_sum, z_data); /* z_sum = s15 .. s0 */
+                z_sum  = own_k0_add_32u_64u(z_sum, z_data);
             }
             if (remind) {
                 msk16  = (__mmask16)_bzhi_u32(0xffff, remind);
                 z_data = _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length));
                 z_min  = _mm512_mask_min_epu32(z_min, msk16, z_min, z_data); /* z_min = min */
-                z_sum  = _mm512_add_epi32(z_sum, z_data);                    /* z_sum = s15 .. s0 */
+                z_sum  = own_k0_add_32u_64u(z_sum, z_data);
             }
         } else {
             for (uint32_t idx = 0U; idx < length; idx += 16) {
                 z_data = _mm512_loadu_si512((void const*)(src_32u_ptr + idx));
                 z_min  = _mm512_min_epu32(z_min, z_data); /* z_min = min */
                 z_max  = _mm512_max_epu32(z_max, z_data); /* z_max = max */
-                z_sum  = _mm512_add_epi32(z_sum, z_data); /* z_sum = s15 .. s0 */
+                z_sum  = own_k0_add_32u_64u(z_sum, z_data);
             }
             if (remind) {
                 msk16  = (__mmask16)_bzhi_u32(0xffff, remind);
                 z_data = _mm512_maskz_loadu_epi32(msk16, (void const*)(src_32u_ptr + length));
                 z_min  = _mm512_mask_min_epu32(z_min, msk16, z_min, z_data); /* z_min = min */
                 z_max  = _mm512_max_epu32(z_max, z_data);                    /* z_max = max */
-                z_sum  = _mm512_add_epi32(z_sum, z_data);                    /* z_sum = s15 .. s0 */
+                z_sum  = own_k0_add_32u_64u(z_sum, z_data);
             }
         }
     }
@@ -468,13 +480,7 @@ OWN_OPT_FUN(void, k0_qplc_aggregates_32u,
         x_data         = _mm_max_epu32(x_data, _mm_srli_epi64(x_data, 32));     /* x_data = mx0 */
         *max_value_ptr = (uint32_t)_mm_cvtsi128_si32(x_data);
     }
-    y_data = _mm512_extracti64x4_epi64(z_sum, 1);
-    y_data = _mm256_add_epi32(y_data, _mm512_castsi512_si256(z_sum)); /* y_data = s7 .. s0 */
-    x_data = _mm256_extracti128_si256(y_data, 1);
-    x_data = _mm_add_epi32(x_data, _mm256_castsi256_si128(y_data)); /* x_data = s3 .. s0 */
-    x_data = _mm_add_epi32(x_data, _mm_srli_si128(x_data, 8));      /* x_data = s1 s0 */
-    x_data = _mm_add_epi32(x_data, _mm_srli_epi64(x_data, 32));     /* x_data = s0 */
-    *sum_ptr += (uint32_t)_mm_cvtsi128_si32(x_data);
+    *sum_ptr += (uint64_t)_mm512_reduce_add_epi64(z_sum);
 }
 #if defined _MSC_VER
 #if _MSC_VER <= 1916
@@ -486,4 +492,37 @@ There is the problem with compiler of MSVC2017.
 #endif
 #endif
 
+// ********************** 64u ****************************** //
+
+OWN_OPT_FUN(void, k0_qplc_aggregates_64u,
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr)) {
+    const uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    __m512i         z_data;
+    __m512i         z_sum  = _mm512_setzero_si512();
+    __m512i         z_min  = _mm512_set1_epi64((int64_t)*min_value_ptr);
+    __m512i         z_max  = _mm512_set1_epi64((int64_t)*max_value_ptr);
+    __mmask8        msk8   = 0;
+    uint32_t        remind = length & 7;
+
+    length -= remind;
+
+    for (uint32_t idx = 0U; idx < length; idx += 8) {
+        z_data = _mm512_loadu_si512((void const*)(src_64u_ptr + idx));
+        z_min  = _mm512_min_epu64(z_min, z_data);
+        z_max  = _mm512_max_epu64(z_max, z_data);
+        z_sum  = _mm512_add_epi64(z_sum, z_data);
+    }
+    if (remind) {
+        msk8   = (__mmask8)_bzhi_u32(0xff, remind);
+        z_data = _mm512_maskz_loadu_epi64(msk8, (void const*)(src_64u_ptr + length));
+        z_min  = _mm512_mask_min_epu64(z_min, msk8, z_min, z_data);
+        z_max  = _mm512_max_epu64(z_max, z_data);
+        z_sum  = _mm512_add_epi64(z_sum, z_data);
+    }
+    *min_value_ptr = (uint64_t)_mm512_reduce_min_epu64(z_min);
+    *max_value_ptr = (uint64_t)_mm512_reduce_max_epu64(z_max);
+    *sum_ptr += (uint64_t)_mm512_reduce_add_epi64(z_sum);
+}
+
 #endif // OWN_AGGREGATES_H
@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+  * @brief Contains AVX2 implementation of functions for calculating aggregates
+  * @date 10/17/2026
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_bit_aggregates_8u
+  *          - @ref l9_qplc_aggregates_8u
+  *          - @ref l9_qplc_aggregates_16u
+  *          - @ref l9_qplc_aggregates_32u
+  */
+#ifndef OWN_AGGREGATES_L9_H
+#define OWN_AGGREGATES_L9_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_min_32u, (__m256i src)) {
+    __m128i x_data = _mm_min_epu32(_mm256_castsi256_si128(src), _mm256_extracti128_si256(src, 1));
+    x_data         = _mm_min_epu32(x_data, _mm_shuffle_epi32(x_data, _MM_SHUFFLE(1, 0, 3, 2)));
+    x_data         = _mm_min_epu32(x_data, _mm_shuffle_epi32(x_data, _MM_SHUFFLE(2, 3, 0, 1)));
+    return (uint32_t)_mm_cvtsi128_si32(x_data);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_max_32u, (__m256i src)) {
+    __m128i x_data = _mm_max_epu32(_mm256_castsi256_si128(src), _mm256_extracti128_si256(src, 1));
+    x_data         = _mm_max_epu32(x_data, _mm_shuffle_epi32(x_data, _MM_SHUFFLE(1, 0, 3, 2)));
+    x_data         = _mm_max_epu32(x_data, _mm_shuffle_epi32(x_data, _MM_SHUFFLE(2, 3, 0, 1)));
+    return (uint32_t)_mm_cvtsi128_si32(x_data);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_add_32u, (__m256i src)) {
+    __m128i x_data = _mm_add_epi32(_mm256_castsi256_si128(src), _mm256_extracti128_si256(src, 1));
+    x_data         = _mm_add_epi32(x_data, _mm_shuffle_epi32(x_data, _MM_SHUFFLE(1, 0, 3, 2)));
+    x_data         = _mm_add_epi32(x_data, _mm_shuffle_epi32(x_data, _MM_SHUFFLE(2, 3, 0, 1)));
+    return (uint32_t)_mm_cvtsi128_si32(x_data);
+}
+
+OWN_QPLC_INLINE(uint64_t, own_l9_reduce_add_64u, (__m256i src)) {
+    __m128i x_data = _mm_add_epi64(_mm256_castsi256_si128(src), _mm256_extracti128_si256(src, 1));
+    x_data         = _mm_add_epi64(x_data, _mm_unpackhi_epi64(x_data, x_data));
+    return (uint64_t)_mm_cvtsi128_si64(x_data);
+}
+
+// ********************** bit ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_bit_aggregates_8u,
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr, uint32_t* index_ptr)) {
+    const __m256i y_zero = _mm256_setzero_si256();
+
+    uint32_t index   = *index_ptr;
+    uint32_t len_crn = length & (~31U);
+    uint32_t sum     = 0U;
+    uint32_t idx     = 0U;
+
+    for (; idx < len_crn; idx += 32U) {
+        __m256i  y_data = _mm256_loadu_si256((__m256i const*)(src_ptr + idx));
+        uint32_t msk32  = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(y_data, y_zero));
+
+        if (0U == msk32) { continue; }
+        if (OWN_MAX_32U == *min_value_ptr) { *min_value_ptr = index + idx + _tzcnt_u32(msk32); }
+        *max_value_ptr = index + idx + 31U - _lzcnt_u32(msk32);
+        sum += (uint32_t)_mm_popcnt_u32(msk32);
+    }
+
+    for (; idx < length; idx++) {
+        if (0U == src_ptr[idx]) { continue; }
+        if (OWN_MAX_32U == *min_value_ptr) { *min_value_ptr = index + idx; }
+        *max_value_ptr = index + idx;
+        sum += src_ptr[idx];
+    }
+
+    *sum_ptr += sum;
+    *index_ptr += length;
+}
+
+// ********************** 8u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_8u,
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr)) {
+    __m256i y_sum  = _mm256_setzero_si256();
+    __m256i y_min  = _mm256_set1_epi8((char)0xFF);
+    __m256i y_max  = _mm256_setzero_si256();
+    __m256i y_zero = _mm256_setzero_si256();
+
+    uint32_t len_crn = length & (~31U);
+    uint32_t idx     = 0U;
+
+    for (; idx < len_crn; idx += 32U) {
+        __m256i y_data = _mm256_loadu_si256((__m256i const*)(src_ptr + idx));
+        y_sum          = _mm256_add_epi64(y_sum, _mm256_sad_epu8(y_data, y_zero));
+        y_min          = _mm256_min_epu8(y_min, y_data);
+        y_max          = _mm256_max_epu8(y_max, y_data);
+    }
+
+    if (len_crn) {
+        /* Fold the byte lanes into 32-bit lanes before the horizontal reduction */
+        y_min = _mm256_min_epu8(y_min, _mm256_srli_epi16(y_min, 8));
+        y_min = _mm256_min_epu8(y_min, _mm256_srli_epi32(y_min, 16));
+        y_max = _mm256_max_epu8(y_max, _mm256_srli_epi16(y_max, 8));
+        y_max = _mm256_max_epu8(y_max, _mm256_srli_epi32(y_max, 16));
+
+        uint32_t min_value = own_l9_reduce_min_32u(_mm256_and_si256(y_min, _mm256_set1_epi32(0xFF)));
+        uint32_t max_value = own_l9_reduce_max_32u(_mm256_and_si256(y_max, _mm256_set1_epi32(0xFF)));
+
+        *sum_ptr += own_l9_reduce_add_64u(y_sum);
+        *min_value_ptr = QPL_MIN(min_value, *min_value_ptr);
+        *max_value_ptr = QPL_MAX(max_value, *max_value_ptr);
+    }
+
+    for (; idx < length; idx++) {
+        *sum_ptr += src_ptr[idx];
+        *min_value_ptr = (src_ptr[idx] < *min_value_ptr) ? src_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_ptr[idx] > *max_value_ptr) ? src_ptr[idx] : *max_value_ptr;
+    }
+}
+
+// ********************** 16u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_16u,
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr)) {
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+
+    __m256i y_sum     = _mm256_setzero_si256();
+    __m256i y_min     = _mm256_set1_epi16((short)0xFFFF);
+    __m256i y_max     = _mm256_setzero_si256();
+    __m256i y_low_msk = _mm256_set1_epi32(0xFFFF);
+
+    uint32_t len_crn = length & (~15U);
+    uint32_t idx     = 0U;
+
+    for (; idx < len_crn; idx += 16U) {
+        __m256i y_data = _mm256_loadu_si256((__m256i const*)(src_16u_ptr + idx));
+        y_sum          = _mm256_add_epi32(y_sum, _mm256_and_si256(y_data, y_low_msk));
+        y_sum          = _mm256_add_epi32(y_sum, _mm256_srli_epi32(y_data, 16));
+        y_min          = _mm256_min_epu16(y_min, y_data);
+        y_max          = _mm256_max_epu16(y_max, y_data);
+    }
+
+    if (len_crn) {
+        y_min = _mm256_min_epu16(y_min, _mm256_srli_epi32(y_min, 16));
+        y_max = _mm256_max_epu16(y_max, _mm256_srli_epi32(y_max, 16));
+
+        uint32_t min_value = own_l9_reduce_min_32u(_mm256_and_si256(y_min, y_low_msk));
+        uint32_t max_value = own_l9_reduce_max_32u(_mm256_and_si256(y_max, y_low_msk));
+
+        *sum_ptr += own_l9_reduce_add_32u(y_sum);
+        *min_value_ptr = QPL_MIN(min_value, *min_value_ptr);
+        *max_value_ptr = QPL_MAX(max_value, *max_value_ptr);
+    }
+
+    for (; idx < length; idx++) {
+        *sum_ptr += src_16u_ptr[idx];
+        *min_value_ptr = (src_16u_ptr[idx] < *min_value_ptr) ? src_16u_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_16u_ptr[idx] > *max_value_ptr) ? src_16u_ptr[idx] : *max_value_ptr;
+    }
+}
+
+// ********************** 32u ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_32u,
+            (const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr, uint64_t* max_value_ptr,
+             uint64_t* sum_ptr)) {
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+
+    __m256i y_sum     = _mm256_setzero_si256();
+    __m256i y_min     = _mm256_set1_epi32((int)OWN_MAX_32U);
+    __m256i y_max     = _mm256_setzero_si256();
+    __m256i y_low_msk = _mm256_set1_epi64x((int64_t)OWN_MAX_32U);
+
+    uint32_t len_crn = length & (~7U);
+    uint32_t idx     = 0U;
+
+    for (; idx < len_crn; idx += 8U) {
+        __m256i y_data = _mm256_loadu_si256((__m256i const*)(src_32u_ptr + idx));
+        y_sum          = _mm256_add_epi64(y_sum, _mm256_and_si256(y_data, y_low_msk));
+        y_sum          = _mm256_add_epi64(y_sum, _mm256_srli_epi64(y_data, 32));
+        y_min          = _mm256_min_epu32(y_min, y_data);
+        y_max          = _mm256_max_epu32(y_max, y_data);
+    }
+
+    if (len_crn) {
+        uint32_t min_value = own_l9_reduce_min_32u(y_min);
+        uint32_t max_value = own_l9_reduce_max_32u(y_max);
+
+        *sum_ptr += own_l9_reduce_add_64u(y_sum);
+        *min_value_ptr = QPL_MIN(min_value, *min_value_ptr);
+        *max_value_ptr = QPL_MAX(max_value, *max_value_ptr);
+    }
+
+    for (; idx < length; idx++) {
+        *sum_ptr += src_32u_ptr[idx];
+        *min_value_ptr = (src_32u_ptr[idx] < *min_value_ptr) ? src_32u_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_32u_ptr[idx] > *max_value_ptr) ? src_32u_ptr[idx] : *max_value_ptr;
+    }
+}
+
+#endif // OWN_AGGREGATES_L9_H
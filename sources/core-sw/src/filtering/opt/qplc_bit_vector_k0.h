@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of bit-vector operations
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref k0_qplc_bit_vector
+ *
+ * @note The kernel processes only full blocks of 512 bits and returns the number of processed bits,
+ *       the rest is processed by the generic implementation.
+ */
+
+#ifndef OWN_BIT_VECTOR_K0_H
+#define OWN_BIT_VECTOR_K0_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+OWN_QPLC_INLINE(__m512i, k0_own_bit_vector_combine, (__m512i src1, __m512i src2, uint32_t operation)) {
+    switch (operation) {
+        case OWN_BIT_VECTOR_AND: return _mm512_and_si512(src1, src2);
+        case OWN_BIT_VECTOR_OR: return _mm512_or_si512(src1, src2);
+        case OWN_BIT_VECTOR_AND_NOT: return _mm512_andnot_si512(src2, src1);
+        default: return _mm512_xor_si512(src1, src2);
+    }
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_bit_vector,
+            (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+             uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr,
+             uint32_t operation)) {
+    const uint32_t length_512 = length & (~511U);
+    const uint32_t index      = *index_ptr;
+
+    // Bytes are counted by the nibble lookups, the counts are summed into 64-bit lanes
+    const __m512i z_table  = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+    const __m512i z_nibble = _mm512_set1_epi8(0x0F);
+    const __m512i z_zero   = _mm512_setzero_si512();
+    __m512i       z_sum    = _mm512_setzero_si512();
+
+    uint32_t last_block = 0U;
+    __mmask8 last_lanes = 0U;
+
+    for (uint32_t idx = 0U; idx < length_512; idx += 512U) {
+        const __m512i z_src1 = _mm512_loadu_si512((void const*)(src1_ptr + (idx >> 3U)));
+        const __m512i z_src2 = _mm512_loadu_si512((void const*)(src2_ptr + (idx >> 3U)));
+        const __m512i z_bits = k0_own_bit_vector_combine(z_src1, z_src2, operation);
+
+        _mm512_storeu_si512((void*)(dst_ptr + (idx >> 3U)), z_bits);
+
+        const __m512i z_low  = _mm512_shuffle_epi8(z_table, _mm512_and_si512(z_bits, z_nibble));
+        const __m512i z_high = _mm512_shuffle_epi8(z_table, _mm512_and_si512(_mm512_srli_epi16(z_bits, 4U), z_nibble));
+
+        z_sum = _mm512_add_epi64(z_sum, _mm512_sad_epu8(_mm512_add_epi8(z_low, z_high), z_zero));
+
+        const __mmask8 lanes = _mm512_test_epi64_mask(z_bits, z_bits);
+
+        if (0U != lanes) {
+            if (OWN_MAX_32U == *min_value_ptr) {
+                const uint32_t lane = (uint32_t)_tzcnt_u32(lanes);
+                const uint64_t word = ((const uint64_t*)(dst_ptr + (idx >> 3U)))[lane];
+
+                *min_value_ptr = index + idx + lane * 64U + (uint32_t)_tzcnt_u64(word);
+            }
+
+            last_block = idx;
+            last_lanes = lanes;
+        }
+    }
+
+    if (0U != last_lanes) {
+        const uint32_t lane = 31U - (uint32_t)_lzcnt_u32(last_lanes);
+        const uint64_t word = ((const uint64_t*)(dst_ptr + (last_block >> 3U)))[lane];
+
+        *max_value_ptr = index + last_block + lane * 64U + 63U - (uint32_t)_lzcnt_u64(word);
+    }
+
+    *sum_ptr += (uint32_t)_mm512_reduce_add_epi64(z_sum);
+    *index_ptr = index + length_512;
+
+    return length_512;
+}
+
+#endif // OWN_BIT_VECTOR_K0_H
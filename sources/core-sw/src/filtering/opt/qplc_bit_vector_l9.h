@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of bit-vector operations
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_bit_vector
+ *
+ * @note The kernel processes only full blocks of 256 bits and returns the number of processed bits,
+ *       the rest is processed by the generic implementation.
+ */
+
+#ifndef OWN_BIT_VECTOR_L9_H
+#define OWN_BIT_VECTOR_L9_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+OWN_QPLC_INLINE(__m256i, l9_own_bit_vector_combine, (__m256i src1, __m256i src2, uint32_t operation)) {
+    switch (operation) {
+        case OWN_BIT_VECTOR_AND: return _mm256_and_si256(src1, src2);
+        case OWN_BIT_VECTOR_OR: return _mm256_or_si256(src1, src2);
+        case OWN_BIT_VECTOR_AND_NOT: return _mm256_andnot_si256(src2, src1);
+        default: return _mm256_xor_si256(src1, src2);
+    }
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_bit_vector,
+            (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+             uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr,
+             uint32_t operation)) {
+    const uint32_t length_256 = length & (~255U);
+    const uint32_t index      = *index_ptr;
+
+    // Bytes are counted by the nibble lookups, the counts are summed into 64-bit lanes
+    const __m256i y_table = _mm256_broadcastsi128_si256(
+            _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+    const __m256i y_nibble = _mm256_set1_epi8(0x0F);
+    const __m256i y_zero   = _mm256_setzero_si256();
+    __m256i       y_sum    = _mm256_setzero_si256();
+
+    uint32_t last_block = 0U;
+    uint32_t last_lanes = 0U;
+
+    for (uint32_t idx = 0U; idx < length_256; idx += 256U) {
+        const __m256i y_src1 = _mm256_loadu_si256((__m256i const*)(src1_ptr + (idx >> 3U)));
+        const __m256i y_src2 = _mm256_loadu_si256((__m256i const*)(src2_ptr + (idx >> 3U)));
+        const __m256i y_bits = l9_own_bit_vector_combine(y_src1, y_src2, operation);
+
+        _mm256_storeu_si256((__m256i*)(dst_ptr + (idx >> 3U)), y_bits);
+
+        const __m256i y_low  = _mm256_shuffle_epi8(y_table, _mm256_and_si256(y_bits, y_nibble));
+        const __m256i y_high = _mm256_shuffle_epi8(y_table, _mm256_and_si256(_mm256_srli_epi16(y_bits, 4), y_nibble));
+
+        y_sum = _mm256_add_epi64(y_sum, _mm256_sad_epu8(_mm256_add_epi8(y_low, y_high), y_zero));
+
+        const uint32_t lanes =
+                (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(y_bits, y_zero))) ^ 0xFU;
+
+        if (0U != lanes) {
+            if (OWN_MAX_32U == *min_value_ptr) {
+                const uint32_t lane = (uint32_t)_tzcnt_u32(lanes);
+                const uint64_t word = ((const uint64_t*)(dst_ptr + (idx >> 3U)))[lane];
+
+                *min_value_ptr = index + idx + lane * 64U + (uint32_t)_tzcnt_u64(word);
+            }
+
+            last_block = idx;
+            last_lanes = lanes;
+        }
+    }
+
+    if (0U != last_lanes) {
+        const uint32_t lane = 31U - (uint32_t)_lzcnt_u32(last_lanes);
+        const uint64_t word = ((const uint64_t*)(dst_ptr + (last_block >> 3U)))[lane];
+
+        *max_value_ptr = index + last_block + lane * 64U + 63U - (uint32_t)_lzcnt_u64(word);
+    }
+
+    const __m128i x_sum = _mm_add_epi64(_mm256_castsi256_si128(y_sum), _mm256_extracti128_si256(y_sum, 1));
+
+    *sum_ptr += (uint32_t)(_mm_cvtsi128_si64(x_sum) + _mm_extract_epi64(x_sum, 1));
+    *index_ptr = index + length_256;
+
+    return length_256;
+}
+
+#endif // OWN_BIT_VECTOR_L9_H
@@ -12,6 +12,7 @@
   *          - @ref k0_qplc_expand_8u
   *          - @ref k0_qplc_expand_16u
   *          - @ref k0_qplc_expand_32u
+  *          - @ref k0_qplc_expand_64u
 *
   */
 #ifndef OWN_EXPAND_H
@@ -285,4 +286,49 @@ OWN_OPT_FUN(uint32_t, k0_qplc_qplc_expand_32u,
     return expanded;
 }
 
+// ********************** 64u ****************************** //
+OWN_OPT_FUN(uint32_t, k0_qplc_qplc_expand_64u,
+            (const uint8_t* src1_ptr, uint32_t length_1, const uint8_t* src2_ptr, uint32_t* length_2_ptr,
+             uint8_t* dst_ptr)) {
+
+    __m512i   z_data;
+    __m512i   z_zero      = _mm512_setzero_si512();
+    __mmask8  msk8        = 0;
+    __mmask8  msk_data    = 0;
+    uint64_t* src_64u_ptr = (uint64_t*)src1_ptr;
+    uint64_t* dst_64u_ptr = (uint64_t*)dst_ptr;
+    uint32_t  length_2    = *length_2_ptr;
+    uint32_t  remind      = length_2 & 7;
+    uint32_t  expanded    = 0U;
+    uint32_t  num_data    = 0U;
+    uint32_t  idx         = 0U;
+
+    length_2 -= remind;
+    for (idx = 0; idx < length_2; idx += 8) {
+        z_data = _mm512_cvtepu8_epi64(_mm_loadl_epi64((const __m128i*)(src2_ptr + idx)));
+        msk8   = _mm512_cmpneq_epi64_mask(z_data, z_zero);
+        z_data = z_zero;
+        if (msk8) {
+            num_data = (uint32_t)_mm_popcnt_u32((uint32_t)msk8);
+            if ((expanded + num_data) > length_1) break;
+            msk_data = (__mmask8)_bzhi_u32(0xff, num_data);
+            z_data   = _mm512_maskz_loadu_epi64(msk_data, (const __m512i*)(src_64u_ptr + expanded));
+            z_data   = _mm512_maskz_expand_epi64(msk8, z_data);
+            expanded += num_data;
+        }
+        _mm512_storeu_si512((__m512i*)(dst_64u_ptr + idx), z_data);
+    }
+    length_2 += remind;
+    for (; idx < length_2; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_64u_ptr[idx] = src_64u_ptr[expanded++];
+        } else {
+            dst_64u_ptr[idx] = 0U;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+}
+
 #endif // OWN_EXPAND_H
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of scan analytics operation for 64u data
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref k0_qplc_scan_lt_64u8u
+ *          - @ref k0_qplc_scan_le_64u8u
+ *          - @ref k0_qplc_scan_gt_64u8u
+ *          - @ref k0_qplc_scan_ge_64u8u
+ *          - @ref k0_qplc_scan_eq_64u8u
+ *          - @ref k0_qplc_scan_ne_64u8u
+ *          - @ref k0_qplc_scan_range_64u8u
+ *          - @ref k0_qplc_scan_not_range_64u8u
+ *
+ */
+
+#ifndef SCAN_64U_OPT_H
+#define SCAN_64U_OPT_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+// Writes 8 results of the comparison as bytes with 1 for the set bits of scan_mask
+OWN_QPLC_INLINE(void, own_k0_store_scan_64u8u, (uint8_t* dst_ptr, __mmask8 scan_mask)) {
+    __m512i dstmm = _mm512_movm_epi8((__mmask64)scan_mask);
+    dstmm         = _mm512_abs_epi8(dstmm);
+    _mm512_mask_storeu_epi8(dst_ptr, 0x00000000000000FF, dstmm);
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_lt_64u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint64_t low_value)) {
+    uint32_t length8           = length & (-8);
+    uint32_t tail              = length - length8;
+    __m512i  broadcasted_value = _mm512_set1_epi64((int64_t)low_value);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m512i  srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask8 scan_mask = _mm512_cmp_epu64_mask(srcmm, broadcasted_value, _MM_CMPINT_LT);
+        own_k0_store_scan_64u8u(dst_ptr, scan_mask);
+
+        src_ptr += 64U;
+        dst_ptr += 8U;
+    }
+
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] < low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_le_64u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint64_t low_value)) {
+    uint32_t length8           = length & (-8);
+    uint32_t tail              = length - length8;
+    __m512i  broadcasted_value = _mm512_set1_epi64((int64_t)low_value);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m512i  srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask8 scan_mask = _mm512_cmp_epu64_mask(srcmm, broadcasted_value, _MM_CMPINT_LE);
+        own_k0_store_scan_64u8u(dst_ptr, scan_mask);
+
+        src_ptr += 64U;
+        dst_ptr += 8U;
+    }
+
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] <= low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_gt_64u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint64_t low_value)) {
+    uint32_t length8           = length & (-8);
+    uint32_t tail              = length - length8;
+    __m512i  broadcasted_value = _mm512_set1_epi64((int64_t)low_value);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m512i  srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask8 scan_mask = _mm512_cmp_epu64_mask(srcmm, broadcasted_value, _MM_CMPINT_NLE);
+        own_k0_store_scan_64u8u(dst_ptr, scan_mask);
+
+        src_ptr += 64U;
+        dst_ptr += 8U;
+    }
+
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] > low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_ge_64u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint64_t low_value)) {
+    uint32_t length8           = length & (-8);
+    uint32_t tail              = length - length8;
+    __m512i  broadcasted_value = _mm512_set1_epi64((int64_t)low_value);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m512i  srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask8 scan_mask = _mm512_cmp_epu64_mask(srcmm, broadcasted_value, _MM_CMPINT_NLT);
+        own_k0_store_scan_64u8u(dst_ptr, scan_mask);
+
+        src_ptr += 64U;
+        dst_ptr += 8U;
+    }
+
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] >= low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_eq_64u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint64_t low_value)) {
+    uint32_t length8           = length & (-8);
+    uint32_t tail              = length - length8;
+    __m512i  broadcasted_value = _mm512_set1_epi64((int64_t)low_value);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m512i  srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask8 scan_mask = _mm512_cmp_epu64_mask(srcmm, broadcasted_value, _MM_CMPINT_EQ);
+        own_k0_store_scan_64u8u(dst_ptr, scan_mask);
+
+        src_ptr += 64U;
+        dst_ptr += 8U;
+    }
+
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] == low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_ne_64u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint64_t low_value)) {
+    uint32_t length8           = length & (-8);
+    uint32_t tail              = length - length8;
+    __m512i  broadcasted_value = _mm512_set1_epi64((int64_t)low_value);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m512i  srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask8 scan_mask = _mm512_cmp_epu64_mask(srcmm, broadcasted_value, _MM_CMPINT_NE);
+        own_k0_store_scan_64u8u(dst_ptr, scan_mask);
+
+        src_ptr += 64U;
+        dst_ptr += 8U;
+    }
+
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] != low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_range_64u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value)) {
+    uint32_t length8                = length & (-8);
+    uint32_t tail                   = length - length8;
+    __m512i  broadcasted_low_value  = _mm512_set1_epi64((int64_t)low_value);
+    __m512i  broadcasted_high_value = _mm512_set1_epi64((int64_t)high_value);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m512i  srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask8 scan_mask = _mm512_cmp_epu64_mask(srcmm, broadcasted_low_value, _MM_CMPINT_NLT);
+        scan_mask          = _mm512_mask_cmp_epu64_mask(scan_mask, srcmm, broadcasted_high_value, _MM_CMPINT_LE);
+        own_k0_store_scan_64u8u(dst_ptr, scan_mask);
+
+        src_ptr += 64U;
+        dst_ptr += 8U;
+    }
+
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = ((src_64u_ptr[idx] >= low_value) && (src_64u_ptr[idx] <= high_value)) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_not_range_64u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value)) {
+    uint32_t length8                = length & (-8);
+    uint32_t tail                   = length - length8;
+    __m512i  broadcasted_low_value  = _mm512_set1_epi64((int64_t)low_value);
+    __m512i  broadcasted_high_value = _mm512_set1_epi64((int64_t)high_value);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m512i  srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask8 scan_mask = _mm512_cmp_epu64_mask(srcmm, broadcasted_low_value, _MM_CMPINT_LT);
+        scan_mask |= _mm512_cmp_epu64_mask(srcmm, broadcasted_high_value, _MM_CMPINT_NLE);
+        own_k0_store_scan_64u8u(dst_ptr, scan_mask);
+
+        src_ptr += 64U;
+        dst_ptr += 8U;
+    }
+
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = ((src_64u_ptr[idx] < low_value) || (src_64u_ptr[idx] > high_value)) ? 1U : 0U;
+    }
+}
+
+#endif // SCAN_64U_OPT_H
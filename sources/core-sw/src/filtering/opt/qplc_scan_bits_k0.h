@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of fused scan kernels for bit-vector output
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref k0_qplc_scan_bits_8u
+ *          - @ref k0_qplc_scan_bits_16u
+ *          - @ref k0_qplc_scan_bits_32u
+ *
+ * @note Kernels process only full groups of 64 elements and return the number of processed elements,
+ *       the rest is processed by the generic implementation.
+ */
+
+#ifndef OWN_SCAN_BITS_K0_H
+#define OWN_SCAN_BITS_K0_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+OWN_QPLC_INLINE(void, k0_own_scan_bits_store,
+                (uint64_t bits, uint8_t* dst_ptr, uint32_t index, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
+                 uint32_t* sum_ptr)) {
+    *(uint64_t*)dst_ptr = bits;
+
+    if (0U == bits) { return; }
+    if (OWN_MAX_32U == *min_value_ptr) { *min_value_ptr = index + (uint32_t)_tzcnt_u64(bits); }
+    *max_value_ptr = index + 63U - (uint32_t)_lzcnt_u64(bits);
+    *sum_ptr += (uint32_t)_mm_popcnt_u64(bits);
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_scan_bits_8u,
+            (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+             uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+             uint32_t* index_ptr)) {
+    if (low_value > UINT8_MAX) { return 0U; }
+
+    const __m512i  z_low          = _mm512_set1_epi8((char)low_value);
+    const __m512i  z_high         = _mm512_set1_epi8((char)QPL_MIN(high_value, UINT8_MAX));
+    const uint64_t inversion_mask = (inversion_flag) ? UINT64_MAX : 0U;
+    const uint32_t length_64      = length & (~63U);
+    const uint32_t index          = *index_ptr;
+    uint32_t       min_value      = *min_value_ptr;
+    uint32_t       max_value      = *max_value_ptr;
+    uint32_t       sum            = 0U;
+
+    for (uint32_t idx = 0U; idx < length_64; idx += 64U) {
+        const __m512i  z_data = _mm512_loadu_si512((void const*)(src_ptr + idx));
+        const uint64_t bits   = _mm512_mask_cmple_epu8_mask(_mm512_cmpge_epu8_mask(z_data, z_low), z_data, z_high);
+
+        k0_own_scan_bits_store(bits ^ inversion_mask, dst_ptr + (idx >> 3U), index + idx, &min_value,
+                               &max_value, &sum);
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr = index + length_64;
+
+    return length_64;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_scan_bits_16u,
+            (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+             uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+             uint32_t* index_ptr)) {
+    if (low_value > UINT16_MAX) { return 0U; }
+
+    const uint16_t* src_16u_ptr    = (const uint16_t*)src_ptr;
+    const __m512i   z_low          = _mm512_set1_epi16((short)low_value);
+    const __m512i   z_high         = _mm512_set1_epi16((short)QPL_MIN(high_value, UINT16_MAX));
+    const uint64_t  inversion_mask = (inversion_flag) ? UINT64_MAX : 0U;
+    const uint32_t  length_64      = length & (~63U);
+    const uint32_t  index          = *index_ptr;
+    uint32_t        min_value      = *min_value_ptr;
+    uint32_t        max_value      = *max_value_ptr;
+    uint32_t        sum            = 0U;
+
+    for (uint32_t idx = 0U; idx < length_64; idx += 64U) {
+        const __m512i z_data_0 = _mm512_loadu_si512((void const*)(src_16u_ptr + idx));
+        const __m512i z_data_1 = _mm512_loadu_si512((void const*)(src_16u_ptr + idx + 32U));
+
+        const uint64_t bits_0 =
+                _mm512_mask_cmple_epu16_mask(_mm512_cmpge_epu16_mask(z_data_0, z_low), z_data_0, z_high);
+        const uint64_t bits_1 =
+                _mm512_mask_cmple_epu16_mask(_mm512_cmpge_epu16_mask(z_data_1, z_low), z_data_1, z_high);
+
+        k0_own_scan_bits_store((bits_0 | (bits_1 << 32U)) ^ inversion_mask, dst_ptr + (idx >> 3U), index + idx,
+                               &min_value, &max_value, &sum);
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr = index + length_64;
+
+    return length_64;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_scan_bits_32u,
+            (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+             uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+             uint32_t* index_ptr)) {
+    const uint32_t* src_32u_ptr    = (const uint32_t*)src_ptr;
+    const __m512i   z_low          = _mm512_set1_epi32((int)low_value);
+    const __m512i   z_high         = _mm512_set1_epi32((int)high_value);
+    const uint64_t  inversion_mask = (inversion_flag) ? UINT64_MAX : 0U;
+    const uint32_t  length_64      = length & (~63U);
+    const uint32_t  index          = *index_ptr;
+    uint32_t        min_value      = *min_value_ptr;
+    uint32_t        max_value      = *max_value_ptr;
+    uint32_t        sum            = 0U;
+
+    for (uint32_t idx = 0U; idx < length_64; idx += 64U) {
+        uint64_t bits = 0U;
+
+        for (uint32_t part = 0U; part < 4U; part++) {
+            const __m512i  z_data = _mm512_loadu_si512((void const*)(src_32u_ptr + idx + part * 16U));
+            const uint64_t mask = _mm512_mask_cmple_epu32_mask(_mm512_cmpge_epu32_mask(z_data, z_low), z_data, z_high);
+
+            bits |= mask << (part * 16U);
+        }
+
+        k0_own_scan_bits_store(bits ^ inversion_mask, dst_ptr + (idx >> 3U), index + idx, &min_value,
+                               &max_value, &sum);
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr = index + length_64;
+
+    return length_64;
+}
+
+#endif // OWN_SCAN_BITS_K0_H
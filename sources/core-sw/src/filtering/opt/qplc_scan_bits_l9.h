@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of fused scan kernels for bit-vector output
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_scan_bits_8u
+ *          - @ref l9_qplc_scan_bits_16u
+ *          - @ref l9_qplc_scan_bits_32u
+ *
+ * @note Kernels process only full groups of 64 elements and return the number of processed elements,
+ *       the rest is processed by the generic implementation.
+ */
+
+#ifndef OWN_SCAN_BITS_L9_H
+#define OWN_SCAN_BITS_L9_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+OWN_QPLC_INLINE(__m256i, l9_own_scan_bits_in_range_8u, (__m256i y_data, __m256i y_low, __m256i y_high)) {
+    const __m256i y_greater_equals = _mm256_cmpeq_epi8(_mm256_max_epu8(y_data, y_low), y_data);
+    const __m256i y_less_equals    = _mm256_cmpeq_epi8(_mm256_min_epu8(y_data, y_high), y_data);
+
+    return _mm256_and_si256(y_greater_equals, y_less_equals);
+}
+
+OWN_QPLC_INLINE(__m256i, l9_own_scan_bits_in_range_16u, (__m256i y_data, __m256i y_low, __m256i y_high)) {
+    const __m256i y_greater_equals = _mm256_cmpeq_epi16(_mm256_max_epu16(y_data, y_low), y_data);
+    const __m256i y_less_equals    = _mm256_cmpeq_epi16(_mm256_min_epu16(y_data, y_high), y_data);
+
+    return _mm256_and_si256(y_greater_equals, y_less_equals);
+}
+
+OWN_QPLC_INLINE(__m256i, l9_own_scan_bits_in_range_32u, (__m256i y_data, __m256i y_low, __m256i y_high)) {
+    const __m256i y_greater_equals = _mm256_cmpeq_epi32(_mm256_max_epu32(y_data, y_low), y_data);
+    const __m256i y_less_equals    = _mm256_cmpeq_epi32(_mm256_min_epu32(y_data, y_high), y_data);
+
+    return _mm256_and_si256(y_greater_equals, y_less_equals);
+}
+
+OWN_QPLC_INLINE(void, l9_own_scan_bits_store,
+                (uint64_t bits, uint8_t* dst_ptr, uint32_t index, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
+                 uint32_t* sum_ptr)) {
+    *(uint64_t*)dst_ptr = bits;
+
+    if (0U == bits) { return; }
+    if (OWN_MAX_32U == *min_value_ptr) { *min_value_ptr = index + (uint32_t)_tzcnt_u64(bits); }
+    *max_value_ptr = index + 63U - (uint32_t)_lzcnt_u64(bits);
+    *sum_ptr += (uint32_t)_mm_popcnt_u64(bits);
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_scan_bits_8u,
+            (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+             uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+             uint32_t* index_ptr)) {
+    if (low_value > UINT8_MAX) { return 0U; }
+
+    const __m256i  y_low          = _mm256_set1_epi8((char)low_value);
+    const __m256i  y_high         = _mm256_set1_epi8((char)QPL_MIN(high_value, UINT8_MAX));
+    const uint64_t inversion_mask = (inversion_flag) ? UINT64_MAX : 0U;
+    const uint32_t length_64      = length & (~63U);
+    const uint32_t index          = *index_ptr;
+    uint32_t       min_value      = *min_value_ptr;
+    uint32_t       max_value      = *max_value_ptr;
+    uint32_t       sum            = 0U;
+
+    for (uint32_t idx = 0U; idx < length_64; idx += 64U) {
+        const __m256i y_data_0 = _mm256_loadu_si256((__m256i const*)(src_ptr + idx));
+        const __m256i y_data_1 = _mm256_loadu_si256((__m256i const*)(src_ptr + idx + 32U));
+
+        const uint64_t bits_0 =
+                (uint32_t)_mm256_movemask_epi8(l9_own_scan_bits_in_range_8u(y_data_0, y_low, y_high));
+        const uint64_t bits_1 =
+                (uint32_t)_mm256_movemask_epi8(l9_own_scan_bits_in_range_8u(y_data_1, y_low, y_high));
+
+        l9_own_scan_bits_store((bits_0 | (bits_1 << 32U)) ^ inversion_mask, dst_ptr + (idx >> 3U), index + idx,
+                               &min_value, &max_value, &sum);
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr = index + length_64;
+
+    return length_64;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_scan_bits_16u,
+            (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+             uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+             uint32_t* index_ptr)) {
+    if (low_value > UINT16_MAX) { return 0U; }
+
+    const uint16_t* src_16u_ptr    = (const uint16_t*)src_ptr;
+    const __m256i   y_low          = _mm256_set1_epi16((short)low_value);
+    const __m256i   y_high         = _mm256_set1_epi16((short)QPL_MIN(high_value, UINT16_MAX));
+    const uint64_t  inversion_mask = (inversion_flag) ? UINT64_MAX : 0U;
+    const uint32_t  length_64      = length & (~63U);
+    const uint32_t  index          = *index_ptr;
+    uint32_t        min_value      = *min_value_ptr;
+    uint32_t        max_value      = *max_value_ptr;
+    uint32_t        sum            = 0U;
+
+    for (uint32_t idx = 0U; idx < length_64; idx += 64U) {
+        uint64_t bits = 0U;
+
+        for (uint32_t part = 0U; part < 2U; part++) {
+            const uint16_t* part_ptr = src_16u_ptr + idx + part * 32U;
+
+            const __m256i y_mask_0 = l9_own_scan_bits_in_range_16u(_mm256_loadu_si256((__m256i const*)part_ptr),
+                                                                   y_low, y_high);
+            const __m256i y_mask_1 = l9_own_scan_bits_in_range_16u(
+                    _mm256_loadu_si256((__m256i const*)(part_ptr + 16U)), y_low, y_high);
+
+            // Packing works within 128-bit lanes, so the quadwords are reordered back before the movemask
+            const __m256i y_mask =
+                    _mm256_permute4x64_epi64(_mm256_packs_epi16(y_mask_0, y_mask_1), _MM_SHUFFLE(3, 1, 2, 0));
+
+            bits |= (uint64_t)(uint32_t)_mm256_movemask_epi8(y_mask) << (part * 32U);
+        }
+
+        l9_own_scan_bits_store(bits ^ inversion_mask, dst_ptr + (idx >> 3U), index + idx, &min_value,
+                               &max_value, &sum);
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr = index + length_64;
+
+    return length_64;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_scan_bits_32u,
+            (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+             uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+             uint32_t* index_ptr)) {
+    const uint32_t* src_32u_ptr    = (const uint32_t*)src_ptr;
+    const __m256i   y_low          = _mm256_set1_epi32((int)low_value);
+    const __m256i   y_high         = _mm256_set1_epi32((int)high_value);
+    const uint64_t  inversion_mask = (inversion_flag) ? UINT64_MAX : 0U;
+    const uint32_t  length_64      = length & (~63U);
+    const uint32_t  index          = *index_ptr;
+    uint32_t        min_value      = *min_value_ptr;
+    uint32_t        max_value      = *max_value_ptr;
+    uint32_t        sum            = 0U;
+
+    for (uint32_t idx = 0U; idx < length_64; idx += 64U) {
+        uint64_t bits = 0U;
+
+        for (uint32_t part = 0U; part < 8U; part++) {
+            const __m256i y_data = _mm256_loadu_si256((__m256i const*)(src_32u_ptr + idx + part * 8U));
+            const __m256i y_mask = l9_own_scan_bits_in_range_32u(y_data, y_low, y_high);
+
+            bits |= (uint64_t)(uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(y_mask)) << (part * 8U);
+        }
+
+        l9_own_scan_bits_store(bits ^ inversion_mask, dst_ptr + (idx >> 3U), index + idx, &min_value,
+                               &max_value, &sum);
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr = index + length_64;
+
+    return length_64;
+}
+
+#endif // OWN_SCAN_BITS_L9_H
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX512 implementation of all functions for scan in set analytics operation
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref k0_qplc_scan_in_set_8u
+ *          - @ref k0_qplc_scan_in_set_16u8u
+ *          - @ref k0_qplc_scan_in_set_32u8u
+ *
+ */
+
+#ifndef OWN_SCAN_IN_SET_K0_H
+#define OWN_SCAN_IN_SET_K0_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+/**
+ * @brief Maximal number of set values that are compared with every element, larger sets are binary searched
+ */
+#define OWN_SCAN_IN_SET_COMPARE_LIMIT 8U
+
+OWN_QPLC_INLINE(__mmask64, own_k0_scan_in_set_8u_kernel,
+                (__m512i srcmm, __m512i low_set_mm, __m512i high_set_mm, __m512i bit_table_mm)) {
+    const __m512i byte_index_mm = _mm512_and_si512(_mm512_srli_epi16(srcmm, 3U), _mm512_set1_epi8(0x0F));
+    const __m512i bit_index_mm  = _mm512_and_si512(srcmm, _mm512_set1_epi8(0x07));
+
+    // Codes 0..127 are looked up in the low half of the bitmap, codes 128..255 in the high one
+    const __mmask64 is_high_mask = _mm512_test_epi8_mask(srcmm, _mm512_set1_epi8((char)0x80));
+    const __m512i   low_byte_mm  = _mm512_shuffle_epi8(low_set_mm, byte_index_mm);
+    const __m512i   high_byte_mm = _mm512_shuffle_epi8(high_set_mm, byte_index_mm);
+    const __m512i   set_byte_mm  = _mm512_mask_blend_epi8(is_high_mask, low_byte_mm, high_byte_mm);
+
+    return _mm512_test_epi8_mask(set_byte_mm, _mm512_shuffle_epi8(bit_table_mm, bit_index_mm));
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_in_set_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, const uint8_t* set_ptr)) {
+    uint32_t length64 = length & (-64);
+    uint32_t tail     = length - length64;
+
+    // 256-bit bitmap is kept in registers, every 128-bit lane holds a copy of the looked up half
+    const __m512i low_set_mm   = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)set_ptr));
+    const __m512i high_set_mm  = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)(set_ptr + 16U)));
+    const __m512i bit_table_mm = _mm512_broadcast_i32x4(
+            _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)128, 1, 2, 4, 8, 16, 32, 64, (char)128));
+
+    for (uint32_t i = 0U; i < length64; i += 64U) {
+        __m512i   srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask64 scan_mask = own_k0_scan_in_set_8u_kernel(srcmm, low_set_mm, high_set_mm, bit_table_mm);
+        __m512i   dstmm     = _mm512_movm_epi8(scan_mask);
+        dstmm               = _mm512_abs_epi8(dstmm);
+        _mm512_storeu_si512(dst_ptr, dstmm);
+
+        src_ptr += 64U;
+        dst_ptr += 64U;
+    }
+
+    if (0U != tail) {
+        __mmask64 tail_mask = (1ULL << tail) - 1U;
+        __m512i   srcmm     = _mm512_maskz_loadu_epi8(tail_mask, src_ptr);
+        __mmask64 scan_mask = own_k0_scan_in_set_8u_kernel(srcmm, low_set_mm, high_set_mm, bit_table_mm);
+        __m512i   dstmm     = _mm512_movm_epi8(scan_mask);
+        dstmm               = _mm512_abs_epi8(dstmm);
+        _mm512_mask_storeu_epi8(dst_ptr, tail_mask, dstmm);
+    }
+}
+
+OWN_QPLC_INLINE(__mmask16, own_k0_scan_in_set_16u_kernel, (__m512i srcmm, const uint8_t* set_ptr)) {
+    // Every element gathers the 32-bit word of the bitmap with its bit
+    const __m512i word_mm = _mm512_i32gather_epi32(_mm512_srli_epi32(srcmm, 5U), (const void*)set_ptr, 4);
+    const __m512i bit_mm  = _mm512_srlv_epi32(word_mm, _mm512_and_si512(srcmm, _mm512_set1_epi32(31)));
+
+    return _mm512_test_epi32_mask(bit_mm, _mm512_set1_epi32(1));
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_in_set_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, const uint8_t* set_ptr)) {
+    uint32_t length16 = length & (-16);
+    uint32_t tail     = length - length16;
+
+    for (uint32_t i = 0U; i < length16; i += 16U) {
+        __m512i   srcmm     = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)src_ptr));
+        __mmask64 scan_mask = (__mmask64)own_k0_scan_in_set_16u_kernel(srcmm, set_ptr);
+        __m512i   dstmm     = _mm512_movm_epi8(scan_mask);
+        dstmm               = _mm512_abs_epi8(dstmm);
+        _mm512_mask_storeu_epi8(dst_ptr, 0x000000000000FFFF, dstmm);
+
+        src_ptr += 32U;
+        dst_ptr += 16U;
+    }
+
+    if (0U != tail) {
+        __mmask16 tail_mask = (__mmask16)((1U << tail) - 1U);
+        __m512i   srcmm     = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail_mask, (const __m256i*)src_ptr));
+        __mmask64 scan_mask = (__mmask64)own_k0_scan_in_set_16u_kernel(srcmm, set_ptr);
+        __m512i   dstmm     = _mm512_movm_epi8(scan_mask);
+        dstmm               = _mm512_abs_epi8(dstmm);
+        _mm512_mask_storeu_epi8(dst_ptr, (__mmask64)tail_mask, dstmm);
+    }
+}
+
+OWN_QPLC_INLINE(__mmask16, own_k0_scan_in_set_32u_kernel,
+                (__m512i srcmm, const uint32_t* set_ptr, uint32_t set_size, uint32_t first_step)) {
+    const __m512i zero_mm = _mm512_setzero_si512();
+    const __m512i one_mm  = _mm512_set1_epi32(1);
+
+    __mmask16 scan_mask = 0U;
+
+    if (set_size <= OWN_SCAN_IN_SET_COMPARE_LIMIT) {
+        for (uint32_t idx = 0U; idx < set_size; idx++) {
+            scan_mask |= _mm512_cmpeq_epu32_mask(srcmm, _mm512_set1_epi32((int)set_ptr[idx]));
+        }
+
+        return scan_mask;
+    }
+
+    // Branchless binary search in all lanes at once, position is the number of set values not greater than element
+    const __m512i size_mm     = _mm512_set1_epi32((int)set_size);
+    __m512i       position_mm = zero_mm;
+
+    for (uint32_t step = first_step; 0U != step; step >>= 1U) {
+        const __m512i   candidate_mm = _mm512_add_epi32(position_mm, _mm512_set1_epi32((int)step));
+        const __mmask16 valid_mask   = _mm512_cmple_epu32_mask(candidate_mm, size_mm);
+        const __m512i   value_mm     = _mm512_mask_i32gather_epi32(zero_mm, valid_mask,
+                                                                   _mm512_sub_epi32(candidate_mm, one_mm),
+                                                                   (const void*)set_ptr, 4);
+        const __mmask16 take_mask    = _mm512_mask_cmple_epu32_mask(valid_mask, value_mm, srcmm);
+
+        position_mm = _mm512_mask_mov_epi32(position_mm, take_mask, candidate_mm);
+    }
+
+    const __mmask16 found_mask = _mm512_cmpneq_epu32_mask(position_mm, zero_mm);
+    const __m512i   value_mm   = _mm512_mask_i32gather_epi32(zero_mm, found_mask, _mm512_sub_epi32(position_mm, one_mm),
+                                                             (const void*)set_ptr, 4);
+
+    return _mm512_mask_cmpeq_epu32_mask(found_mask, value_mm, srcmm);
+}
+
+OWN_OPT_FUN(void, k0_qplc_scan_in_set_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, const uint32_t* set_ptr, uint32_t set_size)) {
+    uint32_t length16   = length & (-16);
+    uint32_t tail       = length - length16;
+    uint32_t first_step = (0U == set_size) ? 0U : (1U << (31U - _lzcnt_u32(set_size)));
+
+    for (uint32_t i = 0U; i < length16; i += 16U) {
+        __m512i   srcmm     = _mm512_loadu_si512(src_ptr);
+        __mmask64 scan_mask = (__mmask64)own_k0_scan_in_set_32u_kernel(srcmm, set_ptr, set_size, first_step);
+        __m512i   dstmm     = _mm512_movm_epi8(scan_mask);
+        dstmm               = _mm512_abs_epi8(dstmm);
+        _mm512_mask_storeu_epi8(dst_ptr, 0x000000000000FFFF, dstmm);
+
+        src_ptr += 64U;
+        dst_ptr += 16U;
+    }
+
+    if (0U != tail) {
+        __mmask16 tail_mask = (__mmask16)((1U << tail) - 1U);
+        __m512i   srcmm     = _mm512_maskz_loadu_epi32(tail_mask, src_ptr);
+        __mmask64 scan_mask = (__mmask64)own_k0_scan_in_set_32u_kernel(srcmm, set_ptr, set_size, first_step);
+        __m512i   dstmm     = _mm512_movm_epi8(scan_mask);
+        dstmm               = _mm512_abs_epi8(dstmm);
+        _mm512_mask_storeu_epi8(dst_ptr, (__mmask64)tail_mask, dstmm);
+    }
+}
+
+#endif // OWN_SCAN_IN_SET_K0_H
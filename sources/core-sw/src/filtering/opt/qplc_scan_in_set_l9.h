@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of all functions for scan in set analytics operation
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_scan_in_set_8u
+ *          - @ref l9_qplc_scan_in_set_16u8u
+ *          - @ref l9_qplc_scan_in_set_32u8u
+ *
+ */
+
+#ifndef OWN_SCAN_IN_SET_L9_H
+#define OWN_SCAN_IN_SET_L9_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+/**
+ * @brief Maximal number of set values that are compared with every element, larger sets are binary searched
+ */
+#define OWN_SCAN_IN_SET_COMPARE_LIMIT 8U
+
+OWN_QPLC_INLINE(uint8_t, own_l9_scan_in_set_bitmap, (const uint8_t* set_ptr, uint32_t value)) {
+    return (set_ptr[value >> 3U] >> (value & 7U)) & 1U;
+}
+
+OWN_QPLC_INLINE(uint8_t, own_l9_scan_in_set_search, (const uint32_t* set_ptr, uint32_t set_size, uint32_t value)) {
+    uint32_t position = 0U;
+    uint32_t count    = set_size;
+
+    while (0U != count) {
+        const uint32_t half = count >> 1U;
+
+        if (set_ptr[position + half] <= value) {
+            position += half + 1U;
+            count -= half + 1U;
+        } else {
+            count = half;
+        }
+    }
+
+    return (0U != position && set_ptr[position - 1U] == value) ? 1U : 0U;
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_in_set_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, const uint8_t* set_ptr)) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+
+    // 256-bit bitmap is kept in registers, every 128-bit lane holds a copy of the looked up half
+    const __m256i low_set_mm   = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)set_ptr));
+    const __m256i high_set_mm  = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(set_ptr + 16U)));
+    const __m256i bit_table_mm = _mm256_broadcastsi128_si256(
+            _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)128, 1, 2, 4, 8, 16, 32, 64, (char)128));
+    const __m256i nibble_mm    = _mm256_set1_epi8(0x0F);
+    const __m256i bit_index_mm = _mm256_set1_epi8(0x07);
+    const __m256i one_mm       = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm         = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i byte_index_mm = _mm256_and_si256(_mm256_srli_epi16(srcmm, 3U), nibble_mm);
+        __m256i bit_mm        = _mm256_shuffle_epi8(bit_table_mm, _mm256_and_si256(srcmm, bit_index_mm));
+
+        // Codes 0..127 are looked up in the low half of the bitmap, codes 128..255 in the high one
+        __m256i set_byte_mm = _mm256_blendv_epi8(_mm256_shuffle_epi8(low_set_mm, byte_index_mm),
+                                                 _mm256_shuffle_epi8(high_set_mm, byte_index_mm), srcmm);
+        __m256i dstmm       = _mm256_cmpeq_epi8(_mm256_and_si256(set_byte_mm, bit_mm), bit_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = own_l9_scan_in_set_bitmap(set_ptr, src_ptr[idx]);
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_in_set_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, const uint8_t* set_ptr)) {
+    uint32_t length16 = length & (-16);
+    uint32_t tail     = length - length16;
+
+    const __m256i bit_index_mm = _mm256_set1_epi32(31);
+    const __m256i one_mm       = _mm256_set1_epi32(1);
+
+    for (uint32_t i = 0U; i < length16; i += 16U) {
+        __m256i src0mm = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)src_ptr));
+        __m256i src1mm = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(src_ptr + 16U)));
+
+        // Every element gathers the 32-bit word of the bitmap with its bit
+        __m256i word0mm = _mm256_i32gather_epi32((const int*)set_ptr, _mm256_srli_epi32(src0mm, 5U), 4);
+        __m256i word1mm = _mm256_i32gather_epi32((const int*)set_ptr, _mm256_srli_epi32(src1mm, 5U), 4);
+        __m256i bit0mm  = _mm256_and_si256(_mm256_srlv_epi32(word0mm, _mm256_and_si256(src0mm, bit_index_mm)), one_mm);
+        __m256i bit1mm  = _mm256_and_si256(_mm256_srlv_epi32(word1mm, _mm256_and_si256(src1mm, bit_index_mm)), one_mm);
+
+        __m256i dst16mm = _mm256_permute4x64_epi64(_mm256_packus_epi32(bit0mm, bit1mm), 0xD8);
+        __m128i dstmm   = _mm_packus_epi16(_mm256_castsi256_si128(dst16mm), _mm256_extracti128_si256(dst16mm, 1));
+        _mm_storeu_si128((__m128i*)dst_ptr, dstmm);
+
+        src_ptr += 32U;
+        dst_ptr += 16U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = own_l9_scan_in_set_bitmap(set_ptr, src_16u_ptr[idx]);
+    }
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_in_set_32u_kernel,
+                (__m256i srcmm, const uint32_t* set_ptr, uint32_t set_size, uint32_t first_step)) {
+    const __m256i zero_mm = _mm256_setzero_si256();
+    const __m256i one_mm  = _mm256_set1_epi32(1);
+
+    if (set_size <= OWN_SCAN_IN_SET_COMPARE_LIMIT) {
+        __m256i scan_mm = zero_mm;
+
+        for (uint32_t idx = 0U; idx < set_size; idx++) {
+            scan_mm = _mm256_or_si256(scan_mm, _mm256_cmpeq_epi32(srcmm, _mm256_set1_epi32((int)set_ptr[idx])));
+        }
+
+        return scan_mm;
+    }
+
+    // Branchless binary search in all lanes at once, position is the number of set values not greater than element.
+    // Positions never exceed 2^31, so they are compared as signed values, set values are compared as unsigned.
+    const __m256i size_mm     = _mm256_set1_epi32((int)set_size);
+    __m256i       position_mm = zero_mm;
+
+    for (uint32_t step = first_step; 0U != step; step >>= 1U) {
+        const __m256i candidate_mm = _mm256_add_epi32(position_mm, _mm256_set1_epi32((int)step));
+        const __m256i valid_mm     = _mm256_andnot_si256(_mm256_cmpgt_epi32(candidate_mm, size_mm),
+                                                         _mm256_cmpeq_epi32(zero_mm, zero_mm));
+        const __m256i value_mm     = _mm256_mask_i32gather_epi32(zero_mm, (const int*)set_ptr,
+                                                                 _mm256_sub_epi32(candidate_mm, one_mm), valid_mm, 4);
+        const __m256i take_mm      = _mm256_and_si256(valid_mm,
+                                                      _mm256_cmpeq_epi32(_mm256_max_epu32(value_mm, srcmm), srcmm));
+
+        position_mm = _mm256_blendv_epi8(position_mm, candidate_mm, take_mm);
+    }
+
+    const __m256i found_mm = _mm256_andnot_si256(_mm256_cmpeq_epi32(position_mm, zero_mm),
+                                                 _mm256_cmpeq_epi32(zero_mm, zero_mm));
+    const __m256i value_mm = _mm256_mask_i32gather_epi32(zero_mm, (const int*)set_ptr,
+                                                         _mm256_sub_epi32(position_mm, one_mm), found_mm, 4);
+
+    return _mm256_and_si256(found_mm, _mm256_cmpeq_epi32(value_mm, srcmm));
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_in_set_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, const uint32_t* set_ptr, uint32_t set_size)) {
+    uint32_t length8    = length & (-8);
+    uint32_t tail       = length - length8;
+    uint32_t first_step = (0U == set_size) ? 0U : (1U << (31U - _lzcnt_u32(set_size)));
+
+    const __m256i one_mm = _mm256_set1_epi32(1);
+
+    for (uint32_t i = 0U; i < length8; i += 8U) {
+        __m256i srcmm  = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i scanmm = _mm256_and_si256(own_l9_scan_in_set_32u_kernel(srcmm, set_ptr, set_size, first_step), one_mm);
+
+        // Dword results are narrowed to bytes, both packs keep the 128-bit lanes apart
+        __m256i dst16mm = _mm256_packus_epi32(scanmm, scanmm);
+        __m256i dst8mm  = _mm256_packus_epi16(dst16mm, dst16mm);
+        __m128i dstmm   = _mm_unpacklo_epi32(_mm256_castsi256_si128(dst8mm), _mm256_extracti128_si256(dst8mm, 1));
+        _mm_storel_epi64((__m128i*)dst_ptr, dstmm);
+
+        src_ptr += 32U;
+        dst_ptr += 8U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = own_l9_scan_in_set_search(set_ptr, set_size, src_32u_ptr[idx]);
+    }
+}
+
+#endif // OWN_SCAN_IN_SET_L9_H
@@ -0,0 +1,809 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of all functions for scan analytics operation
+ * @date 10/17/2026
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_scan_lt_8u
+ *          - @ref l9_qplc_scan_lt_16u8u
+ *          - @ref l9_qplc_scan_lt_32u8u
+ *          - @ref l9_qplc_scan_le_8u
+ *          - @ref l9_qplc_scan_le_16u8u
+ *          - @ref l9_qplc_scan_le_32u8u
+ *          - @ref l9_qplc_scan_gt_8u
+ *          - @ref l9_qplc_scan_gt_16u8u
+ *          - @ref l9_qplc_scan_gt_32u8u
+ *          - @ref l9_qplc_scan_ge_8u
+ *          - @ref l9_qplc_scan_ge_16u8u
+ *          - @ref l9_qplc_scan_ge_32u8u
+ *          - @ref l9_qplc_scan_eq_8u
+ *          - @ref l9_qplc_scan_eq_16u8u
+ *          - @ref l9_qplc_scan_eq_32u8u
+ *          - @ref l9_qplc_scan_ne_8u
+ *          - @ref l9_qplc_scan_ne_16u8u
+ *          - @ref l9_qplc_scan_ne_32u8u
+ *          - @ref l9_qplc_scan_range_8u
+ *          - @ref l9_qplc_scan_range_16u8u
+ *          - @ref l9_qplc_scan_range_32u8u
+ *          - @ref l9_qplc_scan_not_range_8u
+ *          - @ref l9_qplc_scan_not_range_16u8u
+ *          - @ref l9_qplc_scan_not_range_32u8u
+ *
+ */
+
+#ifndef SCAN_L9_OPT_H
+#define SCAN_L9_OPT_H
+
+#include "own_qplc_defs.h"
+
+// ********************** Comparison kernels ****************************** //
+
+/**
+ * @brief Comparison kernels return all-ones lanes for elements that satisfy the predicate.
+ *
+ * @note AVX2 has no unsigned comparisons, so "greater or equal" is derived from max(a, b) == a
+ *       and "less or equal" from min(a, b) == a.
+ */
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_EQ_8u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi8(srcmm, low_mm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_NE_8u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_xor_si256(_mm256_cmpeq_epi8(srcmm, low_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_GE_8u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi8(_mm256_max_epu8(srcmm, low_mm), srcmm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_LE_8u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(srcmm, low_mm), srcmm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_LT_8u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_GE_8u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_GT_8u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_LE_8u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_RANGE_8u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(srcmm, low_mm), srcmm), _mm256_cmpeq_epi8(_mm256_min_epu8(srcmm, high_mm), srcmm));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_NOT_RANGE_8u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_RANGE_8u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_EQ_16u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi16(srcmm, low_mm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_NE_16u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_xor_si256(_mm256_cmpeq_epi16(srcmm, low_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_GE_16u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi16(_mm256_max_epu16(srcmm, low_mm), srcmm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_LE_16u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi16(_mm256_min_epu16(srcmm, low_mm), srcmm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_LT_16u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_GE_16u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_GT_16u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_LE_16u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_RANGE_16u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_and_si256(_mm256_cmpeq_epi16(_mm256_max_epu16(srcmm, low_mm), srcmm), _mm256_cmpeq_epi16(_mm256_min_epu16(srcmm, high_mm), srcmm));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_NOT_RANGE_16u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_RANGE_16u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_EQ_32u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi32(srcmm, low_mm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_NE_32u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_xor_si256(_mm256_cmpeq_epi32(srcmm, low_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_GE_32u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi32(_mm256_max_epu32(srcmm, low_mm), srcmm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_LE_32u_kernel, (__m256i srcmm, __m256i low_mm, __m256i UNREFERENCED_PARAMETER(high_mm))) {
+    return _mm256_cmpeq_epi32(_mm256_min_epu32(srcmm, low_mm), srcmm);
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_LT_32u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_GE_32u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_GT_32u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_LE_32u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_RANGE_32u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(srcmm, low_mm), srcmm), _mm256_cmpeq_epi32(_mm256_min_epu32(srcmm, high_mm), srcmm));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_NOT_RANGE_32u_kernel, (__m256i srcmm, __m256i low_mm, __m256i high_mm)) {
+    return _mm256_xor_si256(own_l9_scan_RANGE_32u_kernel(srcmm, low_mm, high_mm), _mm256_set1_epi32(-1));
+}
+
+// ********************** Mask narrowing ****************************** //
+
+/**
+ * @brief Narrows two 16-bit lane masks into one 8-bit lane mask preserving elements order
+ */
+OWN_QPLC_INLINE(__m256i, own_l9_pack_mask_16u8u, (__m256i maskmm0, __m256i maskmm1)) {
+    __m256i packedmm = _mm256_packs_epi16(maskmm0, maskmm1);
+    return _mm256_permute4x64_epi64(packedmm, 0xD8);
+}
+
+/**
+ * @brief Narrows four 32-bit lane masks into one 8-bit lane mask preserving elements order
+ */
+OWN_QPLC_INLINE(__m256i, own_l9_pack_mask_32u8u, (__m256i maskmm0, __m256i maskmm1, __m256i maskmm2, __m256i maskmm3)) {
+    __m256i packedmm0 = _mm256_packs_epi32(maskmm0, maskmm1);
+    __m256i packedmm1 = _mm256_packs_epi32(maskmm2, maskmm3);
+    __m256i packedmm  = _mm256_packs_epi16(packedmm0, packedmm1);
+    return _mm256_permutevar8x32_epi32(packedmm, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+// ********************** lt ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi8((char)low_value);
+    __m256i  high_mm  = _mm256_set1_epi8((char)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i dstmm = own_l9_scan_LT_8u_kernel(srcmm, low_mm, high_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_ptr[idx] < low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi16((short)low_value);
+    __m256i  high_mm  = _mm256_set1_epi16((short)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i maskmm0 = own_l9_scan_LT_16u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_LT_16u_kernel(srcmm1, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_16u8u(maskmm0, maskmm1);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 64U;
+        dst_ptr += 32U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_16u_ptr[idx] < low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi32((int)low_value);
+    __m256i  high_mm  = _mm256_set1_epi32((int)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i srcmm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i srcmm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        __m256i maskmm0 = own_l9_scan_LT_32u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_LT_32u_kernel(srcmm1, low_mm, high_mm);
+        __m256i maskmm2 = own_l9_scan_LT_32u_kernel(srcmm2, low_mm, high_mm);
+        __m256i maskmm3 = own_l9_scan_LT_32u_kernel(srcmm3, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_32u8u(maskmm0, maskmm1, maskmm2, maskmm3);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 128U;
+        dst_ptr += 32U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_32u_ptr[idx] < low_value) ? 1U : 0U;
+    }
+}
+
+// ********************** le ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi8((char)low_value);
+    __m256i  high_mm  = _mm256_set1_epi8((char)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i dstmm = own_l9_scan_LE_8u_kernel(srcmm, low_mm, high_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_ptr[idx] <= low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi16((short)low_value);
+    __m256i  high_mm  = _mm256_set1_epi16((short)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i maskmm0 = own_l9_scan_LE_16u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_LE_16u_kernel(srcmm1, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_16u8u(maskmm0, maskmm1);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 64U;
+        dst_ptr += 32U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_16u_ptr[idx] <= low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi32((int)low_value);
+    __m256i  high_mm  = _mm256_set1_epi32((int)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i srcmm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i srcmm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        __m256i maskmm0 = own_l9_scan_LE_32u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_LE_32u_kernel(srcmm1, low_mm, high_mm);
+        __m256i maskmm2 = own_l9_scan_LE_32u_kernel(srcmm2, low_mm, high_mm);
+        __m256i maskmm3 = own_l9_scan_LE_32u_kernel(srcmm3, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_32u8u(maskmm0, maskmm1, maskmm2, maskmm3);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 128U;
+        dst_ptr += 32U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_32u_ptr[idx] <= low_value) ? 1U : 0U;
+    }
+}
+
+// ********************** gt ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi8((char)low_value);
+    __m256i  high_mm  = _mm256_set1_epi8((char)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i dstmm = own_l9_scan_GT_8u_kernel(srcmm, low_mm, high_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_ptr[idx] > low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi16((short)low_value);
+    __m256i  high_mm  = _mm256_set1_epi16((short)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i maskmm0 = own_l9_scan_GT_16u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_GT_16u_kernel(srcmm1, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_16u8u(maskmm0, maskmm1);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 64U;
+        dst_ptr += 32U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_16u_ptr[idx] > low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi32((int)low_value);
+    __m256i  high_mm  = _mm256_set1_epi32((int)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i srcmm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i srcmm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        __m256i maskmm0 = own_l9_scan_GT_32u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_GT_32u_kernel(srcmm1, low_mm, high_mm);
+        __m256i maskmm2 = own_l9_scan_GT_32u_kernel(srcmm2, low_mm, high_mm);
+        __m256i maskmm3 = own_l9_scan_GT_32u_kernel(srcmm3, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_32u8u(maskmm0, maskmm1, maskmm2, maskmm3);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 128U;
+        dst_ptr += 32U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_32u_ptr[idx] > low_value) ? 1U : 0U;
+    }
+}
+
+// ********************** ge ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi8((char)low_value);
+    __m256i  high_mm  = _mm256_set1_epi8((char)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i dstmm = own_l9_scan_GE_8u_kernel(srcmm, low_mm, high_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_ptr[idx] >= low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi16((short)low_value);
+    __m256i  high_mm  = _mm256_set1_epi16((short)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i maskmm0 = own_l9_scan_GE_16u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_GE_16u_kernel(srcmm1, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_16u8u(maskmm0, maskmm1);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 64U;
+        dst_ptr += 32U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_16u_ptr[idx] >= low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi32((int)low_value);
+    __m256i  high_mm  = _mm256_set1_epi32((int)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i srcmm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i srcmm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        __m256i maskmm0 = own_l9_scan_GE_32u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_GE_32u_kernel(srcmm1, low_mm, high_mm);
+        __m256i maskmm2 = own_l9_scan_GE_32u_kernel(srcmm2, low_mm, high_mm);
+        __m256i maskmm3 = own_l9_scan_GE_32u_kernel(srcmm3, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_32u8u(maskmm0, maskmm1, maskmm2, maskmm3);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 128U;
+        dst_ptr += 32U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_32u_ptr[idx] >= low_value) ? 1U : 0U;
+    }
+}
+
+// ********************** eq ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi8((char)low_value);
+    __m256i  high_mm  = _mm256_set1_epi8((char)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i dstmm = own_l9_scan_EQ_8u_kernel(srcmm, low_mm, high_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_ptr[idx] == low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi16((short)low_value);
+    __m256i  high_mm  = _mm256_set1_epi16((short)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i maskmm0 = own_l9_scan_EQ_16u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_EQ_16u_kernel(srcmm1, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_16u8u(maskmm0, maskmm1);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 64U;
+        dst_ptr += 32U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_16u_ptr[idx] == low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi32((int)low_value);
+    __m256i  high_mm  = _mm256_set1_epi32((int)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i srcmm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i srcmm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        __m256i maskmm0 = own_l9_scan_EQ_32u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_EQ_32u_kernel(srcmm1, low_mm, high_mm);
+        __m256i maskmm2 = own_l9_scan_EQ_32u_kernel(srcmm2, low_mm, high_mm);
+        __m256i maskmm3 = own_l9_scan_EQ_32u_kernel(srcmm3, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_32u8u(maskmm0, maskmm1, maskmm2, maskmm3);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 128U;
+        dst_ptr += 32U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_32u_ptr[idx] == low_value) ? 1U : 0U;
+    }
+}
+
+// ********************** ne ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi8((char)low_value);
+    __m256i  high_mm  = _mm256_set1_epi8((char)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i dstmm = own_l9_scan_NE_8u_kernel(srcmm, low_mm, high_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_ptr[idx] != low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi16((short)low_value);
+    __m256i  high_mm  = _mm256_set1_epi16((short)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i maskmm0 = own_l9_scan_NE_16u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_NE_16u_kernel(srcmm1, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_16u8u(maskmm0, maskmm1);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 64U;
+        dst_ptr += 32U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_16u_ptr[idx] != low_value) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t UNREFERENCED_PARAMETER(high_value))) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi32((int)low_value);
+    __m256i  high_mm  = _mm256_set1_epi32((int)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i srcmm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i srcmm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        __m256i maskmm0 = own_l9_scan_NE_32u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_NE_32u_kernel(srcmm1, low_mm, high_mm);
+        __m256i maskmm2 = own_l9_scan_NE_32u_kernel(srcmm2, low_mm, high_mm);
+        __m256i maskmm3 = own_l9_scan_NE_32u_kernel(srcmm3, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_32u8u(maskmm0, maskmm1, maskmm2, maskmm3);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 128U;
+        dst_ptr += 32U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = (src_32u_ptr[idx] != low_value) ? 1U : 0U;
+    }
+}
+
+// ********************** range ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi8((char)low_value);
+    __m256i  high_mm  = _mm256_set1_epi8((char)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i dstmm = own_l9_scan_RANGE_8u_kernel(srcmm, low_mm, high_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = ((src_ptr[idx] >= low_value) && (src_ptr[idx] <= high_value)) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi16((short)low_value);
+    __m256i  high_mm  = _mm256_set1_epi16((short)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i maskmm0 = own_l9_scan_RANGE_16u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_RANGE_16u_kernel(srcmm1, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_16u8u(maskmm0, maskmm1);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 64U;
+        dst_ptr += 32U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = ((src_16u_ptr[idx] >= low_value) && (src_16u_ptr[idx] <= high_value)) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi32((int)low_value);
+    __m256i  high_mm  = _mm256_set1_epi32((int)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i srcmm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i srcmm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        __m256i maskmm0 = own_l9_scan_RANGE_32u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_RANGE_32u_kernel(srcmm1, low_mm, high_mm);
+        __m256i maskmm2 = own_l9_scan_RANGE_32u_kernel(srcmm2, low_mm, high_mm);
+        __m256i maskmm3 = own_l9_scan_RANGE_32u_kernel(srcmm3, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_32u8u(maskmm0, maskmm1, maskmm2, maskmm3);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 128U;
+        dst_ptr += 32U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = ((src_32u_ptr[idx] >= low_value) && (src_32u_ptr[idx] <= high_value)) ? 1U : 0U;
+    }
+}
+
+// ********************** not_range ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi8((char)low_value);
+    __m256i  high_mm  = _mm256_set1_epi8((char)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i dstmm = own_l9_scan_NOT_RANGE_8u_kernel(srcmm, low_mm, high_mm);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 32U;
+        dst_ptr += 32U;
+    }
+
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = ((src_ptr[idx] < low_value) || (src_ptr[idx] > high_value)) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_16u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi16((short)low_value);
+    __m256i  high_mm  = _mm256_set1_epi16((short)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i maskmm0 = own_l9_scan_NOT_RANGE_16u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_NOT_RANGE_16u_kernel(srcmm1, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_16u8u(maskmm0, maskmm1);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 64U;
+        dst_ptr += 32U;
+    }
+
+    const uint16_t* src_16u_ptr = (const uint16_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = ((src_16u_ptr[idx] < low_value) || (src_16u_ptr[idx] > high_value)) ? 1U : 0U;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_32u8u,
+            (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
+    uint32_t length32 = length & (-32);
+    uint32_t tail     = length - length32;
+    __m256i  low_mm   = _mm256_set1_epi32((int)low_value);
+    __m256i  high_mm  = _mm256_set1_epi32((int)high_value);
+    __m256i  one_mm   = _mm256_set1_epi8(1);
+
+    for (uint32_t i = 0U; i < length32; i += 32U) {
+        __m256i srcmm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i srcmm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i srcmm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i srcmm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        __m256i maskmm0 = own_l9_scan_NOT_RANGE_32u_kernel(srcmm0, low_mm, high_mm);
+        __m256i maskmm1 = own_l9_scan_NOT_RANGE_32u_kernel(srcmm1, low_mm, high_mm);
+        __m256i maskmm2 = own_l9_scan_NOT_RANGE_32u_kernel(srcmm2, low_mm, high_mm);
+        __m256i maskmm3 = own_l9_scan_NOT_RANGE_32u_kernel(srcmm3, low_mm, high_mm);
+        __m256i dstmm   = own_l9_pack_mask_32u8u(maskmm0, maskmm1, maskmm2, maskmm3);
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_and_si256(dstmm, one_mm));
+
+        src_ptr += 128U;
+        dst_ptr += 32U;
+    }
+
+    const uint32_t* src_32u_ptr = (const uint32_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < tail; idx++) {
+        dst_ptr[idx] = ((src_32u_ptr[idx] < low_value) || (src_32u_ptr[idx] > high_value)) ? 1U : 0U;
+    }
+}
+
+#endif // SCAN_L9_OPT_H
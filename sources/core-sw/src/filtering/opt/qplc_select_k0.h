@@ -12,9 +12,11 @@
   *          - @ref qplc_select_8u_i
   *          - @ref qplc_select_16u_i
   *          - @ref qplc_select_32u_i
+  *          - @ref qplc_select_64u_i
   *          - @ref qplc_select_8u
   *          - @ref qplc_select_16u
   *          - @ref qplc_select_32u
+  *          - @ref qplc_select_64u
   *
   */
 
@@ -165,4 +167,49 @@ OWN_OPT_FUN(uint32_t, k0_qplc_select_32u,
     return selected;
 }
 
+OWN_OPT_FUN(uint32_t, k0_qplc_select_64u,
+            (const uint8_t* src_ptr, const uint8_t* src2_ptr, uint8_t* dst_ptr, uint32_t length)) {
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    uint64_t* dst_64u_ptr = (uint64_t*)dst_ptr;
+    uint32_t  selected    = 0U;
+    uint32_t  remind      = length & 63;
+    uint32_t  num_data    = 0U;
+    __m512i   z_zero      = _mm512_setzero_si512();
+    __m512i   z_data;
+    __mmask64 msk  = 0;
+    __mmask8  msk8 = 0;
+
+    length -= remind;
+    for (uint32_t idx = 0U; idx < length; idx += 64) {
+        msk = _mm512_cmpneq_epi8_mask(z_zero, _mm512_loadu_si512((__m512i const*)(src2_ptr + idx)));
+        for (uint32_t idx_inloop = idx; (msk != 0); idx_inloop += 8, msk = (__mmask64)((uint64_t)msk >> 8U)) {
+            msk8 = (__mmask8)msk;
+            if (msk8 != 0) {
+                z_data   = _mm512_maskz_compress_epi64(msk8,
+                                                       _mm512_loadu_si512((__m512i const*)(src_64u_ptr + idx_inloop)));
+                num_data = (uint32_t)_mm_popcnt_u32((uint32_t)msk8);
+                msk8     = (__mmask8)_bzhi_u32(0xff, num_data);
+                _mm512_mask_storeu_epi64((void*)(dst_64u_ptr + selected), msk8, z_data);
+                selected += num_data;
+            }
+        }
+    }
+    if (remind) {
+        msk = _bzhi_u64((uint64_t)((int64_t)(-1)), remind);
+        msk = _mm512_cmpneq_epi8_mask(z_zero, _mm512_maskz_loadu_epi8(msk, (__m512i const*)(src2_ptr + length)));
+        for (uint32_t idx_inloop = length; (msk != 0); idx_inloop += 8, msk = (__mmask64)((uint64_t)msk >> 8U)) {
+            msk8 = (__mmask8)msk;
+            if (msk8 != 0) {
+                z_data = _mm512_maskz_compress_epi64(
+                        msk8, _mm512_maskz_loadu_epi64(msk8, (__m512i const*)(src_64u_ptr + idx_inloop)));
+                num_data = (uint32_t)_mm_popcnt_u32((uint32_t)msk8);
+                msk8     = (__mmask8)_bzhi_u32(0xff, num_data);
+                _mm512_mask_storeu_epi64((void*)(dst_64u_ptr + selected), msk8, z_data);
+                selected += num_data;
+            }
+        }
+    }
+    return selected;
+}
+
 #endif // OWN_SELECT_H
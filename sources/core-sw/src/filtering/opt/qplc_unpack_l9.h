@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2/BMI2 implementation of functions for unpacking little-endian bit-packed data
+ * @date 10/17/2026
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_unpack_nu8u
+ *          - @ref l9_qplc_unpack_nu16u
+ *          - @ref l9_qplc_unpack_nu32u
+ *
+ * @note Every group of elements is extracted with a single PDEP instruction: the packed bits are
+ *       deposited into the low bits of each output lane, so no per-element shifting or masking is needed.
+ */
+
+#ifndef OWN_UNPACK_L9_H
+#define OWN_UNPACK_L9_H
+
+#include "immintrin.h"
+#include "own_qplc_defs.h"
+
+/**
+ * @brief Scalar unpacking of the elements that do not fill a whole 8-element group
+ */
+OWN_QPLC_INLINE(void, own_l9_unpack_tail,
+                (const uint8_t* src_ptr, uint32_t num_elements, uint64_t bit_pos, uint32_t bit_width,
+                 uint8_t* dst_ptr, uint32_t dst_width)) {
+    uint64_t mask = OWN_BIT_MASK(bit_width);
+
+    for (uint32_t i = 0U; i < num_elements; i++) {
+        const uint8_t* byte_ptr = src_ptr + (bit_pos >> 3U);
+        uint32_t       shift    = (uint32_t)(bit_pos & OWN_BYTE_BIT_MASK);
+        uint32_t       bytes    = OWN_BITS_2_BYTE(shift + bit_width);
+        uint64_t       src      = 0U;
+
+        for (uint32_t j = 0U; j < bytes; j++) {
+            src |= ((uint64_t)byte_ptr[j]) << (j * OWN_BYTE_WIDTH);
+        }
+        src = (src >> shift) & mask;
+
+        switch (dst_width) {
+            case 1U: *dst_ptr = (uint8_t)src; break;
+            case 2U: *(uint16_t*)dst_ptr = (uint16_t)src; break;
+            default: *(uint32_t*)dst_ptr = (uint32_t)src; break;
+        }
+
+        dst_ptr += dst_width;
+        bit_pos += bit_width;
+    }
+}
+
+/**
+ * @brief Reads 64 bits starting from an arbitrary bit position (touches 9 bytes of the source)
+ */
+OWN_QPLC_INLINE(uint64_t, own_l9_load_64u, (const uint8_t* src_ptr, uint64_t bit_pos)) {
+    const uint8_t* byte_ptr = src_ptr + (bit_pos >> 3U);
+    uint32_t       shift    = (uint32_t)(bit_pos & OWN_BYTE_BIT_MASK);
+
+    // Double shift of the 9th byte avoids an undefined shift by 64 for byte-aligned positions
+    return (*(const uint64_t*)byte_ptr >> shift) | (((uint64_t)byte_ptr[8] << (63U - shift)) << 1U);
+}
+
+/**
+ * @brief Unpacks 1..7-bit elements to bytes, 8 elements per PDEP
+ */
+OWN_QPLC_INLINE(void, l9_qplc_unpack_nu8u,
+                (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint32_t bit_width,
+                 uint8_t* dst_ptr)) {
+    const uint64_t src_bytes = OWN_BITS_2_BYTE((uint64_t)num_elements * bit_width + start_bit);
+    const uint64_t pdep_mask = 0x0101010101010101LLU * OWN_BIT_MASK(bit_width);
+    uint64_t       bit_pos   = start_bit;
+
+    while ((num_elements >= 8U) && ((bit_pos >> 3U) + bit_width + 9U <= src_bytes)) {
+        *(uint64_t*)dst_ptr = _pdep_u64(own_l9_load_64u(src_ptr, bit_pos), pdep_mask);
+
+        bit_pos += 8U * bit_width;
+        dst_ptr += 8U;
+        num_elements -= 8U;
+    }
+
+    own_l9_unpack_tail(src_ptr, num_elements, bit_pos, bit_width, dst_ptr, sizeof(uint8_t));
+}
+
+/**
+ * @brief Unpacks 9..15-bit elements to words, 4 elements per PDEP
+ */
+OWN_QPLC_INLINE(void, l9_qplc_unpack_nu16u,
+                (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint32_t bit_width,
+                 uint8_t* dst_ptr)) {
+    const uint64_t src_bytes = OWN_BITS_2_BYTE((uint64_t)num_elements * bit_width + start_bit);
+    const uint64_t pdep_mask = 0x0001000100010001LLU * OWN_BIT_MASK(bit_width);
+    uint64_t       bit_pos   = start_bit;
+
+    while ((num_elements >= 8U) && ((bit_pos >> 3U) + bit_width + 9U <= src_bytes)) {
+        ((uint64_t*)dst_ptr)[0] = _pdep_u64(own_l9_load_64u(src_ptr, bit_pos), pdep_mask);
+        ((uint64_t*)dst_ptr)[1] = _pdep_u64(own_l9_load_64u(src_ptr, bit_pos + 4U * bit_width), pdep_mask);
+
+        bit_pos += 8U * bit_width;
+        dst_ptr += 8U * sizeof(uint16_t);
+        num_elements -= 8U;
+    }
+
+    own_l9_unpack_tail(src_ptr, num_elements, bit_pos, bit_width, dst_ptr, sizeof(uint16_t));
+}
+
+/**
+ * @brief Unpacks 17..31-bit elements to double words, 2 elements per PDEP
+ */
+OWN_QPLC_INLINE(void, l9_qplc_unpack_nu32u,
+                (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint32_t bit_width,
+                 uint8_t* dst_ptr)) {
+    const uint64_t src_bytes = OWN_BITS_2_BYTE((uint64_t)num_elements * bit_width + start_bit);
+    const uint64_t pdep_mask = 0x0000000100000001LLU * OWN_BIT_MASK(bit_width);
+    uint64_t       bit_pos   = start_bit;
+
+    while ((num_elements >= 8U) && ((bit_pos >> 3U) + bit_width + 9U <= src_bytes)) {
+        ((uint64_t*)dst_ptr)[0] = _pdep_u64(own_l9_load_64u(src_ptr, bit_pos), pdep_mask);
+        ((uint64_t*)dst_ptr)[1] = _pdep_u64(own_l9_load_64u(src_ptr, bit_pos + 2U * bit_width), pdep_mask);
+        ((uint64_t*)dst_ptr)[2] = _pdep_u64(own_l9_load_64u(src_ptr, bit_pos + 4U * bit_width), pdep_mask);
+        ((uint64_t*)dst_ptr)[3] = _pdep_u64(own_l9_load_64u(src_ptr, bit_pos + 6U * bit_width), pdep_mask);
+
+        bit_pos += 8U * bit_width;
+        dst_ptr += 8U * sizeof(uint32_t);
+        num_elements -= 8U;
+    }
+
+    own_l9_unpack_tail(src_ptr, num_elements, bit_pos, bit_width, dst_ptr, sizeof(uint32_t));
+}
+
+#endif // OWN_UNPACK_L9_H
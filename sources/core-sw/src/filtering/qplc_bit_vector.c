@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+  * @brief Contains implementation of all functions for bit-vector operations
+  * @date 10/18/2026
+  *
+  * @details The bit-vectors are combined by 64-bit words, aggregates of the result are accumulated
+  *          in the same pass.
+  *
+  *          Function list:
+  *          - @ref qplc_bit_vector_and
+  *          - @ref qplc_bit_vector_or
+  *          - @ref qplc_bit_vector_and_not
+  *          - @ref qplc_bit_vector_xor
+  *
+  */
+
+#include "own_qplc_bits.h"
+#include "own_qplc_defs.h"
+#include "qplc_bit_vector.h"
+
+#define OWN_BIT_VECTOR_AND     0U /**< src1 & src2 */
+#define OWN_BIT_VECTOR_OR      1U /**< src1 | src2 */
+#define OWN_BIT_VECTOR_AND_NOT 2U /**< src1 & ~src2 */
+#define OWN_BIT_VECTOR_XOR     3U /**< src1 ^ src2 */
+
+#if PLATFORM >= K0
+#include "opt/qplc_bit_vector_k0.h"
+#elif PLATFORM >= L9
+#include "opt/qplc_bit_vector_l9.h"
+#endif
+
+OWN_QPLC_INLINE(uint64_t, own_bit_vector_combine, (uint64_t src1, uint64_t src2, uint32_t operation)) {
+    switch (operation) {
+        case OWN_BIT_VECTOR_AND: return src1 & src2;
+        case OWN_BIT_VECTOR_OR: return src1 | src2;
+        case OWN_BIT_VECTOR_AND_NOT: return src1 & ~src2;
+        default: return src1 ^ src2;
+    }
+}
+
+OWN_QPLC_INLINE(void, own_bit_vector,
+                (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+                 uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr,
+                 uint32_t operation)) {
+    uint32_t idx = 0U;
+
+#if PLATFORM >= K0
+    idx = CALL_OPT_FUNCTION(k0_qplc_bit_vector)(src1_ptr, src2_ptr, length, dst_ptr, min_value_ptr, max_value_ptr,
+                                                sum_ptr, index_ptr, operation);
+#elif PLATFORM >= L9
+    idx = CALL_OPT_FUNCTION(l9_qplc_bit_vector)(src1_ptr, src2_ptr, length, dst_ptr, min_value_ptr, max_value_ptr,
+                                                sum_ptr, index_ptr, operation);
+#endif
+
+    const uint32_t index     = *index_ptr - idx;
+    uint32_t       min_value = *min_value_ptr;
+    uint32_t       max_value = *max_value_ptr;
+    uint32_t       sum       = 0U;
+
+    for (; idx + 64U <= length; idx += 64U) {
+        const uint64_t bits = own_bit_vector_combine(*(const uint64_t*)(src1_ptr + (idx >> 3U)),
+                                                     *(const uint64_t*)(src2_ptr + (idx >> 3U)), operation);
+
+        *(uint64_t*)(dst_ptr + (idx >> 3U)) = bits;
+
+        own_bits_aggregates(bits, index + idx, &min_value, &max_value, &sum);
+    }
+
+    if (idx < length) {
+        const uint32_t count      = length - idx;
+        const uint32_t byte_count = (count + 7U) >> 3U;
+        uint64_t       src1_bits  = 0U;
+        uint64_t       src2_bits  = 0U;
+
+        for (uint32_t i = 0U; i < byte_count; i++) {
+            src1_bits |= (uint64_t)src1_ptr[(idx >> 3U) + i] << (i * 8U);
+            src2_bits |= (uint64_t)src2_ptr[(idx >> 3U) + i] << (i * 8U);
+        }
+
+        const uint64_t bits = own_bit_vector_combine(src1_bits, src2_bits, operation) & ((QPL_ONE_64U << count) - 1U);
+
+        for (uint32_t i = 0U; i < byte_count; i++) {
+            dst_ptr[(idx >> 3U) + i] = (uint8_t)(bits >> (i * 8U));
+        }
+
+        own_bits_aggregates(bits, index + idx, &min_value, &max_value, &sum);
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr = index + length;
+}
+
+OWN_QPLC_FUN(void, qplc_bit_vector_and,
+             (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+              uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr)) {
+    own_bit_vector(src1_ptr, src2_ptr, length, dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr,
+                   OWN_BIT_VECTOR_AND);
+}
+
+OWN_QPLC_FUN(void, qplc_bit_vector_or,
+             (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+              uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr)) {
+    own_bit_vector(src1_ptr, src2_ptr, length, dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr,
+                   OWN_BIT_VECTOR_OR);
+}
+
+OWN_QPLC_FUN(void, qplc_bit_vector_and_not,
+             (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+              uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr)) {
+    own_bit_vector(src1_ptr, src2_ptr, length, dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr,
+                   OWN_BIT_VECTOR_AND_NOT);
+}
+
+OWN_QPLC_FUN(void, qplc_bit_vector_xor,
+             (const uint8_t* src1_ptr, const uint8_t* src2_ptr, uint32_t length, uint8_t* dst_ptr,
+              uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr)) {
+    own_bit_vector(src1_ptr, src2_ptr, length, dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr,
+                   OWN_BIT_VECTOR_XOR);
+}
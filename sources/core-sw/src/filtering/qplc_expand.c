@@ -12,6 +12,7 @@
  *          - @ref qplc_expand_8u
  *          - @ref qplc_expand_16u
  *          - @ref qplc_expand_32u
+ *          - @ref qplc_expand_64u
  */
 
 #include "own_qplc_defs.h"
@@ -96,3 +97,28 @@ OWN_QPLC_FUN(uint32_t, qplc_expand_32u,
     return expanded;
 #endif
 }
+
+OWN_QPLC_FUN(uint32_t, qplc_expand_64u,
+             (const uint8_t* src1_ptr, uint32_t length_1, const uint8_t* src2_ptr, uint32_t* length_2_ptr,
+              uint8_t* dst_ptr)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_qplc_expand_64u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
+#else
+
+    uint64_t* src_64u_ptr = (uint64_t*)src1_ptr;
+    uint64_t* dst_64u_ptr = (uint64_t*)dst_ptr;
+    uint32_t  expanded    = 0U;
+    uint32_t  idx         = 0U;
+
+    for (idx = 0U; idx < *length_2_ptr; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_64u_ptr[idx] = src_64u_ptr[expanded++];
+        } else {
+            dst_64u_ptr[idx] = 0U;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+#endif
+}
@@ -12,9 +12,11 @@
  *          - @ref qplc_extract_8u_i
  *          - @ref qplc_extract_16u_i
  *          - @ref qplc_extract_32u_i
+ *          - @ref qplc_extract_64u_i
  *          - @ref qplc_extract_8u
  *          - @ref qplc_extract_16u
  *          - @ref qplc_extract_32u
+ *          - @ref qplc_extract_64u
  */
 
 #include "own_qplc_defs.h"
@@ -92,6 +94,30 @@ OWN_QPLC_FUN(uint32_t, qplc_extract_32u_i,
     return (stop - start);
 }
 
+OWN_QPLC_FUN(uint32_t, qplc_extract_64u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint32_t* index_ptr, uint32_t low_value, uint32_t high_value)) {
+    uint32_t start   = 0U;
+    uint32_t stop    = 0U;
+    uint8_t* src_ptr = (uint8_t*)src_dst_ptr;
+    uint8_t* dst_ptr = (uint8_t*)src_dst_ptr;
+
+    if ((*index_ptr + length) < low_value) {
+        *index_ptr += length;
+        return 0U;
+    }
+    if (*index_ptr > high_value) { return 0U; }
+
+    start = (*index_ptr < low_value) ? (low_value - *index_ptr) : 0U;
+    stop  = ((*index_ptr + length) > high_value) ? (high_value + 1U - *index_ptr) : length;
+
+    if (0U != start) {
+        src_ptr += start * sizeof(uint64_t);
+        CALL_CORE_FUN(qplc_move_8u)(src_ptr, dst_ptr, (stop - start) * sizeof(uint64_t));
+    }
+    *index_ptr += length;
+    return (stop - start);
+}
+
 /******** out-of-place scan functions ********/
 
 OWN_QPLC_FUN(uint32_t, qplc_extract_8u,
@@ -160,3 +186,24 @@ OWN_QPLC_FUN(uint32_t, qplc_extract_32u,
     *index_ptr += length;
     return (stop - start);
 }
+
+OWN_QPLC_FUN(uint32_t, qplc_extract_64u,
+             (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t* index_ptr, uint32_t low_value,
+              uint32_t high_value)) {
+    uint32_t start = 0U;
+    uint32_t stop  = 0U;
+
+    if ((*index_ptr + length) < low_value) {
+        *index_ptr += length;
+        return 0U;
+    }
+    if (*index_ptr > high_value) { return 0U; }
+
+    start = (*index_ptr < low_value) ? (low_value - *index_ptr) : 0U;
+    stop  = ((*index_ptr + length) > high_value) ? (high_value + 1U - *index_ptr) : length;
+
+    src_ptr += start * sizeof(uint64_t);
+    CALL_CORE_FUN(qplc_move_8u)(src_ptr, dst_ptr, (stop - start) * sizeof(uint64_t));
+    *index_ptr += length;
+    return (stop - start);
+}
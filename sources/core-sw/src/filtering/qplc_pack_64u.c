@@ -0,0 +1,308 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of functions for vector packing qword integers to 33...64-bit integers
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref qplc_pack_64u33u
+ *          - @ref qplc_pack_64u34u
+ *          - @ref qplc_pack_64u35u
+ *          - @ref qplc_pack_64u36u
+ *          - @ref qplc_pack_64u37u
+ *          - @ref qplc_pack_64u38u
+ *          - @ref qplc_pack_64u39u
+ *          - @ref qplc_pack_64u40u
+ *          - @ref qplc_pack_64u41u
+ *          - @ref qplc_pack_64u42u
+ *          - @ref qplc_pack_64u43u
+ *          - @ref qplc_pack_64u44u
+ *          - @ref qplc_pack_64u45u
+ *          - @ref qplc_pack_64u46u
+ *          - @ref qplc_pack_64u47u
+ *          - @ref qplc_pack_64u48u
+ *          - @ref qplc_pack_64u49u
+ *          - @ref qplc_pack_64u50u
+ *          - @ref qplc_pack_64u51u
+ *          - @ref qplc_pack_64u52u
+ *          - @ref qplc_pack_64u53u
+ *          - @ref qplc_pack_64u54u
+ *          - @ref qplc_pack_64u55u
+ *          - @ref qplc_pack_64u56u
+ *          - @ref qplc_pack_64u57u
+ *          - @ref qplc_pack_64u58u
+ *          - @ref qplc_pack_64u59u
+ *          - @ref qplc_pack_64u60u
+ *          - @ref qplc_pack_64u61u
+ *          - @ref qplc_pack_64u62u
+ *          - @ref qplc_pack_64u63u
+ *          - @ref qplc_pack_64u64u
+ *
+ */
+#include "own_qplc_defs.h"
+#include "qplc_memop.h"
+
+// Every element is put to the buffer as the low dword and the high part of up to 32 bits,
+// so the buffer always keeps less than 32 bits after a dword is written
+OWN_QPLC_INLINE(void, qplc_pack_64u_nu,
+                (const uint8_t* src_ptr, uint32_t num_elements, uint32_t bit_width, uint8_t* dst_ptr,
+                 uint32_t start_bit)) {
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    uint32_t  high_width  = bit_width - OWN_DWORD_WIDTH;
+    uint64_t  high_mask   = OWN_BIT_MASK(high_width);
+    int32_t   bits_in_buf = (int32_t)start_bit;
+    uint64_t  dst         = (uint64_t)(*dst_ptr) & OWN_BIT_MASK(start_bit);
+
+    while (0U < num_elements) {
+        dst |= ((*src_64u_ptr) & OWN_MAX_32U) << bits_in_buf;
+        *(uint32_t*)dst_ptr = (uint32_t)dst;
+        dst_ptr += sizeof(uint32_t);
+        dst >>= OWN_DWORD_WIDTH;
+
+        dst |= (((*src_64u_ptr) >> OWN_DWORD_WIDTH) & high_mask) << bits_in_buf;
+        bits_in_buf += (int32_t)high_width;
+        if (OWN_DWORD_WIDTH <= (uint32_t)bits_in_buf) {
+            *(uint32_t*)dst_ptr = (uint32_t)dst;
+            dst_ptr += sizeof(uint32_t);
+            dst >>= OWN_DWORD_WIDTH;
+            bits_in_buf -= OWN_DWORD_WIDTH;
+        }
+        src_64u_ptr++;
+        num_elements--;
+    }
+    while (0 < bits_in_buf) {
+        *dst_ptr = (uint8_t)(dst);
+        bits_in_buf -= OWN_BYTE_WIDTH;
+        dst_ptr++;
+        dst >>= OWN_BYTE_WIDTH;
+    }
+}
+
+// ********************** 33u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u33u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 33U, dst_ptr, start_bit);
+}
+
+// ********************** 34u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u34u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 34U, dst_ptr, start_bit);
+}
+
+// ********************** 35u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u35u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 35U, dst_ptr, start_bit);
+}
+
+// ********************** 36u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u36u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 36U, dst_ptr, start_bit);
+}
+
+// ********************** 37u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u37u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 37U, dst_ptr, start_bit);
+}
+
+// ********************** 38u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u38u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 38U, dst_ptr, start_bit);
+}
+
+// ********************** 39u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u39u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 39U, dst_ptr, start_bit);
+}
+
+// ********************** 40u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u40u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 40U, dst_ptr, start_bit);
+}
+
+// ********************** 41u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u41u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 41U, dst_ptr, start_bit);
+}
+
+// ********************** 42u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u42u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 42U, dst_ptr, start_bit);
+}
+
+// ********************** 43u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u43u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 43U, dst_ptr, start_bit);
+}
+
+// ********************** 44u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u44u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 44U, dst_ptr, start_bit);
+}
+
+// ********************** 45u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u45u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 45U, dst_ptr, start_bit);
+}
+
+// ********************** 46u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u46u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 46U, dst_ptr, start_bit);
+}
+
+// ********************** 47u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u47u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 47U, dst_ptr, start_bit);
+}
+
+// ********************** 48u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u48u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 48U, dst_ptr, start_bit);
+}
+
+// ********************** 49u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u49u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 49U, dst_ptr, start_bit);
+}
+
+// ********************** 50u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u50u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 50U, dst_ptr, start_bit);
+}
+
+// ********************** 51u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u51u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 51U, dst_ptr, start_bit);
+}
+
+// ********************** 52u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u52u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 52U, dst_ptr, start_bit);
+}
+
+// ********************** 53u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u53u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 53U, dst_ptr, start_bit);
+}
+
+// ********************** 54u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u54u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 54U, dst_ptr, start_bit);
+}
+
+// ********************** 55u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u55u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 55U, dst_ptr, start_bit);
+}
+
+// ********************** 56u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u56u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 56U, dst_ptr, start_bit);
+}
+
+// ********************** 57u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u57u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 57U, dst_ptr, start_bit);
+}
+
+// ********************** 58u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u58u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 58U, dst_ptr, start_bit);
+}
+
+// ********************** 59u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u59u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 59U, dst_ptr, start_bit);
+}
+
+// ********************** 60u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u60u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 60U, dst_ptr, start_bit);
+}
+
+// ********************** 61u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u61u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 61U, dst_ptr, start_bit);
+}
+
+// ********************** 62u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u62u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 62U, dst_ptr, start_bit);
+}
+
+// ********************** 63u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u63u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr, uint32_t start_bit)) {
+    qplc_pack_64u_nu(src_ptr, num_elements, 63U, dst_ptr, start_bit);
+}
+
+// ********************** 64u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_pack_64u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint8_t* dst_ptr,
+              uint32_t UNREFERENCED_PARAMETER(start_bit))) {
+    CALL_CORE_FUN(qplc_copy_8u)(src_ptr, dst_ptr, num_elements * sizeof(uint64_t));
+}
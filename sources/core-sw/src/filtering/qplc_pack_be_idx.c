@@ -22,7 +22,9 @@ OWN_QPLC_FUN(qplc_status_t, qplc_pack_bits_be_nu,
              (const uint8_t* src_ptr, uint32_t num_elements, uint8_t** pp_dst, uint32_t start_bit,
               uint32_t* pack_bits_index_ptr)) {
     uint8_t* dst_ptr   = (0U != start_bit) ? *pp_dst - 1U : *pp_dst;
-    uint32_t bit_width = own_get_bit_width_from_index(*pack_bits_index_ptr - OWN_QPLC_PACK_BE_INDEX_SHIFT);
+    uint32_t bit_width = (OWN_QPLC_PACK_64U_INDEX <= *pack_bits_index_ptr)
+                                 ? own_get_bit_width_from_index(*pack_bits_index_ptr - OWN_QPLC_PACK_64U_BE_INDEX_SHIFT)
+                                 : own_get_bit_width_from_index(*pack_bits_index_ptr - OWN_QPLC_PACK_BE_INDEX_SHIFT);
 
     (*qplc_pack_bits_array[*pack_bits_index_ptr])(src_ptr, num_elements, dst_ptr, start_bit);
     *pp_dst += OWN_BITS_2_BYTE(num_elements * bit_width - ((OWN_BYTE_WIDTH - start_bit) & OWN_BYTE_BIT_MASK));
@@ -64,6 +64,8 @@
 
 #if PLATFORM >= K0
 #include "opt/qplc_scan_k0.h"
+#elif PLATFORM >= L9
+#include "opt/qplc_scan_l9.h"
 #endif
 
 OWN_QPLC_FUN(void, qplc_scan_lt_8u_i,
@@ -71,6 +73,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         src_dst_ptr[idx] = (src_dst_ptr[idx] < low_value) ? 1U : 0U;
@@ -83,6 +87,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_16u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -98,6 +104,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_32u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t* src_ptr = (uint32_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -113,6 +121,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         src_dst_ptr[idx] = (src_dst_ptr[idx] == low_value) ? 1U : 0U;
@@ -125,6 +135,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_16u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -140,6 +152,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_32u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t* src_ptr = (uint32_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -155,6 +169,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         src_dst_ptr[idx] = (src_dst_ptr[idx] == low_value) ? 0U : 1U;
@@ -167,6 +183,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_16u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -182,6 +200,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_32u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t* src_ptr = (uint32_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -197,6 +217,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         src_dst_ptr[idx] = (src_dst_ptr[idx] <= low_value) ? 1U : 0U;
@@ -209,6 +231,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_16u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -224,6 +248,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_32u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t* src_ptr = (uint32_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -239,6 +265,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         src_dst_ptr[idx] = (src_dst_ptr[idx] > low_value) ? 1U : 0U;
@@ -251,6 +279,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_16u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -266,6 +296,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_32u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t* src_ptr = (uint32_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -281,6 +313,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         src_dst_ptr[idx] = (src_dst_ptr[idx] >= low_value) ? 1U : 0U;
@@ -293,6 +327,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_16u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -308,6 +344,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_32u8u_i,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t* src_ptr = (uint32_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -322,6 +360,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_8u_i,
              (uint8_t * src_dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         src_dst_ptr[idx] = ((src_dst_ptr[idx] >= low_value) && (src_dst_ptr[idx] <= high_value)) ? 1U : 0U;
@@ -333,6 +373,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_16u8u_i,
              (uint8_t * src_dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -347,6 +389,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_32u8u_i,
              (uint8_t * src_dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t* src_ptr = (uint32_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -361,6 +405,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_8u_i,
              (uint8_t * src_dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         src_dst_ptr[idx] = ((src_dst_ptr[idx] >= low_value) && (src_dst_ptr[idx] <= high_value)) ? 0U : 1U;
@@ -372,6 +418,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_16u8u_i,
              (uint8_t * src_dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_16u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -386,6 +434,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_32u8u_i,
              (uint8_t * src_dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_32u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
 #else
     uint32_t* src_ptr = (uint32_t*)src_dst_ptr;
     uint8_t*  dst_ptr = src_dst_ptr;
@@ -403,6 +453,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         dst_ptr[idx] = (src_ptr[idx] < low_value) ? 1U : 0U;
@@ -415,6 +467,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_16u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t* p_src_16u = (uint16_t*)src_ptr;
 
@@ -429,6 +483,8 @@ OWN_QPLC_FUN(void, qplc_scan_lt_32u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_lt_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_lt_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t* p_src_32u = (uint32_t*)src_ptr;
 
@@ -443,6 +499,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         dst_ptr[idx] = (src_ptr[idx] == low_value) ? 1U : 0U;
@@ -455,6 +513,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_16u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t* p_src_16u = (uint16_t*)src_ptr;
 
@@ -469,6 +529,8 @@ OWN_QPLC_FUN(void, qplc_scan_eq_32u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_eq_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_eq_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t* p_src_32u = (uint32_t*)src_ptr;
 
@@ -483,6 +545,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         dst_ptr[idx] = (src_ptr[idx] == low_value) ? 0U : 1U;
@@ -495,6 +559,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_16u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t* p_src_16u = (uint16_t*)src_ptr;
 
@@ -509,6 +575,8 @@ OWN_QPLC_FUN(void, qplc_scan_ne_32u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ne_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ne_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t* p_src_32u = (uint32_t*)src_ptr;
 
@@ -523,6 +591,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         dst_ptr[idx] = (src_ptr[idx] <= low_value) ? 1U : 0U;
@@ -535,6 +605,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_16u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t* p_src_16u = (uint16_t*)src_ptr;
 
@@ -549,6 +621,8 @@ OWN_QPLC_FUN(void, qplc_scan_le_32u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_le_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_le_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t* p_src_32u = (uint32_t*)src_ptr;
 
@@ -563,6 +637,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         dst_ptr[idx] = (src_ptr[idx] > low_value) ? 1U : 0U;
@@ -575,6 +651,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_16u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t* p_src_16u = (uint16_t*)src_ptr;
 
@@ -589,6 +667,8 @@ OWN_QPLC_FUN(void, qplc_scan_gt_32u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_gt_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_gt_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t* p_src_32u = (uint32_t*)src_ptr;
 
@@ -603,6 +683,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         dst_ptr[idx] = (src_ptr[idx] >= low_value) ? 1U : 0U;
@@ -615,6 +697,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_16u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_16u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t* p_src_16u = (uint16_t*)src_ptr;
 
@@ -629,6 +713,8 @@ OWN_QPLC_FUN(void, qplc_scan_ge_32u8u,
               uint32_t UNREFERENCED_PARAMETER(high_value))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_ge_32u8u)(src_ptr, dst_ptr, length, low_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_ge_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t* p_src_32u = (uint32_t*)src_ptr;
 
@@ -642,6 +728,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_8u,
              (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         dst_ptr[idx] = ((src_ptr[idx] >= low_value) && (src_ptr[idx] <= high_value)) ? 1U : 0U;
@@ -653,6 +741,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_16u8u,
              (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t* p_src_16u = (uint16_t*)src_ptr;
 
@@ -666,6 +756,8 @@ OWN_QPLC_FUN(void, qplc_scan_range_32u8u,
              (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_range_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_range_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t* p_src_32u = (uint32_t*)src_ptr;
 
@@ -679,6 +771,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_8u,
              (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     for (uint32_t idx = 0U; idx < length; idx++) {
         dst_ptr[idx] = ((src_ptr[idx] >= low_value) && (src_ptr[idx] <= high_value)) ? 0U : 1U;
@@ -690,6 +784,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_16u8u,
              (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_16u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint16_t* p_src_16u = (uint16_t*)src_ptr;
 
@@ -703,6 +799,8 @@ OWN_QPLC_FUN(void, qplc_scan_not_range_32u8u,
              (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length, uint32_t low_value, uint32_t high_value)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_scan_not_range_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_not_range_32u8u)(src_ptr, dst_ptr, length, low_value, high_value);
 #else
     const uint32_t* p_src_32u = (uint32_t*)src_ptr;
 
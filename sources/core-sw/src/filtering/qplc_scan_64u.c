@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of in-place functions for scan analytics operation on 64u data
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref qplc_scan_eq_64u8u_i
+ *          - @ref qplc_scan_ne_64u8u_i
+ *          - @ref qplc_scan_lt_64u8u_i
+ *          - @ref qplc_scan_le_64u8u_i
+ *          - @ref qplc_scan_gt_64u8u_i
+ *          - @ref qplc_scan_ge_64u8u_i
+ *          - @ref qplc_scan_range_64u8u_i
+ *          - @ref qplc_scan_not_range_64u8u_i
+ *
+ */
+
+#include "own_qplc_defs.h"
+#include "qplc_scan.h"
+
+#if PLATFORM >= K0
+#include "opt/qplc_scan_64u_k0.h"
+#endif
+
+OWN_QPLC_FUN(void, qplc_scan_eq_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value,
+              uint64_t UNREFERENCED_PARAMETER(high_value))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_eq_64u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_dst_ptr;
+    uint8_t*  dst_ptr     = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] == low_value) ? 1U : 0U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_ne_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value,
+              uint64_t UNREFERENCED_PARAMETER(high_value))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_ne_64u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_dst_ptr;
+    uint8_t*  dst_ptr     = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] != low_value) ? 1U : 0U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_lt_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value,
+              uint64_t UNREFERENCED_PARAMETER(high_value))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_lt_64u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_dst_ptr;
+    uint8_t*  dst_ptr     = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] < low_value) ? 1U : 0U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_le_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value,
+              uint64_t UNREFERENCED_PARAMETER(high_value))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_le_64u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_dst_ptr;
+    uint8_t*  dst_ptr     = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] <= low_value) ? 1U : 0U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_gt_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value,
+              uint64_t UNREFERENCED_PARAMETER(high_value))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_gt_64u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_dst_ptr;
+    uint8_t*  dst_ptr     = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] > low_value) ? 1U : 0U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_ge_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value,
+              uint64_t UNREFERENCED_PARAMETER(high_value))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_ge_64u8u)(src_dst_ptr, src_dst_ptr, length, low_value);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_dst_ptr;
+    uint8_t*  dst_ptr     = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        dst_ptr[idx] = (src_64u_ptr[idx] >= low_value) ? 1U : 0U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_range_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_range_64u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_dst_ptr;
+    uint8_t*  dst_ptr     = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        dst_ptr[idx] = ((src_64u_ptr[idx] >= low_value) && (src_64u_ptr[idx] <= high_value)) ? 1U : 0U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_not_range_64u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, uint64_t low_value, uint64_t high_value)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_not_range_64u8u)(src_dst_ptr, src_dst_ptr, length, low_value, high_value);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_dst_ptr;
+    uint8_t*  dst_ptr     = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        dst_ptr[idx] = ((src_64u_ptr[idx] < low_value) || (src_64u_ptr[idx] > high_value)) ? 1U : 0U;
+    }
+#endif
+}
@@ -0,0 +1,660 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+  * @brief Contains implementation of fused scan kernels for packed input and bit-vector output
+  * @date 10/18/2026
+  *
+  * @details Unpack, scan, aggregates calculation and pack are performed in a single pass over the source:
+  *          the input is unpacked by small blocks that stay in L1 cache, every 64 elements of a block
+  *          are compared at once, stored as one 64-bit word of the bit-vector and aggregated in registers.
+  *
+  *          Function list:
+  *          - @ref qplc_scan_bits_1u ... @ref qplc_scan_bits_32u
+  *          - @ref qplc_scan_bits_be_1u ... @ref qplc_scan_bits_be_32u
+  *
+  */
+
+#include "own_qplc_bits.h"
+#include "own_qplc_defs.h"
+#include "qplc_scan.h"
+#include "qplc_unpack.h"
+
+#if PLATFORM >= K0
+#include "opt/qplc_scan_bits_k0.h"
+#elif PLATFORM >= L9
+#include "opt/qplc_scan_bits_l9.h"
+#endif
+
+#define OWN_SCAN_BITS_GROUP 64U  /**< Number of elements stored to the bit-vector at once */
+#define OWN_SCAN_BITS_BLOCK 512U /**< Number of elements unpacked at once, a multiple of OWN_SCAN_BITS_GROUP */
+
+OWN_QPLC_INLINE(uint32_t, own_scan_bits_get_element, (const uint8_t* src_ptr, uint32_t idx, uint32_t element_size)) {
+    switch (element_size) {
+        case sizeof(uint8_t): return src_ptr[idx];
+        case sizeof(uint16_t): return ((const uint16_t*)src_ptr)[idx];
+        default: return ((const uint32_t*)src_ptr)[idx];
+    }
+}
+
+/**
+ * @brief Scans unpacked 8u, 16u or 32u elements into the bit-vector
+ */
+OWN_QPLC_INLINE(void, own_scan_bits_unpacked,
+                (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value,
+                 uint8_t inversion_flag, uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
+                 uint32_t* sum_ptr, uint32_t* index_ptr, uint32_t element_size)) {
+    uint32_t idx = 0U;
+
+#if PLATFORM >= K0
+    switch (element_size) {
+        case sizeof(uint8_t): {
+            idx = CALL_OPT_FUNCTION(k0_qplc_scan_bits_8u)(src_ptr, length, low_value, high_value, inversion_flag,
+                                                          dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
+            break;
+        }
+        case sizeof(uint16_t): {
+            idx = CALL_OPT_FUNCTION(k0_qplc_scan_bits_16u)(src_ptr, length, low_value, high_value, inversion_flag,
+                                                           dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
+            break;
+        }
+        default: {
+            idx = CALL_OPT_FUNCTION(k0_qplc_scan_bits_32u)(src_ptr, length, low_value, high_value, inversion_flag,
+                                                           dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
+            break;
+        }
+    }
+#elif PLATFORM >= L9
+    switch (element_size) {
+        case sizeof(uint8_t): {
+            idx = CALL_OPT_FUNCTION(l9_qplc_scan_bits_8u)(src_ptr, length, low_value, high_value, inversion_flag,
+                                                          dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
+            break;
+        }
+        case sizeof(uint16_t): {
+            idx = CALL_OPT_FUNCTION(l9_qplc_scan_bits_16u)(src_ptr, length, low_value, high_value, inversion_flag,
+                                                           dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
+            break;
+        }
+        default: {
+            idx = CALL_OPT_FUNCTION(l9_qplc_scan_bits_32u)(src_ptr, length, low_value, high_value, inversion_flag,
+                                                           dst_ptr, min_value_ptr, max_value_ptr, sum_ptr, index_ptr);
+            break;
+        }
+    }
+#endif
+
+    const uint64_t inversion_mask = (inversion_flag) ? UINT64_MAX : 0U;
+    const uint32_t index          = *index_ptr - idx;
+    uint32_t       min_value      = *min_value_ptr;
+    uint32_t       max_value      = *max_value_ptr;
+    uint32_t       sum            = 0U;
+
+    while (idx < length) {
+        const uint32_t count = QPL_MIN(length - idx, OWN_SCAN_BITS_GROUP);
+        uint64_t       bits  = 0U;
+
+        for (uint32_t i = 0U; i < count; i++) {
+            const uint32_t element = own_scan_bits_get_element(src_ptr, idx + i, element_size);
+
+            bits |= (uint64_t)((element >= low_value) & (element <= high_value)) << i;
+        }
+
+        bits ^= inversion_mask;
+
+        if (count < OWN_SCAN_BITS_GROUP) {
+            bits &= OWN_BIT_MASK(count);
+
+            for (uint32_t i = 0U; i < OWN_BITS_2_BYTE(count); i++) {
+                dst_ptr[(idx >> 3U) + i] = (uint8_t)(bits >> (i * OWN_BYTE_WIDTH));
+            }
+        } else {
+            *(uint64_t*)(dst_ptr + (idx >> 3U)) = bits;
+        }
+
+        own_bits_aggregates(bits, index + idx, &min_value, &max_value, &sum);
+        idx += count;
+    }
+
+    *min_value_ptr = min_value;
+    *max_value_ptr = max_value;
+    *sum_ptr += sum;
+    *index_ptr = index + length;
+}
+
+/**
+ * @brief Unpacks the source by blocks into a buffer that stays in L1 cache and scans every block
+ */
+OWN_QPLC_INLINE(void, own_scan_bits_packed,
+                (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value,
+                 uint8_t inversion_flag, uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr,
+                 uint32_t* sum_ptr, uint32_t* index_ptr, uint32_t bit_width, qplc_unpack_bits_t_ptr unpack_ptr)) {
+    OWN_ALIGNED_64_ARRAY(uint8_t buffer[OWN_SCAN_BITS_BLOCK * sizeof(uint32_t)]);
+
+    const uint32_t element_size = 1U << OWN_BITS_2_DATA_TYPE_INDEX(bit_width);
+
+    for (uint32_t idx = 0U; idx < length; idx += OWN_SCAN_BITS_BLOCK) {
+        const uint32_t count = QPL_MIN(length - idx, OWN_SCAN_BITS_BLOCK);
+
+        // Every block starts from a byte boundary as the block size is a multiple of 8
+        unpack_ptr(src_ptr + OWN_BITS_2_BYTE_TRUNCATE((uint64_t)idx * bit_width), count, 0U, buffer);
+
+        own_scan_bits_unpacked(buffer, count, low_value, high_value, inversion_flag, dst_ptr + (idx >> 3U),
+                               min_value_ptr, max_value_ptr, sum_ptr, index_ptr, element_size);
+    }
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_1u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 1U, CALL_CORE_FUN(qplc_unpack_1u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_2u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 2U, CALL_CORE_FUN(qplc_unpack_2u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_3u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 3U, CALL_CORE_FUN(qplc_unpack_3u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_4u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 4U, CALL_CORE_FUN(qplc_unpack_4u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_5u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 5U, CALL_CORE_FUN(qplc_unpack_5u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_6u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 6U, CALL_CORE_FUN(qplc_unpack_6u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_7u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 7U, CALL_CORE_FUN(qplc_unpack_7u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_8u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_unpacked(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                           max_value_ptr, sum_ptr, index_ptr, sizeof(uint8_t));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_9u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 9U, CALL_CORE_FUN(qplc_unpack_9u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_10u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 10U, CALL_CORE_FUN(qplc_unpack_10u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_11u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 11U, CALL_CORE_FUN(qplc_unpack_11u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_12u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 12U, CALL_CORE_FUN(qplc_unpack_12u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_13u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 13U, CALL_CORE_FUN(qplc_unpack_13u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_14u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 14U, CALL_CORE_FUN(qplc_unpack_14u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_15u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 15U, CALL_CORE_FUN(qplc_unpack_15u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_16u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_unpacked(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                           max_value_ptr, sum_ptr, index_ptr, sizeof(uint16_t));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_17u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 17U, CALL_CORE_FUN(qplc_unpack_17u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_18u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 18U, CALL_CORE_FUN(qplc_unpack_18u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_19u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 19U, CALL_CORE_FUN(qplc_unpack_19u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_20u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 20U, CALL_CORE_FUN(qplc_unpack_20u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_21u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 21U, CALL_CORE_FUN(qplc_unpack_21u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_22u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 22U, CALL_CORE_FUN(qplc_unpack_22u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_23u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 23U, CALL_CORE_FUN(qplc_unpack_23u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_24u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 24U, CALL_CORE_FUN(qplc_unpack_24u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_25u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 25U, CALL_CORE_FUN(qplc_unpack_25u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_26u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 26U, CALL_CORE_FUN(qplc_unpack_26u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_27u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 27U, CALL_CORE_FUN(qplc_unpack_27u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_28u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 28U, CALL_CORE_FUN(qplc_unpack_28u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_29u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 29U, CALL_CORE_FUN(qplc_unpack_29u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_30u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 30U, CALL_CORE_FUN(qplc_unpack_30u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_31u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 31U, CALL_CORE_FUN(qplc_unpack_31u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_32u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_unpacked(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                           max_value_ptr, sum_ptr, index_ptr, sizeof(uint32_t));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_1u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 1U, CALL_CORE_FUN(qplc_unpack_be_1u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_2u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 2U, CALL_CORE_FUN(qplc_unpack_be_2u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_3u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 3U, CALL_CORE_FUN(qplc_unpack_be_3u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_4u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 4U, CALL_CORE_FUN(qplc_unpack_be_4u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_5u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 5U, CALL_CORE_FUN(qplc_unpack_be_5u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_6u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 6U, CALL_CORE_FUN(qplc_unpack_be_6u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_7u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 7U, CALL_CORE_FUN(qplc_unpack_be_7u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_8u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 8U, CALL_CORE_FUN(qplc_unpack_be_8u8u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_9u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 9U, CALL_CORE_FUN(qplc_unpack_be_9u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_10u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 10U, CALL_CORE_FUN(qplc_unpack_be_10u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_11u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 11U, CALL_CORE_FUN(qplc_unpack_be_11u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_12u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 12U, CALL_CORE_FUN(qplc_unpack_be_12u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_13u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 13U, CALL_CORE_FUN(qplc_unpack_be_13u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_14u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 14U, CALL_CORE_FUN(qplc_unpack_be_14u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_15u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 15U, CALL_CORE_FUN(qplc_unpack_be_15u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_16u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 16U, CALL_CORE_FUN(qplc_unpack_be_16u16u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_17u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 17U, CALL_CORE_FUN(qplc_unpack_be_17u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_18u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 18U, CALL_CORE_FUN(qplc_unpack_be_18u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_19u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 19U, CALL_CORE_FUN(qplc_unpack_be_19u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_20u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 20U, CALL_CORE_FUN(qplc_unpack_be_20u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_21u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 21U, CALL_CORE_FUN(qplc_unpack_be_21u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_22u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 22U, CALL_CORE_FUN(qplc_unpack_be_22u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_23u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 23U, CALL_CORE_FUN(qplc_unpack_be_23u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_24u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 24U, CALL_CORE_FUN(qplc_unpack_be_24u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_25u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 25U, CALL_CORE_FUN(qplc_unpack_be_25u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_26u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 26U, CALL_CORE_FUN(qplc_unpack_be_26u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_27u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 27U, CALL_CORE_FUN(qplc_unpack_be_27u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_28u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 28U, CALL_CORE_FUN(qplc_unpack_be_28u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_29u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 29U, CALL_CORE_FUN(qplc_unpack_be_29u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_30u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 30U, CALL_CORE_FUN(qplc_unpack_be_30u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_31u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 31U, CALL_CORE_FUN(qplc_unpack_be_31u32u));
+}
+
+OWN_QPLC_FUN(void, qplc_scan_bits_be_32u,
+             (const uint8_t* src_ptr, uint32_t length, uint32_t low_value, uint32_t high_value, uint8_t inversion_flag,
+              uint8_t* dst_ptr, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr,
+              uint32_t* index_ptr)) {
+    own_scan_bits_packed(src_ptr, length, low_value, high_value, inversion_flag, dst_ptr, min_value_ptr,
+                         max_value_ptr, sum_ptr, index_ptr, 32U, CALL_CORE_FUN(qplc_unpack_be_32u32u));
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+  * @brief Contains implementation of all functions for scan in set analytics operation
+  * @date 10/18/2026
+  *
+  * @details Function list:
+  *          - @ref qplc_scan_in_set_8u_i
+  *          - @ref qplc_scan_in_set_16u8u_i
+  *          - @ref qplc_scan_in_set_32u8u_i
+  *
+  */
+
+#include "own_qplc_defs.h"
+#include "qplc_scan.h"
+
+#if PLATFORM >= K0
+#include "opt/qplc_scan_in_set_k0.h"
+#elif PLATFORM >= L9
+#include "opt/qplc_scan_in_set_l9.h"
+#endif
+
+OWN_QPLC_FUN(void, qplc_scan_in_set_8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, const uint8_t* set_ptr,
+              uint32_t UNREFERENCED_PARAMETER(set_size))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_in_set_8u)(src_dst_ptr, src_dst_ptr, length, set_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_in_set_8u)(src_dst_ptr, src_dst_ptr, length, set_ptr);
+#else
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        const uint8_t value = src_dst_ptr[idx];
+
+        src_dst_ptr[idx] = (set_ptr[value >> 3U] >> (value & 7U)) & 1U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_in_set_16u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, const uint8_t* set_ptr,
+              uint32_t UNREFERENCED_PARAMETER(set_size))) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_in_set_16u8u)(src_dst_ptr, src_dst_ptr, length, set_ptr);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_in_set_16u8u)(src_dst_ptr, src_dst_ptr, length, set_ptr);
+#else
+    uint16_t* src_ptr = (uint16_t*)src_dst_ptr;
+    uint8_t*  dst_ptr = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        const uint16_t value = src_ptr[idx];
+
+        dst_ptr[idx] = (set_ptr[value >> 3U] >> (value & 7U)) & 1U;
+    }
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_scan_in_set_32u8u_i,
+             (uint8_t * src_dst_ptr, uint32_t length, const uint8_t* set_ptr, uint32_t set_size)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_scan_in_set_32u8u)(src_dst_ptr, src_dst_ptr, length, (const uint32_t*)set_ptr, set_size);
+#elif PLATFORM >= L9
+    CALL_OPT_FUNCTION(l9_qplc_scan_in_set_32u8u)(src_dst_ptr, src_dst_ptr, length, (const uint32_t*)set_ptr, set_size);
+#else
+    const uint32_t* values_ptr = (const uint32_t*)set_ptr;
+    uint32_t*       src_ptr    = (uint32_t*)src_dst_ptr;
+    uint8_t*        dst_ptr    = src_dst_ptr;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        const uint32_t value = src_ptr[idx];
+
+        // Number of set values less or equal to the element
+        uint32_t position = 0U;
+        uint32_t count    = set_size;
+
+        while (0U != count) {
+            const uint32_t half = count >> 1U;
+
+            if (values_ptr[position + half] <= value) {
+                position += half + 1U;
+                count -= half + 1U;
+            } else {
+                count = half;
+            }
+        }
+
+        dst_ptr[idx] = (0U != position && values_ptr[position - 1U] == value) ? 1U : 0U;
+    }
+#endif
+}
@@ -12,9 +12,11 @@
  *          - @ref qplc_select_8u_i
  *          - @ref qplc_select_16u_i
  *          - @ref qplc_select_32u_i
+ *          - @ref qplc_select_64u_i
  *          - @ref qplc_select_8u
  *          - @ref qplc_select_16u
  *          - @ref qplc_select_32u
+ *          - @ref qplc_select_64u
  *
  */
 
@@ -71,6 +73,21 @@ OWN_QPLC_FUN(uint32_t, qplc_select_32u_i, (uint8_t * src_dst_ptr, const uint8_t*
 #endif
 }
 
+OWN_QPLC_FUN(uint32_t, qplc_select_64u_i, (uint8_t * src_dst_ptr, const uint8_t* src2_ptr, uint32_t length)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_select_64u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
+#else
+    uint64_t* src_ptr  = (uint64_t*)src_dst_ptr;
+    uint64_t* dst_ptr  = (uint64_t*)src_dst_ptr;
+    uint32_t  selected = 0U;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        if (src2_ptr[idx] != 0U) { dst_ptr[selected++] = src_ptr[idx]; }
+    }
+    return selected;
+#endif
+}
+
 /******** out-of-place select functions ********/
 
 OWN_QPLC_FUN(uint32_t, qplc_select_8u,
@@ -118,3 +135,19 @@ OWN_QPLC_FUN(uint32_t, qplc_select_32u,
     return selected;
 #endif
 }
+
+OWN_QPLC_FUN(uint32_t, qplc_select_64u,
+             (const uint8_t* src_ptr, const uint8_t* src2_ptr, uint8_t* dst_ptr, uint32_t length)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_select_64u)(src_ptr, src2_ptr, dst_ptr, length);
+#else
+    uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    uint64_t* dst_64u_ptr = (uint64_t*)dst_ptr;
+    uint32_t  selected    = 0U;
+
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        if (src2_ptr[idx] != 0U) { dst_64u_ptr[selected++] = src_64u_ptr[idx]; }
+    }
+    return selected;
+#endif
+}
@@ -30,6 +30,10 @@
 
 #else
 
+#if PLATFORM >= L9
+#include "opt/qplc_unpack_l9.h"
+#endif
+
 OWN_QPLC_INLINE(void, qplc_unpack_Nu16u,
                 (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint32_t bit_width,
                  uint8_t* dst_ptr)) {
@@ -73,6 +77,8 @@ OWN_QPLC_FUN(void, qplc_unpack_9u16u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_9u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu16u(src_ptr, num_elements, start_bit, 9U, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 9U, dst_ptr);
 #endif
@@ -82,6 +88,8 @@ OWN_QPLC_FUN(void, qplc_unpack_10u16u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_10u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu16u(src_ptr, num_elements, start_bit, 10U, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 10U, dst_ptr);
 #endif
@@ -91,6 +99,8 @@ OWN_QPLC_FUN(void, qplc_unpack_11u16u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_11u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu16u(src_ptr, num_elements, start_bit, 11U, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 11U, dst_ptr);
 #endif
@@ -100,6 +110,8 @@ OWN_QPLC_FUN(void, qplc_unpack_12u16u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_12u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu16u(src_ptr, num_elements, start_bit, 12U, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 12U, dst_ptr);
 #endif
@@ -109,6 +121,8 @@ OWN_QPLC_FUN(void, qplc_unpack_13u16u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_13u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu16u(src_ptr, num_elements, start_bit, 13U, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 13U, dst_ptr);
 #endif
@@ -118,6 +132,8 @@ OWN_QPLC_FUN(void, qplc_unpack_14u16u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_14u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu16u(src_ptr, num_elements, start_bit, 14U, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 14U, dst_ptr);
 #endif
@@ -127,6 +143,8 @@ OWN_QPLC_FUN(void, qplc_unpack_15u16u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_15u16u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu16u(src_ptr, num_elements, start_bit, 15U, dst_ptr);
 #else
     qplc_unpack_Nu16u(src_ptr, num_elements, start_bit, 15U, dst_ptr);
 #endif
@@ -38,6 +38,10 @@
 
 #else
 
+#if PLATFORM >= L9
+#include "opt/qplc_unpack_l9.h"
+#endif
+
 OWN_QPLC_INLINE(void, qplc_unpack_Nu32u,
                 (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint32_t bit_width,
                  uint8_t* dst_ptr)) {
@@ -108,6 +112,8 @@ OWN_QPLC_FUN(void, qplc_unpack_17u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_17u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 17U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 17U, dst_ptr);
 #endif
@@ -119,6 +125,8 @@ OWN_QPLC_FUN(void, qplc_unpack_18u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_18u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 18U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 18U, dst_ptr);
 #endif
@@ -130,6 +138,8 @@ OWN_QPLC_FUN(void, qplc_unpack_19u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_19u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 19U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 19U, dst_ptr);
 #endif
@@ -141,6 +151,8 @@ OWN_QPLC_FUN(void, qplc_unpack_20u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_20u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 20U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 20U, dst_ptr);
 #endif
@@ -152,6 +164,8 @@ OWN_QPLC_FUN(void, qplc_unpack_21u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_21u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 21U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 21U, dst_ptr);
 #endif
@@ -163,6 +177,8 @@ OWN_QPLC_FUN(void, qplc_unpack_22u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_22u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 22U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 22U, dst_ptr);
 #endif
@@ -174,6 +190,8 @@ OWN_QPLC_FUN(void, qplc_unpack_23u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_23u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 23U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 23U, dst_ptr);
 #endif
@@ -185,6 +203,8 @@ OWN_QPLC_FUN(void, qplc_unpack_24u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_24u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 24U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 24U, dst_ptr);
 #endif
@@ -196,6 +216,8 @@ OWN_QPLC_FUN(void, qplc_unpack_25u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_25u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 25U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 25U, dst_ptr);
 #endif
@@ -207,6 +229,8 @@ OWN_QPLC_FUN(void, qplc_unpack_26u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_26u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 26U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 26U, dst_ptr);
 #endif
@@ -218,6 +242,8 @@ OWN_QPLC_FUN(void, qplc_unpack_27u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_27u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 27U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 27U, dst_ptr);
 #endif
@@ -229,6 +255,8 @@ OWN_QPLC_FUN(void, qplc_unpack_28u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_28u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 28U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 28U, dst_ptr);
 #endif
@@ -240,6 +268,8 @@ OWN_QPLC_FUN(void, qplc_unpack_29u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_29u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 29U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 29U, dst_ptr);
 #endif
@@ -251,6 +281,8 @@ OWN_QPLC_FUN(void, qplc_unpack_30u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_30u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 30U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 30U, dst_ptr);
 #endif
@@ -262,6 +294,8 @@ OWN_QPLC_FUN(void, qplc_unpack_31u32u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_31u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu32u(src_ptr, num_elements, start_bit, 31U, dst_ptr);
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 31U, dst_ptr);
 #endif
@@ -28,6 +28,10 @@
 
 #include "opt/qplc_unpack_8u_k0.h"
 
+#elif PLATFORM >= L9
+
+#include "opt/qplc_unpack_l9.h"
+
 #endif
 
 // ********************** 1u ****************************** //
@@ -36,6 +40,8 @@ OWN_QPLC_FUN(void, qplc_unpack_1u8u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_1u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu8u(src_ptr, num_elements, start_bit, 1U, dst_ptr);
 #else
     uint64_t bit_mask = 0x0101010101010101LLU;
     uint32_t i        = 0U;
@@ -124,6 +130,8 @@ OWN_QPLC_FUN(void, qplc_unpack_2u8u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_2u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu8u(src_ptr, num_elements, start_bit, 2U, dst_ptr);
 #else
     uint64_t bit_mask = 0x0303030303030303LLU;
     uint32_t i        = 0U;
@@ -221,6 +229,8 @@ OWN_QPLC_FUN(void, qplc_unpack_3u8u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_3u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu8u(src_ptr, num_elements, start_bit, 3U, dst_ptr);
 #else
     uint64_t bit_mask0 = 0x0007000007000007LLU;
     uint64_t bit_mask1 = 0x0700000700000700LLU;
@@ -404,6 +414,8 @@ OWN_QPLC_FUN(void, qplc_unpack_4u8u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_4u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu8u(src_ptr, num_elements, start_bit, 4U, dst_ptr);
 #else
     uint64_t bit_mask = 0x0f0f0f0f0f0f0f0fLLU;
     uint32_t i        = 0U;
@@ -543,6 +555,8 @@ OWN_QPLC_FUN(void, qplc_unpack_5u8u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_5u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu8u(src_ptr, num_elements, start_bit, 5U, dst_ptr);
 #else
     uint64_t bit_mask0 = 0x00001f000000001fLLU;
     uint64_t bit_mask1 = 0x000000001f000000LLU;
@@ -686,6 +700,8 @@ OWN_QPLC_FUN(void, qplc_unpack_6u8u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_6u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu8u(src_ptr, num_elements, start_bit, 6U, dst_ptr);
 #else
     qplc_unpack_Nu8u(src_ptr, num_elements, start_bit, 6U, dst_ptr);
 #endif
@@ -695,6 +711,8 @@ OWN_QPLC_FUN(void, qplc_unpack_7u8u,
              (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_7u8u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM >= L9
+    l9_qplc_unpack_nu8u(src_ptr, num_elements, start_bit, 7U, dst_ptr);
 #else
     qplc_unpack_Nu8u(src_ptr, num_elements, start_bit, 7U, dst_ptr);
 #endif
@@ -0,0 +1,327 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of functions for unpacking 33..64-bit BE data to qwords
+ * @date 10/18/2026
+ *
+ * @details Function list:
+ *          - @ref qplc_unpack_be_33u64u
+ *          - @ref qplc_unpack_be_34u64u
+ *          - @ref qplc_unpack_be_35u64u
+ *          - @ref qplc_unpack_be_36u64u
+ *          - @ref qplc_unpack_be_37u64u
+ *          - @ref qplc_unpack_be_38u64u
+ *          - @ref qplc_unpack_be_39u64u
+ *          - @ref qplc_unpack_be_40u64u
+ *          - @ref qplc_unpack_be_41u64u
+ *          - @ref qplc_unpack_be_42u64u
+ *          - @ref qplc_unpack_be_43u64u
+ *          - @ref qplc_unpack_be_44u64u
+ *          - @ref qplc_unpack_be_45u64u
+ *          - @ref qplc_unpack_be_46u64u
+ *          - @ref qplc_unpack_be_47u64u
+ *          - @ref qplc_unpack_be_48u64u
+ *          - @ref qplc_unpack_be_49u64u
+ *          - @ref qplc_unpack_be_50u64u
+ *          - @ref qplc_unpack_be_51u64u
+ *          - @ref qplc_unpack_be_52u64u
+ *          - @ref qplc_unpack_be_53u64u
+ *          - @ref qplc_unpack_be_54u64u
+ *          - @ref qplc_unpack_be_55u64u
+ *          - @ref qplc_unpack_be_56u64u
+ *          - @ref qplc_unpack_be_57u64u
+ *          - @ref qplc_unpack_be_58u64u
+ *          - @ref qplc_unpack_be_59u64u
+ *          - @ref qplc_unpack_be_60u64u
+ *          - @ref qplc_unpack_be_61u64u
+ *          - @ref qplc_unpack_be_62u64u
+ *          - @ref qplc_unpack_be_63u64u
+ *          - @ref qplc_unpack_be_64u64u
+ *
+ */
+
+#include "own_qplc_defs.h"
+#include "qplc_unpack.h"
+
+// Appends the next dword of the source, or the bytes left at the end of the source, below bits_in_buf top bits
+OWN_QPLC_INLINE(uint32_t, own_load_be_32u,
+                (const uint8_t** pp_src, const uint8_t* end_ptr, uint64_t* buf_ptr, uint32_t bits_in_buf)) {
+    const uint8_t* src_ptr = *pp_src;
+    uint64_t       data    = 0U;
+    uint32_t       bytes   = (uint32_t)(end_ptr - src_ptr);
+
+    if (sizeof(uint32_t) <= bytes) {
+        data  = (uint64_t)qplc_swap_bytes_32u(*(uint32_t*)src_ptr);
+        bytes = sizeof(uint32_t);
+    } else {
+        for (uint32_t i = 0U; i < bytes; i++) {
+            data |= ((uint64_t)src_ptr[i]) << ((sizeof(uint32_t) - 1U - i) * OWN_BYTE_WIDTH);
+        }
+    }
+
+    *buf_ptr |= data << (OWN_DWORD_WIDTH - bits_in_buf);
+    *pp_src = src_ptr + bytes;
+
+    return bits_in_buf + bytes * OWN_BYTE_WIDTH;
+}
+
+// For BE start_bit is bit index from the top of a byte, every element is taken from the top of the buffer
+// as the high part of up to 32 bits and the low dword
+OWN_QPLC_INLINE(void, qplc_unpack_be_Nu64u,
+                (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint32_t bit_width,
+                 uint8_t* dst_ptr)) {
+    const uint8_t* end_ptr     = src_ptr + OWN_BITS_2_BYTE((uint64_t)num_elements * bit_width + start_bit);
+    uint64_t*      dst64u_ptr  = (uint64_t*)dst_ptr;
+    uint32_t       high_width  = bit_width - OWN_DWORD_WIDTH;
+    uint64_t       src         = 0U;
+    uint64_t       high        = 0U;
+    uint32_t       bits_in_buf = 0U;
+
+    if (0U == num_elements) { return; }
+
+    bits_in_buf = own_load_be_32u(&src_ptr, end_ptr, &src, 0U);
+    src <<= start_bit;
+    bits_in_buf -= start_bit;
+
+    while (0U < num_elements) {
+        if (high_width > bits_in_buf) { bits_in_buf = own_load_be_32u(&src_ptr, end_ptr, &src, bits_in_buf); }
+        high = src >> (OWN_QWORD_WIDTH - high_width);
+        src <<= high_width;
+        bits_in_buf -= high_width;
+
+        if (OWN_DWORD_WIDTH > bits_in_buf) { bits_in_buf = own_load_be_32u(&src_ptr, end_ptr, &src, bits_in_buf); }
+        *dst64u_ptr = (high << OWN_DWORD_WIDTH) | (src >> OWN_DWORD_WIDTH);
+        src <<= OWN_DWORD_WIDTH;
+        bits_in_buf -= OWN_DWORD_WIDTH;
+        dst64u_ptr++;
+        num_elements--;
+    }
+}
+
+// ********************** 33u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_33u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 33U, dst_ptr);
+}
+
+// ********************** 34u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_34u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 34U, dst_ptr);
+}
+
+// ********************** 35u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_35u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 35U, dst_ptr);
+}
+
+// ********************** 36u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_36u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 36U, dst_ptr);
+}
+
+// ********************** 37u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_37u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 37U, dst_ptr);
+}
+
+// ********************** 38u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_38u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 38U, dst_ptr);
+}
+
+// ********************** 39u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_39u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 39U, dst_ptr);
+}
+
+// ********************** 40u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_40u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 40U, dst_ptr);
+}
+
+// ********************** 41u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_41u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 41U, dst_ptr);
+}
+
+// ********************** 42u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_42u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 42U, dst_ptr);
+}
+
+// ********************** 43u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_43u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 43U, dst_ptr);
+}
+
+// ********************** 44u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_44u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 44U, dst_ptr);
+}
+
+// ********************** 45u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_45u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 45U, dst_ptr);
+}
+
+// ********************** 46u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_46u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 46U, dst_ptr);
+}
+
+// ********************** 47u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_47u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 47U, dst_ptr);
+}
+
+// ********************** 48u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_48u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 48U, dst_ptr);
+}
+
+// ********************** 49u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_49u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 49U, dst_ptr);
+}
+
+// ********************** 50u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_50u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 50U, dst_ptr);
+}
+
+// ********************** 51u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_51u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 51U, dst_ptr);
+}
+
+// ********************** 52u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_52u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 52U, dst_ptr);
+}
+
+// ********************** 53u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_53u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 53U, dst_ptr);
+}
+
+// ********************** 54u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_54u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 54U, dst_ptr);
+}
+
+// ********************** 55u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_55u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 55U, dst_ptr);
+}
+
+// ********************** 56u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_56u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 56U, dst_ptr);
+}
+
+// ********************** 57u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_57u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 57U, dst_ptr);
+}
+
+// ********************** 58u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_58u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 58U, dst_ptr);
+}
+
+// ********************** 59u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_59u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 59U, dst_ptr);
+}
+
+// ********************** 60u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_60u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 60U, dst_ptr);
+}
+
+// ********************** 61u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_61u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 61U, dst_ptr);
+}
+
+// ********************** 62u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_62u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 62U, dst_ptr);
+}
+
+// ********************** 63u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_63u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 63U, dst_ptr);
+}
+
+// ********************** 64u ****************************** //
+
+OWN_QPLC_FUN(void, qplc_unpack_be_64u64u,
+             (const uint8_t* src_ptr, uint32_t num_elements, uint32_t start_bit, uint8_t* dst_ptr)) {
+    qplc_unpack_be_Nu64u(src_ptr, num_elements, start_bit, 64U, dst_ptr);
+}
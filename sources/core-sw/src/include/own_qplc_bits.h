@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  SW Core API (Private API)
+ */
+
+#ifndef QPL_SOURCES_CORE_SRC_INCLUDE_OWN_QPLC_BITS_H_
+#define QPL_SOURCES_CORE_SRC_INCLUDE_OWN_QPLC_BITS_H_
+
+#include "own_qplc_defs.h"
+
+/**
+ * @brief Portable bit counting helpers for the generic implementations of the kernels with bit-vector output
+ */
+
+OWN_QPLC_INLINE(uint32_t, own_bits_popcount_64u, (uint64_t value)) {
+    value = value - ((value >> 1U) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2U) & 0x3333333333333333ULL);
+    value = (value + (value >> 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return (uint32_t)((value * 0x0101010101010101ULL) >> 56U);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_bits_lowest_bit_64u, (uint64_t value)) {
+    // Value is expected to be non-zero
+    return own_bits_popcount_64u((value & (~value + 1U)) - 1U);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_bits_highest_bit_64u, (uint64_t value)) {
+    // Value is expected to be non-zero
+    value |= value >> 1U;
+    value |= value >> 2U;
+    value |= value >> 4U;
+    value |= value >> 8U;
+    value |= value >> 16U;
+    value |= value >> 32U;
+
+    return own_bits_popcount_64u(value) - 1U;
+}
+
+/**
+ * @brief Accumulates aggregates of 64 bit-vector elements starting from the index:
+ *        indices of the first and the last set bits and the number of set bits
+ */
+OWN_QPLC_INLINE(void, own_bits_aggregates,
+                (uint64_t bits, uint32_t index, uint32_t* min_value_ptr, uint32_t* max_value_ptr, uint32_t* sum_ptr)) {
+    if (0U == bits) { return; }
+    if (OWN_MAX_32U == *min_value_ptr) { *min_value_ptr = index + own_bits_lowest_bit_64u(bits); }
+    *max_value_ptr = index + own_bits_highest_bit_64u(bits);
+    *sum_ptr += own_bits_popcount_64u(bits);
+}
+
+#endif // QPL_SOURCES_CORE_SRC_INCLUDE_OWN_QPLC_BITS_H_
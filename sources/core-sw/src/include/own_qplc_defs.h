@@ -204,7 +204,9 @@ OWN_QPLC_INLINE(uint64_t, OWN_QPLC_UINT_PTR, (const void* ptr)) {
     return dd.cardinal;
 }
 
-#define OWN_QPLC_PACK_BE_INDEX_SHIFT 35U
+#define OWN_QPLC_PACK_BE_INDEX_SHIFT     35U
+#define OWN_QPLC_PACK_64U_INDEX          70U /**< First pack index of 33..64-bit output */
+#define OWN_QPLC_PACK_64U_BE_INDEX_SHIFT 32U
 
 /**
  * @brief Helper for calculating input bit width from pack index.
@@ -215,6 +217,8 @@ OWN_QPLC_INLINE(uint64_t, OWN_QPLC_UINT_PTR, (const void* ptr)) {
  *      - bit_width;
  */
 OWN_QPLC_INLINE(uint32_t, own_get_bit_width_from_index, (uint32_t pack_index)) {
+    if (OWN_QPLC_PACK_64U_INDEX <= pack_index) { return pack_index - OWN_QPLC_PACK_64U_INDEX + 33U; }
+
     uint32_t bit_width = pack_index + 1U;
     bit_width          = (33U == bit_width) ? OWN_WORD_WIDTH : bit_width;
     bit_width          = (33U < bit_width) ? OWN_DWORD_WIDTH : bit_width;
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+  * @brief Contains AVX2 implementation of functions for Intel® Query Processing Library (Intel® QPL)
+  * memory group functions
+  *
+  * @date 10/17/2026
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_zero_8u
+  *          - @ref l9_qplc_copy_8u
+  *          - @ref l9_qplc_move_8u
+  */
+
+#ifndef OWN_MEMOP_L9_H
+#define OWN_MEMOP_L9_H
+
+#include "own_qplc_defs.h"
+#include "qplc_memop.h"
+
+// ********************** Zero ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_zero_8u, (uint8_t * dst_ptr, uint32_t length)) {
+    uint32_t length256u = length / sizeof(__m256i);
+    uint32_t tail       = length % sizeof(__m256i);
+
+    while (length256u > 3U) {
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_setzero_si256());
+        _mm256_storeu_si256((__m256i*)(dst_ptr + 32U), _mm256_setzero_si256());
+        _mm256_storeu_si256((__m256i*)(dst_ptr + 64U), _mm256_setzero_si256());
+        _mm256_storeu_si256((__m256i*)(dst_ptr + 96U), _mm256_setzero_si256());
+        dst_ptr += 128U;
+        length256u -= 4U;
+    }
+
+    while (length256u > 0U) {
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_setzero_si256());
+        dst_ptr += 32U;
+        --length256u;
+    }
+
+    for (uint32_t i = 0U; i < tail; i++) {
+        dst_ptr[i] = 0U;
+    }
+}
+
+// ********************** Copy ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_copy_8u, (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length)) {
+    uint32_t length256u = length / sizeof(__m256i);
+    uint32_t tail       = length % sizeof(__m256i);
+
+    while (length256u > 3U) {
+        __m256i ymm0 = _mm256_loadu_si256((const __m256i*)src_ptr);
+        __m256i ymm1 = _mm256_loadu_si256((const __m256i*)(src_ptr + 32U));
+        __m256i ymm2 = _mm256_loadu_si256((const __m256i*)(src_ptr + 64U));
+        __m256i ymm3 = _mm256_loadu_si256((const __m256i*)(src_ptr + 96U));
+        _mm256_storeu_si256((__m256i*)dst_ptr, ymm0);
+        _mm256_storeu_si256((__m256i*)(dst_ptr + 32U), ymm1);
+        _mm256_storeu_si256((__m256i*)(dst_ptr + 64U), ymm2);
+        _mm256_storeu_si256((__m256i*)(dst_ptr + 96U), ymm3);
+        src_ptr += 128U;
+        dst_ptr += 128U;
+        length256u -= 4U;
+    }
+
+    while (length256u > 0U) {
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_loadu_si256((const __m256i*)src_ptr));
+        src_ptr += 32U;
+        dst_ptr += 32U;
+        --length256u;
+    }
+
+    for (uint32_t i = 0U; i < tail; i++) {
+        dst_ptr[i] = src_ptr[i];
+    }
+}
+
+// ********************** Move ****************************** //
+
+/**
+ * @note Every 32-byte block is loaded before it is stored, so walking the buffers towards
+ *       the overlapping side keeps the move correct for any distance between src and dst.
+ */
+OWN_OPT_FUN(void, l9_qplc_move_8u, (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length)) {
+    uint32_t length256u = length / sizeof(__m256i);
+    uint32_t tail       = length % sizeof(__m256i);
+
+    if (OWN_QPLC_UINT_PTR(src_ptr) < OWN_QPLC_UINT_PTR(dst_ptr)) {
+        const uint8_t* src_end_ptr = src_ptr + length;
+        uint8_t*       dst_end_ptr = dst_ptr + length;
+
+        while (length256u > 0U) {
+            src_end_ptr -= 32U;
+            dst_end_ptr -= 32U;
+            _mm256_storeu_si256((__m256i*)dst_end_ptr, _mm256_loadu_si256((const __m256i*)src_end_ptr));
+            --length256u;
+        }
+
+        for (uint32_t i = 0U; i < tail; i++) {
+            dst_ptr[tail - 1U - i] = src_ptr[tail - 1U - i];
+        }
+    } else {
+        while (length256u > 0U) {
+            _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_loadu_si256((const __m256i*)src_ptr));
+            src_ptr += 32U;
+            dst_ptr += 32U;
+            --length256u;
+        }
+
+        for (uint32_t i = 0U; i < tail; i++) {
+            dst_ptr[i] = src_ptr[i];
+        }
+    }
+}
+
+#endif // OWN_MEMOP_L9_H
@@ -23,23 +23,30 @@ extern "C" hw_accelerator_status hw_enqueue_descriptor(void* desc_ptr, int32_t u
 
     if (device_count == 0) { return HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE; }
 
-    for (uint64_t try_count = 0U; try_count < device_count; ++try_count) {
-        const auto& device = dispatcher.device(device_idx);
-        device_idx         = (device_idx + 1) % device_count;
-
-        if (!device.is_matching_user_numa_policy(user_specified_numa_id)) { continue; }
-
-        hw_iaa_descriptor_hint_cpu_cache_as_destination((hw_descriptor*)desc_ptr, device.get_cache_write_available());
-
-        const hw_accelerator_status enqueue_result = device.enqueue_descriptor(desc_ptr);
-        if (enqueue_result == HW_ACCELERATOR_NOT_SUPPORTED_BY_WQ &&
-            result == HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE) {
-            result = HW_ACCELERATOR_NOT_SUPPORTED_BY_WQ;
-        } else if (enqueue_result == HW_ACCELERATOR_WQ_IS_BUSY) {
-            result = HW_ACCELERATOR_WQ_IS_BUSY;
-        } else if (enqueue_result == HW_ACCELERATOR_STATUS_OK) {
-            result = HW_ACCELERATOR_STATUS_OK;
-            break;
+    const auto start_idx = device_idx;
+    device_idx           = (device_idx + 1) % device_count;
+
+    // Devices with all WQs congested are tried in the second pass only
+    for (uint32_t pass = 0U; pass < 2U && result != HW_ACCELERATOR_STATUS_OK; ++pass) {
+        for (uint64_t try_count = 0U; try_count < device_count; ++try_count) {
+            const auto& device = dispatcher.device((start_idx + try_count) % device_count);
+
+            if (!device.is_matching_user_numa_policy(user_specified_numa_id)) { continue; }
+            if (device.is_congested() != (1U == pass)) { continue; }
+
+            hw_iaa_descriptor_hint_cpu_cache_as_destination((hw_descriptor*)desc_ptr,
+                                                            device.get_cache_write_available());
+
+            const hw_accelerator_status enqueue_result = device.enqueue_descriptor(desc_ptr);
+            if (enqueue_result == HW_ACCELERATOR_NOT_SUPPORTED_BY_WQ &&
+                result == HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE) {
+                result = HW_ACCELERATOR_NOT_SUPPORTED_BY_WQ;
+            } else if (enqueue_result == HW_ACCELERATOR_WQ_IS_BUSY) {
+                result = HW_ACCELERATOR_WQ_IS_BUSY;
+            } else if (enqueue_result == HW_ACCELERATOR_STATUS_OK) {
+                result = HW_ACCELERATOR_STATUS_OK;
+                break;
+            }
         }
     }
 #else
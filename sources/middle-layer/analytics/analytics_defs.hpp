@@ -26,6 +26,12 @@ enum class output_bit_width_format_t : uint32_t {
 
 enum class analytic_pipeline { simple, prle, inflate, inflate_prle };
 
+/**
+ * @brief Minimal length of a PRLE run processed as a whole by the software path,
+ *        shorter runs are unpacked together with the neighbouring groups
+ */
+constexpr uint32_t prle_min_run_length = 64U;
+
 struct analytic_operation_result_t {
     uint32_t     status_code_     = 0U;
     uint32_t     output_bytes_    = 0U;
@@ -36,9 +42,9 @@ struct analytic_operation_result_t {
 
 void inline aggregates_empty_callback(const uint8_t* UNREFERENCED_PARAMETER(src_ptr),
                                       uint32_t       UNREFERENCED_PARAMETER(length),
-                                      uint32_t*      UNREFERENCED_PARAMETER(min_value_ptr),
-                                      uint32_t*      UNREFERENCED_PARAMETER(max_value_ptr),
-                                      uint32_t*      UNREFERENCED_PARAMETER(sum_ptr),
+                                      uint64_t*      UNREFERENCED_PARAMETER(min_value_ptr),
+                                      uint64_t*      UNREFERENCED_PARAMETER(max_value_ptr),
+                                      uint64_t*      UNREFERENCED_PARAMETER(sum_ptr),
                                       uint32_t*      UNREFERENCED_PARAMETER(index_ptr)) {
     // Don't do anything, this is just a stub
 }
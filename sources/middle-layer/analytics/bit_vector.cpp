@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "bit_vector.hpp"
+
+#include <algorithm>
+
+// core-sw
+#include "dispatcher.hpp"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Combines unpacked elements of the source and the mask in place, the elements are 0 or 1
+ */
+static inline void combine_elements(bit_vector_operation_t operation, uint8_t* source_ptr, const uint8_t* mask_ptr,
+                                    uint32_t elements_count) noexcept {
+    switch (operation) {
+        case bit_vector_operation_t::logical_and: {
+            for (uint32_t i = 0U; i < elements_count; i++) {
+                source_ptr[i] &= mask_ptr[i];
+            }
+            break;
+        }
+        case bit_vector_operation_t::logical_or: {
+            for (uint32_t i = 0U; i < elements_count; i++) {
+                source_ptr[i] |= mask_ptr[i];
+            }
+            break;
+        }
+        case bit_vector_operation_t::logical_and_not: {
+            for (uint32_t i = 0U; i < elements_count; i++) {
+                source_ptr[i] &= mask_ptr[i] ^ 1U;
+            }
+            break;
+        }
+        case bit_vector_operation_t::logical_xor: {
+            for (uint32_t i = 0U; i < elements_count; i++) {
+                source_ptr[i] ^= mask_ptr[i];
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Single pass operation on uncompressed LE bit-vectors with plain bit-vector output
+ */
+static inline auto bit_vector_words(input_stream_t& input_stream, input_stream_t& mask_stream,
+                                    output_stream_t<bit_stream>& output_stream, bit_vector_operation_t operation,
+                                    limited_buffer_t& buffer, aggregates_t& aggregates) noexcept -> uint32_t {
+    auto table  = core_sw::dispatcher::kernels_dispatcher::get_instance().get_bit_vector_table();
+    auto kernel = table[static_cast<uint32_t>(operation)];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    const uint32_t elements_to_process = input_stream.elements_left();
+
+    uint8_t* destination_ptr = output_stream.reserve_bits(elements_to_process);
+
+    if (nullptr == destination_ptr) { return status_list::destination_is_short_error; }
+
+    uint32_t min_value = std::numeric_limits<uint32_t>::max();
+    uint32_t max_value = 0U;
+    uint32_t sum       = 0U;
+    uint32_t index     = 0U;
+
+    kernel(input_stream.current_ptr(), mask_stream.current_ptr(), elements_to_process, destination_ptr, &min_value,
+           &max_value, &sum, &index);
+
+    if (!input_stream.are_aggregates_disabled()) { aggregates = {min_value, max_value, sum, index}; }
+
+    input_stream.shift_current_ptr(util::bit_to_byte(elements_to_process));
+    input_stream.add_elements_processed(elements_to_process);
+
+    return status_list::ok;
+}
+
+template <analytic_pipeline pipeline_t>
+static inline auto bit_vector(input_stream_t& input_stream, input_stream_t& mask_stream,
+                              output_stream_t<bit_stream>& output_stream, bit_vector_operation_t operation,
+                              limited_buffer_t& unpack_buffer, limited_buffer_t& mask_buffer,
+                              core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                              aggregates_t&                                  aggregates) noexcept -> uint32_t {
+    uint32_t source_elements = 0U;
+    uint32_t mask_elements   = 0U;
+    uint8_t* source_ptr      = nullptr;
+    uint8_t* mask_ptr        = nullptr;
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(unpack_buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    // Chunks of the source and the mask have different sizes, the last source chunk may be left after
+    // the source is unpacked
+    while (!input_stream.is_processed() || 0U != source_elements) {
+        if (0U == mask_elements) {
+            auto unpack_result = mask_stream.unpack<analytic_pipeline::simple>(mask_buffer);
+
+            if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+            mask_elements = unpack_result.unpacked_elements;
+            mask_ptr      = mask_buffer.data();
+        }
+
+        if (0U == source_elements) {
+            auto unpack_result = input_stream.unpack<pipeline_t>(unpack_buffer);
+
+            if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+            source_elements = unpack_result.unpacked_elements;
+            source_ptr      = unpack_buffer.data();
+        }
+
+        const uint32_t elements_to_process = std::min(source_elements, mask_elements);
+
+        combine_elements(operation, source_ptr, mask_ptr, elements_to_process);
+
+        aggregates_callback(source_ptr, elements_to_process, &aggregates.min_value_, &aggregates.max_value_,
+                            &aggregates.sum_, &aggregates.index_);
+
+        auto status = output_stream.perform_pack(source_ptr, elements_to_process);
+
+        if (status_list::ok != status) { return status; }
+
+        source_ptr += elements_to_process;
+        mask_ptr += elements_to_process;
+
+        source_elements -= elements_to_process;
+        mask_elements -= elements_to_process;
+    }
+
+    return status_list::ok;
+}
+
+template <>
+auto call_bit_vector<execution_path_t::software>(input_stream_t& input_stream, input_stream_t& mask_stream,
+                                                 output_stream_t<bit_stream>& output_stream,
+                                                 bit_vector_operation_t operation, limited_buffer_t& unpack_buffer,
+                                                 limited_buffer_t& mask_buffer,
+                                                 int32_t           UNREFERENCED_PARAMETER(numa_id)) noexcept
+        -> analytic_operation_result_t {
+    const uint32_t number_of_elements = input_stream.elements_left();
+
+    analytic_operation_result_t operation_result {};
+    aggregates_t                aggregates {};
+
+    auto aggregates_table = core_sw::dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
+    auto aggregates_index = core_sw::dispatcher::get_aggregates_index(1U);
+    auto aggregates_callback =
+            (input_stream.are_aggregates_disabled()) ? &aggregates_empty_callback : aggregates_table[aggregates_index];
+
+    uint32_t status_code = status_list::ok;
+
+    if (input_stream.stream_format() == stream_format_t::le_format && !input_stream.is_compressed() &&
+        mask_stream.stream_format() == stream_format_t::le_format && output_stream.is_plain_bit_vector()) {
+        status_code = bit_vector_words(input_stream, mask_stream, output_stream, operation, unpack_buffer, aggregates);
+    } else if (input_stream.stream_format() == stream_format_t::prle_format) {
+        if (input_stream.is_compressed()) {
+            status_code = bit_vector<analytic_pipeline::inflate_prle>(input_stream, mask_stream, output_stream,
+                                                                      operation, unpack_buffer, mask_buffer,
+                                                                      aggregates_callback, aggregates);
+        } else {
+            status_code = bit_vector<analytic_pipeline::prle>(input_stream, mask_stream, output_stream, operation,
+                                                              unpack_buffer, mask_buffer, aggregates_callback,
+                                                              aggregates);
+        }
+    } else {
+        if (input_stream.is_compressed()) {
+            status_code = bit_vector<analytic_pipeline::inflate>(input_stream, mask_stream, output_stream, operation,
+                                                                 unpack_buffer, mask_buffer, aggregates_callback,
+                                                                 aggregates);
+        } else {
+            status_code = bit_vector<analytic_pipeline::simple>(input_stream, mask_stream, output_stream, operation,
+                                                                unpack_buffer, mask_buffer, aggregates_callback,
+                                                                aggregates);
+        }
+    }
+
+    input_stream.calculate_checksums();
+
+    operation_result.status_code_      = status_code;
+    operation_result.aggregates_       = aggregates;
+    operation_result.checksums_.crc32_ = input_stream.crc_checksum();
+    operation_result.checksums_.xor_   = input_stream.xor_checksum();
+    operation_result.last_bit_offset_  = (1U == output_stream.bit_width()) ? number_of_elements & max_bit_index : 0U;
+    operation_result.output_bytes_     = output_stream.bytes_written();
+
+    return operation_result;
+}
+
+template <>
+auto call_bit_vector<execution_path_t::hardware>(input_stream_t& UNREFERENCED_PARAMETER(input_stream),
+                                                 input_stream_t& UNREFERENCED_PARAMETER(mask_stream),
+                                                 output_stream_t<bit_stream>& UNREFERENCED_PARAMETER(output_stream),
+                                                 bit_vector_operation_t       UNREFERENCED_PARAMETER(operation),
+                                                 limited_buffer_t&            UNREFERENCED_PARAMETER(unpack_buffer),
+                                                 limited_buffer_t&            UNREFERENCED_PARAMETER(mask_buffer),
+                                                 int32_t UNREFERENCED_PARAMETER(numa_id)) noexcept
+        -> analytic_operation_result_t {
+    analytic_operation_result_t operation_result {};
+
+    operation_result.status_code_ = status_list::not_supported_err;
+
+    return operation_result;
+}
+
+template <>
+auto call_bit_vector<execution_path_t::auto_detect>(input_stream_t& input_stream, input_stream_t& mask_stream,
+                                                    output_stream_t<bit_stream>& output_stream,
+                                                    bit_vector_operation_t operation, limited_buffer_t& unpack_buffer,
+                                                    limited_buffer_t& mask_buffer, int32_t numa_id) noexcept
+        -> analytic_operation_result_t {
+    return call_bit_vector<execution_path_t::software>(input_stream, mask_stream, output_stream, operation,
+                                                       unpack_buffer, mask_buffer, numa_id);
+}
+
+} // namespace qpl::ml::analytics
@@ -0,0 +1,41 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_BIT_VECTOR_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_BIT_VECTOR_HPP_
+
+#include "input_stream.hpp"
+#include "output_stream.hpp"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Bitwise operations on two bit-vectors, the values are the indices of the core-sw bit-vector kernels
+ */
+enum class bit_vector_operation_t : uint32_t {
+    logical_and     = 0U, /**< source-1 & source-2 */
+    logical_or      = 1U, /**< source-1 | source-2 */
+    logical_and_not = 2U, /**< source-1 & ~source-2 */
+    logical_xor     = 3U  /**< source-1 ^ source-2 */
+};
+
+/**
+ * @brief Combines the bit-vector of the input stream with the bit-vector of the mask stream bit by bit.
+ *
+ * LE bit-vectors with plain bit-vector output are combined by 64-bit words in a single pass, other formats
+ * are unpacked into the unpack and mask buffers first. Aggregates report the number of set bits and indices
+ * of the first and the last of them. The accelerator has no bit-vector operations, so the hardware path
+ * returns status_list::not_supported_err.
+ */
+template <execution_path_t path>
+auto call_bit_vector(input_stream_t& input_stream, input_stream_t& mask_stream,
+                     output_stream_t<bit_stream>& output_stream, bit_vector_operation_t operation,
+                     limited_buffer_t& unpack_buffer, limited_buffer_t& mask_buffer, int32_t numa_id = -1) noexcept
+        -> analytic_operation_result_t;
+
+} // namespace qpl::ml::analytics
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_BIT_VECTOR_HPP_
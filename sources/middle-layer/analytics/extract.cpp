@@ -52,6 +52,120 @@ static inline auto extract(input_stream_t& input_stream, limited_buffer_t& buffe
     return status_list::ok;
 }
 
+template <class element_t>
+static inline auto pack_repeated_element(limited_buffer_t& buffer, output_stream_t<array_stream>& output_stream,
+                                         uint32_t value, uint32_t elements_count) noexcept -> uint32_t {
+    auto* elements_ptr = reinterpret_cast<element_t*>(buffer.data());
+
+    std::fill(elements_ptr, elements_ptr + std::min(elements_count, buffer.max_elements_count()),
+              static_cast<element_t>(value));
+
+    while (0U != elements_count) {
+        const uint32_t chunk_size = std::min(elements_count, buffer.max_elements_count());
+        const uint32_t status     = output_stream.perform_pack(buffer.data(), chunk_size);
+
+        if (status_list::ok != status) { return status; }
+
+        elements_count -= chunk_size;
+    }
+
+    return status_list::ok;
+}
+
+/**
+ * @brief Extract from uncompressed PRLE input that handles each long RLE run at once
+ *
+ * Runs outside of the index range are skipped, the part of a run inside of it is written as repeated elements
+ * and updates the aggregates at once. Bit-packed groups and short runs are unpacked and extracted as usual.
+ */
+static inline auto extract_prle_runs(input_stream_t& input_stream, limited_buffer_t& buffer,
+                                     output_stream_t<array_stream>&                       output_stream,
+                                     const core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                     aggregates_t& aggregates, const uint32_t param_low,
+                                     const uint32_t param_high) noexcept -> uint32_t {
+    auto           table        = core_sw::dispatcher::kernels_dispatcher::get_instance().get_extract_i_table();
+    const uint32_t index        = core_sw::dispatcher::get_extract_index(input_stream.bit_width());
+    auto           extract_impl = table[index];
+    const uint32_t element_bits = util::bit_width_to_bits(input_stream.bit_width());
+
+    uint32_t source_index = 0;
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    while (!input_stream.is_processed()) {
+        const auto run = input_stream.take_prle_run(prle_min_run_length);
+
+        if (0U != run.length) {
+            const uint64_t first_index = std::max<uint64_t>(source_index, param_low);
+            const uint64_t last_index  = std::min<uint64_t>(source_index + uint64_t {run.length} - 1U, param_high);
+
+            source_index += run.length;
+
+            if (first_index > last_index) { continue; }
+
+            const auto extracted_elements = static_cast<uint32_t>(last_index - first_index + 1U);
+
+            if (!input_stream.are_aggregates_disabled()) {
+                if (1U == input_stream.bit_width()) {
+                    // 1-bit elements are aggregated as a bit-vector
+                    if (0U != run.value) {
+                        if (std::numeric_limits<uint32_t>::max() == aggregates.min_value_) {
+                            aggregates.min_value_ = aggregates.index_;
+                        }
+
+                        aggregates.max_value_ = aggregates.index_ + extracted_elements - 1U;
+                        aggregates.sum_ += extracted_elements;
+                    }
+
+                    aggregates.index_ += extracted_elements;
+                } else {
+                    aggregates.min_value_ = std::min<uint64_t>(aggregates.min_value_, run.value);
+                    aggregates.max_value_ = std::max<uint64_t>(aggregates.max_value_, run.value);
+                    aggregates.sum_ += uint64_t {run.value} * extracted_elements;
+                }
+            }
+
+            uint32_t status = status_list::ok;
+
+            if (byte_bits_size == element_bits) {
+                status = pack_repeated_element<uint8_t>(buffer, output_stream, run.value, extracted_elements);
+            } else if (short_bits_size == element_bits) {
+                status = pack_repeated_element<uint16_t>(buffer, output_stream, run.value, extracted_elements);
+            } else {
+                status = pack_repeated_element<uint32_t>(buffer, output_stream, run.value, extracted_elements);
+            }
+
+            if (status_list::ok != status) { return status; }
+
+            continue;
+        }
+
+        const uint32_t elements_to_unpack =
+                input_stream.prle_elements_before_run(prle_min_run_length, buffer.max_elements_count());
+
+        auto unpack_result = input_stream.unpack<analytic_pipeline::prle>(buffer, elements_to_unpack);
+
+        if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        auto extracted_elements =
+                extract_impl(buffer.data(), elements_to_process, &source_index, param_low, param_high);
+
+        if (0U != extracted_elements) {
+            aggregates_callback(buffer.data(), extracted_elements, &aggregates.min_value_, &aggregates.max_value_,
+                                &aggregates.sum_, &aggregates.index_);
+
+            auto status = output_stream.perform_pack(buffer.data(), extracted_elements);
+
+            if (status_list::ok != status) { return status; }
+        }
+    }
+
+    return status_list::ok;
+}
+
 template <analytic_pipeline = analytic_pipeline::simple>
 static inline auto extract(input_stream_t& input_stream, limited_buffer_t& buffer,
                            output_stream_t<array_stream>&                       output_stream,
@@ -95,6 +209,14 @@ auto call_extract<execution_path_t::hardware>(input_stream_t&                inp
                                               uint32_t          param_high,
                                               limited_buffer_t& UNREFERENCED_PARAMETER(temporary_buffer),
                                               int32_t           numa_id) noexcept -> analytic_operation_result_t {
+    if (limits::max_bit_width < input_stream.bit_width()) {
+        // Elements wider than 32 bits are processed on the host only
+        analytic_operation_result_t operation_result {};
+        operation_result.status_code_ = status_list::not_supported_err;
+
+        return operation_result;
+    }
+
     hw_iaa_aecs_analytic HW_PATH_ALIGN_STRUCTURE                  aecs_analytic {};
     HW_PATH_VOLATILE hw_completion_record HW_PATH_ALIGN_STRUCTURE completion_record {};
     hw_descriptor HW_PATH_ALIGN_STRUCTURE                         descriptor {};
@@ -129,7 +251,10 @@ auto call_extract<execution_path_t::software>(input_stream_t&                inp
     auto aggregates_callback =
             (input_stream.are_aggregates_disabled()) ? &aggregates_empty_callback : aggregates_table[aggregates_index];
 
-    if ((input_bit_width == 8U || input_bit_width == 16U || input_bit_width == 32U) &&
+    // Values of 33..64-bit elements may be above the default minimum
+    if (input_bit_width > int_bits_size) { aggregates.min_value_ = std::numeric_limits<uint64_t>::max(); }
+
+    if ((input_bit_width == 8U || input_bit_width == 16U || input_bit_width == 32U || input_bit_width == 64U) &&
         input_stream.stream_format() == stream_format_t::le_format && !input_stream.is_compressed()) {
         auto           extract_table  = core_sw::dispatcher::kernels_dispatcher::get_instance().get_extract_table();
         const uint32_t extract_index  = core_sw::dispatcher::get_extract_index(input_bit_width);
@@ -144,8 +269,8 @@ auto call_extract<execution_path_t::software>(input_stream_t&                inp
                                                                        aggregates_callback, aggregates, param_low,
                                                                        param_high);
             } else {
-                status_code = extract<analytic_pipeline::prle>(input_stream, temporary_buffer, output_stream,
-                                                               aggregates_callback, aggregates, param_low, param_high);
+                status_code = extract_prle_runs(input_stream, temporary_buffer, output_stream, aggregates_callback,
+                                                aggregates, param_low, param_high);
             }
         } else {
             if (input_stream.is_compressed()) {
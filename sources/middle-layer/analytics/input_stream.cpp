@@ -11,6 +11,34 @@
 
 namespace qpl::ml::analytics {
 
+static constexpr uint32_t prle_group_size      = 8U; /**< Number of elements in a bit-packed PRLE group */
+static constexpr uint32_t prle_max_header_size = 5U; /**< Maximal size of the PRLE group header varint */
+
+/**
+ * @brief Decodes a PRLE group header, the lowest bit of the varint tells if the group is bit-packed,
+ *        the remaining bits hold the number of groups or repeated elements
+ *
+ * @return header size in bytes, 0 if the header is truncated
+ */
+static inline auto decode_prle_header(const uint8_t* source_ptr, size_t source_size, bool& is_bit_packed,
+                                      uint32_t& count) noexcept -> uint32_t {
+    const size_t header_limit = std::min(source_size, static_cast<size_t>(prle_max_header_size));
+    uint64_t     header       = 0U;
+
+    for (size_t i = 0U; i < header_limit; i++) {
+        header |= static_cast<uint64_t>(source_ptr[i] & 0x7FU) << (7U * i);
+
+        if (0U == (source_ptr[i] & 0x80U)) {
+            is_bit_packed = (0U != (header & 1U));
+            count         = static_cast<uint32_t>(header >> 1U);
+
+            return static_cast<uint32_t>(i + 1U);
+        }
+    }
+
+    return 0U;
+}
+
 template <>
 auto input_stream_t::unpack<analytic_pipeline::simple>(limited_buffer_t& output_buffer,
                                                        size_t required_elements) noexcept -> unpack_result_t {
@@ -38,7 +66,13 @@ auto input_stream_t::unpack<analytic_pipeline::prle>(limited_buffer_t& output_bu
     uint8_t* saved_source_ptr = current_source_ptr_;
     uint8_t* current_ptr      = output_buffer.data();
 
-    required_elements = std::min(static_cast<uint32_t>(required_elements), current_number_of_elements_);
+    // The last bit-packed group is unpacked as a whole if the buffer allows, the padding elements are dropped
+    if (required_elements >= current_number_of_elements_) {
+        const uint32_t rounded_elements =
+                (current_number_of_elements_ + prle_group_size - 1U) / prle_group_size * prle_group_size;
+
+        required_elements = std::min(rounded_elements, output_buffer.max_elements_count());
+    }
 
     auto status = unpack_prle_kernel_(&current_source_ptr_, current_source_size_, bit_width_, &current_ptr,
                                       static_cast<uint32_t>(required_elements), &prle_count_, &prle_value_);
@@ -170,6 +204,78 @@ auto input_stream_t::unpack<analytic_pipeline::inflate_prle>(limited_buffer_t& o
     return input_stream_t::unpack<analytic_pipeline::inflate_prle>(output_buffer, output_buffer.max_elements_count());
 }
 
+auto input_stream_t::take_prle_run(uint32_t min_run_length) noexcept -> prle_run_t {
+    prle_run_t run {};
+
+    if (0 != prle_count_ || is_processed()) { return run; }
+
+    bool           is_bit_packed = false;
+    uint32_t       count         = 0U;
+    const uint32_t header_size   = decode_prle_header(current_source_ptr_, current_source_size_, is_bit_packed, count);
+    const uint32_t value_size    = util::bit_to_byte(static_cast<uint32_t>(bit_width_));
+
+    if (0U == header_size || is_bit_packed || 0U == count || count < min_run_length ||
+        header_size + value_size > current_source_size_) {
+        return run;
+    }
+
+    // The repeated element is stored in the little-endian order using the byte-rounded bit width
+    for (uint32_t i = 0U; i < value_size; i++) {
+        run.value |= static_cast<uint32_t>(current_source_ptr_[header_size + i]) << (i * byte_bits_size);
+    }
+
+    run.length = std::min(count, current_number_of_elements_);
+
+    shift_current_ptr(header_size + value_size);
+    add_elements_processed(run.length);
+
+    return run;
+}
+
+auto input_stream_t::prle_elements_before_run(uint32_t min_run_length, uint32_t max_elements) const noexcept
+        -> uint32_t {
+    // Bit-packed groups are split at the group boundaries only
+    if (max_elements >= prle_group_size) { max_elements -= max_elements % prle_group_size; }
+
+    const uint32_t elements_limit = std::min(max_elements, current_number_of_elements_);
+
+    // The group partially unpacked by the previous call is finished first
+    if (prle_count_ > 0) { return std::min(elements_limit, static_cast<uint32_t>(prle_count_)); }
+    if (prle_count_ < 0) { return std::min(elements_limit, static_cast<uint32_t>(-prle_count_) * prle_group_size); }
+
+    const uint32_t value_size = util::bit_to_byte(static_cast<uint32_t>(bit_width_));
+    uint64_t       elements   = 0U;
+    size_t         offset     = 0U;
+
+    while (elements < elements_limit && offset < current_source_size_) {
+        bool           is_bit_packed = false;
+        uint32_t       count         = 0U;
+        const uint32_t header_size =
+                decode_prle_header(current_source_ptr_ + offset, current_source_size_ - offset, is_bit_packed, count);
+
+        if (0U == header_size) { break; }
+
+        const bool is_long_run = !is_bit_packed && 0U != count && count >= min_run_length;
+
+        if (is_long_run) { break; }
+
+        const uint64_t group_elements = (is_bit_packed) ? static_cast<uint64_t>(count) * prle_group_size : count;
+        const uint64_t group_size     = (is_bit_packed) ? static_cast<uint64_t>(count) * bit_width_ : value_size;
+
+        // A group that doesn't fit is unpacked in several calls if it goes first
+        if (elements + group_elements > elements_limit) {
+            if (0U == elements) { elements = elements_limit; }
+            break;
+        }
+
+        elements += group_elements;
+        offset += header_size + group_size;
+    }
+
+    // Nothing to stop at, so the kernel unpacks as much as it can and reports a malformed stream if any
+    return (0U == elements) ? elements_limit : static_cast<uint32_t>(elements);
+}
+
 auto input_stream_t::initialize_sw_kernels() noexcept -> void {
     auto unpack_table      = core_sw::dispatcher::kernels_dispatcher::get_instance().get_unpack_table();
     auto unpack_prle_table = core_sw::dispatcher::kernels_dispatcher::get_instance().get_unpack_prle_table();
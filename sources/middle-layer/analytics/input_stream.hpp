@@ -61,12 +61,35 @@ public:
 
     enum class crc_t : uint32_t { gzip = 0U, iscsi = 1U };
 
+    struct prle_run_t {
+        uint32_t length = 0U; /**< Number of repeated elements, 0 if there is no run */
+        uint32_t value  = 0U; /**< Repeated element */
+    };
+
     template <analytic_pipeline pipeline>
     auto unpack(limited_buffer_t& output_buffer) noexcept -> unpack_result_t;
 
     template <analytic_pipeline pipeline>
     auto unpack(limited_buffer_t& output_buffer, size_t required_elements) noexcept -> unpack_result_t;
 
+    /**
+     * @brief Skips the RLE run of at least min_run_length elements the uncompressed PRLE stream is positioned at
+     *
+     * @return the run limited by the elements left, or an empty run if the next group is bit-packed, shorter,
+     *         truncated or partially unpacked already
+     */
+    auto take_prle_run(uint32_t min_run_length) noexcept -> prle_run_t;
+
+    /**
+     * @brief Counts the elements of the uncompressed PRLE stream before the next RLE run of at least min_run_length
+     *        elements, so that unpack<analytic_pipeline::prle> stops right at that run
+     *
+     * @return number of elements to unpack, at most max_elements and at least one group unless the stream is
+     *         processed
+     */
+    [[nodiscard]] auto prle_elements_before_run(uint32_t min_run_length, uint32_t max_elements) const noexcept
+            -> uint32_t;
+
     [[nodiscard]] inline auto bit_width() const noexcept -> uint32_t { return bit_width_; }
 
     [[nodiscard]] inline auto stream_format() const noexcept -> stream_format_t { return stream_format_; }
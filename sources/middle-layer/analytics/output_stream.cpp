@@ -6,6 +6,8 @@
 
 #include "output_stream.hpp"
 
+#include <cstring>
+
 namespace qpl::ml::analytics {
 
 template <>
@@ -32,6 +34,59 @@ auto output_stream_t<bit_stream>::perform_pack(const uint8_t* buffer_ptr, const
     return status;
 }
 
+template <>
+auto output_stream_t<bit_stream>::perform_fill(const bool is_set, uint32_t elements_count) noexcept -> uint32_t {
+    constexpr uint32_t fill_chunk_size = 64U;
+
+    uint8_t elements[fill_chunk_size];
+    std::memset(elements, (is_set) ? 1 : 0, sizeof(elements));
+
+    if (1U == actual_bit_width_) {
+        if (elements_count > capacity_) { return static_cast<uint32_t>(status_list::destination_is_short_error); }
+
+        // Bits up to the byte boundary are packed as usual, then whole bytes are set at once
+        const uint32_t head_count = std::min(elements_count, (byte_bits_size - start_bit_) & max_bit_index);
+
+        if (0U != head_count) {
+            const uint32_t status = perform_pack(elements, head_count);
+            if (status_list::ok != status) { return status; }
+
+            elements_count -= head_count;
+        }
+
+        const uint32_t byte_count = elements_count / byte_bits_size;
+
+        std::memset(destination_current_ptr_, (is_set) ? 0xFF : 0x00, byte_count);
+
+        destination_current_ptr_ += byte_count;
+        elements_written_ += byte_count * byte_bits_size;
+        capacity_ -= byte_count * byte_bits_size;
+        elements_count -= byte_count * byte_bits_size;
+
+        return (0U != elements_count) ? perform_pack(elements, elements_count) : status_list::ok;
+    }
+
+    // Cleared elements only advance the index of the next element
+    if (!is_set) {
+        current_output_index_ += elements_count;
+        elements_written_ += elements_count;
+        capacity_ -= elements_count;
+
+        return status_list::ok;
+    }
+
+    while (0U != elements_count) {
+        const uint32_t chunk_size = std::min(elements_count, fill_chunk_size);
+        const uint32_t status     = perform_pack(elements, chunk_size);
+
+        if (status_list::ok != status) { return status; }
+
+        elements_count -= chunk_size;
+    }
+
+    return status_list::ok;
+}
+
 template <>
 uint32_t output_stream_t<array_stream>::perform_pack(const uint8_t* buffer_ptr, const uint32_t elements_count,
                                                      const bool UNREFERENCED_PARAMETER(is_start_bit_used)) noexcept {
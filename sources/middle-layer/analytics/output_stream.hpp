@@ -31,6 +31,13 @@ public:
     auto perform_pack(const uint8_t* buffer_ptr, uint32_t elements_count, bool is_start_bit_used = true) noexcept
             -> uint32_t;
 
+    /**
+     * @brief Appends elements_count equal elements of the nominal bit-vector, so that a run of elements is written
+     *        at once, whole bytes of the 1-bit output are set directly and cleared elements of indices output are
+     *        skipped
+     */
+    auto perform_fill(bool is_set, uint32_t elements_count) noexcept -> uint32_t;
+
     [[nodiscard]] inline auto elements_written() -> uint32_t { return elements_written_; }
 
     [[nodiscard]] inline auto bit_width() noexcept -> uint32_t { return actual_bit_width_; }
@@ -55,6 +62,32 @@ public:
 
     auto invert_data() noexcept -> void { is_inverted_ = !is_inverted_; }
 
+    /**
+     * @brief Checks if the output is a LE bit-vector that starts from a byte boundary,
+     *        so the fused kernels can write it directly
+     */
+    [[nodiscard]] inline auto is_plain_bit_vector() const noexcept -> bool {
+        return (1U == actual_bit_width_) && (stream_format_t::le_format == stream_format_) && (0U == start_bit_);
+    }
+
+    /**
+     * @brief Reserves space for the bit-vector of elements_count elements written directly by a kernel
+     *
+     * @return pointer to the reserved space, nullptr if the destination is too short
+     */
+    [[nodiscard]] inline auto reserve_bits(uint32_t elements_count) noexcept -> uint8_t* {
+        if (elements_count > capacity_) { return nullptr; }
+
+        uint8_t* reserved_ptr = destination_current_ptr_;
+
+        destination_current_ptr_ += util::bit_to_byte(elements_count);
+        start_bit_ = elements_count & 7U;
+        elements_written_ += elements_count;
+        capacity_ -= elements_count;
+
+        return reserved_ptr;
+    }
+
 protected:
     template <class iterator_t>
     output_stream_t(iterator_t begin, iterator_t end) : buffer_t(begin, end) {}
@@ -39,6 +39,142 @@ static inline auto correct_input_param(const uint32_t source_bit_width, const ui
     return (input_param & (std::numeric_limits<uint32_t>::max() >> (limits::max_bit_width - source_bit_width)));
 }
 
+static inline auto correct_wide_input_param(const uint32_t source_bit_width, const uint64_t input_param) noexcept
+        -> uint64_t {
+    return (input_param & (std::numeric_limits<uint64_t>::max() >> (limits::max_wide_bit_width - source_bit_width)));
+}
+
+template <comparator_t comparator>
+constexpr static inline auto own_get_scan_range(const uint32_t low_limit, const uint32_t high_limit,
+                                                const uint32_t element_bit_width) noexcept -> scan_range_t {
+    scan_range_t   range {};
+    const auto     range_mask = (uint32_t)((1ULL << element_bit_width) - 1U);
+    const uint32_t param_low  = low_limit & range_mask;
+
+    if constexpr (comparator == equals || comparator == not_equals) {
+        range.low  = param_low;
+        range.high = param_low;
+    }
+
+    if constexpr (comparator == less_equals) {
+        range.low  = 0U;
+        range.high = param_low;
+    }
+
+    if constexpr (comparator == less_than) {
+        if (0U == param_low) {
+            range.low  = 1U;
+            range.high = 0U;
+        } else {
+            range.low  = 0U;
+            range.high = param_low - 1U;
+        }
+    }
+
+    if constexpr (comparator == greater_equals) {
+        range.low  = param_low;
+        range.high = std::numeric_limits<uint32_t>::max();
+    }
+
+    if constexpr (comparator == greater_than) {
+        if (param_low == range_mask) {
+            range.low  = 1U;
+            range.high = 0U;
+        } else {
+            range.low  = param_low + 1U;
+            range.high = std::numeric_limits<uint32_t>::max();
+        }
+    }
+
+    if constexpr (comparator == in_range || comparator == out_of_range) {
+        const uint32_t param_high = high_limit & range_mask;
+        range.low                 = param_low;
+        range.high                = param_high;
+    }
+
+    return range;
+}
+
+template <comparator_t comparator>
+constexpr static inline auto is_scan_match(const uint32_t value, const uint32_t param_low,
+                                           const uint32_t param_high) noexcept -> bool {
+    if constexpr (comparator == equals) { return value == param_low; }
+    if constexpr (comparator == not_equals) { return value != param_low; }
+    if constexpr (comparator == less_than) { return value < param_low; }
+    if constexpr (comparator == less_equals) { return value <= param_low; }
+    if constexpr (comparator == greater_than) { return value > param_low; }
+    if constexpr (comparator == greater_equals) { return value >= param_low; }
+    if constexpr (comparator == in_range) { return value >= param_low && value <= param_high; }
+    if constexpr (comparator == out_of_range) { return value < param_low || value > param_high; }
+
+    return false;
+}
+
+/**
+ * @brief Scan of uncompressed PRLE input that evaluates the predicate once per RLE run
+ *
+ * Long runs are written to the output as runs of equal bits and update the aggregates at once,
+ * bit-packed groups and short runs between them are unpacked and scanned as usual.
+ */
+template <comparator_t comparator>
+static inline auto scan_prle_runs(input_stream_t& input_stream, limited_buffer_t& buffer,
+                                  output_stream_t<output_stream_type_t::bit_stream>& output_stream,
+                                  core_sw::dispatcher::aggregates_function_ptr_t     aggregates_callback,
+                                  aggregates_t& aggregates, uint32_t param_low, uint32_t param_high) noexcept
+        -> uint32_t {
+    auto table     = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_i_table();
+    auto index     = core_sw::dispatcher::get_scan_index(input_stream.bit_width(), static_cast<uint32_t>(comparator));
+    auto scan_impl = table[index];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    while (!input_stream.is_processed()) {
+        const auto run = input_stream.take_prle_run(prle_min_run_length);
+
+        if (0U != run.length) {
+            const bool is_match = is_scan_match<comparator>(run.value, param_low, param_high);
+
+            if (is_match && !input_stream.are_aggregates_disabled()) {
+                if (std::numeric_limits<uint32_t>::max() == aggregates.min_value_) {
+                    aggregates.min_value_ = aggregates.index_;
+                }
+
+                aggregates.max_value_ = aggregates.index_ + run.length - 1U;
+                aggregates.sum_ += run.length;
+            }
+
+            aggregates.index_ += run.length;
+
+            auto status = output_stream.perform_fill(is_match, run.length);
+
+            if (status_list::ok != status) { return status; }
+
+            continue;
+        }
+
+        const uint32_t elements_to_unpack =
+                input_stream.prle_elements_before_run(prle_min_run_length, buffer.max_elements_count());
+
+        auto unpack_result = input_stream.unpack<analytic_pipeline::prle>(buffer, elements_to_unpack);
+
+        if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        scan_impl(buffer.data(), elements_to_process, param_low, param_high);
+
+        aggregates_callback(buffer.data(), elements_to_process, &aggregates.min_value_, &aggregates.max_value_,
+                            &aggregates.sum_, &aggregates.index_);
+
+        auto status = output_stream.perform_pack(buffer.data(), elements_to_process);
+
+        if (status_list::ok != status) { return status; }
+    }
+
+    return status_list::ok;
+}
+
 template <analytic_pipeline pipeline_t, comparator_t comparator>
 static inline auto scan(input_stream_t& input_stream, limited_buffer_t& buffer,
                         output_stream_t<output_stream_type_t::bit_stream>& output_stream,
@@ -99,9 +235,90 @@ static inline auto scan(input_stream_t& input_stream, limited_buffer_t& buffer,
     return status_list::ok;
 }
 
+/**
+ * @brief Scan of 33..64-bit elements, which are unpacked to 64u and compared with 64-bit parameters
+ */
+template <analytic_pipeline pipeline_t, comparator_t comparator>
+static inline auto scan_wide(input_stream_t& input_stream, limited_buffer_t& buffer,
+                             output_stream_t<output_stream_type_t::bit_stream>& output_stream,
+                             core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                             aggregates_t& aggregates, uint64_t param_low, uint64_t param_high) noexcept -> uint32_t {
+    auto table     = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_64u_i_table();
+    auto scan_impl = table[static_cast<uint32_t>(comparator)];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    while (!input_stream.is_processed()) {
+        auto unpack_result = input_stream.unpack<pipeline_t>(buffer);
+
+        if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        scan_impl(buffer.data(), elements_to_process, param_low, param_high);
+
+        aggregates_callback(buffer.data(), elements_to_process, &aggregates.min_value_, &aggregates.max_value_,
+                            &aggregates.sum_, &aggregates.index_);
+
+        auto status = output_stream.perform_pack(buffer.data(), elements_to_process);
+
+        if (status_list::ok != status) { return status; }
+    }
+
+    return status_list::ok;
+}
+
+/**
+ * @brief Single pass scan of packed uncompressed input with plain bit-vector output
+ *
+ * The dispatched kernel compares elements straight from the packed source, writes the bit-vector
+ * and accumulates aggregates, so no staging buffer is involved.
+ */
+template <comparator_t comparator>
+static inline auto scan_bits(input_stream_t& input_stream, limited_buffer_t& buffer,
+                             output_stream_t<bit_stream>& output_stream, aggregates_t& aggregates, uint32_t param_low,
+                             uint32_t param_high) noexcept -> uint32_t {
+    constexpr uint8_t inversion_flag = (comparator == not_equals || comparator == out_of_range) ? 1U : 0U;
+
+    const bool is_input_be = (input_stream.stream_format() == stream_format_t::be_format);
+    const auto bit_width   = input_stream.bit_width();
+    const auto range       = own_get_scan_range<comparator>(param_low, param_high, bit_width);
+
+    auto table       = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_bits_table();
+    auto index       = core_sw::dispatcher::get_scan_bits_index(is_input_be, bit_width);
+    auto scan_kernel = table[index];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    const uint32_t elements_to_process = input_stream.elements_left();
+
+    uint8_t* destination_ptr = output_stream.reserve_bits(elements_to_process);
+
+    if (nullptr == destination_ptr) { return status_list::destination_is_short_error; }
+
+    uint32_t min_value = std::numeric_limits<uint32_t>::max();
+    uint32_t max_value = 0U;
+    uint32_t sum       = 0U;
+    uint32_t bit_index = 0U;
+
+    scan_kernel(input_stream.current_ptr(), elements_to_process, range.low, range.high, inversion_flag,
+                destination_ptr, &min_value, &max_value, &sum, &bit_index);
+
+    if (!input_stream.are_aggregates_disabled()) { aggregates = {min_value, max_value, sum, bit_index}; }
+
+    const size_t source_bits = static_cast<size_t>(elements_to_process) * bit_width;
+
+    input_stream.shift_current_ptr(static_cast<uint32_t>(util::bit_to_byte(source_bits)));
+    input_stream.add_elements_processed(elements_to_process);
+
+    return status_list::ok;
+}
+
 template <comparator_t comparator>
 static inline auto call_scan_sw(input_stream_t& input_stream, output_stream_t<bit_stream>& output_stream,
-                                const uint32_t param_low, const uint32_t param_high,
+                                const uint64_t param_low, const uint64_t param_high,
                                 limited_buffer_t& temporary_buffer) noexcept -> analytic_operation_result_t {
     auto input_bit_width    = input_stream.bit_width();
     auto output_bit_width   = output_stream.bit_width();
@@ -112,16 +329,35 @@ static inline auto call_scan_sw(input_stream_t& input_stream, output_stream_t<bi
 
     uint32_t status_code = status_list::ok;
 
-    auto corrected_param_low  = correct_input_param(input_bit_width, param_low);
-    auto corrected_param_high = correct_input_param(input_bit_width, param_high);
+    auto corrected_param_low  = correct_input_param(input_bit_width, static_cast<uint32_t>(param_low));
+    auto corrected_param_high = correct_input_param(input_bit_width, static_cast<uint32_t>(param_high));
 
     auto aggregates_table = core_sw::dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
     auto aggregates_index = core_sw::dispatcher::get_aggregates_index(1U);
     auto aggregates_callback =
             (input_stream.are_aggregates_disabled()) ? &aggregates_empty_callback : aggregates_table[aggregates_index];
 
-    if ((input_bit_width == 8 || input_bit_width == 16 || input_bit_width == 32) &&
-        input_stream.stream_format() == stream_format_t::le_format && !input_stream.is_compressed()) {
+    if (input_bit_width > int_bits_size) {
+        const uint64_t wide_param_low  = correct_wide_input_param(input_bit_width, param_low);
+        const uint64_t wide_param_high = correct_wide_input_param(input_bit_width, param_high);
+
+        if (input_stream.is_compressed()) {
+            status_code = scan_wide<analytic_pipeline::inflate, comparator>(input_stream, temporary_buffer,
+                                                                            output_stream, aggregates_callback,
+                                                                            aggregates, wide_param_low,
+                                                                            wide_param_high);
+        } else {
+            status_code = scan_wide<analytic_pipeline::simple, comparator>(input_stream, temporary_buffer,
+                                                                           output_stream, aggregates_callback,
+                                                                           aggregates, wide_param_low,
+                                                                           wide_param_high);
+        }
+    } else if (input_stream.stream_format() != stream_format_t::prle_format && !input_stream.is_compressed() &&
+               output_stream.is_plain_bit_vector()) {
+        status_code = scan_bits<comparator>(input_stream, temporary_buffer, output_stream, aggregates,
+                                            static_cast<uint32_t>(param_low), static_cast<uint32_t>(param_high));
+    } else if ((input_bit_width == 8 || input_bit_width == 16 || input_bit_width == 32) &&
+               input_stream.stream_format() == stream_format_t::le_format && !input_stream.is_compressed()) {
 
         auto scan_table  = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_table();
         auto scan_index  = core_sw::dispatcher::get_scan_index(input_bit_width, (uint32_t)comparator);
@@ -137,9 +373,9 @@ static inline auto call_scan_sw(input_stream_t& input_stream, output_stream_t<bi
                         input_stream, temporary_buffer, output_stream, aggregates_callback, aggregates,
                         corrected_param_low, corrected_param_high);
             } else {
-                status_code = scan<analytic_pipeline::prle, comparator>(input_stream, temporary_buffer, output_stream,
-                                                                        aggregates_callback, aggregates,
-                                                                        corrected_param_low, corrected_param_high);
+                status_code = scan_prle_runs<comparator>(input_stream, temporary_buffer, output_stream,
+                                                         aggregates_callback, aggregates, corrected_param_low,
+                                                         corrected_param_high);
             }
         } else {
             if (input_stream.is_compressed()) {
@@ -166,57 +402,6 @@ static inline auto call_scan_sw(input_stream_t& input_stream, output_stream_t<bi
     return operation_result;
 }
 
-template <comparator_t comparator>
-constexpr static inline auto own_get_scan_range(const uint32_t low_limit, const uint32_t high_limit,
-                                                const uint32_t element_bit_width) noexcept -> scan_range_t {
-    scan_range_t   range {};
-    const auto     range_mask = (uint32_t)((1ULL << element_bit_width) - 1U);
-    const uint32_t param_low  = low_limit & range_mask;
-
-    if constexpr (comparator == equals || comparator == not_equals) {
-        range.low  = param_low;
-        range.high = param_low;
-    }
-
-    if constexpr (comparator == less_equals) {
-        range.low  = 0U;
-        range.high = param_low;
-    }
-
-    if constexpr (comparator == less_than) {
-        if (0U == param_low) {
-            range.low  = 1U;
-            range.high = 0U;
-        } else {
-            range.low  = 0U;
-            range.high = param_low - 1U;
-        }
-    }
-
-    if constexpr (comparator == greater_equals) {
-        range.low  = param_low;
-        range.high = std::numeric_limits<uint32_t>::max();
-    }
-
-    if constexpr (comparator == greater_than) {
-        if (param_low == range_mask) {
-            range.low  = 1U;
-            range.high = 0U;
-        } else {
-            range.low  = param_low + 1U;
-            range.high = std::numeric_limits<uint32_t>::max();
-        }
-    }
-
-    if constexpr (comparator == in_range || comparator == out_of_range) {
-        const uint32_t param_high = high_limit & range_mask;
-        range.low                 = param_low;
-        range.high                = param_high;
-    }
-
-    return range;
-}
-
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstack-usage=4096"
@@ -278,18 +463,24 @@ auto call_scan_multidescriptor(input_stream_t& input_stream, output_stream_t<bit
 }
 
 template <comparator_t comparator, execution_path_t path>
-auto call_scan(input_stream_t& input_stream, output_stream_t<bit_stream>& output_stream, const uint32_t param_low,
-               const uint32_t param_high, limited_buffer_t& temporary_buffer,
+auto call_scan(input_stream_t& input_stream, output_stream_t<bit_stream>& output_stream, const uint64_t param_low,
+               const uint64_t param_high, limited_buffer_t& temporary_buffer,
                int32_t UNREFERENCED_PARAMETER(numa_id) = -1) noexcept -> analytic_operation_result_t {
+    // The accelerator compares elements of up to 32 bits
+    [[maybe_unused]] const auto hw_param_low  = static_cast<uint32_t>(param_low);
+    [[maybe_unused]] const auto hw_param_high = static_cast<uint32_t>(param_high);
+
     if constexpr (path == execution_path_t::auto_detect) {
         analytic_operation_result_t hw_result {};
 
-        if (is_operation_splittable(input_stream, output_stream)) {
-            hw_result = call_scan_multidescriptor<comparator>(input_stream, output_stream, param_low, param_high,
+        if (limits::max_bit_width < input_stream.bit_width()) {
+            hw_result.status_code_ = status_list::not_supported_err;
+        } else if (is_operation_splittable(input_stream, output_stream)) {
+            hw_result = call_scan_multidescriptor<comparator>(input_stream, output_stream, hw_param_low, hw_param_high,
                                                               temporary_buffer, numa_id);
         } else {
-            hw_result = call_scan_hw<comparator>(input_stream, output_stream, param_low, param_high, temporary_buffer,
-                                                 numa_id);
+            hw_result = call_scan_hw<comparator>(input_stream, output_stream, hw_param_low, hw_param_high,
+                                                 temporary_buffer, numa_id);
         }
 
         if (hw_result.status_code_ != status_list::ok) {
@@ -298,12 +489,19 @@ auto call_scan(input_stream_t& input_stream, output_stream_t<bit_stream>& output
 
         return hw_result;
     } else if constexpr (path == execution_path_t::hardware) {
+        if (limits::max_bit_width < input_stream.bit_width()) {
+            analytic_operation_result_t operation_result {};
+            operation_result.status_code_ = status_list::not_supported_err;
+
+            return operation_result;
+        }
+
         if (is_operation_splittable(input_stream, output_stream)) {
-            return call_scan_multidescriptor<comparator>(input_stream, output_stream, param_low, param_high,
+            return call_scan_multidescriptor<comparator>(input_stream, output_stream, hw_param_low, hw_param_high,
                                                          temporary_buffer, numa_id);
         } else {
-            return call_scan_hw<comparator>(input_stream, output_stream, param_low, param_high, temporary_buffer,
-                                            numa_id);
+            return call_scan_hw<comparator>(input_stream, output_stream, hw_param_low, hw_param_high,
+                                            temporary_buffer, numa_id);
         }
     } else {
         return call_scan_sw<comparator>(input_stream, output_stream, param_low, param_high, temporary_buffer);
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "scan_in_set.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+// core-sw
+#include "dispatcher.hpp"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Minimal bitmap size, 8u kernel looks up all 256 values of a byte
+ */
+constexpr uint32_t scan_in_set_min_bitmap_size = 32U;
+
+/**
+ * @brief Set in the form taken by the scan in set kernel of the source bit width
+ */
+struct scan_set_lookup_t {
+    const uint8_t* data_ptr = nullptr; /**< Bitmap or the sorted values */
+    uint32_t       size     = 0U;      /**< Number of the sorted values, not used for the bitmap */
+    bool           is_bitmap = false;  /**< Set is looked up as a bitmap */
+
+    [[nodiscard]] auto contains(uint32_t value) const noexcept -> bool {
+        if (is_bitmap) { return (data_ptr[value >> 3U] >> (value & 7U)) & 1U; }
+
+        const auto* values_ptr = reinterpret_cast<const uint32_t*>(data_ptr);
+
+        return std::binary_search(values_ptr, values_ptr + size, value);
+    }
+};
+
+static inline auto prepare_set(const scan_set_t& set, uint32_t bit_width, limited_buffer_t& set_buffer,
+                               scan_set_lookup_t& lookup) noexcept -> uint32_t {
+    const uint32_t bitmap_bit_size = (bit_width <= scan_in_set_max_bitmap_bit_width) ? (1U << bit_width) : 0U;
+    const uint32_t bitmap_size     = util::bit_to_byte(bitmap_bit_size);
+    const uint32_t buffer_size     = std::max(bitmap_size, scan_in_set_min_bitmap_size);
+
+    if (1U == set.bit_width) {
+        if (bit_width > scan_in_set_max_bitmap_bit_width) { return status_list::bit_width_error; }
+        if (set.byte_size < bitmap_size) { return status_list::source_2_is_short_error; }
+
+        lookup.is_bitmap = true;
+        lookup.data_ptr  = set.data_ptr;
+
+        // Short bitmaps are padded to the size looked up by the kernel
+        if (bitmap_size < scan_in_set_min_bitmap_size) {
+            std::memset(set_buffer.data(), 0, scan_in_set_min_bitmap_size);
+            std::memcpy(set_buffer.data(), set.data_ptr, bitmap_size);
+
+            lookup.data_ptr = set_buffer.data();
+        }
+
+        return status_list::ok;
+    }
+
+    const auto*    values_ptr   = reinterpret_cast<const uint32_t*>(set.data_ptr);
+    const uint32_t values_count = set.byte_size / sizeof(uint32_t);
+
+    if (!std::is_sorted(values_ptr, values_ptr + values_count)) { return status_list::status_invalid_params; }
+
+    if (bit_width > scan_in_set_max_bitmap_bit_width) {
+        lookup.data_ptr = set.data_ptr;
+        lookup.size     = values_count;
+
+        return status_list::ok;
+    }
+
+    // Values of narrow elements are converted to the bitmap, the values that don't fit the bit width are skipped
+    uint8_t* bitmap_ptr = set_buffer.data();
+    std::memset(bitmap_ptr, 0, buffer_size);
+
+    for (uint32_t i = 0U; i < values_count && values_ptr[i] < bitmap_bit_size; ++i) {
+        bitmap_ptr[values_ptr[i] >> 3U] |= static_cast<uint8_t>(1U << (values_ptr[i] & 7U));
+    }
+
+    lookup.is_bitmap = true;
+    lookup.data_ptr  = bitmap_ptr;
+
+    return status_list::ok;
+}
+
+/**
+ * @brief Scan in set of uncompressed PRLE input that looks the value of a long RLE run up once
+ */
+static inline auto scan_in_set_prle_runs(input_stream_t& input_stream, limited_buffer_t& buffer,
+                                         output_stream_t<bit_stream>& output_stream, const scan_set_lookup_t& set,
+                                         core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                         aggregates_t& aggregates) noexcept -> uint32_t {
+    auto table     = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_in_set_i_table();
+    auto index     = core_sw::dispatcher::get_scan_in_set_index(input_stream.bit_width());
+    auto scan_impl = table[index];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    while (!input_stream.is_processed()) {
+        const auto run = input_stream.take_prle_run(prle_min_run_length);
+
+        if (0U != run.length) {
+            const bool is_match = set.contains(run.value);
+
+            if (is_match && !input_stream.are_aggregates_disabled()) {
+                if (std::numeric_limits<uint32_t>::max() == aggregates.min_value_) {
+                    aggregates.min_value_ = aggregates.index_;
+                }
+
+                aggregates.max_value_ = aggregates.index_ + run.length - 1U;
+                aggregates.sum_ += run.length;
+            }
+
+            aggregates.index_ += run.length;
+
+            auto status = output_stream.perform_fill(is_match, run.length);
+
+            if (status_list::ok != status) { return status; }
+
+            continue;
+        }
+
+        const uint32_t elements_to_unpack =
+                input_stream.prle_elements_before_run(prle_min_run_length, buffer.max_elements_count());
+
+        auto unpack_result = input_stream.unpack<analytic_pipeline::prle>(buffer, elements_to_unpack);
+
+        if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        scan_impl(buffer.data(), elements_to_process, set.data_ptr, set.size);
+
+        aggregates_callback(buffer.data(), elements_to_process, &aggregates.min_value_, &aggregates.max_value_,
+                            &aggregates.sum_, &aggregates.index_);
+
+        auto status = output_stream.perform_pack(buffer.data(), elements_to_process);
+
+        if (status_list::ok != status) { return status; }
+    }
+
+    return status_list::ok;
+}
+
+template <analytic_pipeline pipeline_t>
+static inline auto scan_in_set(input_stream_t& input_stream, limited_buffer_t& buffer,
+                               output_stream_t<bit_stream>& output_stream, const scan_set_lookup_t& set,
+                               core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                               aggregates_t&                                  aggregates) noexcept -> uint32_t {
+    auto table     = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_in_set_i_table();
+    auto index     = core_sw::dispatcher::get_scan_in_set_index(input_stream.bit_width());
+    auto scan_impl = table[index];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    while (!input_stream.is_processed()) {
+        auto unpack_result = input_stream.unpack<pipeline_t>(buffer);
+
+        if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        scan_impl(buffer.data(), elements_to_process, set.data_ptr, set.size);
+
+        aggregates_callback(buffer.data(), elements_to_process, &aggregates.min_value_, &aggregates.max_value_,
+                            &aggregates.sum_, &aggregates.index_);
+
+        auto status = output_stream.perform_pack(buffer.data(), elements_to_process);
+
+        if (status_list::ok != status) { return status; }
+    }
+
+    return status_list::ok;
+}
+
+template <>
+auto call_scan_in_set<execution_path_t::software>(input_stream_t& input_stream, output_stream_t<bit_stream>& output_stream,
+                                                  const scan_set_t& set, limited_buffer_t& unpack_buffer,
+                                                  limited_buffer_t& set_buffer,
+                                                  int32_t           UNREFERENCED_PARAMETER(numa_id)) noexcept
+        -> analytic_operation_result_t {
+    const uint32_t number_of_elements = input_stream.elements_left();
+
+    analytic_operation_result_t operation_result {};
+    aggregates_t                aggregates {};
+    scan_set_lookup_t           lookup {};
+
+    auto aggregates_table = core_sw::dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
+    auto aggregates_index = core_sw::dispatcher::get_aggregates_index(1U);
+    auto aggregates_callback =
+            (input_stream.are_aggregates_disabled()) ? &aggregates_empty_callback : aggregates_table[aggregates_index];
+
+    uint32_t status_code = prepare_set(set, input_stream.bit_width(), set_buffer, lookup);
+
+    if (status_list::ok == status_code) {
+        if (input_stream.stream_format() == stream_format_t::prle_format) {
+            if (input_stream.is_compressed()) {
+                status_code = scan_in_set<analytic_pipeline::inflate_prle>(input_stream, unpack_buffer, output_stream,
+                                                                           lookup, aggregates_callback, aggregates);
+            } else {
+                status_code = scan_in_set_prle_runs(input_stream, unpack_buffer, output_stream, lookup,
+                                                    aggregates_callback, aggregates);
+            }
+        } else {
+            if (input_stream.is_compressed()) {
+                status_code = scan_in_set<analytic_pipeline::inflate>(input_stream, unpack_buffer, output_stream,
+                                                                      lookup, aggregates_callback, aggregates);
+            } else {
+                status_code = scan_in_set<analytic_pipeline::simple>(input_stream, unpack_buffer, output_stream,
+                                                                     lookup, aggregates_callback, aggregates);
+            }
+        }
+    }
+
+    input_stream.calculate_checksums();
+
+    operation_result.status_code_      = status_code;
+    operation_result.aggregates_       = aggregates;
+    operation_result.checksums_.crc32_ = input_stream.crc_checksum();
+    operation_result.checksums_.xor_   = input_stream.xor_checksum();
+    operation_result.last_bit_offset_  = (1U == output_stream.bit_width()) ? number_of_elements & max_bit_index : 0U;
+    operation_result.output_bytes_     = output_stream.bytes_written();
+
+    return operation_result;
+}
+
+template <>
+auto call_scan_in_set<execution_path_t::hardware>(input_stream_t& UNREFERENCED_PARAMETER(input_stream),
+                                                  output_stream_t<bit_stream>& UNREFERENCED_PARAMETER(output_stream),
+                                                  const scan_set_t&            UNREFERENCED_PARAMETER(set),
+                                                  limited_buffer_t&            UNREFERENCED_PARAMETER(unpack_buffer),
+                                                  limited_buffer_t&            UNREFERENCED_PARAMETER(set_buffer),
+                                                  int32_t UNREFERENCED_PARAMETER(numa_id)) noexcept
+        -> analytic_operation_result_t {
+    analytic_operation_result_t operation_result {};
+
+    operation_result.status_code_ = status_list::not_supported_err;
+
+    return operation_result;
+}
+
+template <>
+auto call_scan_in_set<execution_path_t::auto_detect>(input_stream_t&              input_stream,
+                                                     output_stream_t<bit_stream>& output_stream, const scan_set_t& set,
+                                                     limited_buffer_t& unpack_buffer, limited_buffer_t& set_buffer,
+                                                     int32_t numa_id) noexcept -> analytic_operation_result_t {
+    return call_scan_in_set<execution_path_t::software>(input_stream, output_stream, set, unpack_buffer, set_buffer,
+                                                        numa_id);
+}
+
+} // namespace qpl::ml::analytics
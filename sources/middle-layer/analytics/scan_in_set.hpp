@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_IN_SET_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_IN_SET_HPP_
+
+#include "input_stream.hpp"
+#include "output_stream.hpp"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Maximal source bit width the set is looked up as a bitmap for
+ */
+constexpr uint32_t scan_in_set_max_bitmap_bit_width = 16U;
+
+/**
+ * @brief Accepted values of the scan in set operation
+ */
+struct scan_set_t {
+    const uint8_t* data_ptr  = nullptr; /**< Bitmap of the accepted values or the accepted values in 32u format */
+    uint32_t       byte_size = 0U;      /**< Size of the set data in bytes */
+    uint32_t       bit_width = 0U;      /**< 1 for the bitmap, 32 for the values sorted in ascending order */
+};
+
+/**
+ * @brief Marks the elements of the input stream that are in the set with '1' in the bit-vector output.
+ *
+ * The set is looked up as a bitmap for bit widths up to @ref scan_in_set_max_bitmap_bit_width, sorted values are
+ * converted to the bitmap in the set buffer. Wider elements are searched in the sorted values.
+ * The accelerator has no set scan, so the hardware path returns status_list::not_supported_err.
+ */
+template <execution_path_t path>
+auto call_scan_in_set(input_stream_t& input_stream, output_stream_t<bit_stream>& output_stream, const scan_set_t& set,
+                      limited_buffer_t& unpack_buffer, limited_buffer_t& set_buffer, int32_t numa_id = -1) noexcept
+        -> analytic_operation_result_t;
+
+} // namespace qpl::ml::analytics
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_IN_SET_HPP_
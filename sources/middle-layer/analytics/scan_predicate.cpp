@@ -0,0 +1,359 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "scan_predicate.hpp"
+
+#include <algorithm>
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Predicate program with the scan kernels resolved for the source bit width
+ */
+struct predicate_evaluator_t {
+    predicate_program_t                    program {};
+    core_sw::dispatcher::scan_function_ptr kernels[max_predicate_length] {};
+    uint8_t*                               results_ptr = nullptr; /**< Intermediate results of the chunk */
+    uint32_t                               result_size = 0U;      /**< Size of a single intermediate result */
+};
+
+static inline auto is_comparator_match(comparator_t comparator, uint32_t value, uint32_t param_low,
+                                       uint32_t param_high) noexcept -> bool {
+    switch (comparator) {
+        case equals: return is_scan_match<equals>(value, param_low, param_high);
+        case not_equals: return is_scan_match<not_equals>(value, param_low, param_high);
+        case less_than: return is_scan_match<less_than>(value, param_low, param_high);
+        case less_equals: return is_scan_match<less_equals>(value, param_low, param_high);
+        case greater_than: return is_scan_match<greater_than>(value, param_low, param_high);
+        case greater_equals: return is_scan_match<greater_equals>(value, param_low, param_high);
+        case in_range: return is_scan_match<in_range>(value, param_low, param_high);
+        case out_of_range: return is_scan_match<out_of_range>(value, param_low, param_high);
+    }
+
+    return false;
+}
+
+/**
+ * @brief Evaluates the program for a single value, used for the values of PRLE runs
+ */
+static inline auto is_predicate_match(const predicate_program_t& program, uint32_t value) noexcept -> bool {
+    bool     results[max_predicate_length] {};
+    uint32_t top = 0U;
+
+    for (uint32_t i = 0U; i < program.length; i++) {
+        const auto& instruction = program.instructions[i];
+
+        switch (instruction.opcode) {
+            case predicate_opcode_t::compare: {
+                results[top++] = is_comparator_match(instruction.comparator, value, instruction.param_low,
+                                                     instruction.param_high);
+                break;
+            }
+            case predicate_opcode_t::logical_and: {
+                top--;
+                results[top - 1U] = results[top - 1U] && results[top];
+                break;
+            }
+            case predicate_opcode_t::logical_or: {
+                top--;
+                results[top - 1U] = results[top - 1U] || results[top];
+                break;
+            }
+            case predicate_opcode_t::logical_not: {
+                results[top - 1U] = !results[top - 1U];
+                break;
+            }
+        }
+    }
+
+    return results[0];
+}
+
+/**
+ * @brief Evaluates the program for a chunk of elements, the bytes of the result are 0 or 1
+ *
+ * @return pointer to the result of the chunk
+ */
+static inline auto evaluate_predicate(const predicate_evaluator_t& evaluator, const uint8_t* elements_ptr,
+                                      uint32_t elements_count) noexcept -> uint8_t* {
+    const auto& program = evaluator.program;
+    uint32_t    top     = 0U;
+
+    for (uint32_t i = 0U; i < program.length; i++) {
+        const auto& instruction = program.instructions[i];
+
+        uint8_t* const top_ptr = evaluator.results_ptr + top * evaluator.result_size;
+
+        switch (instruction.opcode) {
+            case predicate_opcode_t::compare: {
+                evaluator.kernels[i](elements_ptr, top_ptr, elements_count, instruction.param_low,
+                                     instruction.param_high);
+                top++;
+                break;
+            }
+            case predicate_opcode_t::logical_and: {
+                uint8_t* const left_ptr  = top_ptr - 2U * evaluator.result_size;
+                uint8_t* const right_ptr = top_ptr - evaluator.result_size;
+
+                for (uint32_t j = 0U; j < elements_count; j++) {
+                    left_ptr[j] &= right_ptr[j];
+                }
+
+                top--;
+                break;
+            }
+            case predicate_opcode_t::logical_or: {
+                uint8_t* const left_ptr  = top_ptr - 2U * evaluator.result_size;
+                uint8_t* const right_ptr = top_ptr - evaluator.result_size;
+
+                for (uint32_t j = 0U; j < elements_count; j++) {
+                    left_ptr[j] |= right_ptr[j];
+                }
+
+                top--;
+                break;
+            }
+            case predicate_opcode_t::logical_not: {
+                uint8_t* const operand_ptr = top_ptr - evaluator.result_size;
+
+                for (uint32_t j = 0U; j < elements_count; j++) {
+                    operand_ptr[j] ^= 1U;
+                }
+
+                break;
+            }
+        }
+    }
+
+    return evaluator.results_ptr;
+}
+
+/**
+ * @brief Scan of packed uncompressed 8u, 16u or 32u input, the kernels compare elements right in the source
+ */
+static inline auto scan_predicate_direct(input_stream_t& input_stream, limited_buffer_t& buffer,
+                                         output_stream_t<bit_stream>& output_stream,
+                                         const predicate_evaluator_t& evaluator,
+                                         core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                         aggregates_t& aggregates) noexcept -> uint32_t {
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    while (!input_stream.is_processed()) {
+        const uint32_t elements_to_process = std::min(buffer.max_elements_count(), input_stream.elements_left());
+
+        uint8_t* result_ptr = evaluate_predicate(evaluator, input_stream.current_ptr(), elements_to_process);
+
+        aggregates_callback(result_ptr, elements_to_process, &aggregates.min_value_, &aggregates.max_value_,
+                            &aggregates.sum_, &aggregates.index_);
+
+        auto status = output_stream.perform_pack(result_ptr, elements_to_process);
+
+        if (status_list::ok != status) { return status; }
+
+        const uint32_t length_in_bytes = util::bit_to_byte(elements_to_process * input_stream.bit_width());
+
+        input_stream.shift_current_ptr(length_in_bytes);
+        input_stream.add_elements_processed(elements_to_process);
+    }
+
+    return status_list::ok;
+}
+
+/**
+ * @brief Scan of uncompressed PRLE input that evaluates the program once per RLE run
+ */
+static inline auto scan_predicate_prle_runs(input_stream_t& input_stream, limited_buffer_t& buffer,
+                                            output_stream_t<bit_stream>& output_stream,
+                                            const predicate_evaluator_t& evaluator,
+                                            core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                            aggregates_t& aggregates) noexcept -> uint32_t {
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    while (!input_stream.is_processed()) {
+        const auto run = input_stream.take_prle_run(prle_min_run_length);
+
+        if (0U != run.length) {
+            const bool is_match = is_predicate_match(evaluator.program, run.value);
+
+            if (is_match && !input_stream.are_aggregates_disabled()) {
+                if (std::numeric_limits<uint32_t>::max() == aggregates.min_value_) {
+                    aggregates.min_value_ = aggregates.index_;
+                }
+
+                aggregates.max_value_ = aggregates.index_ + run.length - 1U;
+                aggregates.sum_ += run.length;
+            }
+
+            aggregates.index_ += run.length;
+
+            auto status = output_stream.perform_fill(is_match, run.length);
+
+            if (status_list::ok != status) { return status; }
+
+            continue;
+        }
+
+        const uint32_t elements_to_unpack =
+                input_stream.prle_elements_before_run(prle_min_run_length, buffer.max_elements_count());
+
+        auto unpack_result = input_stream.unpack<analytic_pipeline::prle>(buffer, elements_to_unpack);
+
+        if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        uint8_t* result_ptr = evaluate_predicate(evaluator, buffer.data(), elements_to_process);
+
+        aggregates_callback(result_ptr, elements_to_process, &aggregates.min_value_, &aggregates.max_value_,
+                            &aggregates.sum_, &aggregates.index_);
+
+        auto status = output_stream.perform_pack(result_ptr, elements_to_process);
+
+        if (status_list::ok != status) { return status; }
+    }
+
+    return status_list::ok;
+}
+
+template <analytic_pipeline pipeline_t>
+static inline auto scan_predicate(input_stream_t& input_stream, limited_buffer_t& buffer,
+                                  output_stream_t<bit_stream>& output_stream, const predicate_evaluator_t& evaluator,
+                                  core_sw::dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                  aggregates_t&                                  aggregates) noexcept -> uint32_t {
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) { return drop_initial_bytes_status; }
+
+    while (!input_stream.is_processed()) {
+        auto unpack_result = input_stream.unpack<pipeline_t>(buffer);
+
+        if (status_list::ok != unpack_result.status) { return unpack_result.status; }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        uint8_t* result_ptr = evaluate_predicate(evaluator, buffer.data(), elements_to_process);
+
+        aggregates_callback(result_ptr, elements_to_process, &aggregates.min_value_, &aggregates.max_value_,
+                            &aggregates.sum_, &aggregates.index_);
+
+        auto status = output_stream.perform_pack(result_ptr, elements_to_process);
+
+        if (status_list::ok != status) { return status; }
+    }
+
+    return status_list::ok;
+}
+
+template <>
+auto call_scan_predicate<execution_path_t::software>(input_stream_t&              input_stream,
+                                                     output_stream_t<bit_stream>& output_stream,
+                                                     const predicate_program_t&   program,
+                                                     limited_buffer_t&            unpack_buffer,
+                                                     limited_buffer_t&            results_buffer,
+                                                     int32_t UNREFERENCED_PARAMETER(numa_id)) noexcept
+        -> analytic_operation_result_t {
+    const uint32_t input_bit_width    = input_stream.bit_width();
+    const uint32_t number_of_elements = input_stream.elements_left();
+
+    analytic_operation_result_t operation_result {};
+    aggregates_t                aggregates {};
+    predicate_evaluator_t       evaluator {};
+
+    auto scan_table = core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_table();
+
+    evaluator.program = program;
+
+    for (uint32_t i = 0U; i < program.length; i++) {
+        auto& instruction = evaluator.program.instructions[i];
+
+        if (predicate_opcode_t::compare != instruction.opcode) { continue; }
+
+        instruction.param_low  = correct_input_param(input_bit_width, instruction.param_low);
+        instruction.param_high = correct_input_param(input_bit_width, instruction.param_high);
+
+        evaluator.kernels[i] = scan_table[core_sw::dispatcher::get_scan_index(
+                input_bit_width, static_cast<uint32_t>(instruction.comparator))];
+    }
+
+    // Elements are processed by chunks, the results of all comparisons of a chunk are kept at once
+    const uint32_t element_size   = util::bit_to_byte(util::bit_width_to_bits(input_bit_width));
+    const uint32_t chunk_elements = std::min(unpack_buffer.max_elements_count(),
+                                             results_buffer.size() / std::max(program.depth, 1U)) &
+                                    ~(byte_bits_size - 1U);
+
+    evaluator.results_ptr = results_buffer.data();
+    evaluator.result_size = chunk_elements;
+
+    limited_buffer_t chunk_buffer(unpack_buffer.data(), unpack_buffer.data() + chunk_elements * element_size,
+                                  input_bit_width);
+
+    auto aggregates_table = core_sw::dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
+    auto aggregates_index = core_sw::dispatcher::get_aggregates_index(1U);
+    auto aggregates_callback =
+            (input_stream.are_aggregates_disabled()) ? &aggregates_empty_callback : aggregates_table[aggregates_index];
+
+    uint32_t status_code = status_list::ok;
+
+    if (input_stream.stream_format() == stream_format_t::prle_format) {
+        if (input_stream.is_compressed()) {
+            status_code = scan_predicate<analytic_pipeline::inflate_prle>(input_stream, chunk_buffer, output_stream,
+                                                                          evaluator, aggregates_callback, aggregates);
+        } else {
+            status_code = scan_predicate_prle_runs(input_stream, chunk_buffer, output_stream, evaluator,
+                                                   aggregates_callback, aggregates);
+        }
+    } else if (input_stream.is_compressed()) {
+        status_code = scan_predicate<analytic_pipeline::inflate>(input_stream, chunk_buffer, output_stream, evaluator,
+                                                                 aggregates_callback, aggregates);
+    } else if ((8U == input_bit_width || 16U == input_bit_width || 32U == input_bit_width) &&
+               input_stream.stream_format() == stream_format_t::le_format) {
+        status_code = scan_predicate_direct(input_stream, chunk_buffer, output_stream, evaluator, aggregates_callback,
+                                            aggregates);
+    } else {
+        status_code = scan_predicate<analytic_pipeline::simple>(input_stream, chunk_buffer, output_stream, evaluator,
+                                                                aggregates_callback, aggregates);
+    }
+
+    input_stream.calculate_checksums();
+
+    operation_result.status_code_      = status_code;
+    operation_result.aggregates_       = aggregates;
+    operation_result.checksums_.crc32_ = input_stream.crc_checksum();
+    operation_result.checksums_.xor_   = input_stream.xor_checksum();
+    operation_result.last_bit_offset_  = (1U == output_stream.bit_width()) ? number_of_elements & max_bit_index : 0U;
+    operation_result.output_bytes_     = output_stream.bytes_written();
+
+    return operation_result;
+}
+
+template <>
+auto call_scan_predicate<execution_path_t::hardware>(input_stream_t& UNREFERENCED_PARAMETER(input_stream),
+                                                     output_stream_t<bit_stream>& UNREFERENCED_PARAMETER(output_stream),
+                                                     const predicate_program_t&   UNREFERENCED_PARAMETER(program),
+                                                     limited_buffer_t&            UNREFERENCED_PARAMETER(unpack_buffer),
+                                                     limited_buffer_t& UNREFERENCED_PARAMETER(results_buffer),
+                                                     int32_t           UNREFERENCED_PARAMETER(numa_id)) noexcept
+        -> analytic_operation_result_t {
+    analytic_operation_result_t operation_result {};
+
+    operation_result.status_code_ = status_list::not_supported_err;
+
+    return operation_result;
+}
+
+template <>
+auto call_scan_predicate<execution_path_t::auto_detect>(input_stream_t&              input_stream,
+                                                        output_stream_t<bit_stream>& output_stream,
+                                                        const predicate_program_t&   program,
+                                                        limited_buffer_t&            unpack_buffer,
+                                                        limited_buffer_t& results_buffer, int32_t numa_id) noexcept
+        -> analytic_operation_result_t {
+    return call_scan_predicate<execution_path_t::software>(input_stream, output_stream, program, unpack_buffer,
+                                                           results_buffer, numa_id);
+}
+
+} // namespace qpl::ml::analytics
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_PREDICATE_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_PREDICATE_HPP_
+
+#include "input_stream.hpp"
+#include "output_stream.hpp"
+#include "scan.hpp"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Maximal number of instructions in the predicate program
+ */
+constexpr uint32_t max_predicate_length = 16U;
+
+enum class predicate_opcode_t : uint32_t { compare = 0U, logical_and = 1U, logical_or = 2U, logical_not = 3U };
+
+struct predicate_instruction_t {
+    predicate_opcode_t opcode     = predicate_opcode_t::compare;
+    comparator_t       comparator = equals;
+    uint32_t           param_low  = 0U;
+    uint32_t           param_high = 0U;
+};
+
+/**
+ * @brief Predicate in postfix notation, comparisons push their results and logical instructions take them
+ */
+struct predicate_program_t {
+    predicate_instruction_t instructions[max_predicate_length] {};
+
+    uint32_t length = 0U; /**< Number of the instructions */
+    uint32_t depth  = 0U; /**< Maximal number of the intermediate results kept during the evaluation */
+};
+
+/**
+ * @brief Evaluates the predicate program for every element of the input stream in a single pass and marks
+ * the matching elements with '1' in the bit-vector output.
+ *
+ * Every unpacked chunk is compared by the scan kernels into the intermediate results kept in the results buffer,
+ * the chunk size is limited so that the results of @ref predicate_program_t::depth comparisons fit the buffer.
+ * The accelerator can't evaluate programs, so the hardware path returns status_list::not_supported_err.
+ */
+template <execution_path_t path>
+auto call_scan_predicate(input_stream_t& input_stream, output_stream_t<bit_stream>& output_stream,
+                         const predicate_program_t& program, limited_buffer_t& unpack_buffer,
+                         limited_buffer_t& results_buffer, int32_t numa_id = -1) noexcept
+        -> analytic_operation_result_t;
+
+} // namespace qpl::ml::analytics
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_PREDICATE_HPP_
@@ -120,8 +120,9 @@ auto call_select<execution_path_t::software>(input_stream_t& input_stream, input
     operation_result.checksums_.xor_   = input_stream.xor_checksum();
     operation_result.output_bytes_     = output_stream.bytes_written();
 
+    // Number of valid bits in the last output byte, the same as the accelerator reports
     operation_result.last_bit_offset_ =
-            (1U == output_stream.bit_width()) ? input_stream.elements_left() & max_bit_index : 0U;
+            static_cast<uint8_t>((output_stream.elements_written() * output_stream.bit_width()) & max_bit_index);
 
     return operation_result;
 }
@@ -138,6 +139,14 @@ auto call_select<execution_path_t::hardware>(input_stream_t& input_stream, input
                                              limited_buffer_t&              UNREFERENCED_PARAMETER(set_buffer),
                                              limited_buffer_t&              UNREFERENCED_PARAMETER(output_buffer),
                                              int32_t numa_id) noexcept -> analytic_operation_result_t {
+    if (limits::max_bit_width < input_stream.bit_width()) {
+        // Elements wider than 32 bits are processed on the host only
+        analytic_operation_result_t operation_result {};
+        operation_result.status_code_ = status_list::not_supported_err;
+
+        return operation_result;
+    }
+
     hw_iaa_aecs_analytic HW_PATH_ALIGN_STRUCTURE                  aecs_analytic {};
     HW_PATH_VOLATILE hw_completion_record HW_PATH_ALIGN_STRUCTURE completion_record {};
     hw_descriptor HW_PATH_ALIGN_STRUCTURE                         descriptor {};
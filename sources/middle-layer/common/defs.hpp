@@ -50,6 +50,8 @@ constexpr qpl_ml_status output_overflow_error              = QPL_STS_OUTPUT_OVER
 constexpr qpl_ml_status buffers_overlap                    = QPL_STS_BUFFER_OVERLAP_ERR;
 constexpr qpl_ml_status compression_reference_before_start = QPL_STS_REF_BEFORE_START_ERR;
 constexpr qpl_ml_status output_format_error                = QPL_STS_OUT_FORMAT_ERR;
+constexpr qpl_ml_status bad_huffman_code_error             = QPL_STS_BAD_LL_CODE_ERR;
+constexpr qpl_ml_status memory_allocation_error            = QPL_STS_NO_MEM_ERR;
 
 } // namespace status_list
 
@@ -60,9 +62,9 @@ struct checksums_t {
 };
 
 struct aggregates_t {
-    uint32_t min_value_ = std::numeric_limits<uint32_t>::max();
-    uint32_t max_value_ = 0U;
-    uint32_t sum_       = 0U;
+    uint64_t min_value_ = std::numeric_limits<uint32_t>::max();
+    uint64_t max_value_ = 0U;
+    uint64_t sum_       = 0U;
     uint32_t index_     = 0U;
 };
 
@@ -72,17 +74,19 @@ constexpr uint32_t bit_bits_size                = 1U;
 constexpr uint32_t byte_bits_size               = 8U;
 constexpr uint32_t short_bits_size              = 16U;
 constexpr uint32_t int_bits_size                = 32U;
+constexpr uint32_t long_bits_size               = 64U;
 constexpr uint32_t bit_len_to_byte_shift_offset = 3U;
 constexpr uint32_t max_bit_index                = 7U;
 constexpr uint32_t qpl_1k                       = 1024U;
 constexpr uint32_t max_history_size             = 4U * qpl_1k;
 
 namespace limits {
-constexpr uint32_t max_bit_width    = int_bits_size;
-constexpr uint32_t min_bit_width    = bit_bits_size;
-constexpr uint32_t max_set_size     = 15U;
-constexpr uint32_t set_buf_bit_size = (1U << max_set_size);
-constexpr uint32_t set_buf_size     = set_buf_bit_size / byte_bits_size;
+constexpr uint32_t max_bit_width      = int_bits_size;
+constexpr uint32_t max_wide_bit_width = long_bits_size; /**< Unpacked to 64u, software path only */
+constexpr uint32_t min_bit_width      = bit_bits_size;
+constexpr uint32_t max_set_size       = 15U;
+constexpr uint32_t set_buf_bit_size   = (1U << max_set_size);
+constexpr uint32_t set_buf_size       = set_buf_bit_size / byte_bits_size;
 
 static_assert(set_buf_size == 4096U, "Intermediate buffer for size is too small");
 } // namespace limits
@@ -87,7 +87,8 @@ auto init_compression(stream_t& stream, compression_state_t& state) noexcept ->
 
         if constexpr (std::is_same_v<deflate_state<execution_path_t::software>, stream_t>) {
             if (stream.mini_blocks_support() == mini_blocks_support_t::disabled) {
-                stored_len = !stream.is_last_chunk() ? stored_len : stored_len + bit_buffer_slope_bytes * 2;
+                stored_len = !(stream.is_last_chunk() || stream.sync_flush_) ? stored_len
+                                                                             : stored_len + bit_buffer_slope_bytes * 2;
 
                 if (stream.isal_stream_ptr_->avail_out >= stored_len) {
                     stream.isal_stream_ptr_->avail_out = stored_len;
@@ -197,12 +198,26 @@ auto flush_bit_buffer(stream_t& stream, compression_state_t& state) noexcept ->
     uint64_t bits_to_write = 0xFFFF0000;
     uint32_t bits_length   = 0;
     int      flush_size    = 0;
+    bool     sync_flush    = false;
 
-    if (is_last_chunk(stream)) {
+    if constexpr (std::is_same_v<deflate_state<execution_path_t::software>, stream_t>) {
+        sync_flush = stream.sync_flush_;
+    }
+
+    if (is_last_chunk(stream) || sync_flush) {
         if (stream.isal_stream_ptr_->avail_out < bit_buffer_slope_bytes && bit_buffer->m_bit_count) {
             return status_list::more_output_needed;
         }
 
+        if constexpr (std::is_same_v<deflate_state<execution_path_t::software>, stream_t>) {
+            // Blocks with a prebuilt header are left open at the end of a chunk, close it before the stored block
+            if (sync_flush && stream.compression_mode() != dynamic_mode) {
+                auto status = write_end_of_block(stream, state);
+
+                if (status) { return status; }
+            }
+        }
+
         stream.reset_bit_buffer();
 
         flush_size =
@@ -283,7 +298,7 @@ auto finish_compression_process(deflate_state<execution_path_t::software>& strea
 
 void update_hash(deflate_state<execution_path_t::software>& stream, uint8_t* dictionary_ptr,
                  uint32_t dictionary_size) noexcept {
-    if (stream.compression_level() == high_level) {
+    if (stream.compression_level() >= high_level) {
         qplc_setup_dictionary()(dictionary_ptr, dictionary_size, stream.hash_table());
     } else {
         qpl_isal_deflate_hash(stream.isal_stream_ptr_, dictionary_ptr, dictionary_size);
@@ -319,6 +334,7 @@ auto deflate_body_with_dictionary(deflate_state<execution_path_t::software>& str
     uint32_t       avail_in       = stream.isal_stream_ptr_->avail_in;
     int32_t        buf_hist_start = 0;
     uint32_t       size           = 0;
+    const uint16_t flush          = stream.isal_stream_ptr_->flush;
 
     update_hash(stream, isal_state->buffer, isal_state->b_bytes_processed);
     uint32_t history_size = get_history_size(stream, start_in, buf_hist_start);
@@ -414,6 +430,7 @@ auto deflate_body_with_dictionary(deflate_state<execution_path_t::software>& str
             buffered_size -= processed;
 
             stream.isal_stream_ptr_->end_of_stream = stream.is_last_chunk();
+            stream.isal_stream_ptr_->flush         = flush;
             stream.isal_stream_ptr_->total_in += buffered_size;
 
             stream.isal_stream_ptr_->next_in  = next_in;
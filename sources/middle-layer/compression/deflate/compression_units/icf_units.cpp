@@ -24,6 +24,11 @@ static inline qplc_slow_deflate_icf_body_t_ptr qplc_slow_deflate_icf_body() {
                                                       .get_deflate_table()[0]);
 }
 
+static inline qplc_slow_deflate_icf_body_t_ptr qplc_optimal_deflate_icf_body() {
+    return (qplc_slow_deflate_icf_body_t_ptr)(qpl::core_sw::dispatcher::kernels_dispatcher::get_instance()
+                                                      .get_deflate_table()[3]);
+}
+
 namespace qpl::ml::compression {
 
 auto write_buffered_icf_header(deflate_state<execution_path_t::software>& stream, compression_state_t& state) noexcept
@@ -260,30 +265,42 @@ auto deflate_icf_body(deflate_state<execution_path_t::software>& stream, compres
     return status_list::ok;
 }
 
-auto slow_deflate_icf_body(deflate_state<execution_path_t::software>& stream, compression_state_t& state) noexcept
-        -> qpl_ml_status {
-    auto level_buffer = reinterpret_cast<level_buf*>(stream.isal_stream_ptr_->level_buf);
+static void own_deflate_icf_body(isal_zstream* isal_stream_ptr, deflate_hash_table_t* hash_table_ptr,
+                                 qplc_slow_deflate_icf_body_t_ptr deflate_body_ptr) noexcept {
+    auto level_buffer = reinterpret_cast<level_buf*>(isal_stream_ptr->level_buf);
 
     deflate_icf* icf_buffer_begin = level_buffer->icf_buf_next;
     deflate_icf* icf_buffer_end   = icf_buffer_begin + (level_buffer->icf_buf_avail_out / sizeof(deflate_icf));
 
     deflate_icf_stream icf_stream = {icf_buffer_begin, icf_buffer_begin, icf_buffer_end};
 
-    const uint32_t bytes_processed = qplc_slow_deflate_icf_body()(
-            stream.isal_stream_ptr_->next_in, stream.isal_stream_ptr_->next_in - stream.isal_stream_ptr_->total_in,
-            stream.isal_stream_ptr_->next_in + stream.isal_stream_ptr_->avail_in, &stream.hash_table_,
-            &level_buffer->hist, &icf_stream);
+    const uint32_t bytes_processed = deflate_body_ptr(
+            isal_stream_ptr->next_in, isal_stream_ptr->next_in - isal_stream_ptr->total_in,
+            isal_stream_ptr->next_in + isal_stream_ptr->avail_in, hash_table_ptr, &level_buffer->hist, &icf_stream);
 
-    stream.isal_stream_ptr_->internal_state.block_end =
-            stream.isal_stream_ptr_->internal_state.block_end + bytes_processed;
+    isal_stream_ptr->internal_state.block_end = isal_stream_ptr->internal_state.block_end + bytes_processed;
 
-    stream.isal_stream_ptr_->next_in += bytes_processed;
-    stream.isal_stream_ptr_->avail_in -= bytes_processed;
-    stream.isal_stream_ptr_->total_in += bytes_processed;
+    isal_stream_ptr->next_in += bytes_processed;
+    isal_stream_ptr->avail_in -= bytes_processed;
+    isal_stream_ptr->total_in += bytes_processed;
 
     level_buffer->icf_buf_next = icf_stream.next_ptr;
     level_buffer->icf_buf_avail_out -=
             static_cast<uint32_t>(icf_stream.next_ptr - icf_stream.begin_ptr) * sizeof(deflate_icf);
+}
+
+auto slow_deflate_icf_body(deflate_state<execution_path_t::software>& stream, compression_state_t& state) noexcept
+        -> qpl_ml_status {
+    own_deflate_icf_body(stream.isal_stream_ptr_, &stream.hash_table_, qplc_slow_deflate_icf_body());
+
+    state = compression_state_t::create_icf_header;
+
+    return status_list::ok;
+}
+
+auto optimal_deflate_icf_body(deflate_state<execution_path_t::software>& stream, compression_state_t& state) noexcept
+        -> qpl_ml_status {
+    own_deflate_icf_body(stream.isal_stream_ptr_, &stream.hash_table_, qplc_optimal_deflate_icf_body());
 
     state = compression_state_t::create_icf_header;
 
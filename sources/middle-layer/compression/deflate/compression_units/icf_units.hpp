@@ -34,6 +34,9 @@ auto deflate_icf_body(deflate_state<execution_path_t::software>& stream, compres
 auto slow_deflate_icf_body(deflate_state<execution_path_t::software>& stream, compression_state_t& state) noexcept
         -> qpl_ml_status;
 
+auto optimal_deflate_icf_body(deflate_state<execution_path_t::software>& stream, compression_state_t& state) noexcept
+        -> qpl_ml_status;
+
 } // namespace qpl::ml::compression
 
 #endif // QPL_MIDDLE_LAYER_COMPRESSION_COMPRESSION_UNITS_ICF_UNITS_HPP
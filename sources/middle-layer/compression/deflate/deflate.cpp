@@ -6,12 +6,19 @@
 
 #include "deflate.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <new>
+
+#include "common/allocation_buffer_t.hpp"
 #include "compression/deflate/compression_units/auxiliary_units.hpp"
 #include "compression/deflate/implementations/deflate_implementation.hpp"
+#include "compression/deflate/streams/deflate_state_builder.hpp"
 #include "compression/deflate/streams/hw_deflate_state.hpp"
 #include "compression/verification/verification_state_builder.hpp"
 #include "compression/verification/verify.hpp"
 #include "dispatcher/hw_dispatcher.hpp"
+#include "dispatcher/sw_executor.hpp"
 #include "util/descriptor_processing.hpp"
 #include "util/hw_status_converting.hpp"
 #include "util/iaa_features_checks.hpp"
@@ -47,6 +54,158 @@ auto deflate_pass(deflate_state<execution_path_t::software>& stream, uint8_t* be
     return result;
 }
 
+/**
+ * Parallel compression is not worth the task hand-off and the lost matches on smaller parts
+ */
+constexpr uint32_t parallel_deflate_min_chunk_size = 512_kb;
+
+struct parallel_deflate_context_t;
+
+/**
+ * Part of a single job compressed by a separate executor task with its own deflate state
+ */
+struct parallel_deflate_chunk_t {
+    parallel_deflate_context_t* context_ptr     = nullptr;
+    uint8_t*                    source_ptr      = nullptr;
+    uint32_t                    source_size     = 0U;
+    uint32_t                    history_size    = 0U;
+    bool                        is_last         = false;
+    std::unique_ptr<uint8_t[]>  state_buffer    = nullptr;
+    std::unique_ptr<uint8_t[]>  output_buffer   = nullptr;
+    uint32_t                    output_capacity = 0U;
+    uint32_t                    output_size     = 0U;
+    uint32_t                    crc32           = 0U;
+    qpl_ml_status               status          = status_list::ok;
+};
+
+/**
+ * Settings shared by all parts of a job
+ */
+struct parallel_deflate_context_t {
+    deflate_state<execution_path_t::software>* stream_ptr        = nullptr;
+    uint32_t                                   state_buffer_size = 0U;
+};
+
+/**
+ * @brief Splits the input into parts that are compressed concurrently and stitched into a single stream
+ *
+ * Parts are compressed by the tasks of the shared software executor, so the number of parts is limited
+ * by both the requested number of threads and the number of executor workers.
+ * Every part except the last one ends with a non-final empty stored block (sync flush), so the parts are
+ * byte-aligned and can be simply concatenated. CRC32 of the parts is combined without reading the data again.
+ * With default level dynamic compression every part except the first one is primed with the preceding
+ * history window of the input, other modes start every part from scratch.
+ * Parts that can't be queued are compressed by the calling thread, so the stream does not depend on the executor load.
+ *
+ * @note Falls back to @ref deflate_pass if the input is too small or any part can't be compressed
+ */
+auto deflate_pass_parallel(deflate_state<execution_path_t::software>& stream, uint8_t* begin, uint32_t size) noexcept
+        -> compression_operation_result_t {
+    auto& executor = dispatcher::sw_executor::get_instance();
+
+    const uint32_t chunk_count =
+            std::min({stream.parallel_threads_, executor.worker_count(), size / parallel_deflate_min_chunk_size});
+
+    if (chunk_count < 2U) { return deflate_pass(stream, begin, size); }
+
+    const uint32_t chunk_size = size / chunk_count;
+    const bool     is_history_primed =
+            stream.compression_level() == default_level && stream.compression_mode() == dynamic_mode;
+
+    parallel_deflate_context_t context;
+    context.stream_ptr        = &stream;
+    context.state_buffer_size = deflate_state<execution_path_t::software>::get_buffer_size() + 64U;
+
+    if (stream.compression_level() > high_level) {
+        context.state_buffer_size += deflate_state<execution_path_t::software>::get_high_ratio_buffer_size();
+    }
+
+    auto chunks = std::unique_ptr<parallel_deflate_chunk_t[]>(new (std::nothrow) parallel_deflate_chunk_t[chunk_count]);
+
+    if (!chunks) { return deflate_pass(stream, begin, size); }
+
+    for (uint32_t i = 0U; i < chunk_count; i++) {
+        auto& chunk = chunks[i];
+
+        chunk.context_ptr     = &context;
+        chunk.source_ptr      = begin + i * chunk_size;
+        chunk.source_size     = (i == chunk_count - 1U) ? size - i * chunk_size : chunk_size;
+        chunk.history_size    = (i != 0U && is_history_primed) ? (1U << isal_history_size_boundary) : 0U;
+        chunk.is_last         = (i == chunk_count - 1U);
+        chunk.output_capacity = chunk.source_size + chunk.source_size / 8U + 1_kb;
+        chunk.state_buffer    = std::unique_ptr<uint8_t[]>(new (std::nothrow) uint8_t[context.state_buffer_size]());
+        chunk.output_buffer   = std::unique_ptr<uint8_t[]>(new (std::nothrow) uint8_t[chunk.output_capacity]);
+
+        if (!chunk.state_buffer || !chunk.output_buffer) { return deflate_pass(stream, begin, size); }
+    }
+
+    void (*const compress_chunk)(parallel_deflate_chunk_t&) = [](parallel_deflate_chunk_t& chunk) noexcept {
+        auto& context = *chunk.context_ptr;
+        auto& source  = *context.stream_ptr;
+
+        allocation_buffer_t state_buffer(chunk.state_buffer.get(),
+                                         chunk.state_buffer.get() + context.state_buffer_size);
+        const util::linear_allocator allocator(state_buffer);
+
+        auto builder = deflate_state_builder<execution_path_t::software>::create(allocator);
+
+        builder.output(chunk.output_buffer.get(), chunk.output_capacity)
+                .compression_level(source.compression_level())
+                .terminate(chunk.is_last)
+                .sync_flush(!chunk.is_last);
+
+        if (source.compression_mode() == dynamic_mode) {
+            builder.collect_statistics_step(true);
+        } else if (source.compression_mode() == static_mode) {
+            builder.compression_table(source.compression_table_);
+        }
+
+        if (chunk.history_size) { builder.history(chunk.source_ptr - chunk.history_size, chunk.history_size); }
+
+        auto chunk_state = builder.build();
+
+        chunk.status = deflate_pass(chunk_state, chunk.source_ptr, chunk.source_size).status_code_;
+
+        if (!chunk.status && chunk_state.isal_stream_ptr_->internal_state.count) {
+            chunk.status = status_list::more_output_needed;
+        }
+
+        chunk.output_size = chunk_state.isal_stream_ptr_->total_out;
+        chunk.crc32       = chunk_state.checksum_.crc32;
+    };
+
+    executor.parallel_for(chunks.get(), chunk_count, compress_chunk);
+
+    uint32_t output_size = 0U;
+
+    for (uint32_t i = 0U; i < chunk_count; i++) {
+        if (chunks[i].status) { return deflate_pass(stream, begin, size); }
+
+        output_size += chunks[i].output_size;
+    }
+
+    if (output_size > stream.avail_out()) { return deflate_pass(stream, begin, size); }
+
+    stream.set_source(begin, size);
+
+    for (uint32_t i = 0U; i < chunk_count; i++) {
+        const auto& chunk = chunks[i];
+
+        stream.write_bytes(chunk.output_buffer.get(), chunk.output_size);
+        stream.checksum_.crc32 = util::crc32_gzip_combine(stream.checksum_.crc32, chunk.crc32, chunk.source_size);
+    }
+
+    stream.isal_stream_ptr_->next_in += size;
+    stream.isal_stream_ptr_->avail_in = 0U;
+    stream.isal_stream_ptr_->total_in += size;
+
+    compression_operation_result_t result;
+
+    result.status_code_ = status_list::ok;
+
+    return result;
+}
+
 template <>
 auto deflate<execution_path_t::hardware, deflate_mode_t::deflate_no_headers>(
         deflate_state<execution_path_t::hardware>& state, uint8_t* begin, const uint32_t size) noexcept
@@ -516,7 +675,21 @@ auto deflate<execution_path_t::software, deflate_mode_t::deflate_default>(
         -> compression_operation_result_t {
     auto output_begin_ptr = state.next_out();
 
-    compression_operation_result_t result = deflate_pass(state, begin, size);
+    // State buffer has no room for the match search tables of the levels 4-9
+    if (state.compression_level() > high_level && nullptr == state.high_ratio_hash_buffer_) {
+        compression_operation_result_t result;
+
+        result.status_code_ = status_list::memory_allocation_error;
+
+        return result;
+    }
+
+    const bool is_parallel = state.parallel_threads_ > 1U && state.is_first_chunk() && state.is_last_chunk() &&
+                             state.mini_blocks_support() == mini_blocks_support_t::disabled &&
+                             state.dictionary_support() == dictionary_support_t::disabled;
+
+    compression_operation_result_t result =
+            is_parallel ? deflate_pass_parallel(state, begin, size) : deflate_pass(state, begin, size);
 
     if (!(state.is_first_chunk() && state.is_last_chunk())) { state.save_bit_buffer(); }
 
@@ -157,4 +157,14 @@ auto update_histogram<execution_path_t::software>(const uint8_t* begin, const ui
 #pragma GCC diagnostic pop
 #endif
 
+auto update_literals_histogram(const uint8_t* begin, const uint8_t* end, deflate_histogram& histogram) noexcept
+        -> qpl_ml_status {
+    deflate_histogram_count_literals(begin, static_cast<uint32_t>(std::distance(begin, end)),
+                                     histogram.literal_lengths);
+
+    details::remove_empty_places_in_histogram(histogram);
+
+    return status_list::ok;
+}
+
 } // namespace qpl::ml::compression
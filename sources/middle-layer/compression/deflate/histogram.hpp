@@ -23,6 +23,12 @@ template <
         class = typename std::enable_if<path == execution_path_t::software || path == execution_path_t::hardware>::type>
 auto update_histogram(iterator_t begin, iterator_t end, deflate_histogram& histogram,
                       deflate_level level = qpl_default_level) noexcept -> qpl_ml_status;
+
+/**
+ * @brief Counts the source bytes as literals without the match search, lengths and offsets are not updated
+ */
+auto update_literals_histogram(const uint8_t* begin, const uint8_t* end, deflate_histogram& histogram) noexcept
+        -> qpl_ml_status;
 } // namespace qpl::ml::compression
 
 #endif //QPL_HISTOGRAM_HPP_
@@ -30,6 +30,11 @@ constexpr auto build_deflate_implementation(compression_level_t level, compressi
     }
 
     if (mode == dynamic_mode) {
+        if constexpr (block_type == block_type_t::deflate_block) {
+            if (level == level_9) { return deflate_implementation<level_9, dynamic_mode, block_type>::instance; }
+        }
+
+        // Levels 4-8 use the same lazy matching bodies as the high level with their own search parameters
         return level == default_level ? deflate_implementation<default_level, dynamic_mode, block_type>::instance
                                       : deflate_implementation<high_level, dynamic_mode, block_type>::instance;
     }
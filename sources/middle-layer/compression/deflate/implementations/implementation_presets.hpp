@@ -59,6 +59,21 @@ struct deflate_implementation<high_level, dynamic_mode, block_type_t::deflate_bl
              {compression_state_t::finish_deflate_block, &finish_deflate_block}});
 };
 
+template <>
+struct deflate_implementation<level_9, dynamic_mode, block_type_t::deflate_block> {
+    static constexpr auto instance = implementation<deflate_state<execution_path_t::software>>(
+            {{compression_state_t::init_compression, &init_compression},
+             {compression_state_t::start_new_block, &init_new_icf_block},
+             {compression_state_t::compression_body, &optimal_deflate_icf_body},
+             {compression_state_t::create_icf_header, &create_icf_block_header},
+             {compression_state_t::write_buffered_icf_header, &write_buffered_icf_header},
+             {compression_state_t::flush_icf_buffer, &flush_icf_block},
+             {compression_state_t::write_stored_block_header, &write_stored_block_header},
+             {compression_state_t::write_stored_block, &write_stored_block},
+             {compression_state_t::flush_bit_buffer, &flush_bit_buffer},
+             {compression_state_t::finish_deflate_block, &finish_deflate_block}});
+};
+
 template <>
 struct deflate_implementation<default_level, static_mode, block_type_t::deflate_block> {
     static constexpr auto instance = implementation<deflate_state<execution_path_t::software>>(
@@ -5,6 +5,8 @@
  ******************************************************************************/
 
 #include "deflate_state_builder.hpp"
+
+#include "dispatcher/sw_executor.hpp"
 #include "igzip_lib.h"
 
 extern "C" {
@@ -45,6 +47,13 @@ auto deflate_state_builder<execution_path_t::software>::compression_level(compre
         -> common_type& {
     stream_.level_ = level;
 
+    // Tables of the levels 4-9 follow the other buffers, so every chunk of the stream finds them at the same place.
+    // Without space for them the buffer stays nullptr and compression fails
+    if (level > high_level && nullptr == stream_.high_ratio_hash_buffer_) {
+        stream_.high_ratio_hash_buffer_ =
+                stream_.allocator_.allocate<uint32_t, util::memory_block_t::aligned_64u>(high_ratio_hash_table_size);
+    }
+
     return *reinterpret_cast<common_type*>(this);
 }
 
@@ -106,4 +115,20 @@ auto deflate_state_builder<execution_path_t::software>::dictionary(qpl_dictionar
     return *reinterpret_cast<common_type*>(this);
 };
 
+auto deflate_state_builder<execution_path_t::software>::history(uint8_t* history_ptr, uint32_t history_size) noexcept
+        -> common_type& {
+    // Previous data of the same stream is primed the same way as a raw dictionary
+    qpl_isal_deflate_set_dict(stream_.isal_stream_ptr_, history_ptr, history_size);
+    stream_.isal_stream_ptr_->internal_state.max_dist = history_size;
+    stream_.dictionary_support_                       = dictionary_support_t::enabled;
+
+    return *reinterpret_cast<common_type*>(this);
+}
+
+auto deflate_state_builder<execution_path_t::software>::parallel(uint32_t threads) noexcept -> common_type& {
+    stream_.parallel_threads_ = (0U != threads) ? threads : dispatcher::sw_executor::get_instance().worker_count();
+
+    return *reinterpret_cast<common_type*>(this);
+}
+
 } // namespace qpl::ml::compression
@@ -111,6 +111,16 @@ public:
 
     auto dictionary(qpl_dictionary& dictionary) noexcept -> common_type&;
 
+    auto history(uint8_t* history_ptr, uint32_t history_size) noexcept -> common_type&;
+
+    auto parallel(uint32_t threads) noexcept -> common_type&;
+
+    auto sync_flush(bool value) noexcept -> common_type& {
+        stream_.sync_flush_ = value;
+
+        return *reinterpret_cast<common_type*>(this);
+    }
+
     auto verify(bool value) noexcept -> common_type& {
         stream_.is_verification_enabled_ = value;
 
@@ -218,6 +228,8 @@ public:
 
     inline auto dictionary(qpl_dictionary& dictionary) noexcept -> common_type&;
 
+    inline auto parallel(uint32_t threads) noexcept -> common_type&;
+
     inline auto verify(bool value) noexcept -> common_type&;
 
     inline auto multidescriptor_status(const qpl_job* const job_ptr) noexcept -> common_type&;
@@ -330,6 +342,12 @@ inline auto deflate_state_builder<execution_path_t::hardware>::dictionary(qpl_di
     return *this;
 }
 
+inline auto deflate_state_builder<execution_path_t::hardware>::parallel(uint32_t UNREFERENCED_PARAMETER(threads)) noexcept
+        -> common_type& {
+    // HW path submits a job as is, the splitting is done by the software path only
+    return *this;
+}
+
 inline auto deflate_state_builder<execution_path_t::hardware>::verify(bool value) noexcept -> common_type& {
     if (value && state_.verify_descriptor_ == nullptr) { state_.allocate_verification_state(); }
 
@@ -44,18 +44,27 @@ void deflate_state<execution_path_t::software>::reset_match_history() noexcept {
 
     auto level_buffer = reinterpret_cast<level_buf*>(isal_stream_ptr_->level_buf);
 
-    if (compression_level() == high_level) {
-        hash_table_.hash_table_ptr = reinterpret_cast<uint32_t*>(level_buffer->hash_map.hash_table);
-        hash_table_.hash_story_ptr = hash_table_.hash_table_ptr + high_hash_table_size;
+    if (compression_level() >= high_level) {
+        const auto parameters = get_match_search_parameters(compression_level());
+
+        if (compression_level() == high_level) {
+            hash_table_.hash_table_ptr = reinterpret_cast<uint32_t*>(level_buffer->hash_map.hash_table);
+            hash_table_.hash_story_ptr = hash_table_.hash_table_ptr + high_hash_table_size;
+        } else {
+            // Full window doesn't fit into the level buffer, so high-ratio levels use their own tables
+            hash_table_.hash_table_ptr = high_ratio_hash_buffer_;
+            hash_table_.hash_story_ptr = high_ratio_hash_buffer_ + (1U << parameters.hash_bits);
+        }
 
         if (isal_stream_ptr_->total_in == 0) {
-            deflate_hash_table_reset(&hash_table_);
+            hash_table_.hash_mask   = util::build_mask<uint32_t>(parameters.hash_bits);
+            hash_table_.window_size = 1U << parameters.history_size_boundary;
+            hash_table_.attempts    = parameters.chain_length;
+            hash_table_.good_match  = parameters.good_match;
+            hash_table_.nice_match  = parameters.nice_match;
+            hash_table_.lazy_match  = parameters.lazy_match;
 
-            hash_table_.hash_mask  = util::build_mask<uint32_t, 12U>();
-            hash_table_.attempts   = 4096U;
-            hash_table_.good_match = 32U;
-            hash_table_.nice_match = 258U;
-            hash_table_.lazy_match = 258U;
+            deflate_hash_table_reset(&hash_table_);
         }
     } else {
         auto isal_state = &isal_stream_ptr_->internal_state;
@@ -51,6 +51,15 @@ public:
         return static_cast<uint32_t>(util::align_size(size, 1_kb));
     }
 
+    /**
+     * @brief Size of the match search tables of the levels 4-9, allocated on top of @ref get_buffer_size
+     * when such a level is set
+     */
+    [[nodiscard]] static inline auto get_high_ratio_buffer_size() noexcept -> uint32_t {
+        // Allocation is aligned to 64 bytes
+        return static_cast<uint32_t>(util::align_size(high_ratio_hash_table_size * sizeof(uint32_t) + 64U, 1_kb));
+    }
+
     auto write_bytes(const uint8_t* data, uint32_t size) noexcept -> qpl_ml_status override;
 
     void set_source(uint8_t* begin, uint32_t size) noexcept override;
@@ -106,6 +115,7 @@ protected:
     isal_hufftables*     isal_huffman_table_ptr_ = nullptr;
     huffman_table_icf    huffman_table_icf_      = {};
     deflate_hash_table_t hash_table_             = {};
+    uint32_t*            high_ratio_hash_buffer_ = nullptr;
     index_table_t        index_table_            = {};
     compression_level_t  level_                  = default_level;
     dictionary_support_t dictionary_support_     = dictionary_support_t::disabled;
@@ -116,6 +126,10 @@ protected:
     uint32_t             ignore_start_bits_      = 0U;
     uint32_t             total_bytes_written_    = 0U;
 
+    // Parallel compression
+    uint32_t parallel_threads_ = 0U;    /**< Number of threads a single job can be split into, 0 - disabled */
+    bool     sync_flush_       = false; /**< Byte-align the end of a non-last chunk with an empty stored block */
+
     // Verification
     bool                           is_verification_enabled_ = false;
     qpl_compression_huffman_table* compression_table_       = nullptr;
@@ -156,6 +170,9 @@ private:
     friend auto slow_deflate_icf_body(deflate_state<execution_path_t::software>& stream,
                                       compression_state_t&                       state) noexcept -> qpl_ml_status;
 
+    friend auto optimal_deflate_icf_body(deflate_state<execution_path_t::software>& stream,
+                                         compression_state_t&                       state) noexcept -> qpl_ml_status;
+
     friend auto write_header(deflate_state<execution_path_t::software>& stream, compression_state_t& state) noexcept
             -> qpl_ml_status;
 
@@ -179,6 +196,9 @@ private:
 
     friend auto update_checksum(deflate_state<execution_path_t::software>& stream) noexcept -> qpl_ml_status;
 
+    friend auto deflate_pass_parallel(deflate_state<execution_path_t::software>& stream, uint8_t* begin,
+                                      uint32_t size) noexcept -> compression_operation_result_t;
+
     friend auto deflate_body(deflate_state<execution_path_t::software>& stream, compression_state_t& state) noexcept
             -> qpl_ml_status;
 
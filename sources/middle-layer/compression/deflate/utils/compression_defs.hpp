@@ -83,6 +83,41 @@ constexpr uint32_t isal_history_size_boundary = 12U;
  */
 constexpr uint32_t high_hash_table_size = 4096U;
 
+/**
+ * Number of bits in the window and in the hash of the high-ratio levels (4-9), the full deflate window is used
+ */
+constexpr uint32_t high_ratio_history_size_boundary = 15U;
+constexpr uint32_t high_ratio_hash_bits             = 15U;
+
+/**
+ * Number of entries in the hash table and in the history table of the high-ratio levels
+ */
+constexpr uint32_t high_ratio_hash_table_size = (1U << high_ratio_hash_bits) + (1U << high_ratio_history_size_boundary);
+
+/**
+ * @brief Match search settings of the levels that search matches with hash chains
+ */
+struct match_search_parameters_t {
+    uint32_t history_size_boundary; /**< Number of bits in the window size */
+    uint32_t hash_bits;             /**< Number of bits in the hash value */
+    uint32_t chain_length;          /**< Maximal number of previous positions checked for a match */
+    uint32_t good_match;            /**< Chain is shortened 4 times once a match of this length is found */
+    uint32_t lazy_match;            /**< Match of this length is taken without a search at the next position */
+    uint32_t nice_match;            /**< Search is stopped once a match of this length is found */
+};
+
+constexpr auto get_match_search_parameters(compression_level_t level) noexcept -> match_search_parameters_t {
+    switch (level) {
+        case level_4: return {high_ratio_history_size_boundary, high_ratio_hash_bits, 64U, 8U, 32U, 128U};
+        case level_5: return {high_ratio_history_size_boundary, high_ratio_hash_bits, 128U, 16U, 128U, 258U};
+        case level_6: return {high_ratio_history_size_boundary, high_ratio_hash_bits, 256U, 32U, 258U, 258U};
+        case level_7: return {high_ratio_history_size_boundary, high_ratio_hash_bits, 1024U, 32U, 258U, 258U};
+        case level_8: return {high_ratio_history_size_boundary, high_ratio_hash_bits, 4096U, 64U, 258U, 258U};
+        case level_9: return {high_ratio_history_size_boundary, high_ratio_hash_bits, 4096U, 64U, 258U, 258U};
+        default: return {isal_history_size_boundary, isal_history_size_boundary, 256U, 32U, 258U, 258U};
+    }
+}
+
 constexpr uint32_t byte_bit_size   = 8U;
 constexpr uint32_t uint32_bit_size = 32U;
 constexpr uint32_t max_uint8       = 0xFFU;
@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#include "dictionary_training.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "dictionary_utils.hpp"
+#include "simple_memory_ops.hpp"
+
+namespace qpl::ml::compression {
+
+/**
+ * @brief Length of the substrings counted in the samples, a segment is scored by the substrings it contains
+ */
+static constexpr uint32_t training_dmer_length = 8U;
+
+/**
+ * @brief Maximal size of a segment selected from the samples
+ */
+static constexpr uint32_t training_segment_size = 256U;
+
+/**
+ * @brief Number of bits in the hash of a counted substring
+ */
+static constexpr uint32_t training_hash_bits = 20U;
+static constexpr uint32_t training_hash_size = 1U << training_hash_bits;
+
+/**
+ * @brief Maximal number of passes over the samples, a pass selects at most one segment per epoch
+ */
+static constexpr uint32_t training_max_passes = 4U;
+
+/**
+ * @brief Segment of the samples selected for the dictionary
+ */
+struct training_segment_t {
+    size_t   offset; /**< Offset of the segment in the samples buffer */
+    uint32_t size;   /**< Size of the segment */
+    uint64_t score;  /**< Sum of the frequencies of the segment substrings at the moment of the selection */
+};
+
+static inline auto dmer_hash(const uint8_t* source_ptr) noexcept -> uint32_t {
+    uint64_t value = 0U;
+    std::memcpy(&value, source_ptr, training_dmer_length);
+
+    return static_cast<uint32_t>((value * 0x9E3779B97F4A7C15ULL) >> (64U - training_hash_bits));
+}
+
+/**
+ * @brief Finds the segment with the highest score that starts in the epoch [epoch_begin, epoch_end)
+ *        of the samples buffer and does not cross the sample boundaries
+ */
+static auto find_best_segment(const uint8_t* samples_ptr, const size_t* sample_sizes_ptr, uint32_t sample_count,
+                              size_t epoch_begin, size_t epoch_end, const uint32_t* frequencies_ptr) noexcept
+        -> training_segment_t {
+    training_segment_t best {0U, 0U, 0U};
+
+    size_t sample_begin = 0U;
+
+    for (uint32_t i = 0U; i < sample_count && sample_begin < epoch_end; i++) {
+        const size_t sample_size = sample_sizes_ptr[i];
+        const size_t sample_end  = sample_begin + sample_size;
+
+        if (sample_end <= epoch_begin || sample_size < training_dmer_length) {
+            sample_begin = sample_end;
+            continue;
+        }
+
+        const uint8_t* const sample_ptr = samples_ptr + sample_begin;
+
+        const size_t first_start = std::max(epoch_begin, sample_begin) - sample_begin;
+        const size_t last_start  = std::min(epoch_end, sample_end) - sample_begin;
+        const size_t last_dmer   = sample_size - training_dmer_length;
+
+        // Score of the window that starts at first_start, dmers at [start, start + segment_size - dmer_length]
+        uint64_t     score     = 0U;
+        const size_t first_end = std::min(first_start + training_segment_size - training_dmer_length, last_dmer);
+        for (size_t position = first_start; position <= first_end; position++) {
+            score += frequencies_ptr[dmer_hash(sample_ptr + position)];
+        }
+
+        for (size_t start = first_start; start < last_start && start <= last_dmer; start++) {
+            if (score > best.score) {
+                best.offset = sample_begin + start;
+                best.size   = static_cast<uint32_t>(std::min<size_t>(training_segment_size, sample_size - start));
+                best.score  = score;
+            }
+
+            score -= frequencies_ptr[dmer_hash(sample_ptr + start)];
+
+            const size_t next_dmer = start + training_segment_size - training_dmer_length + 1U;
+            if (next_dmer <= last_dmer) { score += frequencies_ptr[dmer_hash(sample_ptr + next_dmer)]; }
+        }
+
+        sample_begin = sample_end;
+    }
+
+    return best;
+}
+
+auto train_dictionary(const uint8_t* samples_ptr, const size_t* sample_sizes_ptr, uint32_t sample_count,
+                      hardware_dictionary_level hw_dict_level, uint8_t* dictionary_ptr, size_t dictionary_capacity,
+                      size_t& dictionary_size) noexcept -> qpl_ml_status {
+    const size_t capacity = std::min(dictionary_capacity, get_history_size_for_dictionary(hw_dict_level));
+
+    size_t total_size = 0U;
+    for (uint32_t i = 0U; i < sample_count; i++) {
+        total_size += sample_sizes_ptr[i];
+    }
+
+    // Small sample sets are used as is
+    if (total_size <= capacity) {
+        core_sw::util::copy(samples_ptr, samples_ptr + total_size, dictionary_ptr);
+        dictionary_size = total_size;
+
+        return status_list::ok;
+    }
+
+    std::unique_ptr<uint32_t[]> frequencies(new (std::nothrow) uint32_t[training_hash_size]());
+    std::unique_ptr<uint32_t[]> last_samples(new (std::nothrow) uint32_t[training_hash_size]());
+
+    if (!frequencies || !last_samples) { return status_list::memory_allocation_error; }
+
+    // Every substring is counted once per sample, so the frequency is the number of samples that contain it
+    size_t sample_begin = 0U;
+    for (uint32_t i = 0U; i < sample_count; i++) {
+        const size_t sample_size = sample_sizes_ptr[i];
+
+        for (size_t position = 0U; position + training_dmer_length <= sample_size; position++) {
+            const uint32_t hash = dmer_hash(samples_ptr + sample_begin + position);
+
+            if (last_samples[hash] != i + 1U) {
+                last_samples[hash] = i + 1U;
+                frequencies[hash]++;
+            }
+        }
+
+        sample_begin += sample_size;
+    }
+
+    // Substrings met in a single sample do not help to compress other samples
+    for (uint32_t i = 0U; i < training_hash_size; i++) {
+        frequencies[i] -= (frequencies[i] != 0U) ? 1U : 0U;
+    }
+
+    // The samples are split into epochs, every pass selects the best segment of each epoch
+    const size_t epoch_count = std::max<size_t>(
+            1U, std::min((capacity + training_segment_size - 1U) / training_segment_size,
+                         total_size / training_segment_size));
+    const size_t epoch_size = (total_size + epoch_count - 1U) / epoch_count;
+
+    std::unique_ptr<training_segment_t[]> segments(new (std::nothrow)
+                                                           training_segment_t[epoch_count * training_max_passes]);
+    if (!segments) { return status_list::memory_allocation_error; }
+
+    size_t segment_count = 0U;
+    size_t selected_size = 0U;
+
+    for (uint32_t pass = 0U; pass < training_max_passes && selected_size < capacity; pass++) {
+        const size_t pass_segment_count = segment_count;
+
+        for (size_t epoch = 0U; epoch < epoch_count && selected_size < capacity; epoch++) {
+            const size_t epoch_begin = epoch * epoch_size;
+            const size_t epoch_end   = std::min(epoch_begin + epoch_size, total_size);
+
+            training_segment_t segment = find_best_segment(samples_ptr, sample_sizes_ptr, sample_count,
+                                                           epoch_begin, epoch_end, frequencies.get());
+            if (0U == segment.score) { continue; }
+
+            // Leading and trailing substrings that no other sample contains are dropped from the segment
+            const uint8_t* segment_ptr = samples_ptr + segment.offset;
+            while (segment.size > training_dmer_length && 0U == frequencies[dmer_hash(segment_ptr)]) {
+                segment.offset++;
+                segment.size--;
+                segment_ptr++;
+            }
+            while (segment.size > training_dmer_length &&
+                   0U == frequencies[dmer_hash(segment_ptr + segment.size - training_dmer_length)]) {
+                segment.size--;
+            }
+
+            // Substrings of the selected segment are already in the dictionary
+            for (size_t position = 0U; position + training_dmer_length <= segment.size; position++) {
+                frequencies[dmer_hash(samples_ptr + segment.offset + position)] = 0U;
+            }
+
+            segment.size = static_cast<uint32_t>(std::min<size_t>(segment.size, capacity - selected_size));
+            selected_size += segment.size;
+
+            segments[segment_count++] = segment;
+        }
+
+        if (pass_segment_count == segment_count) { break; }
+    }
+
+    // The most frequent content is placed at the end of the dictionary, the closest to the compressed data
+    std::sort(segments.get(), segments.get() + segment_count,
+              [](const training_segment_t& lhs, const training_segment_t& rhs) {
+                  return (lhs.score != rhs.score) ? (lhs.score < rhs.score) : (lhs.offset < rhs.offset);
+              });
+
+    uint8_t* destination_ptr = dictionary_ptr;
+    for (size_t i = 0U; i < segment_count; i++) {
+        const uint8_t* const segment_ptr = samples_ptr + segments[i].offset;
+
+        core_sw::util::copy(segment_ptr, segment_ptr + segments[i].size, destination_ptr);
+        destination_ptr += segments[i].size;
+    }
+
+    dictionary_size = selected_size;
+
+    return status_list::ok;
+}
+
+} // namespace qpl::ml::compression
@@ -0,0 +1,42 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#ifndef QPL_COMPRESSION_DICTIONARY_DICTIONARY_TRAINING_HPP_
+#define QPL_COMPRESSION_DICTIONARY_DICTIONARY_TRAINING_HPP_
+
+#include "common/defs.hpp"
+#include "dictionary_defs.hpp"
+
+namespace qpl::ml::compression {
+
+/**
+ * @brief Builds raw dictionary content from a set of samples stored one after another in a single buffer.
+ *
+ * Substrings that occur in many samples are selected and written to the dictionary buffer in the order of
+ * increasing frequency, so the most frequent content is placed at the end of the dictionary, where it is
+ * reached with the shortest match distances. The dictionary size is limited by the capacity and the history
+ * size of the hardware dictionary level.
+ *
+ * @param[in]  samples_ptr          Samples stored one after another
+ * @param[in]  sample_sizes_ptr     Size of every sample
+ * @param[in]  sample_count         Number of samples
+ * @param[in]  hw_dict_level        Hardware dictionary level the content is trained for
+ * @param[out] dictionary_ptr       Buffer for the raw dictionary
+ * @param[in]  dictionary_capacity  Size of the buffer for the raw dictionary
+ * @param[out] dictionary_size      Size of the trained raw dictionary
+ */
+auto train_dictionary(const uint8_t* samples_ptr, const size_t* sample_sizes_ptr, uint32_t sample_count,
+                      hardware_dictionary_level hw_dict_level, uint8_t* dictionary_ptr, size_t dictionary_capacity,
+                      size_t& dictionary_size) noexcept -> qpl_ml_status;
+
+} // namespace qpl::ml::compression
+
+#endif // QPL_COMPRESSION_DICTIONARY_DICTIONARY_TRAINING_HPP_
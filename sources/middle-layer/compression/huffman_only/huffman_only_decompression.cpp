@@ -4,6 +4,10 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 #include "common/bit_reverse.hpp"
 #include "huffman_only.hpp"
 #include "simple_memory_ops.hpp"
@@ -13,131 +17,280 @@
 
 namespace qpl::ml::compression {
 
-static void
-restore_huffman_table(const qplc_huffman_table_flat_format&                      huffman_table,
-                      std::array<huffman_code, huffman_only_number_of_literals>& result_huffman_table) noexcept {
-    // Main cycle
-    for (uint32_t current_code_length = 1U; current_code_length < 16U; current_code_length++) {
-        // Getting number of codes, first code, index of first literal and symbol with Huffman code length "i"
-        const uint16_t number_of_codes   = huffman_table.number_of_codes[current_code_length - 1];
-        const uint16_t first_code        = huffman_table.first_codes[current_code_length - 1];
-        const uint16_t first_table_index = huffman_table.first_table_indexes[current_code_length - 1U];
-        uint8_t        symbol            = huffman_table.index_to_char[first_table_index];
-
-        if (0U == number_of_codes) {
-            // We have no reason to continue this iteration
-            continue;
+/**
+ * @brief Reads Huffman only stream and decodes it with @ref huffman_only_decode_table.
+ *
+ * Little endian streams are read byte by byte starting from the lowest bit. Big endian (BE16) streams consist of
+ * 16-bit words, each of them is read starting from the highest bit, so such words are bit-reversed on load
+ * and decoded the same way as little endian ones afterwards.
+ */
+template <bool is_big_endian>
+class huffman_only_decoder {
+    static constexpr uint32_t unit_bits_size  = (is_big_endian) ? short_bits_size : byte_bits_size;
+    static constexpr uint32_t unit_byte_size  = unit_bits_size / byte_bits_size;
+    static constexpr uint32_t lookup_mask     = (1U << huffman_only_lookup_bits) - 1U;
+    static constexpr uint32_t literals_offset = 24U;
+    static constexpr uint32_t length_offset   = 28U;
+
+    // Fast path keeps the last unit of the stream out of the bit buffer as it can contain bits to ignore,
+    // and stores 4 bytes per lookup with up to 4 lookups per refill
+    static constexpr uint32_t fast_source_margin      = sizeof(uint64_t) + unit_byte_size;
+    static constexpr uint32_t fast_destination_margin = 16U;
+
+    struct bit_buffer_t {
+        const uint8_t* source_ptr     = nullptr;
+        uint64_t       buffer         = 0U;
+        uint32_t       bits_in_buffer = 0U;
+    };
+
+public:
+    huffman_only_decoder(const uint8_t* source_begin_ptr, const uint8_t* source_end_ptr, uint32_t last_bits_offset,
+                         const huffman_only_decode_table& table) noexcept
+        : table_(table), source_begin_ptr_(source_begin_ptr) {
+        const uint32_t units_count =
+                static_cast<uint32_t>(std::distance(source_begin_ptr, source_end_ptr)) / unit_byte_size;
+
+        source_end_ptr_        = source_begin_ptr + units_count * unit_byte_size;
+        bit_buffer_.source_ptr = source_begin_ptr;
+
+        if (units_count) {
+            const uint32_t last_unit_bits =
+                    (0U == last_bits_offset || last_bits_offset > unit_bits_size) ? unit_bits_size : last_bits_offset;
+
+            total_bits_ = static_cast<uint64_t>(units_count - 1U) * unit_bits_size + last_unit_bits;
         }
+    }
+
+    /**
+     * @brief Decodes literals until the stream or the destination end
+     *
+     * @return ok if the whole stream is decoded, more_output_needed if the destination is full
+     */
+    auto decode(uint8_t*& destination_ptr, uint8_t* const destination_end_ptr) noexcept -> qpl_ml_status {
+        // Local copy lets the compiler keep the bit buffer in registers despite the byte stores to destination
+        bit_buffer_t bits                    = bit_buffer_;
+        uint8_t*     current_destination_ptr = destination_ptr;
+        auto         status                  = status_list::ok;
+
+        for (;;) {
+            // Fast path: up to 3 literals per lookup, up to 4 lookups per refill
+            bool is_long_code = false;
+
+            while (!is_long_code && source_end_ptr_ - bits.source_ptr >= fast_source_margin &&
+                   destination_end_ptr - current_destination_ptr >= fast_destination_margin) {
+                refill_fast(bits);
+
+                for (uint32_t i = 0U; i < 4U; i++) {
+                    const uint32_t entry = table_.entries[bits.buffer & lookup_mask];
+
+                    if (entry < (1U << literals_offset)) {
+                        is_long_code = true;
+                        break;
+                    }
+
+                    std::memcpy(current_destination_ptr, &entry, sizeof(uint32_t));
+                    current_destination_ptr += (entry >> literals_offset) & 3U;
+
+                    shift_bits(bits, entry >> length_offset);
+                }
+            }
+
+            // Slow path: a single literal with exact bounds checks, used for long codes and for the stream
+            // and the destination tails
+            refill_safe(bits);
+
+            const uint64_t bits_left = total_bits_ - get_consumed_bits(bits);
+
+            if (0U == bits_left) { break; }
+
+            if (current_destination_ptr == destination_end_ptr) {
+                status = status_list::more_output_needed;
+                break;
+            }
+
+            const uint32_t available_bits =
+                    static_cast<uint32_t>(std::min<uint64_t>(bits_left, QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE));
+
+            uint32_t code          = 0U;
+            uint32_t code_length   = 0U;
+            uint32_t code_offset   = 0U;
+            bool     is_code_found = false;
+
+            while (!is_code_found && code_length < available_bits) {
+                code          = (code << 1U) | static_cast<uint32_t>((bits.buffer >> code_length) & 1U);
+                code_offset   = code - table_.first_codes[code_length];
+                is_code_found = code_offset < table_.number_of_codes[code_length];
+                code_length++;
+            }
+
+            if (!is_code_found) {
+                if (available_bits == QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE) {
+                    status = status_list::bad_huffman_code_error;
+                    break;
+                }
 
-        // First iteration in outer scope
-        result_huffman_table[symbol].code   = first_code;
-        result_huffman_table[symbol].length = current_code_length;
+                // Stream tail is shorter than any code it starts with, treat it as padding
+                shift_bits(bits, available_bits);
+                continue;
+            }
 
-        // Generate other codes and lengths
-        for (uint32_t code_number = 1U; code_number < number_of_codes; code_number++) {
-            symbol = huffman_table.index_to_char[first_table_index + code_number];
+            const uint32_t table_index = table_.first_table_indexes[code_length - 1U] + code_offset;
 
-            result_huffman_table[symbol].code   = first_code + code_number;
-            result_huffman_table[symbol].length = current_code_length;
+            *current_destination_ptr++ = table_.index_to_char[table_index];
+
+            shift_bits(bits, code_length);
         }
-    }
-}
 
-static void build_lookup_table(const std::array<huffman_code, huffman_only_number_of_literals>& huffman_table,
-                               uint8_t* lookup_table_ptr) noexcept {
-    // Main cycle
-    for (uint64_t symbol = 0U; symbol < huffman_table.size(); symbol++) {
-        const uint8_t  code_length             = huffman_table[symbol].length;
-        const uint8_t  offset                  = 16U - code_length;
-        const uint16_t code                    = reverse_bits(huffman_table[symbol].code, code_length);
-        const uint16_t low_lookup_table_index  = 0U;
-        const uint16_t high_lookup_table_index = util::build_mask<uint16_t>(offset);
+        bit_buffer_     = bits;
+        destination_ptr = current_destination_ptr;
 
-        if (0U == code_length) { continue; }
+        return status;
+    }
 
-        // Filling lookup table
-        for (uint32_t i = low_lookup_table_index; i < high_lookup_table_index + 1U; i++) {
-            const uint16_t symbol_position = (i << code_length) | code;
+    [[nodiscard]] auto get_consumed_bytes() const noexcept -> uint32_t {
+        const uint64_t consumed_units = (get_consumed_bits(bit_buffer_) + unit_bits_size - 1U) / unit_bits_size;
 
-            lookup_table_ptr[symbol_position] = (uint8_t)symbol;
+        return static_cast<uint32_t>(consumed_units * unit_byte_size);
+    }
+
+private:
+    [[nodiscard]] static inline auto load(const uint8_t* source_ptr) noexcept -> uint64_t {
+        uint64_t value = 0U;
+        std::memcpy(&value, source_ptr, sizeof(uint64_t));
+
+        if constexpr (is_big_endian) {
+            // Reverse bits in every 16-bit word
+            value = ((value >> 1U) & 0x5555555555555555ULL) | ((value & 0x5555555555555555ULL) << 1U);
+            value = ((value >> 2U) & 0x3333333333333333ULL) | ((value & 0x3333333333333333ULL) << 2U);
+            value = ((value >> 4U) & 0x0F0F0F0F0F0F0F0FULL) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4U);
+            value = ((value >> 8U) & 0x00FF00FF00FF00FFULL) | ((value & 0x00FF00FF00FF00FFULL) << 8U);
         }
+
+        return value;
     }
-}
 
-static auto
-perform_huffman_only_decompression(bit_reader& reader, uint8_t* destination_ptr, uint32_t destination_length,
-                                   const uint8_t*                                                   lookup_table_ptr,
-                                   const std::array<huffman_code, huffman_only_number_of_literals>& huffman_table,
-                                   bool is_big_endian) noexcept -> decompression_operation_result_t {
-    // Main cycle
-    uint32_t current_symbol_index = 0U;
+    // Branchless refill: bits loaded above the buffer count are the following stream bits, so reloading them is safe
+    static inline void refill_fast(bit_buffer_t& bits) noexcept {
+        const uint32_t units_to_load = (63U - bits.bits_in_buffer) / unit_bits_size;
 
-    decompression_operation_result_t result {};
-    bool                             decode_next_symbol = true;
+        bits.buffer |= load(bits.source_ptr) << bits.bits_in_buffer;
+        bits.source_ptr += units_to_load * unit_byte_size;
+        bits.bits_in_buffer += units_to_load * unit_bits_size;
+    }
+
+    // Keeps at most 63 bits in the buffer, as the fast refill expects
+    inline void refill_safe(bit_buffer_t& bits) const noexcept {
+        while (bits.bits_in_buffer < 64U - unit_bits_size && bits.source_ptr < source_end_ptr_) {
+            uint64_t unit = *bits.source_ptr;
 
-    result.status_code_ = status_list::ok;
+            if constexpr (is_big_endian) {
+                uint16_t word = 0U;
+                std::memcpy(&word, bits.source_ptr, sizeof(uint16_t));
+                unit = reverse_bits(word);
+            }
 
-    do { //NOLINT(cppcoreguidelines-avoid-do-while)
-        if (current_symbol_index >= destination_length) {
-            if (!reader.is_source_end()) { result.status_code_ = status_list::more_output_needed; }
-            break;
+            bits.buffer |= unit << bits.bits_in_buffer;
+            bits.source_ptr += unit_byte_size;
+            bits.bits_in_buffer += unit_bits_size;
         }
+    }
+
+    static inline void shift_bits(bit_buffer_t& bits, uint32_t number_of_bits) noexcept {
+        bits.buffer >>= number_of_bits;
+        bits.bits_in_buffer -= number_of_bits;
+    }
+
+    [[nodiscard]] inline auto get_consumed_bits(const bit_buffer_t& bits) const noexcept -> uint64_t {
+        return static_cast<uint64_t>(bits.source_ptr - source_begin_ptr_) * byte_bits_size - bits.bits_in_buffer;
+    }
+
+    const huffman_only_decode_table& table_;
+    const uint8_t*                   source_begin_ptr_;
+    const uint8_t*                   source_end_ptr_;
+    uint64_t                         total_bits_ = 0U;
+    bit_buffer_t                     bit_buffer_ {};
+};
 
-        // Decode the next symbol
-        // peek_bits will get the next bits without removing them from the bit buffer
-        reader.set_big_endian(is_big_endian);
-        const uint16_t next_bits = reader.peek_bits(huffman_code_bit_length);
+static inline auto get_decode_table(huffman_only_decompression_state<execution_path_t::software>& state,
+                                    decompression_huffman_table& decompression_table) noexcept
+        -> const huffman_only_decode_table& {
+    const huffman_only_decode_table* decode_table_ptr = decompression_table.get_huffman_only_decode_table();
 
-        const uint8_t symbol = lookup_table_ptr[next_bits];
+    if (nullptr != decode_table_ptr) { return *decode_table_ptr; }
 
-        // Get the number of bits used to decode the symbol
-        const uint8_t current_symbol_code_length = huffman_table[symbol].length;
+    // The table has no prebuilt lookup table (e.g. temporary one used for verification), build it in the state
+    build_huffman_only_decode_table(*decompression_table.get_sw_decompression_table(), *state.get_decode_table());
 
-        // Remove the used bits from the bit buffer
-        reader.shift_bits(current_symbol_code_length);
+    return *state.get_decode_table();
+}
+
+template <bool is_big_endian>
+static auto perform_huffman_only_decompression(huffman_only_decompression_state<execution_path_t::software>& state,
+                                               const huffman_only_decode_table& decode_table) noexcept
+        -> decompression_operation_result_t {
+    auto& fields = state.get_fields();
+
+    huffman_only_decoder<is_big_endian> decoder(fields.current_source_ptr,
+                                                fields.current_source_ptr + fields.source_available,
+                                                fields.last_bits_offset, decode_table);
+
+    decompression_operation_result_t result {};
 
-        // Writing symbol to output
-        destination_ptr[current_symbol_index++] = symbol;
+    uint8_t* destination_ptr = fields.current_destination_ptr;
 
-        decode_next_symbol = !reader.is_overflowed() || (reader.get_buffer_bit_count() > 0);
-    } while (decode_next_symbol);
+    uint8_t* const destination_end_ptr = fields.current_destination_ptr + fields.destination_available;
 
-    result.output_bytes_ = current_symbol_index;
+    result.status_code_  = decoder.decode(destination_ptr, destination_end_ptr);
+    result.output_bytes_ = static_cast<uint32_t>(destination_ptr - fields.current_destination_ptr);
+    result.completed_bytes_ =
+            (status_list::ok == result.status_code_) ? fields.source_available : decoder.get_consumed_bytes();
 
     return result;
 }
 
-template <>
-auto decompress_huffman_only<execution_path_t::software>(
-        huffman_only_decompression_state<execution_path_t::software>& decompression_state,
-        decompression_huffman_table& decompression_table) noexcept -> decompression_operation_result_t {
-    std::array<huffman_code, huffman_only_number_of_literals> restored_huffman_table;
+template <bool is_big_endian>
+static auto perform_huffman_only_verification(huffman_only_decompression_state<execution_path_t::software>& state,
+                                              const huffman_only_decode_table& decode_table,
+                                              uint32_t                         required_crc) noexcept -> qpl_ml_status {
+    auto& fields = state.get_fields();
 
-    const auto* source_ptr     = decompression_state.get_fields().current_source_ptr;
-    const auto* source_end_ptr = source_ptr + decompression_state.get_fields().source_available;
+    huffman_only_decoder<is_big_endian> decoder(fields.current_source_ptr,
+                                                fields.current_source_ptr + fields.source_available,
+                                                fields.last_bits_offset, decode_table);
 
-    auto* destination_ptr       = decompression_state.get_fields().current_destination_ptr;
-    auto* destination_begin_ptr = decompression_state.get_fields().current_destination_ptr;
-    auto  available_out         = decompression_state.get_fields().destination_available;
+    // Instead of writing literals to output, decode them chunk by chunk and update the overall CRC
+    // @todo Add support for crc32 with iscsi polynomial, which should be used if QPL_FLAG_CRC32C is set
+    std::array<uint8_t, 4_kb> chunk;
 
-    const auto last_byte_valid_bits = decompression_state.get_fields().last_bits_offset;
+    uint32_t crc_value = fields.crc_value;
+    auto     status    = status_list::more_output_needed;
 
-    bit_reader reader(source_ptr, source_end_ptr);
+    while (status_list::more_output_needed == status) {
+        uint8_t* chunk_end_ptr = chunk.data();
 
-    // Restore huffman table and build the lookup table
-    restore_huffman_table(*decompression_table.get_sw_decompression_table(), restored_huffman_table);
+        status    = decoder.decode(chunk_end_ptr, chunk.data() + chunk.size());
+        crc_value = util::crc32_gzip(chunk.data(), chunk_end_ptr, crc_value);
+    }
 
-    build_lookup_table(restored_huffman_table, decompression_state.get_lookup_table());
+    if (status_list::ok != status || required_crc != crc_value) {
+        return status_list::verify_error;
+    } else {
+        return status_list::ok;
+    }
+}
 
-    decompression_operation_result_t result {};
+template <>
+auto decompress_huffman_only<execution_path_t::software>(
+        huffman_only_decompression_state<execution_path_t::software>& decompression_state,
+        decompression_huffman_table& decompression_table) noexcept -> decompression_operation_result_t {
+    const auto& decode_table = get_decode_table(decompression_state, decompression_table);
 
-    reader.set_last_bits_offset(last_byte_valid_bits);
     const bool is_big_endian = decompression_state.get_endianness() == endianness_t::big_endian;
-    result                   = perform_huffman_only_decompression(reader, destination_ptr, available_out,
-                                                                  decompression_state.get_lookup_table(), restored_huffman_table,
-                                                                  is_big_endian);
 
-    result.completed_bytes_ = reader.get_total_bytes_read();
+    auto result = (is_big_endian) ? perform_huffman_only_decompression<true>(decompression_state, decode_table)
+                                  : perform_huffman_only_decompression<false>(decompression_state, decode_table);
+
+    auto* destination_begin_ptr = decompression_state.get_fields().current_destination_ptr;
 
     decompression_state.get_fields().crc_value =
             util::crc32_gzip(destination_begin_ptr, destination_begin_ptr + result.output_bytes_,
@@ -159,50 +312,12 @@ template <>
 auto verify_huffman_only<execution_path_t::software>(
         huffman_only_decompression_state<execution_path_t::software>& state,
         decompression_huffman_table& decompression_table, uint32_t required_crc) noexcept -> qpl_ml_status {
-    uint32_t crc_value = state.get_fields().crc_value;
-
-    // Restore huffman table and build the lookup table
-    std::array<huffman_code, huffman_only_number_of_literals> restored_huffman_table;
-    restore_huffman_table(*decompression_table.get_sw_decompression_table(), restored_huffman_table);
-    build_lookup_table(restored_huffman_table, state.get_lookup_table());
-
-    const uint8_t* lookup_table_ptr = state.get_lookup_table();
-
-    const auto* source_ptr     = state.get_fields().current_source_ptr;
-    const auto* source_end_ptr = source_ptr + state.get_fields().source_available;
-    bit_reader  reader(source_ptr, source_end_ptr);
-    const auto  last_byte_valid_bits = state.get_fields().last_bits_offset;
-    reader.set_last_bits_offset(last_byte_valid_bits);
+    const auto& decode_table = get_decode_table(state, decompression_table);
 
     const bool is_big_endian = state.get_endianness() == endianness_t::big_endian;
-    reader.set_big_endian(is_big_endian);
-
-    bool decode_next_symbol = true;
-    do { //NOLINT(cppcoreguidelines-avoid-do-while)
-        // Decode the next symbol
-        const uint16_t next_bits = reader.peek_bits(huffman_code_bit_length);
-        const uint8_t  symbol    = lookup_table_ptr[next_bits];
 
-        // Get the number of bits used to decode the symbol
-        const uint8_t current_symbol_code_length = restored_huffman_table[symbol].length;
-
-        // Remove the used bits from the bit buffer
-        reader.shift_bits(current_symbol_code_length);
-
-        // Instead of writing symbol to output, find the CRC of the symbol and update the overall CRC
-        // @todo Add support for crc32 with iscsi polynomial, which should be used if QPL_FLAG_CRC32C is set
-        crc_value = ~crc_value;
-        crc_value = (crc_value >> 8) ^ qpl::ml::util::crc32_table_gzip_refl[(crc_value & 0x000000FF) ^ symbol];
-        crc_value = ~crc_value;
-
-        decode_next_symbol = !reader.is_overflowed() || (reader.get_buffer_bit_count() > 0);
-    } while (decode_next_symbol);
-
-    if (required_crc != crc_value) {
-        return status_list::verify_error;
-    } else {
-        return status_list::ok;
-    }
+    return (is_big_endian) ? perform_huffman_only_verification<true>(state, decode_table, required_crc)
+                           : perform_huffman_only_verification<false>(state, decode_table, required_crc);
 }
 
 template <>
@@ -21,8 +21,6 @@ namespace qpl::ml::compression {
 template <execution_path_t path>
 class huffman_only_decompression_state;
 
-constexpr uint32_t huffman_only_lookup_table_size = 0xFFFFU;
-
 template <>
 class huffman_only_decompression_state<execution_path_t::software> {
 public:
@@ -39,8 +37,8 @@ public:
         // Allocate internal buffers
         state_ = allocator.allocate<internal_state_fields_t, qpl::ml::util::memory_block_t::not_aligned>(1U);
 
-        lookup_table_ptr_ =
-                allocator.allocate<uint8_t, qpl::ml::util::memory_block_t::not_aligned>(huffman_only_lookup_table_size);
+        decode_table_ptr_ =
+                allocator.allocate<huffman_only_decode_table, qpl::ml::util::memory_block_t::not_aligned>(1U);
 
         // Initialize internal state
         state_->current_source_ptr      = nullptr;
@@ -70,13 +68,13 @@ public:
 
     [[nodiscard]] inline auto get_endianness() noexcept -> endianness_t;
 
-    [[nodiscard]] inline auto get_lookup_table() noexcept -> uint8_t*;
+    [[nodiscard]] inline auto get_decode_table() noexcept -> huffman_only_decode_table*;
 
     [[nodiscard]] static constexpr inline auto get_buffer_size() noexcept -> uint32_t {
         size_t size = 0;
 
         size += sizeof(internal_state_fields_t);
-        size += sizeof(uint8_t) * huffman_only_lookup_table_size;
+        size += sizeof(huffman_only_decode_table);
 
         return static_cast<uint32_t>(size);
     }
@@ -84,9 +82,9 @@ public:
     static constexpr auto execution_path = execution_path_t::software;
 
 private:
-    internal_state_fields_t* state_;
-    uint8_t*                 lookup_table_ptr_;
-    endianness_t             endianness_ = endianness_t::little_endian;
+    internal_state_fields_t*   state_;
+    huffman_only_decode_table* decode_table_ptr_;
+    endianness_t               endianness_ = endianness_t::little_endian;
 };
 
 template <>
@@ -196,9 +194,9 @@ inline auto huffman_only_decompression_state<execution_path_t::software>::last_b
     return endianness_;
 }
 
-[[nodiscard]] inline auto huffman_only_decompression_state<execution_path_t::software>::get_lookup_table() noexcept
-        -> uint8_t* {
-    return lookup_table_ptr_;
+[[nodiscard]] inline auto huffman_only_decompression_state<execution_path_t::software>::get_decode_table() noexcept
+        -> huffman_only_decode_table* {
+    return decode_table_ptr_;
 }
 
 [[nodiscard]] inline auto huffman_only_decompression_state<execution_path_t::software>::get_fields() noexcept
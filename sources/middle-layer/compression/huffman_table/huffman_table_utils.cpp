@@ -525,21 +525,21 @@ static inline auto comp_to_decompression_table(const compression_huffman_table&
                 &temporary_state);
 
         // Copy lookup tables from temporary state to decompression table
+        auto* canned_table_ptr  = decompression_table.init_canned_table();
         auto* lit_huff_code_ptr = reinterpret_cast<uint8_t*>(&temporary_state.lit_huff_code);
 
         core_sw::util::copy(lit_huff_code_ptr, lit_huff_code_ptr + sizeof(temporary_state.lit_huff_code),
-                            reinterpret_cast<uint8_t*>(&decompression_table.get_canned_table()->literal_huffman_codes));
+                            reinterpret_cast<uint8_t*>(&canned_table_ptr->literal_huffman_codes));
 
         auto* dist_huff_code_ptr = reinterpret_cast<uint8_t*>(&temporary_state.dist_huff_code);
 
-        core_sw::util::copy(
-                dist_huff_code_ptr, dist_huff_code_ptr + sizeof(temporary_state.dist_huff_code),
-                reinterpret_cast<uint8_t*>(&decompression_table.get_canned_table()->distance_huffman_codes));
+        core_sw::util::copy(dist_huff_code_ptr, dist_huff_code_ptr + sizeof(temporary_state.dist_huff_code),
+                            reinterpret_cast<uint8_t*>(&canned_table_ptr->distance_huffman_codes));
 
         // Copy eob symbol properties
-        decompression_table.get_canned_table()->eob_code_and_len = temporary_state.eob_code_and_len;
+        canned_table_ptr->eob_code_and_len = temporary_state.eob_code_and_len;
 
-        decompression_table.get_canned_table()->is_final_block = (temporary_state.bfinal == 1);
+        canned_table_ptr->is_final_block = (temporary_state.bfinal == 1);
 
         if (status_list::ok != status) { return status; }
     }
@@ -613,7 +613,7 @@ static inline auto init_decompression_table_with_stream(const uint8_t* const
     src += flatten_table_size(*decompression_table.get_hw_decompression_state());
     deserialize_table(src, *decompression_table.get_deflate_header());
     src += flatten_table_size(*decompression_table.get_deflate_header());
-    deserialize_table(src, *decompression_table.get_canned_table());
+    deserialize_table(src, *decompression_table.init_canned_table());
 
     return status_list::ok;
 }
@@ -789,6 +789,9 @@ auto huffman_table_init(decompression_huffman_table& table, const qpl_triplet* c
        (using hw_iaa_aecs_decompress_set_huffman_only_huffman_table). */
     details::triplets_to_sw_decompression_table(triplets_ptr, triplets_count, decompression_table_ptr);
 
+    // Software path decodes with the multi-literal lookup table, build it once here instead of per job
+    table.init_huffman_only_decode_table();
+
     return status_list::ok;
 }
 
@@ -1176,7 +1179,8 @@ bool is_equal(qpl_decompression_huffman_table& table, qpl_decompression_huffman_
 
     auto sw_table_diff    = std::memcmp(sw_table, other_sw_table, sizeof(qplc_huffman_table_flat_format));
     auto deflate_buf_diff = std::memcmp(deflate_buf, other_deflate_buf, sizeof(qpl::ml::compression::deflate_header));
-    auto lookup_buf_diff  = std::memcmp(lookup_buf, other_lookup_buf, sizeof(qpl::ml::compression::canned_table));
+    auto lookup_buf_diff =
+            std::memcmp(lookup_buf, other_lookup_buf, sizeof(qpl::ml::compression::decompression_lookup_table));
 
     // TODO: there is an issue in HW representation that doesn't affect the actual data,
     // but some garbage appears even though we do memset at the beginning.
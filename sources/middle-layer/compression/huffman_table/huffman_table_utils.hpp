@@ -116,9 +116,10 @@ struct qpl_decompression_huffman_table {
     uint32_t representation_mask;
 
     /**
-    * This field is used for canned mode only (software path). Contains lookup table for further decompression.
+    * This field is used for canned mode (software path) and for Huffman only decompression (software path).
+    * Contains lookup table for further decompression.
     */
-    std::aligned_storage_t<sizeof(qpl::ml::compression::canned_table), qpl::ml::util::default_alignment>
+    std::aligned_storage_t<sizeof(qpl::ml::compression::decompression_lookup_table), qpl::ml::util::default_alignment>
             lookup_table_buffer;
 };
 
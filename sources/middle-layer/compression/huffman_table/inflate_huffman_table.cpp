@@ -6,15 +6,94 @@
 
 #include "inflate_huffman_table.hpp"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
+#include "common/bit_reverse.hpp"
 #include "hw_definitions.h"
 
 namespace qpl::ml::compression {
+void build_huffman_only_decode_table(const qplc_huffman_table_flat_format& flat_table,
+                                     huffman_only_decode_table&            decode_table) noexcept {
+    constexpr uint32_t max_literals_per_entry = 3U;
+    constexpr uint32_t lookup_mask            = (1U << huffman_only_lookup_bits) - 1U;
+
+    // Restore the canonical description, mapping CAM keeps (code - first code) per literal instead of the mapping table
+    uint32_t empty_position = 0U;
+    for (uint32_t i = 0U; i < QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE; i++) {
+        decode_table.number_of_codes[i]     = flat_table.number_of_codes[i];
+        decode_table.first_codes[i]         = flat_table.first_codes[i];
+        decode_table.first_table_indexes[i] = static_cast<uint16_t>(empty_position);
+
+        empty_position += flat_table.number_of_codes[i];
+    }
+
+    if (empty_position > 256U) {
+        // Malformed table, every code is left undecodable
+        std::fill(std::begin(decode_table.number_of_codes), std::end(decode_table.number_of_codes), 0U);
+        empty_position = 0U;
+    }
+
+    if (flat_table.format_stored == ht_with_mapping_table) {
+        std::copy(flat_table.index_to_char, flat_table.index_to_char + empty_position, decode_table.index_to_char);
+    } else {
+        for (uint32_t symbol = 0U; symbol < 256U; symbol++) {
+            const uint32_t code_length = flat_table.lit_cam[symbol] & 0xFU;
+            const uint32_t code_offset = flat_table.lit_cam[symbol] >> 4U;
+
+            if (0U == code_length || code_offset >= decode_table.number_of_codes[code_length - 1U]) { continue; }
+
+            decode_table.index_to_char[decode_table.first_table_indexes[code_length - 1U] + code_offset] =
+                    static_cast<uint8_t>(symbol);
+        }
+    }
+
+    // Single literal per entry: literal in bits [7:0], code length in bits [11:8], zero for long or absent codes
+    std::array<uint16_t, 1U << huffman_only_lookup_bits> single_entries {};
+
+    for (uint32_t code_length = 1U; code_length <= huffman_only_lookup_bits; code_length++) {
+        for (uint32_t code_offset = 0U; code_offset < decode_table.number_of_codes[code_length - 1U]; code_offset++) {
+            const uint32_t code = decode_table.first_codes[code_length - 1U] + code_offset;
+
+            if (code >> code_length) { break; }
+
+            const uint8_t symbol =
+                    decode_table.index_to_char[decode_table.first_table_indexes[code_length - 1U] + code_offset];
+            const uint16_t reversed_code = reverse_bits(static_cast<uint16_t>(code), code_length);
+
+            for (uint32_t high_bits = 0U; high_bits < (1U << (huffman_only_lookup_bits - code_length)); high_bits++) {
+                single_entries[reversed_code | (high_bits << code_length)] =
+                        static_cast<uint16_t>(symbol | (code_length << 8U));
+            }
+        }
+    }
+
+    // Greedily append the following literals while their codes fit into the index
+    for (uint32_t index = 0U; index <= lookup_mask; index++) {
+        uint32_t entry_literals = 0U;
+        uint32_t literals_count = 0U;
+        uint32_t total_length   = 0U;
+
+        while (literals_count < max_literals_per_entry && total_length < huffman_only_lookup_bits) {
+            const uint32_t single_entry = single_entries[(index >> total_length) & lookup_mask];
+            const uint32_t code_length  = single_entry >> 8U;
+
+            if (0U == code_length || code_length > huffman_only_lookup_bits - total_length) { break; }
+
+            entry_literals |= (single_entry & 0xFFU) << (literals_count * 8U);
+            total_length += code_length;
+            literals_count++;
+        }
+
+        decode_table.entries[index] = entry_literals | (literals_count << 24U) | (total_length << 28U);
+    }
+}
+
 decompression_huffman_table::decompression_huffman_table(uint8_t* sw_table_ptr, uint8_t* hw_table_ptr,
-                                                         uint8_t* deflate_header_ptr, uint8_t* canned_table_ptr)
+                                                         uint8_t* deflate_header_ptr, uint8_t* lookup_table_ptr)
     : sw_decompression_table_ptr(reinterpret_cast<qplc_huffman_table_flat_format*>(sw_table_ptr))
-    , canned_table_ptr_(reinterpret_cast<canned_table*>(canned_table_ptr))
+    , lookup_table_ptr_(reinterpret_cast<decompression_lookup_table*>(lookup_table_ptr))
     , deflate_header_ptr_(reinterpret_cast<deflate_header*>(deflate_header_ptr))
     , sw_decompression_table_flag(false)
     , hw_decompression_table_flag(false)
@@ -55,13 +134,32 @@ auto decompression_huffman_table::get_deflate_header_bit_size() noexcept -> uint
 }
 
 auto decompression_huffman_table::get_canned_table() noexcept -> canned_table* {
-    return canned_table_ptr_;
+    return (lookup_table_ptr_) ? &lookup_table_ptr_->canned : nullptr;
+}
+
+auto decompression_huffman_table::get_huffman_only_decode_table() noexcept -> const huffman_only_decode_table* {
+    if (nullptr == lookup_table_ptr_ || lookup_table_type_e::huffman_only != lookup_table_ptr_->type) { return nullptr; }
+
+    return &lookup_table_ptr_->huffman_only;
 }
 
 void decompression_huffman_table::set_deflate_header_bit_size(uint32_t value) noexcept {
     deflate_header_ptr_->header_bit_size = value;
 }
 
+auto decompression_huffman_table::init_canned_table() noexcept -> canned_table* {
+    lookup_table_ptr_->type = lookup_table_type_e::canned;
+
+    return &lookup_table_ptr_->canned;
+}
+
+void decompression_huffman_table::init_huffman_only_decode_table() noexcept {
+    if (nullptr == lookup_table_ptr_) { return; }
+
+    build_huffman_only_decode_table(*sw_decompression_table_ptr, lookup_table_ptr_->huffman_only);
+    lookup_table_ptr_->type = lookup_table_type_e::huffman_only;
+}
+
 void decompression_huffman_table::enable_sw_decompression_table() noexcept {
     sw_decompression_table_flag = true;
 }
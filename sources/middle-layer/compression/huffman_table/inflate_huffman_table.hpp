@@ -44,6 +44,55 @@ struct canned_table {
     bool is_final_block;
 };
 
+/**
+ * @brief Number of bits indexing @ref huffman_only_decode_table
+ */
+constexpr uint32_t huffman_only_lookup_bits = 12U;
+
+/**
+ * @brief Lookup table for Huffman only decompression, resolves up to 3 literals per lookup.
+ *
+ * Entries are indexed by the next huffman_only_lookup_bits bits of the stream (first stream bit is the lowest one):
+ *  Bits [23:0]  - up to 3 decoded literals, the first one in the lowest byte
+ *  Bits [25:24] - number of decoded literals
+ *  Bits [31:28] - total bit length of their codes
+ *
+ * Zero number of literals means that the next code is longer than huffman_only_lookup_bits or is absent,
+ * such codes are decoded with the canonical description stored next to the entries.
+ */
+struct huffman_only_decode_table {
+    uint32_t entries[1U << huffman_only_lookup_bits];
+    uint16_t number_of_codes[QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE];
+    uint16_t first_codes[QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE];
+    uint16_t first_table_indexes[QPLC_HUFFMAN_CODES_PROPERTIES_TABLE_SIZE];
+    uint8_t  index_to_char[QPLC_INDEX_TO_CHAR_TABLE_SIZE];
+};
+
+/**
+ * @brief Builds @ref huffman_only_decode_table from the software decompression table
+ * (both mapping table and mapping CAM formats are supported)
+ */
+void build_huffman_only_decode_table(const qplc_huffman_table_flat_format& flat_table,
+                                     huffman_only_decode_table&            decode_table) noexcept;
+
+/**
+ * @brief Type of the table kept in @ref decompression_lookup_table
+ */
+enum class lookup_table_type_e : uint32_t { none, canned, huffman_only };
+
+/**
+ * @brief Lookup table of the decompression table: deflate tables keep @ref canned_table there,
+ * Huffman only ones - @ref huffman_only_decode_table
+ */
+struct decompression_lookup_table {
+    lookup_table_type_e type;
+
+    union {
+        canned_table              canned;
+        huffman_only_decode_table huffman_only;
+    };
+};
+
 /**
  * @brief Structure that represents hardware decompression table
  * This is just a stab and is not used anywhere yet
@@ -55,7 +104,7 @@ struct hw_decompression_state {
 class decompression_huffman_table {
 public:
     decompression_huffman_table(uint8_t* sw_table_ptr, uint8_t* hw_table_ptr, uint8_t* deflate_header_ptr,
-                                uint8_t* canned_table_ptr);
+                                uint8_t* lookup_table_ptr);
 
     auto get_sw_decompression_table() noexcept -> qplc_huffman_table_flat_format*;
     auto get_hw_decompression_state() noexcept -> hw_decompression_state*;
@@ -63,9 +112,13 @@ public:
     auto get_deflate_header_data() noexcept -> uint8_t*;
     auto get_deflate_header_bit_size() noexcept -> uint32_t;
     auto get_canned_table() noexcept -> canned_table*;
+    auto get_huffman_only_decode_table() noexcept -> const huffman_only_decode_table*;
 
     void set_deflate_header_bit_size(uint32_t value) noexcept;
 
+    auto init_canned_table() noexcept -> canned_table*;
+    void init_huffman_only_decode_table() noexcept;
+
     void enable_sw_decompression_table() noexcept;
     void enable_hw_decompression_table() noexcept;
     void enable_deflate_header() noexcept;
@@ -77,7 +130,7 @@ public:
 private:
     hw_decompression_state*         hw_decompression_table_ptr;
     qplc_huffman_table_flat_format* sw_decompression_table_ptr;
-    canned_table*                   canned_table_ptr_;
+    decompression_lookup_table*     lookup_table_ptr_;
     deflate_header*                 deflate_header_ptr_;
 
     bool sw_decompression_table_flag;
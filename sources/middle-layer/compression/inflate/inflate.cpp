@@ -31,6 +31,8 @@ static auto flush_tmp_out_buffer(isal_inflate_state& inflate_state) noexcept ->
 
 static inline void ignore_last_bits(isal_inflate_state& inflate_state, uint32_t number_of_bits) noexcept;
 
+static inline void return_unused_bytes(isal_inflate_state& inflate_state) noexcept;
+
 } // namespace utility
 
 // ------ SOFTWARE PATH ------ //
@@ -57,6 +59,9 @@ auto inflate(inflate_state<path>& decompression_state, end_processing_condition_
         result = own_inflate_random(decompression_state);
     } else {
         result = own_inflate(decompression_state, end_processing_condition);
+
+        // Source is read ahead, so the bytes that follow the final block are given back to report the stream end
+        if (ISAL_BLOCK_FINISH == inflate_state->block_state) { utility::return_unused_bytes(*inflate_state); }
     }
 
     utility::ignore_last_bits(*inflate_state, decompression_state.access_properties_.ignore_end_bits);
@@ -126,12 +131,18 @@ static auto own_inflate(inflate_state<execution_path_t::software>& decompression
         inflate_state_ptr->avail_out = saved_output_available;
     }
 
+    // The checksum is accumulated after every piece written to the output, while the data is still in the cache
+    const uint8_t* checksum_begin_ptr = inflate_state_ptr->next_out;
+
     auto flush_status = utility::flush_tmp_out_buffer(*inflate_state_ptr);
     /* Prevent overwrite of inflate pass errors by flush_tmp_out_buffer errors */
     if (status_list::ok != flush_status && status_list::ok == result.status_code_) {
         result.status_code_ = flush_status;
     }
 
+    decompression_state.update_checksum(checksum_begin_ptr, inflate_state_ptr->next_out);
+    checksum_begin_ptr = inflate_state_ptr->next_out;
+
     if (result.status_code_ >= status_list::hardware_error_base) {
         /* Set total_out to not count data in tmp_out_buffer */
         inflate_state_ptr->total_out -= inflate_state_ptr->tmp_out_valid - inflate_state_ptr->tmp_out_processed;
@@ -156,6 +167,9 @@ static auto own_inflate(inflate_state<execution_path_t::software>& decompression
         while (do_next_inflate_pass) {
             result.status_code_ = inflate_pass(*inflate_state_ptr, output_start_ptr);
 
+            decompression_state.update_checksum(checksum_begin_ptr, inflate_state_ptr->next_out);
+            checksum_begin_ptr = inflate_state_ptr->next_out;
+
             if (status_list::ok != result.status_code_) {
                 break; //todo really break?
             }
@@ -203,9 +217,6 @@ static auto own_inflate(inflate_state<execution_path_t::software>& decompression
     if (inflate_state_ptr->block_state == ISAL_BLOCK_INPUT_DONE &&
         inflate_state_ptr->tmp_out_valid == inflate_state_ptr->tmp_out_processed) {
         inflate_state_ptr->block_state = ISAL_BLOCK_FINISH;
-
-        // todo isal read all bytes in the source and we need to set avail int to position after feob symbol
-        // actualize_avail_in(inflate_state_ptr);
     }
 
     // Don't count bytes, which has not been processed yet
@@ -339,6 +350,15 @@ static inline void ignore_last_bits(isal_inflate_state& inflate_state, uint32_t
     }
 }
 
+static inline void return_unused_bytes(isal_inflate_state& inflate_state) noexcept {
+    const uint32_t unused_bytes = static_cast<uint32_t>(inflate_state.read_in_length) / byte_bits_size;
+
+    inflate_state.next_in -= unused_bytes;
+    inflate_state.avail_in += unused_bytes;
+    inflate_state.read_in_length -= static_cast<int32_t>(unused_bytes * byte_bits_size);
+    inflate_state.read_in &= util::build_mask<uint64_t>(static_cast<uint32_t>(inflate_state.read_in_length));
+}
+
 static auto flush_tmp_out_buffer(isal_inflate_state& inflate_state) noexcept -> qpl_ml_status {
     // Determinate maximum copy size
     qpl_ml_status status = status_list::ok;
@@ -37,6 +37,15 @@ enum end_processing_condition_t : uint8_t {
     check_on_nonlast_block        = 8  /**< Stop condition: disabled; Check condition: not last block */
 };
 
+/**
+ * @brief Checksum accumulated by the software inflate over the output while it is written
+ */
+enum class inflate_checksum_t : uint8_t {
+    none,   /**< Checksum is not calculated */
+    crc32,  /**< CRC32 (gzip) is calculated */
+    adler32 /**< Adler32 (zlib) is calculated */
+};
+
 struct access_properties {
     bool    is_random;
     uint8_t ignore_start_bits;
@@ -16,6 +16,7 @@
 #include "inflate.hpp"
 #include "inflate_defs.hpp"
 #include "simple_memory_ops.hpp"
+#include "util/checksum.hpp"
 
 // core-iaa
 #include "hw_aecs_api.h"
@@ -59,6 +60,10 @@ public:
 
     inline auto crc_seed(uint32_t seed) noexcept -> inflate_state&;
 
+    inline auto checksum(inflate_checksum_t checksum_type) noexcept -> inflate_state&;
+
+    inline void update_checksum(const uint8_t* begin, const uint8_t* end) noexcept;
+
     inline auto terminate() noexcept -> inflate_state&;
 
     inline auto in_progress() noexcept -> inflate_state&;
@@ -99,6 +104,7 @@ private:
     util::multitask_status processing_step   = util::multitask_status::ready;
     bool                   is_dictionary_set = false;
     qpl_dictionary*        dictionary_ptr    = nullptr;
+    inflate_checksum_t     checksum_type_    = inflate_checksum_t::none;
 
     explicit inflate_state(const util::linear_allocator& allocator) {
         inflate_state_ = allocator.allocate<isal_inflate_state, util::memory_block_t::not_aligned>(1U);
@@ -349,6 +355,27 @@ inline auto inflate_state<execution_path_t::software>::crc_seed(uint32_t seed) n
     return *this;
 }
 
+inline auto inflate_state<execution_path_t::software>::checksum(inflate_checksum_t checksum_type) noexcept
+        -> inflate_state& {
+    checksum_type_ = checksum_type;
+
+    return *this;
+}
+
+/**
+ * @brief Accumulates the checksum over the just written part of the output, while it is still in the cache
+ */
+inline void inflate_state<execution_path_t::software>::update_checksum(const uint8_t* begin,
+                                                                      const uint8_t* end) noexcept {
+    if (begin == end) { return; }
+
+    if (inflate_checksum_t::crc32 == checksum_type_) {
+        inflate_state_->crc = util::crc32_gzip(begin, end, inflate_state_->crc);
+    } else if (inflate_checksum_t::adler32 == checksum_type_) {
+        inflate_state_->crc = util::adler32(begin, static_cast<uint32_t>(end - begin), inflate_state_->crc);
+    }
+}
+
 inline auto inflate_state<execution_path_t::software>::terminate() noexcept -> inflate_state& {
     processing_step =
             static_cast<util::multitask_status>(processing_step | util::multitask_status::multi_chunk_last_chunk);
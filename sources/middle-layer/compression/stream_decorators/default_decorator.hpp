@@ -13,6 +13,7 @@
 #define QPL_DEFAULT_DECORATOR_HPP_
 
 #include "compression/compression_defs.hpp"
+#include "compression/inflate/inflate_defs.hpp"
 #include "compression/inflate/isal_kernels_wrappers.hpp"
 #include "util/checksum.hpp"
 
@@ -22,30 +23,24 @@ class default_decorator {
 public:
     template <class F, class state_t, class... arguments>
     static auto unwrap(F function, state_t& state, arguments... args) noexcept -> decompression_operation_result_t {
-#if defined(__GNUC__) && !defined(__clang__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
-#endif
-        uint8_t* saved_output_ptr = state.get_output_data(); //state.get_output_buffer;
-#if defined(__GNUC__) && !defined(__clang__)
-#pragma GCC diagnostic pop
-#endif
+        // Software inflate accumulates CRC32 while writing the output, hardware returns it in the completion record
+        if constexpr (execution_path_t::software == state_t::execution_path) {
+            state.checksum(inflate_checksum_t::crc32);
+        }
+
         auto result = function(state, args...);
 
-        if (result.status_code_) { return result; }
+        if constexpr (execution_path_t::software == state_t::execution_path) {
+            result.checksums_.crc32_ = state.get_crc();
+        }
 
-        auto crc = state.get_crc();
+        if (result.status_code_) { return result; }
 
         // @todo Add both crc32 support
         if constexpr (execution_path_t::hardware == state_t::execution_path) {
-            crc = result.checksums_.crc32_;
-        } else {
-            crc = util::crc32_gzip(saved_output_ptr, saved_output_ptr + result.output_bytes_, crc);
+            state.crc_seed(result.checksums_.crc32_);
         }
 
-        state.crc_seed(crc);
-        result.checksums_.crc32_ = crc;
-
         return result;
     }
 
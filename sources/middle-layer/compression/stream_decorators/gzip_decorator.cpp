@@ -153,7 +153,6 @@ auto gzip_decorator::read_header(const uint8_t* stream_ptr, uint32_t stream_size
 template <class F, class state_t, class... arguments>
 auto gzip_decorator::unwrap(F function, state_t& state, arguments... args) noexcept
         -> decompression_operation_result_t {
-    uint8_t*       saved_output_ptr  = state.get_output_data(); //state.get_output_buffer;
     const uint32_t origin_input_size = state.get_input_size();
     uint32_t       wrapper_bytes     = 0;
 
@@ -181,17 +180,16 @@ auto gzip_decorator::unwrap(F function, state_t& state, arguments... args) noexc
         wrapper_bytes += sizeof(gzip_trailer);
     }
 
+    // Software inflate accumulates CRC32 while writing the output, hardware returns it in the completion record
+    if constexpr (state_t::execution_path == execution_path_t::software) { state.checksum(inflate_checksum_t::crc32); }
+
     result = function(state, args...);
 
-    if (result.status_code_) { return result; }
+    if constexpr (state_t::execution_path == execution_path_t::software) { result.checksums_.crc32_ = state.get_crc(); }
 
-    auto crc = state.get_crc();
+    if (result.status_code_) { return result; }
 
-    if constexpr (state_t::execution_path == execution_path_t::hardware) {
-        crc = result.checksums_.crc32_;
-    } else {
-        crc = util::crc32_gzip(saved_output_ptr, saved_output_ptr + result.output_bytes_, crc);
-    }
+    const auto crc = result.checksums_.crc32_;
 
     if (state.is_last() && origin_input_size - result.completed_bytes_ < sizeof(gzip_trailer)) {
         auto trailer = reinterpret_cast<gzip_trailer*>(state.get_input_data());
@@ -201,7 +199,6 @@ auto gzip_decorator::unwrap(F function, state_t& state, arguments... args) noexc
     }
 
     state.crc_seed(crc);
-    result.checksums_.crc32_ = crc;
     result.completed_bytes_ += wrapper_bytes;
 
     return result;
@@ -170,11 +170,24 @@ auto zlib_decorator::unwrap(F function, state_t& state, arguments... args) noexc
         wrapper_bytes = header.byte_size;
     }
 
+    // Software inflate accumulates Adler32 while writing the output, for hardware it is calculated afterwards
+    if constexpr (std::is_same_v<state_t, inflate_state<execution_path_t::software>>) {
+        state.checksum(inflate_checksum_t::adler32);
+    }
+
     result = function(state, args...);
 
+    if constexpr (std::is_same_v<state_t, inflate_state<execution_path_t::software>>) {
+        result.checksums_.crc32_ = state.get_crc();
+    }
+
     if (result.status_code_) { return result; }
 
-    adler_value = util::adler32(saved_output_ptr, result.output_bytes_, adler_value);
+    if constexpr (std::is_same_v<state_t, inflate_state<execution_path_t::software>>) {
+        adler_value = state.get_crc();
+    } else {
+        adler_value = util::adler32(saved_output_ptr, result.output_bytes_, adler_value);
+    }
 
     state.crc_seed(adler_value);
     result.checksums_.crc32_ = adler_value;
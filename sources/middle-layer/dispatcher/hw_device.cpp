@@ -14,6 +14,10 @@
 #include "hw_device.hpp"
 #include "util/topology.hpp"
 
+#if defined(QPL_HW_EMULATION)
+#include "hw_emulator.hpp"
+#endif //QPL_HW_EMULATION
+
 #ifdef DYNAMIC_LOADING_LIBACCEL_CONFIG
 #include "hw_configuration_driver.h"
 #else //DYNAMIC_LOADING_LIBACCEL_CONFIG=OFF
@@ -62,31 +66,66 @@ void hw_device::fill_hw_context(hw_accelerator_context* const hw_context_ptr) co
     hw_context_ptr->device_properties.force_array_output_mod_available = hw_device::get_force_array_output_support();
 }
 
+/**
+ * @brief Submits the descriptor to the first WQ in the order given by @ref order_work_queues that accepts it.
+ * WQs that report retry are marked busy, so the following submissions try them last.
+ */
 auto hw_device::enqueue_descriptor(void* desc_ptr) const noexcept -> hw_accelerator_status {
-    static thread_local std::uint32_t wq_idx                = 0;
-    bool                              is_op_supported_by_wq = false;
-    const uint32_t                    operation             = hw_iaa_descriptor_get_operation((hw_descriptor*)desc_ptr);
-
-    // For small low-latency cases WQ with small transfer size may be preferable
-    // TODO: order WQs by priority and engines capacity, check transfer sizes and other possible features
-    for (uint64_t try_count = 0U; try_count < queue_count_; ++try_count) {
-        hw_iaa_descriptor_set_block_on_fault((hw_descriptor*)desc_ptr, working_queues_[wq_idx].get_block_on_fault());
-        // If OPCFG functionality exists, check OPCFG register before submitting, otherwise try submission
-        if (!op_cfg_enabled_ || get_operation_supported_on_wq(wq_idx, operation)) {
-            // For submitting when OPCFG is supported, logic is :
-            //   If all WQs don't support operation, return HW_ACCELERATOR_NOT_SUPPORTED_BY_WQ
-            //   If any WQ supports operation, but submission fails, then return HW_ACCELERATOR_WQ_IS_BUSY
-            const qpl_status enqueue_status = working_queues_[wq_idx].enqueue_descriptor(desc_ptr);
-            is_op_supported_by_wq           = true;
-            if (QPL_STS_OK == enqueue_status) { return HW_ACCELERATOR_STATUS_OK; }
+    static thread_local std::uint32_t start_idx = 0U;
+
+    auto* const    descriptor_ptr = static_cast<hw_descriptor*>(desc_ptr);
+    const uint32_t operation      = hw_iaa_descriptor_get_operation(descriptor_ptr);
+
+    uint8_t* source_ptr    = nullptr;
+    uint32_t transfer_size = 0U;
+    hw_iaa_descriptor_get_input_buffer(descriptor_ptr, &source_ptr, &transfer_size);
+
+    const uint64_t submission_index = submission_count_.load(std::memory_order_relaxed);
+
+    std::array<hw_queue_candidate_t, max_working_queues> candidates {};
+    for (uint32_t wq_idx = 0U; wq_idx < queue_count_; wq_idx++) {
+        const hw_queue& queue = working_queues_[wq_idx];
+
+        candidates[wq_idx].priority          = queue.priority();
+        candidates[wq_idx].max_transfer_size = queue.get_max_transfer_size();
+        candidates[wq_idx].is_supported      = !op_cfg_enabled_ || get_operation_supported_on_wq(wq_idx, operation);
+        candidates[wq_idx].is_congested      = queue.is_congested(submission_index);
+    }
+
+    std::array<uint32_t, max_working_queues> order {};
+    const uint32_t order_count =
+            order_work_queues(candidates.data(), queue_count_, transfer_size, start_idx, order.data());
+
+    start_idx = (start_idx + 1U) % std::max(queue_count_, 1U);
+
+    // If no WQ supports the operation and the transfer size, return HW_ACCELERATOR_NOT_SUPPORTED_BY_WQ,
+    // if all of the supporting WQs are full, return HW_ACCELERATOR_WQ_IS_BUSY
+    if (0U == order_count) { return HW_ACCELERATOR_NOT_SUPPORTED_BY_WQ; }
+
+    for (uint32_t i = 0U; i < order_count; i++) {
+        const hw_queue& queue = working_queues_[order[i]];
+
+        hw_iaa_descriptor_set_block_on_fault(descriptor_ptr, queue.get_block_on_fault());
+
+        if (QPL_STS_OK == queue.enqueue_descriptor(desc_ptr)) {
+            submission_count_.fetch_add(1U, std::memory_order_relaxed);
+            return HW_ACCELERATOR_STATUS_OK;
         }
-        wq_idx = (wq_idx + 1) % queue_count_;
+
+        queue.mark_busy(submission_index);
     }
-    if (!is_op_supported_by_wq) {
-        return HW_ACCELERATOR_NOT_SUPPORTED_BY_WQ;
-    } else {
-        return HW_ACCELERATOR_WQ_IS_BUSY;
+
+    return HW_ACCELERATOR_WQ_IS_BUSY;
+}
+
+auto hw_device::is_congested() const noexcept -> bool {
+    const uint64_t submission_index = submission_count_.load(std::memory_order_relaxed);
+
+    for (uint32_t wq_idx = 0U; wq_idx < queue_count_; wq_idx++) {
+        if (!working_queues_[wq_idx].is_congested(submission_index)) { return false; }
     }
+
+    return true;
 }
 
 auto hw_device::get_indexing_support_enabled() const noexcept -> uint32_t {
@@ -257,6 +296,40 @@ auto hw_device::initialize_new_device(descriptor_t* device_descriptor_ptr) noexc
     return HW_ACCELERATOR_STATUS_OK;
 }
 
+#if defined(QPL_HW_EMULATION)
+/**
+ * @brief Function to set up the device emulated in the process, see @ref hw_emulator.
+ * The device reports generation 1 capabilities without decompression support and is not bound to a NUMA node.
+ */
+auto hw_device::initialize_emulated_device() noexcept -> hw_accelerator_status {
+    static constexpr uint64_t emulated_max_transfer_size_log = 30U;
+
+    auto& emulator = hw_emulator::get_instance();
+
+    version_major_    = 1U;
+    version_minor_    = 0U;
+    gen_cap_register_ = emulated_max_transfer_size_log << 16U;
+    iaa_cap_register_ = 0U;
+    numa_node_id_     = (uint64_t)(-1);
+    socket_id_        = 0U;
+    op_cfg_enabled_   = false;
+
+    DIAG("emulated device: version: %d.%d\n", version_major_, version_minor_);
+    DIAG("emulated device: GENCAP: %" PRIu64 "\n", gen_cap_register_);
+
+    queue_count_ = std::min<uint32_t>(emulator.queue_count(), max_working_queues);
+
+    for (uint32_t wq_idx = 0U; wq_idx < queue_count_; wq_idx++) {
+        const hw_accelerator_status status = working_queues_[wq_idx].initialize_emulated_queue(wq_idx);
+        if (HW_ACCELERATOR_STATUS_OK != status) { return status; }
+    }
+
+    if (queue_count_ == 0) { return HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE; }
+
+    return HW_ACCELERATOR_STATUS_OK;
+}
+#endif //QPL_HW_EMULATION
+
 auto hw_device::size() const noexcept -> size_t {
     return queue_count_;
 }
@@ -15,6 +15,7 @@
 
 #include "hw_devices.h"
 #include "hw_queue.hpp"
+#include "hw_queue_order.hpp"
 #include "hw_status.h"
 
 namespace qpl::ml::dispatcher {
@@ -38,8 +39,17 @@ public:
 
     [[nodiscard]] auto enqueue_descriptor(void* desc_ptr) const noexcept -> hw_accelerator_status;
 
+    /**
+     * @brief Checks if every WQ of the device reported retry recently
+     */
+    [[nodiscard]] auto is_congested() const noexcept -> bool;
+
     [[nodiscard]] auto initialize_new_device(descriptor_t* device_descriptor_ptr) noexcept -> hw_accelerator_status;
 
+#if defined(QPL_HW_EMULATION)
+    [[nodiscard]] auto initialize_emulated_device() noexcept -> hw_accelerator_status;
+#endif
+
     [[nodiscard]] auto size() const noexcept -> size_t;
 
     [[nodiscard]] auto numa_id() const noexcept -> uint64_t;
@@ -90,6 +100,7 @@ private:
     uint32_t           version_minor_    = 0U;    /**< Minor version of discovered device */
     bool               op_cfg_enabled_   = false; /**< Need to check workqueue's OPCFG register */
     uint64_t           socket_id_        = 0u;    /**< Socket id of the device */
+    mutable std::atomic<uint64_t> submission_count_ = 0U; /**< Number of descriptors accepted by the device */
 };
 
 #endif
@@ -45,6 +45,17 @@ auto hw_dispatcher::initialize_hw() noexcept -> hw_accelerator_status {
 
     DIAG("Intel QPL version %s\n", QPL_VERSION);
 
+#if defined(QPL_HW_EMULATION)
+    // The emulated device replaces the accelerator configuration library and the devices it enumerates
+    DIAG("creating emulated device\n");
+    const hw_accelerator_status emulation_status = devices_[0].initialize_emulated_device();
+    QPL_HWSTS_RET(emulation_status != HW_ACCELERATOR_STATUS_OK, emulation_status);
+
+    device_count_ = 1U;
+
+    return HW_ACCELERATOR_STATUS_OK;
+#endif //QPL_HW_EMULATION
+
 #ifdef DYNAMIC_LOADING_LIBACCEL_CONFIG
     const hw_accelerator_status status = hw_initialize_accelerator_driver(&hw_driver_);
     QPL_HWSTS_RET(status != HW_ACCELERATOR_STATUS_OK, status);
@@ -0,0 +1,410 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#if defined(QPL_HW_EMULATION)
+
+#include "hw_emulator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// core-iaa
+#include "hw_aecs_api.h"
+#include "hw_completion_record_api.h"
+#include "hw_devices.h"
+#include "hw_iaa_flags.h"
+#include "hw_status.h"
+#include "own_hw_definitions.h"
+
+// middle-layer
+#include "analytics/expand.hpp"
+#include "analytics/extract.hpp"
+#include "analytics/scan.hpp"
+#include "analytics/select.hpp"
+#include "other/crc.hpp"
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief Remaining wait time below which an engine stops sleeping and yields until the completion time
+ */
+static constexpr auto emulator_spin_threshold = std::chrono::microseconds(100);
+
+/**
+ * @brief Filter flag of the big-endian bit order of the second source (mask)
+ */
+static constexpr uint32_t filter_flags_source_2_be = 1U << 12U;
+
+static inline auto filter_flags_get_parser(uint32_t filter_flags) noexcept -> uint32_t {
+    return filter_flags & 3U;
+}
+
+static inline auto filter_flags_get_source_1_bit_width(uint32_t filter_flags) noexcept -> uint32_t {
+    return ((filter_flags >> 2U) & 0x1FU) + 1U;
+}
+
+static inline auto filter_flags_get_output_format(uint32_t filter_flags) noexcept -> uint32_t {
+    return (filter_flags >> 13U) & 3U;
+}
+
+static inline auto read_configuration_value(const char* name, uint32_t default_value) noexcept -> uint32_t {
+    const char* value_ptr = std::getenv(name);
+
+    if (nullptr == value_ptr || '\0' == *value_ptr) { return default_value; }
+
+    char*                    end_ptr = nullptr;
+    const unsigned long long value   = std::strtoull(value_ptr, &end_ptr, 10);
+
+    return ('\0' == *end_ptr && value <= UINT32_MAX) ? static_cast<uint32_t>(value) : default_value;
+}
+
+/**
+ * @brief Converts the status of the software path into the completion record status and error code
+ */
+static void store_operation_status(uint32_t status_code, hw_iaa_completion_record& record) noexcept {
+    if (status_list::ok == status_code) {
+        record.status = AD_STATUS_SUCCESS;
+    } else if (status_code > status_list::hardware_error_base && status_code < status_list::hardware_status_base) {
+        record.status     = AD_STATUS_ANALYTICS_ERROR;
+        record.error_code = static_cast<hw_operation_error>(status_code - status_list::hardware_error_base);
+    } else {
+        record.status = AD_STATUS_ANALYTICS_ERROR;
+    }
+}
+
+static void emulate_crc64(const hw_decompress_analytics_descriptor& descriptor,
+                          hw_iaa_completion_record&                 record) noexcept {
+    // CRC64 descriptor keeps the polynomial in the last 8 bytes and the CRC flags in place of decompression flags
+    const uint64_t polynomial =
+            (static_cast<uint64_t>(descriptor.num_input_elements) << 32U) | descriptor.filter_flags;
+    const bool is_be_bit_order = descriptor.decomp_flags & ADC64F_BE;
+    const bool is_inverse      = descriptor.decomp_flags & ADC64F_INVCRC;
+
+    const auto result = other::call_crc<execution_path_t::software>(descriptor.src1_ptr, descriptor.src1_size,
+                                                                    polynomial, is_be_bit_order, is_inverse);
+
+    record.bytes_completed = descriptor.src1_size;
+    record.max_last_agg    = static_cast<uint32_t>(result.crc_);
+    record.sum_agg         = static_cast<uint32_t>(result.crc_ >> 32U);
+
+    store_operation_status(result.status_code_, record);
+}
+
+template <class engine_buffers_t>
+static void emulate_filter(const hw_decompress_analytics_descriptor& descriptor, uint32_t opcode,
+                           engine_buffers_t& buffers, hw_iaa_completion_record& record) noexcept {
+    using namespace analytics;
+
+    // Decompression of the filter input is not emulated, the descriptor is reported the same way as compression
+    if (descriptor.decomp_flags & ADDF_ENABLE_DECOMP) {
+        record.status = AD_STATUS_UNSUPPORTED_OPCODE;
+        return;
+    }
+
+    if (0U == descriptor.num_input_elements) {
+        record.status = AD_STATUS_INVALID_NUM_ELEM;
+        return;
+    }
+
+    const uint32_t opcode_flags  = descriptor.op_code_op_flags;
+    const uint32_t filter_flags  = descriptor.filter_flags;
+    const uint32_t parser        = filter_flags_get_parser(filter_flags);
+    const bool     is_inverse    = filter_flags & hw_iaa_output_modifier_inverse;
+    const bool     is_aecs_input = ((opcode_flags >> 16U) & 3U) == AD_RDSRC2_AECS;
+
+    if (hw_iaa_input_format_prle < parser || (hw_iaa_input_format_prle == parser && 0U == descriptor.src1_size)) {
+        record.status = AD_STATUS_INVALID_FILTER_FLAG;
+        return;
+    }
+
+    if (is_inverse && QPL_OPCODE_SCAN != opcode) {
+        record.status = AD_STATUS_INVALID_INV_OUTPUT;
+        return;
+    }
+
+    if (is_aecs_input && (nullptr == descriptor.src2_ptr || descriptor.src2_size < sizeof(hw_iaa_aecs_filter))) {
+        record.status = AD_STATUS_TRANSFER_SIZE_INVALID;
+        return;
+    }
+
+    const auto* const aecs_ptr = reinterpret_cast<const hw_iaa_aecs_analytic*>(descriptor.src2_ptr);
+
+    const uint32_t param_low            = is_aecs_input ? aecs_ptr->filtering_options.filter_low : 0U;
+    const uint32_t param_high           = is_aecs_input ? aecs_ptr->filtering_options.filter_high : 0U;
+    const uint32_t initial_output_index = is_aecs_input ? aecs_ptr->filtering_options.output_mod_idx : 0U;
+
+    const auto input_format  = static_cast<stream_format_t>(parser);
+    const auto output_format = (filter_flags & hw_iaa_output_modifier_big_endian) ? stream_format_t::be_format
+                                                                                  : stream_format_t::le_format;
+    const auto out_bit_width_format =
+            static_cast<output_bit_width_format_t>(filter_flags_get_output_format(filter_flags));
+    const auto crc_type = (opcode_flags & ADOF_CRC32C) ? input_stream_t::crc_t::iscsi : input_stream_t::crc_t::gzip;
+    const bool is_force_array = filter_flags & hw_iaa_output_modifier_force_array;
+
+    uint8_t* const source_begin      = descriptor.src1_ptr;
+    uint8_t* const source_end        = descriptor.src1_ptr + descriptor.src1_size;
+    uint8_t* const destination_begin = descriptor.dst_ptr;
+    uint8_t* const destination_end   = descriptor.dst_ptr + descriptor.max_dst_size;
+
+    auto input_stream = input_stream_t::builder(source_begin, source_end)
+                                .element_count(descriptor.num_input_elements)
+                                .crc_type(crc_type)
+                                .stream_format(input_format, filter_flags_get_source_1_bit_width(filter_flags))
+                                .build<execution_path_t::software>();
+
+    limited_buffer_t unpack_buffer(buffers.unpack_buffer.begin(), buffers.unpack_buffer.end(),
+                                   static_cast<uint8_t>(input_stream.bit_width()));
+
+    analytic_operation_result_t result {};
+
+    if (QPL_OPCODE_SCAN == opcode) {
+        auto output_stream = output_stream_t<bit_stream>::builder(destination_begin, destination_end)
+                                     .stream_format(output_format)
+                                     .bit_format(out_bit_width_format, bit_bits_size)
+                                     .force_array(is_force_array)
+                                     .nominal(true)
+                                     .initial_output_index(initial_output_index)
+                                     .build<execution_path_t::software>();
+
+        // The device compares with the inclusive range and inverts the bit-vector on request
+        result = (is_inverse) ? call_scan_sw<out_of_range>(input_stream, output_stream, param_low, param_high,
+                                                           unpack_buffer)
+                              : call_scan_sw<in_range>(input_stream, output_stream, param_low, param_high,
+                                                       unpack_buffer);
+    } else {
+        auto output_stream = output_stream_t<array_stream>::builder(destination_begin, destination_end)
+                                     .stream_format(output_format)
+                                     .bit_format(out_bit_width_format, input_stream.bit_width())
+                                     .force_array(is_force_array)
+                                     .nominal(input_stream.bit_width() == bit_bits_size)
+                                     .initial_output_index(initial_output_index)
+                                     .build<execution_path_t::software>();
+
+        if (QPL_OPCODE_EXTRACT == opcode) {
+            result = call_extract<execution_path_t::software>(input_stream, output_stream, param_low, param_high,
+                                                              unpack_buffer);
+        } else {
+            const auto mask_format = (filter_flags & filter_flags_source_2_be) ? stream_format_t::be_format
+                                                                  : stream_format_t::le_format;
+
+            // Select takes a mask bit per source element, expand takes a source element per set mask bit
+            const uint32_t mask_elements = (QPL_OPCODE_SELECT == opcode) ? descriptor.num_input_elements
+                                                                         : descriptor.src2_size * byte_bits_size;
+
+            auto mask_stream = input_stream_t::builder(descriptor.src2_ptr, descriptor.src2_ptr + descriptor.src2_size)
+                                       .element_count(mask_elements)
+                                       .stream_format(mask_format, bit_bits_size)
+                                       .build<execution_path_t::software>();
+
+            limited_buffer_t mask_buffer(buffers.mask_buffer.begin(), buffers.mask_buffer.end(), byte_bits_size);
+            limited_buffer_t output_buffer(buffers.output_buffer.begin(), buffers.output_buffer.end(),
+                                           bit_bits_size);
+
+            result = (QPL_OPCODE_SELECT == opcode)
+                             ? call_select<execution_path_t::software>(input_stream, mask_stream, output_stream,
+                                                                       unpack_buffer, mask_buffer, output_buffer)
+                             : call_expand<execution_path_t::software>(input_stream, mask_stream, output_stream,
+                                                                       unpack_buffer, mask_buffer, output_buffer);
+        }
+    }
+
+    record.bytes_completed = descriptor.src1_size;
+    record.output_size     = result.output_bytes_;
+    record.output_bits     = result.last_bit_offset_;
+    record.xor_checksum    = static_cast<uint16_t>(result.checksums_.xor_);
+    record.crc             = result.checksums_.crc32_;
+    record.min_first_agg   = result.aggregates_.min_value_;
+    record.max_last_agg    = result.aggregates_.max_value_;
+    record.sum_agg         = result.aggregates_.sum_;
+
+    store_operation_status(result.status_code_, record);
+}
+
+/**
+ * @brief Writes the completion record, the status is stored last as the waiting thread polls it
+ */
+static void write_completion_record(uint8_t* completion_record_ptr, const hw_iaa_completion_record& record) noexcept {
+    if (nullptr == completion_record_ptr) { return; }
+
+    auto* const destination_ptr = reinterpret_cast<HW_PATH_VOLATILE hw_iaa_completion_record*>(completion_record_ptr);
+
+    destination_ptr->error_code      = record.error_code;
+    destination_ptr->bytes_completed = record.bytes_completed;
+    destination_ptr->output_size     = record.output_size;
+    destination_ptr->output_bits     = record.output_bits;
+    destination_ptr->xor_checksum    = record.xor_checksum;
+    destination_ptr->crc             = record.crc;
+    destination_ptr->min_first_agg   = record.min_first_agg;
+    destination_ptr->max_last_agg    = record.max_last_agg;
+    destination_ptr->sum_agg         = record.sum_agg;
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    destination_ptr->status = record.status;
+}
+
+auto hw_emulator::work_queue::initialize(uint32_t capacity) noexcept -> bool {
+    entries_  = std::unique_ptr<queue_entry_t[]>(new (std::nothrow) queue_entry_t[capacity]);
+    capacity_ = (entries_) ? capacity : 0U;
+
+    return 0U != capacity_;
+}
+
+auto hw_emulator::work_queue::push(const hw_descriptor& descriptor) noexcept -> bool {
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        if (size_ == capacity_) { return false; }
+
+        auto& entry       = entries_[(head_ + size_) % capacity_];
+        entry.descriptor  = descriptor;
+        entry.submit_time = clock_t::now();
+        size_++;
+    }
+
+    condition_.notify_one();
+
+    return true;
+}
+
+auto hw_emulator::work_queue::pop(queue_entry_t& entry) noexcept -> bool {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    condition_.wait(lock, [this]() { return is_stopped_ || 0U != size_; });
+
+    if (0U == size_) { return false; }
+
+    entry = entries_[head_];
+    head_ = (head_ + 1U) % capacity_;
+    size_--;
+
+    return true;
+}
+
+void hw_emulator::work_queue::stop() noexcept {
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        is_stopped_ = true;
+    }
+
+    condition_.notify_all();
+}
+
+hw_emulator::hw_emulator() noexcept {
+    configuration_.queue_count = read_configuration_value("QPL_HW_EMULATION_WQ_COUNT", configuration_.queue_count);
+    configuration_.queue_size  = read_configuration_value("QPL_HW_EMULATION_WQ_SIZE", configuration_.queue_size);
+    configuration_.latency_ns  = read_configuration_value("QPL_HW_EMULATION_LATENCY_NS", configuration_.latency_ns);
+    configuration_.throughput_mbps =
+            read_configuration_value("QPL_HW_EMULATION_THROUGHPUT_MBPS", configuration_.throughput_mbps);
+
+    configuration_.queue_count = std::min<uint32_t>(configuration_.queue_count, MAX_NUM_WQ);
+
+    if (0U == configuration_.queue_count || 0U == configuration_.queue_size) { return; }
+
+    queues_ = std::unique_ptr<work_queue[]>(new (std::nothrow) work_queue[configuration_.queue_count]);
+
+    // Without queues the emulated device has no work queues and is not used
+    if (!queues_) { return; }
+
+    for (uint32_t i = 0U; i < configuration_.queue_count; i++) {
+        if (!queues_[i].initialize(configuration_.queue_size)) { return; }
+    }
+
+    queue_count_ = configuration_.queue_count;
+    engines_.reserve(queue_count_);
+
+    for (uint32_t i = 0U; i < queue_count_; i++) {
+        engines_.emplace_back(&hw_emulator::engine_loop, this, i);
+    }
+}
+
+hw_emulator::~hw_emulator() noexcept {
+    for (uint32_t i = 0U; i < queue_count_; i++) {
+        queues_[i].stop();
+    }
+
+    for (auto& engine : engines_) {
+        engine.join();
+    }
+}
+
+auto hw_emulator::get_instance() noexcept -> hw_emulator& {
+    static hw_emulator instance {};
+    return instance;
+}
+
+auto hw_emulator::queue_count() const noexcept -> uint32_t {
+    return queue_count_;
+}
+
+auto hw_emulator::queue_size() const noexcept -> uint32_t {
+    return configuration_.queue_size;
+}
+
+auto hw_emulator::enqueue_descriptor(uint32_t queue_index, const void* desc_ptr) noexcept -> qpl_status {
+    if (queue_index >= queue_count_) { return QPL_STS_INIT_HW_NOT_SUPPORTED; }
+
+    const bool is_accepted = queues_[queue_index].push(*static_cast<const hw_descriptor*>(desc_ptr));
+
+    return (is_accepted) ? QPL_STS_OK : QPL_STS_QUEUES_ARE_BUSY_ERR;
+}
+
+void hw_emulator::engine_loop(uint32_t queue_index) noexcept {
+    auto& queue = queues_[queue_index];
+
+    const auto latency = std::chrono::nanoseconds(configuration_.latency_ns);
+
+    clock_t::time_point engine_free_time {};
+    queue_entry_t       entry {};
+
+    while (queue.pop(entry)) {
+        const auto& descriptor = reinterpret_cast<const hw_decompress_analytics_descriptor&>(entry.descriptor);
+        const auto  opcode     = ADOF_GET_OPCODE(descriptor.op_code_op_flags);
+
+        hw_iaa_completion_record record {};
+
+        switch (opcode) {
+            case QPL_OPCODE_NOOP: record.status = AD_STATUS_SUCCESS; break;
+            case QPL_OPCODE_CRC64: emulate_crc64(descriptor, record); break;
+            case QPL_OPCODE_SCAN:
+            case QPL_OPCODE_EXTRACT:
+            case QPL_OPCODE_SELECT:
+            case QPL_OPCODE_EXPAND: emulate_filter(descriptor, opcode, queue.buffers(), record); break;
+            default: record.status = AD_STATUS_UNSUPPORTED_OPCODE;
+        }
+
+        // The engine processes descriptors one by one, the source transfer starts when the previous one is done
+        auto completion_time = std::max(entry.submit_time + latency, engine_free_time);
+
+        if (0U != configuration_.throughput_mbps) {
+            completion_time += std::chrono::nanoseconds(static_cast<uint64_t>(descriptor.src1_size) * 1000U /
+                                                        configuration_.throughput_mbps);
+        }
+
+        if (completion_time - clock_t::now() > emulator_spin_threshold) {
+            std::this_thread::sleep_until(completion_time - emulator_spin_threshold);
+        }
+
+        while (clock_t::now() < completion_time) {
+            std::this_thread::yield();
+        }
+
+        write_completion_record(descriptor.completion_record_ptr, record);
+
+        engine_free_time = std::max(completion_time, clock_t::now());
+    }
+}
+
+} // namespace qpl::ml::dispatcher
+
+#endif //QPL_HW_EMULATION
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
+
+#if defined(QPL_HW_EMULATION)
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "qpl/c_api/status.h"
+
+#include "hw_definitions.h"
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief Parameters of the emulated device, the defaults are overridden with the environment variables
+ *        QPL_HW_EMULATION_WQ_COUNT, QPL_HW_EMULATION_WQ_SIZE, QPL_HW_EMULATION_LATENCY_NS
+ *        and QPL_HW_EMULATION_THROUGHPUT_MBPS read at the device initialization
+ */
+struct hw_emulator_configuration_t {
+    uint32_t queue_count     = 2U;    /**< Number of work queues, every queue is served by its own engine thread */
+    uint32_t queue_size      = 32U;   /**< Number of descriptors a work queue accepts before reporting retry */
+    uint32_t latency_ns      = 1000U; /**< Time from the submission to the earliest completion of a descriptor */
+    uint32_t throughput_mbps = 0U;    /**< Source throughput of an engine in MB/s, 0 is unlimited */
+};
+
+/**
+ * @brief In-process replacement of the Intel® In-Memory Analytics Accelerator (Intel® IAA) device
+ *
+ * Work queues accept the same 64-byte descriptors as the device portals. Every queue is served by an engine
+ * thread that interprets the descriptors with the software path kernels, holds the result until the configured
+ * latency and throughput allow the descriptor to complete and then writes the completion record with the status
+ * stored last, as the device does. The engine supports the NOOP and CRC64 operations and the filter operations
+ * on uncompressed input, with the filter parameters taken from the AECS if the descriptor points to one.
+ * Compression, decompression and filter descriptors with decompression of the input are not emulated, they
+ * complete with the unsupported opcode status, which the auto path handles by the host fallback.
+ */
+class hw_emulator final {
+public:
+    static auto get_instance() noexcept -> hw_emulator&;
+
+    [[nodiscard]] auto queue_count() const noexcept -> uint32_t;
+
+    [[nodiscard]] auto queue_size() const noexcept -> uint32_t;
+
+    /**
+     * @brief Copies the descriptor into the work queue, returns QPL_STS_QUEUES_ARE_BUSY_ERR if the queue is full
+     */
+    [[nodiscard]] auto enqueue_descriptor(uint32_t queue_index, const void* desc_ptr) noexcept -> qpl_status;
+
+    ~hw_emulator() noexcept;
+
+protected:
+    hw_emulator() noexcept;
+
+private:
+    using clock_t = std::chrono::steady_clock;
+
+    /**
+     * @brief Maximal number of elements unpacked by the filter operations at once
+     */
+    static constexpr uint32_t max_unpacked_elements = 4096U;
+
+    /**
+     * @brief Buffer sizes are rounded up to the cache line as in the job analytics state, the filter kernels
+     *        process the source in parts of the buffer capacity and expect the parts to end on a byte boundary
+     */
+    static constexpr uint32_t unpack_buffer_size = ((max_unpacked_elements + 1U) * sizeof(uint32_t) + 63U) & ~63U;
+    static constexpr uint32_t mask_buffer_size   = max_unpacked_elements * sizeof(uint32_t);
+    static constexpr uint32_t output_buffer_size = 1U << 15U;
+
+    struct queue_entry_t {
+        hw_descriptor       descriptor;
+        clock_t::time_point submit_time;
+    };
+
+    /**
+     * @brief Staging buffers of an engine for the filter operations
+     */
+    struct engine_buffers_t {
+        alignas(64U) std::array<uint8_t, unpack_buffer_size> unpack_buffer;
+        alignas(64U) std::array<uint8_t, mask_buffer_size> mask_buffer;
+        alignas(64U) std::array<uint8_t, output_buffer_size> output_buffer;
+    };
+
+    class work_queue final {
+    public:
+        auto initialize(uint32_t capacity) noexcept -> bool;
+
+        auto push(const hw_descriptor& descriptor) noexcept -> bool;
+
+        /**
+         * @brief Waits for the next descriptor, returns false if the queue is stopped
+         */
+        auto pop(queue_entry_t& entry) noexcept -> bool;
+
+        void stop() noexcept;
+
+        [[nodiscard]] auto buffers() noexcept -> engine_buffers_t& { return buffers_; }
+
+    private:
+        std::mutex                       mutex_;
+        std::condition_variable          condition_;
+        std::unique_ptr<queue_entry_t[]> entries_    = nullptr;
+        uint32_t                         capacity_   = 0U;
+        uint32_t                         head_       = 0U;
+        uint32_t                         size_       = 0U;
+        bool                             is_stopped_ = false;
+        engine_buffers_t                 buffers_ {};
+    };
+
+    void engine_loop(uint32_t queue_index) noexcept;
+
+    hw_emulator_configuration_t   configuration_ {};
+    uint32_t                      queue_count_ = 0U;
+    std::unique_ptr<work_queue[]> queues_      = nullptr;
+    std::vector<std::thread>      engines_;
+};
+
+} // namespace qpl::ml::dispatcher
+
+#endif //QPL_HW_EMULATION
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
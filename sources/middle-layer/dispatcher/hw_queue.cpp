@@ -8,6 +8,8 @@
 
 #include "hw_queue.hpp"
 
+#include <algorithm>
+#include <cinttypes>
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/types.h> // write return type
@@ -29,6 +31,10 @@
 #include "util/hw_timing_util.hpp"
 #endif //QPL_LOG_IAA_TIME
 
+#if defined(QPL_HW_EMULATION)
+#include "hw_emulator.hpp"
+#endif //QPL_HW_EMULATION
+
 #define QPL_HWSTS_RET(expr, err_code)    \
     {                                    \
         if (expr) { return (err_code); } \
@@ -45,7 +51,14 @@ hw_queue::hw_queue(hw_queue&& other) noexcept
     , op_cfg_enabled_(other.op_cfg_enabled_)
     , op_cfg_register_(other.op_cfg_register_)
     , mmap_done_(other.mmap_done_)
-    , fd_(other.fd_) {
+    , fd_(other.fd_)
+    , size_(other.size_)
+    , max_transfer_size_(other.max_transfer_size_)
+    , busy_mark_(0)
+#if defined(QPL_HW_EMULATION)
+    , emulated_queue_index_(other.emulated_queue_index_)
+#endif
+{
 
     // to avoid close/freeing resources in the destructor twice
     other.fd_         = -1;
@@ -54,15 +67,21 @@ hw_queue::hw_queue(hw_queue&& other) noexcept
 
 auto hw_queue::operator=(hw_queue&& other) noexcept -> hw_queue& {
     if (this != &other) {
-        block_on_fault_  = other.block_on_fault_;
-        priority_        = other.priority_;
-        portal_mask_     = other.portal_mask_;
-        portal_ptr_      = other.portal_ptr_;
-        portal_offset_   = 0;
-        op_cfg_enabled_  = other.op_cfg_enabled_;
-        op_cfg_register_ = other.op_cfg_register_;
-        mmap_done_       = other.mmap_done_;
-        fd_              = other.fd_;
+        block_on_fault_    = other.block_on_fault_;
+        priority_          = other.priority_;
+        portal_mask_       = other.portal_mask_;
+        portal_ptr_        = other.portal_ptr_;
+        portal_offset_     = 0;
+        op_cfg_enabled_    = other.op_cfg_enabled_;
+        op_cfg_register_   = other.op_cfg_register_;
+        mmap_done_         = other.mmap_done_;
+        fd_                = other.fd_;
+        size_              = other.size_;
+        max_transfer_size_ = other.max_transfer_size_;
+        busy_mark_         = 0;
+#if defined(QPL_HW_EMULATION)
+        emulated_queue_index_ = other.emulated_queue_index_;
+#endif
 
         // to avoid close/freeing resources in the destructor twice
         other.fd_         = -1;
@@ -112,6 +131,10 @@ auto hw_queue::get_portal_ptr() const noexcept -> void* {
  *         if the enqueue failed.
  */
 auto hw_queue::enqueue_descriptor(void* desc_ptr) const noexcept -> qpl_status {
+#if defined(QPL_HW_EMULATION)
+    return hw_emulator::get_instance().enqueue_descriptor(emulated_queue_index_, desc_ptr);
+#endif
+
     if (is_wq_mmaped()) {
         uint8_t retry = 0U; //NOLINT(misc-const-correctness)
 
@@ -239,8 +262,10 @@ auto hw_queue::initialize_new_queue(void* wq_descriptor_ptr) noexcept -> hw_acce
     }
     DIAGA("\n");
 
-    priority_       = accfg_wq_get_priority(work_queue_ptr);
-    block_on_fault_ = accfg_wq_get_block_on_fault(work_queue_ptr);
+    priority_          = accfg_wq_get_priority(work_queue_ptr);
+    block_on_fault_    = accfg_wq_get_block_on_fault(work_queue_ptr);
+    size_              = static_cast<uint32_t>(accfg_wq_get_size(work_queue_ptr));
+    max_transfer_size_ = accfg_wq_get_max_transfer_size(work_queue_ptr);
 
     accfg_op_config op_cfg;
     int32_t get_op_cfg_status = accfg_wq_get_op_config(work_queue_ptr, &op_cfg); //NOLINT(misc-const-correctness)
@@ -273,6 +298,8 @@ auto hw_queue::initialize_new_queue(void* wq_descriptor_ptr) noexcept -> hw_acce
 #else
     DIAG("     %7s: priority:    %d\n", work_queue_dev_name, priority_);
     DIAG("     %7s: bof:         %d\n", work_queue_dev_name, block_on_fault_);
+    DIAG("     %7s: size:        %" PRIu32 "\n", work_queue_dev_name, size_);
+    DIAG("     %7s: max size:    %" PRIu64 "\n", work_queue_dev_name, max_transfer_size_);
     DIAG("     %7s: fd:          %d\n", work_queue_dev_name, fd_);
 #endif
 
@@ -281,6 +308,26 @@ auto hw_queue::initialize_new_queue(void* wq_descriptor_ptr) noexcept -> hw_acce
     return HW_ACCELERATOR_STATUS_OK;
 }
 
+#if defined(QPL_HW_EMULATION)
+/**
+ * @brief Binds the queue to a work queue of the emulated device, the descriptors are submitted without a portal.
+ */
+auto hw_queue::initialize_emulated_queue(uint32_t emulated_queue_index) noexcept -> hw_accelerator_status {
+    emulated_queue_index_ = emulated_queue_index;
+    priority_             = 0;
+    block_on_fault_       = false;
+    op_cfg_enabled_       = false;
+    mmap_done_            = false;
+    fd_                   = -1;
+    size_                 = hw_emulator::get_instance().queue_size();
+    max_transfer_size_    = 0U;
+
+    DIAG("     emulated wq%" PRIu32 "\n", emulated_queue_index);
+
+    return HW_ACCELERATOR_STATUS_OK;
+}
+#endif //QPL_HW_EMULATION
+
 auto hw_queue::priority() const noexcept -> int32_t {
     return priority_;
 }
@@ -289,6 +336,28 @@ auto hw_queue::get_block_on_fault() const noexcept -> bool {
     return block_on_fault_;
 }
 
+auto hw_queue::get_size() const noexcept -> uint32_t {
+    return size_;
+}
+
+auto hw_queue::get_max_transfer_size() const noexcept -> uint64_t {
+    return max_transfer_size_;
+}
+
+/**
+ * @brief Retry means the shared WQ is full, the WQ is expected to be occupied until the device accepts
+ * as many descriptors as the WQ holds, descriptors accepted by the other WQs are used as a measure of that time.
+ */
+auto hw_queue::is_congested(uint64_t submission_index) const noexcept -> bool {
+    const uint64_t busy_mark = busy_mark_.load(std::memory_order_relaxed);
+
+    return 0U != busy_mark && submission_index + 1U - busy_mark < std::max(size_, 1U);
+}
+
+void hw_queue::mark_busy(uint64_t submission_index) const noexcept {
+    busy_mark_.store(submission_index + 1U, std::memory_order_relaxed);
+}
+
 auto hw_queue::get_op_configuration_support() const noexcept -> bool {
     return op_cfg_enabled_;
 }
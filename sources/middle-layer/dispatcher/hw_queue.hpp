@@ -36,6 +36,10 @@ public:
 
     auto initialize_new_queue(descriptor_t* wq_descriptor_ptr) noexcept -> hw_accelerator_status;
 
+#if defined(QPL_HW_EMULATION)
+    auto initialize_emulated_queue(uint32_t emulated_queue_index) noexcept -> hw_accelerator_status;
+#endif
+
     [[nodiscard]] auto get_portal_ptr() const noexcept -> void*;
 
     [[nodiscard]] auto enqueue_descriptor(void* desc_ptr) const noexcept -> qpl_status;
@@ -44,6 +48,17 @@ public:
 
     [[nodiscard]] auto get_block_on_fault() const noexcept -> bool;
 
+    [[nodiscard]] auto get_size() const noexcept -> uint32_t;
+
+    [[nodiscard]] auto get_max_transfer_size() const noexcept -> uint64_t;
+
+    /**
+     * @brief Checks if the WQ reported retry within the last WQ size submissions to the device
+     */
+    [[nodiscard]] auto is_congested(uint64_t submission_index) const noexcept -> bool;
+
+    void mark_busy(uint64_t submission_index) const noexcept;
+
     [[nodiscard]] auto get_op_configuration_support() const noexcept -> bool;
 
     [[nodiscard]] auto get_op_config_register() const noexcept -> op_config_register_t;
@@ -57,15 +72,21 @@ public:
     virtual ~hw_queue() noexcept;
 
 private:
-    bool                          block_on_fault_  = false;
-    int32_t                       priority_        = 0U;
-    uint64_t                      portal_mask_     = 0U; /**< Mask for incrementing portals */
-    mutable void*                 portal_ptr_      = nullptr;
-    mutable std::atomic<uint64_t> portal_offset_   = 0U; /**< Portal for enqcmd (mod page size)*/
-    bool                          op_cfg_enabled_  = false;
-    op_config_register_t          op_cfg_register_ = {};    /**< OPCFG register content */
-    bool                          mmap_done_       = false; /**< Flag to check whether mmap happened */
-    int                           fd_              = -1;    /**< File descriptor for submission via write */
+    bool                          block_on_fault_    = false;
+    int32_t                       priority_          = 0U;
+    uint64_t                      portal_mask_       = 0U; /**< Mask for incrementing portals */
+    mutable void*                 portal_ptr_        = nullptr;
+    mutable std::atomic<uint64_t> portal_offset_     = 0U; /**< Portal for enqcmd (mod page size)*/
+    bool                          op_cfg_enabled_    = false;
+    op_config_register_t          op_cfg_register_   = {};    /**< OPCFG register content */
+    bool                          mmap_done_         = false; /**< Flag to check whether mmap happened */
+    int                           fd_                = -1;    /**< File descriptor for submission via write */
+    uint32_t                      size_              = 0U;    /**< Number of descriptors the WQ holds */
+    uint64_t                      max_transfer_size_ = 0U;    /**< Maximal descriptor source size, 0 if unlimited */
+    mutable std::atomic<uint64_t> busy_mark_         = 0U;    /**< Device submission index of the last retry */
+#if defined(QPL_HW_EMULATION)
+    uint32_t emulated_queue_index_ = 0U; /**< Index of the work queue of the emulated device */
+#endif
 };
 
 } // namespace qpl::ml::dispatcher
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_QUEUE_ORDER_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_QUEUE_ORDER_HPP_
+
+#include <cstdint>
+
+/* The scheduling policy doesn't depend on the device, so it is kept header-only and checked by the unit tests. */
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief Maximal source size of a descriptor that is treated as latency-sensitive by the scheduler
+ */
+static constexpr uint64_t latency_sensitive_transfer_size = 64U * 1024U;
+
+/**
+ * @brief Work queue properties taken into account by the descriptor scheduler
+ */
+struct hw_queue_candidate_t {
+    int32_t  priority;          /**< WQ priority, the device serves the higher priority WQs first */
+    uint64_t max_transfer_size; /**< Maximal source size of a descriptor, 0 if unlimited */
+    bool     is_supported;      /**< Operation is enabled for the WQ */
+    bool     is_congested;      /**< WQ reported retry recently */
+};
+
+/**
+ * @brief Orders the WQs for a descriptor submission and returns the number of WQs to try.
+ *
+ * WQs that do not support the operation or the transfer size are skipped, congested WQs are tried last.
+ * Latency-sensitive descriptors try the higher priority WQs first, larger descriptors try the lower priority
+ * WQs first to keep the higher priority WQs available. WQs with the same properties are tried starting
+ * from the start index.
+ */
+inline auto order_work_queues(const hw_queue_candidate_t* candidates_ptr, uint32_t candidate_count,
+                              uint64_t transfer_size, uint32_t start_index, uint32_t* order_ptr) noexcept -> uint32_t {
+    const bool is_latency_sensitive = transfer_size <= latency_sensitive_transfer_size;
+
+    // Returns true if the WQ lhs should be tried before the WQ rhs
+    const auto is_preferred = [&](uint32_t lhs, uint32_t rhs) -> bool {
+        const hw_queue_candidate_t& lhs_queue = candidates_ptr[lhs];
+        const hw_queue_candidate_t& rhs_queue = candidates_ptr[rhs];
+
+        if (lhs_queue.is_congested != rhs_queue.is_congested) { return rhs_queue.is_congested; }
+
+        if (lhs_queue.priority != rhs_queue.priority) {
+            return (is_latency_sensitive) ? lhs_queue.priority > rhs_queue.priority
+                                          : lhs_queue.priority < rhs_queue.priority;
+        }
+
+        return false;
+    };
+
+    uint32_t order_count = 0U;
+
+    for (uint32_t i = 0U; i < candidate_count; i++) {
+        const uint32_t              wq_idx = (start_index + i) % candidate_count;
+        const hw_queue_candidate_t& queue  = candidates_ptr[wq_idx];
+
+        if (!queue.is_supported) { continue; }
+        if (0U != queue.max_transfer_size && transfer_size > queue.max_transfer_size) { continue; }
+
+        // Insertion keeps the rotation order for the WQs with the same properties
+        uint32_t position = order_count++;
+        for (; position > 0U && is_preferred(wq_idx, order_ptr[position - 1U]); position--) {
+            order_ptr[position] = order_ptr[position - 1U];
+        }
+        order_ptr[position] = wq_idx;
+    }
+
+    return order_count;
+}
+
+} // namespace qpl::ml::dispatcher
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_QUEUE_ORDER_HPP_
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#include "sw_executor.hpp"
+
+#include <algorithm>
+#include <new>
+
+#if !defined(__linux__)
+#include <system_error>
+#endif
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief Index of the queue owned by the current thread, external threads do not own a queue
+ */
+static thread_local uint32_t own_worker_index = UINT32_MAX;
+
+auto sw_executor::task_queue::push(task_t task) noexcept -> bool {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    if (size_ == queue_capacity) { return false; }
+
+    tasks_[(head_ + size_) % queue_capacity] = task;
+    size_++;
+
+    return true;
+}
+
+auto sw_executor::task_queue::pop(task_t& task) noexcept -> bool {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    if (size_ == 0U) { return false; }
+
+    task  = tasks_[head_];
+    head_ = (head_ + 1U) % queue_capacity;
+    size_--;
+
+    return true;
+}
+
+auto sw_executor::start_worker(sw_executor* executor_ptr, worker_t& worker) noexcept -> bool {
+#if defined(__linux__)
+    // Failure is reported by the return code, std::thread would throw or terminate without exceptions
+    auto entry = [](void* argument) -> void* {
+        auto* self_ptr = static_cast<sw_executor*>(argument);
+
+        self_ptr->worker_loop(self_ptr->started_workers_.fetch_add(1U));
+
+        return nullptr;
+    };
+
+    return 0 == pthread_create(&worker, nullptr, entry, executor_ptr);
+#else
+    try {
+        worker = std::thread(
+                [executor_ptr]() { executor_ptr->worker_loop(executor_ptr->started_workers_.fetch_add(1U)); });
+    } catch (const std::system_error&) { return false; }
+
+    return true;
+#endif
+}
+
+void sw_executor::join_worker(worker_t& worker) noexcept {
+#if defined(__linux__)
+    pthread_join(worker, nullptr);
+#else
+    worker.join();
+#endif
+}
+
+sw_executor::sw_executor() noexcept {
+    const uint32_t max_worker_count = std::max(std::thread::hardware_concurrency(), 1U);
+
+    queues_  = std::unique_ptr<task_queue[]>(new (std::nothrow) task_queue[max_worker_count]);
+    workers_ = std::unique_ptr<worker_t[]>(new (std::nothrow) worker_t[max_worker_count]);
+
+    // Without queues every task is rejected and executed by the submitting thread
+    if (!queues_ || !workers_) { return; }
+
+    uint32_t worker_count = 0U;
+
+    while (worker_count < max_worker_count && start_worker(this, workers_[worker_count])) {
+        worker_count++;
+    }
+
+    {
+        // Started workers wait for the final number of workers before they look into the queues
+        const std::lock_guard<std::mutex> lock(sleep_mutex_);
+        worker_count_ = worker_count;
+        is_started_   = true;
+    }
+
+    sleep_condition_.notify_all();
+}
+
+sw_executor::~sw_executor() noexcept {
+    {
+        const std::lock_guard<std::mutex> lock(sleep_mutex_);
+        is_stopped_ = true;
+    }
+
+    sleep_condition_.notify_all();
+
+    for (uint32_t i = 0U; i < worker_count_; i++) {
+        join_worker(workers_[i]);
+    }
+}
+
+auto sw_executor::get_instance() noexcept -> sw_executor& {
+    static sw_executor instance {};
+    return instance;
+}
+
+auto sw_executor::worker_count() const noexcept -> uint32_t {
+    return worker_count_;
+}
+
+auto sw_executor::submit(task_t task) noexcept -> bool {
+    if (0U == worker_count_) { return false; }
+
+    const uint32_t first_queue = (own_worker_index < worker_count_) ? own_worker_index
+                                                                    : next_queue_.fetch_add(1U) % worker_count_;
+
+    {
+        // Counter is updated under the lock, so a worker going to sleep can't miss the task
+        const std::lock_guard<std::mutex> lock(sleep_mutex_);
+
+        // Stopped executor doesn't accept new tasks, the caller executes them in place
+        if (is_stopped_) { return false; }
+
+        pending_tasks_.fetch_add(1U);
+    }
+
+    for (uint32_t i = 0U; i < worker_count_; i++) {
+        if (queues_[(first_queue + i) % worker_count_].push(task)) {
+            sleep_condition_.notify_one();
+
+            return true;
+        }
+    }
+
+    pending_tasks_.fetch_sub(1U);
+
+    return false;
+}
+
+auto sw_executor::take_task(uint32_t first_queue, task_t& task) noexcept -> bool {
+    for (uint32_t i = 0U; i < worker_count_; i++) {
+        if (queues_[(first_queue + i) % worker_count_].pop(task)) {
+            pending_tasks_.fetch_sub(1U);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+auto sw_executor::run_pending_task() noexcept -> bool {
+    if (0U == worker_count_ || 0U == pending_tasks_.load()) { return false; }
+
+    task_t task;
+
+    if (!take_task(next_queue_.load() % worker_count_, task)) { return false; }
+
+    task.function(task.argument);
+
+    return true;
+}
+
+void sw_executor::worker_loop(uint32_t worker_index) noexcept {
+    own_worker_index = worker_index;
+
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+
+        sleep_condition_.wait(lock, [this]() { return is_started_; });
+    }
+
+    while (true) {
+        task_t task;
+
+        // Own queue is checked first, then the tasks are stolen from the other workers
+        if (take_task(worker_index, task)) {
+            task.function(task.argument);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+
+        sleep_condition_.wait(lock, [this]() { return is_stopped_ || 0U != pending_tasks_.load(); });
+
+        // Tasks accepted before the stop are finished, so every submitted job gets its final status
+        if (is_stopped_ && 0U == pending_tasks_.load()) { return; }
+    }
+}
+
+} // namespace qpl::ml::dispatcher
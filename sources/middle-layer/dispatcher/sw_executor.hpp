@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_SW_EXECUTOR_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_SW_EXECUTOR_HPP_
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief Pool of host threads that executes software path jobs asynchronously
+ *
+ * Every worker owns a bounded task queue. A task is placed into the queue of the submitting worker
+ * (or into the next queue in round-robin order for external threads), an idle worker steals tasks
+ * from the queues of other workers.
+ *
+ * Workers that can't be started are skipped, the executor runs with fewer workers or rejects all tasks.
+ * On destruction the tasks that are already queued are executed before the workers are joined,
+ * so every accepted task is run to completion.
+ */
+class sw_executor final {
+public:
+    using task_function_t = void (*)(void*);
+
+    struct task_t {
+        task_function_t function = nullptr;
+        void*           argument = nullptr;
+    };
+
+    static constexpr uint32_t queue_capacity = 256U;
+
+    static auto get_instance() noexcept -> sw_executor&;
+
+    /**
+     * @brief Enqueues the task, returns false if all queues are full and the task shall be executed by the caller
+     */
+    [[nodiscard]] auto submit(task_t task) noexcept -> bool;
+
+    /**
+     * @brief Executes one of the enqueued tasks on the calling thread, returns false if there are no tasks
+     */
+    auto run_pending_task() noexcept -> bool;
+
+    /**
+     * @brief Runs the lane function for every lane and returns once all of them are done
+     *
+     * Lanes 1 and above are enqueued, lane 0 and the lanes that can't be enqueued are run by the calling thread.
+     * The calling thread then helps with the pending tasks rather than waits, as it may be an executor worker itself.
+     */
+    template <class lane_t>
+    void parallel_for(lane_t* lanes_ptr, uint32_t lane_count, void (*lane_function)(lane_t&)) noexcept;
+
+    [[nodiscard]] auto worker_count() const noexcept -> uint32_t;
+
+    ~sw_executor() noexcept;
+
+protected:
+    sw_executor() noexcept;
+
+private:
+#if defined(__linux__)
+    using worker_t = pthread_t;
+#else
+    using worker_t = std::thread;
+#endif
+
+    static auto start_worker(sw_executor* executor_ptr, worker_t& worker) noexcept -> bool;
+
+    static void join_worker(worker_t& worker) noexcept;
+
+    class task_queue final {
+    public:
+        auto push(task_t task) noexcept -> bool;
+
+        auto pop(task_t& task) noexcept -> bool;
+
+    private:
+        std::mutex                          mutex_;
+        std::array<task_t, queue_capacity> tasks_ {};
+        uint32_t                            head_ = 0U;
+        uint32_t                            size_ = 0U;
+    };
+
+    void worker_loop(uint32_t worker_index) noexcept;
+
+    auto take_task(uint32_t first_queue, task_t& task) noexcept -> bool;
+
+    uint32_t                      worker_count_ = 0U;
+    std::unique_ptr<task_queue[]> queues_       = nullptr;
+    std::unique_ptr<worker_t[]>   workers_      = nullptr;
+    std::atomic<uint32_t>         started_workers_ = 0U;
+    std::atomic<uint32_t>         next_queue_      = 0U;
+    std::atomic<uint32_t>         pending_tasks_   = 0U;
+    std::mutex                    sleep_mutex_;
+    std::condition_variable       sleep_condition_;
+    bool                          is_started_ = false;
+    bool                          is_stopped_ = false;
+};
+
+template <class lane_t>
+void sw_executor::parallel_for(lane_t* lanes_ptr, uint32_t lane_count, void (*lane_function)(lane_t&)) noexcept {
+    struct lane_task_t {
+        void (*function)(lane_t&)           = nullptr;
+        lane_t*                lane_ptr         = nullptr;
+        std::atomic<uint32_t>* active_lanes_ptr = nullptr;
+    };
+
+    const task_function_t run_lane_task = [](void* argument) noexcept {
+        auto* const task_ptr = static_cast<lane_task_t*>(argument);
+
+        task_ptr->function(*task_ptr->lane_ptr);
+        task_ptr->active_lanes_ptr->fetch_sub(1U, std::memory_order_release);
+    };
+
+    std::atomic<uint32_t> active_lanes {0U};
+
+    // Without the task list every lane is run by the calling thread
+    std::unique_ptr<lane_task_t[]> tasks((lane_count > 1U) ? new (std::nothrow) lane_task_t[lane_count] : nullptr);
+
+    for (uint32_t i = 1U; i < lane_count; i++) {
+        if (nullptr != tasks) {
+            tasks[i] = {lane_function, &lanes_ptr[i], &active_lanes};
+            active_lanes.fetch_add(1U, std::memory_order_relaxed);
+
+            if (submit({run_lane_task, &tasks[i]})) { continue; }
+
+            active_lanes.fetch_sub(1U, std::memory_order_relaxed);
+        }
+
+        lane_function(lanes_ptr[i]);
+    }
+
+    if (0U != lane_count) { lane_function(lanes_ptr[0]); }
+
+    while (0U != active_lanes.load(std::memory_order_acquire)) {
+        if (!run_pending_task()) { std::this_thread::yield(); }
+    }
+}
+
+} // namespace qpl::ml::dispatcher
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_SW_EXECUTOR_HPP_
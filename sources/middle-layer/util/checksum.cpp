@@ -37,4 +37,43 @@ auto adler32(const uint8_t* const begin, uint32_t size, uint32_t seed) noexcept
     return (old_adler32 & most_significant_16_bits) | new_adler32;
 }
 
+/**
+ * @brief Multiplies two polynomials modulo the reflected CRC32 (gzip) polynomial
+ */
+static inline auto crc32_gzip_multiply(uint32_t a, uint32_t b) noexcept -> uint32_t {
+    constexpr uint32_t polynomial = 0xEDB88320U;
+
+    uint32_t product = 0U;
+
+    for (uint32_t mask = 1U << 31U; mask != 0U; mask >>= 1U) {
+        if (a & mask) { product ^= b; }
+
+        b = (b & 1U) ? (b >> 1U) ^ polynomial : b >> 1U;
+    }
+
+    return product;
+}
+
+/**
+ * @brief function to compute CRC32 (gzip) of two concatenated streams from their CRCs.
+ *
+ * The CRC of the first stream is shifted over `second_size` zero bytes (multiplied by x^(8 * second_size)
+ * in GF(2)) and then added to the CRC of the second stream, so no data needs to be read again.
+ *
+ * @note `first_crc` may be also used as a seed, i.e. the result is equal to
+ * crc32_gzip(second_stream, seed = first_crc).
+ */
+auto crc32_gzip_combine(uint32_t first_crc, uint32_t second_crc, uint32_t second_size) noexcept -> uint32_t {
+    uint32_t power  = 1U << 23U; // x^8 in the reflected representation
+    uint32_t factor = 1U << 31U; // x^0
+
+    for (uint32_t size = second_size; size != 0U; size >>= 1U) {
+        if (size & 1U) { factor = crc32_gzip_multiply(power, factor); }
+
+        power = crc32_gzip_multiply(power, power);
+    }
+
+    return crc32_gzip_multiply(factor, first_crc) ^ second_crc;
+}
+
 } // namespace qpl::ml::util
@@ -50,12 +50,16 @@ inline uint32_t bit_width_to_bits(const uint32_t value) noexcept {
         return byte_bits_size;
     } else if (value > 8U && value <= 16U) {
         return short_bits_size;
+    } else if (value > int_bits_size) {
+        return long_bits_size;
     } else {
         return int_bits_size;
     }
 }
 
 inline uint32_t bit_width_to_bytes(const uint32_t value) noexcept {
+    if (value > int_bits_size) { return long_bits_size / byte_bits_size; }
+
     return std::min(1U << ((value - 1U) >> 3U), 4U);
 }
 
@@ -82,4 +82,89 @@ static inline auto split_data(const data_t& data, std::size_t block_size) {
 
     return blocks;
 }
+
+/**
+ * Reads the first elements_count values of bit_width bits from the little-endian packed buffer
+ */
+static inline std::vector<std::uint32_t> unpack_le(const std::vector<std::uint8_t>& buffer, std::uint32_t bit_width,
+                                                   std::uint32_t elements_count) {
+    std::vector<std::uint32_t> elements(elements_count);
+    const std::uint64_t        mask = (1ULL << bit_width) - 1U;
+
+    for (std::uint32_t idx = 0U; idx < elements_count; ++idx) {
+        const std::uint64_t bit_position = static_cast<std::uint64_t>(idx) * bit_width;
+        std::uint64_t       value        = 0U;
+
+        for (std::uint32_t byte = 0U; byte < 5U && (bit_position >> 3U) + byte < buffer.size(); ++byte) {
+            value |= static_cast<std::uint64_t>(buffer[(bit_position >> 3U) + byte]) << (byte * 8U);
+        }
+        elements[idx] = static_cast<std::uint32_t>((value >> (bit_position & 7U)) & mask);
+    }
+
+    return elements;
+}
+
+/**
+ * Encodes elements into the Parquet RLE stream: runs of at least 8 equal values are stored as RLE runs,
+ * the rest is stored as bit-packed groups of 8 elements. The number of elements must be a multiple of 8.
+ */
+static inline std::vector<std::uint8_t> pack_prle(const std::vector<std::uint32_t>& elements,
+                                                  std::uint32_t                     bit_width) {
+    static constexpr std::uint32_t group_size = 8U;
+
+    std::vector<std::uint8_t> stream {static_cast<std::uint8_t>(bit_width)};
+
+    auto store_header = [&stream](std::uint32_t header) {
+        while (header > 0x7FU) {
+            stream.push_back(static_cast<std::uint8_t>((header & 0x7FU) | 0x80U));
+            header >>= 7U;
+        }
+        stream.push_back(static_cast<std::uint8_t>(header));
+    };
+
+    auto run_length = [&elements](std::size_t position) {
+        std::size_t end = position + 1U;
+        while (end < elements.size() && elements[end] == elements[position]) {
+            end++;
+        }
+        return end - position;
+    };
+
+    std::size_t position = 0U;
+    while (position < elements.size()) {
+        const std::size_t run = run_length(position) / group_size * group_size;
+
+        if (run != 0U) {
+            store_header(static_cast<std::uint32_t>(run << 1U));
+            for (std::uint32_t byte = 0U; byte < (bit_width + 7U) / 8U; ++byte) {
+                stream.push_back(static_cast<std::uint8_t>(elements[position] >> (byte * 8U)));
+            }
+            position += run;
+            continue;
+        }
+
+        // Collect groups until the next run is met
+        std::size_t end = position + group_size;
+        while (end < elements.size() && run_length(end) < group_size) {
+            end += group_size;
+        }
+
+        store_header(static_cast<std::uint32_t>(((end - position) / group_size << 1U) | 1U));
+
+        const std::size_t offset = stream.size();
+        stream.resize(offset + (end - position) * bit_width / 8U, 0U);
+        for (std::size_t idx = 0U; idx < end - position; ++idx) {
+            const std::uint64_t bit_position = idx * bit_width;
+            const std::uint64_t value        = static_cast<std::uint64_t>(elements[position + idx])
+                                        << (bit_position & 7U);
+
+            for (std::uint32_t byte = 0U; byte * 8U < bit_width + (bit_position & 7U); ++byte) {
+                stream[offset + (bit_position >> 3U) + byte] |= static_cast<std::uint8_t>(value >> (byte * 8U));
+            }
+        }
+        position = end;
+    }
+
+    return stream;
+}
 } // namespace bench::data
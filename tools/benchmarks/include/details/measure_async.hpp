@@ -80,6 +80,7 @@ static statistics_t measure_async(benchmark::State& state, const case_params_t&
                     res.completed_operations++;
                     res.data_read += operations[idx].get_bytes_read();
                     res.data_written += operations[idx].get_bytes_written();
+                    res.elements += operations[idx].get_elements();
 
                     operations[idx].light_reset();
                     operations[idx].async_submit();
@@ -56,6 +56,7 @@ static statistics_t measure_sync(benchmark::State& state, const case_params_t& c
             res.completed_operations++;
             res.data_read += operation.get_bytes_read();
             res.data_written += operation.get_bytes_written();
+            res.elements += operation.get_elements();
         }
     }
 
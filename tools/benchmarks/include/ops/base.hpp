@@ -104,6 +104,9 @@ public:
     size_t get_bytes_read() { return bytes_read_; }
     size_t get_bytes_written() { return bytes_written_; }
 
+    // Getter for amount of processed elements for analytics stats
+    size_t get_elements() { return elements_; }
+
 protected:
     const DerivedT& derived() const { return *static_cast<const DerivedT*>(this); }
     DerivedT&       derived() { return *static_cast<DerivedT*>(this); }
@@ -114,5 +117,6 @@ protected:
     std::int32_t numa_id_ {-1};
     std::size_t  bytes_read_ {0};
     std::size_t  bytes_written_ {0};
+    std::size_t  elements_ {0};
 };
 } // namespace bench::ops
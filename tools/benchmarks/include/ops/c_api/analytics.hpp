@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <ops/c_api/base.hpp>
+#include <stdexcept>
+
+namespace bench::ops::c_api {
+
+/**
+ * Common implementation of the analytics operations: scan, extract, select and expand.
+ * The operation itself and all of its arguments are taken from @ref analytics_params_t.
+ */
+template <path_e path>
+class analytics_t : public operation_base_t<analytics_t<path>> {
+public:
+    using result_t    = analytics_results_t;
+    using params_t    = analytics_params_t;
+    using data_type_t = typename result_t::data_type_t;
+    using base_t      = ops::operation_base_t<analytics_t<path>>;
+    using base_api_t  = operation_base_t<analytics_t<path>>;
+
+    static constexpr auto path_v = path;
+
+private:
+    using base_api_t::deinit_lib_impl;
+    using base_api_t::job_;
+    using base_t::bytes_read_;
+    using base_t::bytes_written_;
+    using base_t::elements_;
+
+    // Extra space for the bit-vector and index outputs tails
+    static constexpr std::size_t dst_padding = 64U;
+
+public:
+    analytics_t() noexcept {}
+    ~analytics_t() noexcept(false) { deinit_lib_impl(); }
+
+protected:
+    void init_buffers_impl(const params_t& params) {
+        params_ = params;
+
+        // Any of the supported outputs fits into 32 bits per element
+        data_.resize(static_cast<std::size_t>(params_.elements_) * sizeof(std::uint32_t) + dst_padding);
+    }
+
+    void init_lib_params_impl() noexcept {
+        const std::uint32_t max_value = static_cast<std::uint32_t>((1ULL << params_.bit_width_) - 1U);
+
+        job_->op                 = params_.operation_;
+        job_->parser             = params_.parser_;
+        job_->src1_bit_width     = params_.bit_width_;
+        job_->num_input_elements = params_.elements_;
+        job_->out_bit_width      = params_.out_format_;
+        job_->flags |= QPL_FLAG_FIRST | QPL_FLAG_LAST;
+
+        if (params_.decompress_) job_->flags |= QPL_FLAG_DECOMPRESS_ENABLE;
+
+        if (params_.operation_ == qpl_op_extract) {
+            // Extract the middle half of the vector
+            job_->param_low  = params_.elements_ / 4U;
+            job_->param_high = params_.elements_ - params_.elements_ / 4U - 1U;
+        } else {
+            // Scan for the middle half of the values range
+            job_->param_low  = max_value / 4U;
+            job_->param_high = max_value - max_value / 4U;
+        }
+
+        if (params_.p_mask_) job_->src2_bit_width = 1U;
+
+        set_buffers();
+    }
+
+    void sync_execute_impl() {
+        auto status = qpl_execute_job(job_);
+        if (QPL_STS_OK == status)
+            update_stats();
+        else
+            throw std::runtime_error(format("qpl_execute_job() failed with status %d", status));
+    }
+
+    void async_submit_impl() {
+        auto status = qpl_submit_job(job_);
+        if (QPL_STS_OK != status) throw std::runtime_error(format("qpl_submit_job() failed with status %d", status));
+    }
+
+    task_status_e async_wait_impl() {
+        auto status = qpl_wait_job(job_);
+        if (QPL_STS_OK == status) {
+            update_stats();
+            return task_status_e::completed;
+        } else
+            throw std::runtime_error(format("qpl_wait_job() failed with status %d", status));
+    }
+
+    [[nodiscard]] task_status_e async_poll_impl() {
+        auto status = qpl_check_job(job_);
+        if (QPL_STS_BEING_PROCESSED == status)
+            return task_status_e::in_progress;
+        else {
+            if (QPL_STS_OK == status) {
+                update_stats();
+                return task_status_e::completed;
+            } else
+                throw std::runtime_error(format("qpl_check_job() failed with status %d", status));
+        }
+    }
+
+    void light_reset_impl() noexcept {
+        set_buffers();
+        job_->total_in  = 0U;
+        job_->total_out = 0U;
+    }
+
+    void mem_control_impl(mem_loc_e op, mem_loc_mask_e mask) const noexcept {
+        if (mask & mem_loc_mask_e::src1)
+            details::mem_control(params_.p_source_->buffer.begin(), params_.p_source_->buffer.end(), op);
+        if ((mask & mem_loc_mask_e::src2) && params_.p_mask_)
+            details::mem_control(params_.p_mask_->buffer.begin(), params_.p_mask_->buffer.end(), op);
+        if (mask & mem_loc_mask_e::dst1) details::mem_control(data_.begin(), data_.end(), op);
+    }
+
+    result_t& get_result_impl() noexcept {
+        result_.data_ = data_;
+        result_.data_.resize(data_size_);
+        return result_;
+    }
+
+private:
+    void set_buffers() noexcept {
+        job_->next_in_ptr   = const_cast<std::uint8_t*>(params_.p_source_->buffer.data());
+        job_->available_in  = static_cast<std::uint32_t>(params_.p_source_->buffer.size());
+        job_->next_out_ptr  = data_.data();
+        job_->available_out = static_cast<std::uint32_t>(data_.size());
+
+        if (params_.p_mask_) {
+            job_->next_src2_ptr  = const_cast<std::uint8_t*>(params_.p_mask_->buffer.data());
+            job_->available_src2 = static_cast<std::uint32_t>(params_.p_mask_->buffer.size());
+        }
+    }
+
+    void update_stats() noexcept {
+        data_size_     = job_->total_out;
+        bytes_read_    = job_->total_in;
+        bytes_written_ = job_->total_out;
+        elements_      = params_.elements_;
+    }
+
+    friend class ops::operation_base_t<analytics_t>;
+    friend class operation_base_t<analytics_t>;
+
+    params_t    params_;
+    data_type_t data_;
+    std::size_t data_size_ {0};
+    result_t    result_;
+};
+} // namespace bench::ops::c_api
+
+namespace bench::ops {
+template <path_e path>
+struct traits<operation_base_t<c_api::analytics_t<path>>> {
+    using result_t = analytics_results_t;
+};
+} // namespace bench::ops
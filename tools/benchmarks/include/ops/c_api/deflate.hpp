@@ -49,6 +49,11 @@ protected:
         if (params_.huffman_only_) job_->flags |= QPL_FLAG_GEN_LITERALS;
         if (params_.no_headers_) job_->flags |= QPL_FLAG_NO_HDRS;
 
+        if (params_.format_ == stream_format_e::gzip)
+            job_->flags |= QPL_FLAG_GZIP_MODE;
+        else if (params_.format_ == stream_format_e::zlib)
+            job_->flags |= QPL_FLAG_ZLIB_MODE;
+
         if (params_.huffman_ == huffman_type_e::dynamic)
             job_->flags |= QPL_FLAG_DYNAMIC_HUFFMAN;
         else if (params_.huffman_ == huffman_type_e::fixed)
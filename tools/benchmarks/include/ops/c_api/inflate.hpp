@@ -55,6 +55,11 @@ protected:
         }
 
         if (params_.no_headers_) job_->flags |= QPL_FLAG_NO_HDRS;
+
+        if (params_.format_ == stream_format_e::gzip)
+            job_->flags |= QPL_FLAG_GZIP_MODE;
+        else if (params_.format_ == stream_format_e::zlib)
+            job_->flags |= QPL_FLAG_ZLIB_MODE;
     }
 
     void sync_execute_impl() {
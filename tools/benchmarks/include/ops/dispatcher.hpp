@@ -8,6 +8,7 @@
 
 #include <types.hpp>
 
+#include "c_api/analytics.hpp"
 #include "c_api/crc64.hpp"
 #include "c_api/deflate.hpp"
 #include "c_api/inflate.hpp"
@@ -28,4 +29,21 @@ template <path_e path>
 struct api_dispatcher_t<api_e::c, path, operation_e::crc64> {
     using impl_t = c_api::crc64_t<path>;
 };
+
+template <path_e path>
+struct api_dispatcher_t<api_e::c, path, operation_e::scan> {
+    using impl_t = c_api::analytics_t<path>;
+};
+template <path_e path>
+struct api_dispatcher_t<api_e::c, path, operation_e::extract> {
+    using impl_t = c_api::analytics_t<path>;
+};
+template <path_e path>
+struct api_dispatcher_t<api_e::c, path, operation_e::select> {
+    using impl_t = c_api::analytics_t<path>;
+};
+template <path_e path>
+struct api_dispatcher_t<api_e::c, path, operation_e::expand> {
+    using impl_t = c_api::analytics_t<path>;
+};
 } // namespace bench::ops
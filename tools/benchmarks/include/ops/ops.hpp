@@ -16,4 +16,7 @@ using inflate_t = typename api_dispatcher_t<api, path, operation_e::inflate>::im
 
 template <api_e api, path_e path>
 using crc64_t = typename api_dispatcher_t<api, path, operation_e::crc64>::impl_t;
+
+template <api_e api, path_e path, operation_e operation>
+using analytics_t = typename api_dispatcher_t<api, path, operation>::impl_t;
 } // namespace bench::ops
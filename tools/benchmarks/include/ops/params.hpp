@@ -16,13 +16,15 @@ namespace bench::ops {
 struct deflate_params_t {
     explicit deflate_params_t() = default;
     deflate_params_t(const data_t& data, std::int32_t level, huffman_type_e huffman, bool huffman_only = false,
-                     bool no_headers = false, std::shared_ptr<qpl_huffman_table> huffman_table = nullptr)
+                     bool no_headers = false, std::shared_ptr<qpl_huffman_table> huffman_table = nullptr,
+                     stream_format_e format = stream_format_e::raw)
         : p_source_data_(&data)
         , level_(level)
         , huffman_(huffman)
         , huffman_only_(huffman_only)
         , no_headers_(no_headers)
-        , p_huffman_table_(std::move(huffman_table)) {}
+        , p_huffman_table_(std::move(huffman_table))
+        , format_(format) {}
 
     const data_t*                      p_source_data_ {nullptr};
     std::int32_t                       level_ {0};
@@ -30,24 +32,28 @@ struct deflate_params_t {
     bool                               huffman_only_ {false};
     bool                               no_headers_ {false};
     std::shared_ptr<qpl_huffman_table> p_huffman_table_ {nullptr};
+    stream_format_e                    format_ {stream_format_e::raw};
 };
 
 struct inflate_params_t {
     explicit inflate_params_t() = default;
     inflate_params_t(const data_t& stream, size_t original_size, bool no_headers,
                      huffman_type_e                     mode          = huffman_type_e::fixed,
-                     std::shared_ptr<qpl_huffman_table> huffman_table = nullptr)
+                     std::shared_ptr<qpl_huffman_table> huffman_table = nullptr,
+                     stream_format_e                    format        = stream_format_e::raw)
         : p_stream_(&stream)
         , original_size_(original_size)
         , no_headers_(no_headers)
         , huffman_(mode)
-        , p_huffman_table_(std::move(huffman_table)) {}
+        , p_huffman_table_(std::move(huffman_table))
+        , format_(format) {}
 
     const data_t*                      p_stream_ {nullptr};
     size_t                             original_size_ {0};
     bool                               no_headers_ {false};
     huffman_type_e                     huffman_ {huffman_type_e::fixed};
     std::shared_ptr<qpl_huffman_table> p_huffman_table_ {nullptr};
+    stream_format_e                    format_ {stream_format_e::raw};
 };
 
 struct crc64_params_t {
@@ -60,4 +66,28 @@ struct crc64_params_t {
     crc_type_e    crc_type;
 };
 
+struct analytics_params_t {
+    explicit analytics_params_t() = default;
+    analytics_params_t(const data_t& source, qpl_operation operation, qpl_parser parser, std::uint32_t bit_width,
+                       std::uint32_t elements, qpl_out_format out_format, bool decompress = false,
+                       const data_t* p_mask = nullptr)
+        : p_source_(&source)
+        , p_mask_(p_mask)
+        , operation_(operation)
+        , parser_(parser)
+        , bit_width_(bit_width)
+        , elements_(elements)
+        , out_format_(out_format)
+        , decompress_(decompress) {}
+
+    const data_t*  p_source_ {nullptr}; // Packed (or compressed with decompress_ set) source-1 stream
+    const data_t*  p_mask_ {nullptr};   // Source-2 bit-vector for select and expand
+    qpl_operation  operation_ {qpl_op_scan_eq};
+    qpl_parser     parser_ {qpl_p_le_packed_array};
+    std::uint32_t  bit_width_ {1U};
+    std::uint32_t  elements_ {0U};
+    qpl_out_format out_format_ {qpl_ow_nom};
+    bool           decompress_ {false};
+};
+
 } // namespace bench::ops
@@ -23,7 +23,7 @@ struct dictionary_t {
     std::vector<std::uint8_t> dict;
 };
 
-// Note: completed_operations, data_read, data_written are total stats from all iterations
+// Note: completed_operations, data_read, data_written, elements are total stats from all iterations
 struct statistics_t {
     std::uint32_t queue_size {0};
     std::uint32_t operations {0};
@@ -31,6 +31,7 @@ struct statistics_t {
     std::uint64_t completed_operations {0};
     std::uint64_t data_read {0};
     std::uint64_t data_written {0};
+    std::uint64_t elements {0};
 };
 
 enum class api_e { c, ml };
@@ -39,14 +40,18 @@ enum class path_e { cpu, iaa, auto_ };
 
 enum class execution_e { sync, async };
 
-enum class operation_e { deflate, inflate, crc64 };
+enum class operation_e { deflate, inflate, crc64, scan, extract, select, expand };
 
 enum class stat_type_e { compression, decompression, crc64, filter };
 
 enum class huffman_type_e { fixed, static_, dynamic, canned };
 
+enum class stream_format_e { raw, gzip, zlib };
+
 enum class crc_type_e { crc32_gzip, crc32_wimax, crc32_iscsi, T10DIF, crc16_ccitt, crc64 };
 
+enum class parser_e { le, be, prle };
+
 enum class task_status_e { retired, in_progress, completed };
 
 enum class mem_loc_e { cache, llc, ram, pmem, cc_ram, cc_pmem };
@@ -87,6 +87,11 @@ static inline std::string to_string(operation_e op) {
     switch (op) {
         case operation_e::deflate: return "deflate";
         case operation_e::inflate: return "inflate";
+        case operation_e::crc64: return "crc64";
+        case operation_e::scan: return "scan";
+        case operation_e::extract: return "extract";
+        case operation_e::select: return "select";
+        case operation_e::expand: return "expand";
         default: return "error";
     }
 }
@@ -105,6 +110,17 @@ static inline std::string to_string(huffman_type_e huffman) {
 static inline std::string to_name(huffman_type_e huffman) {
     return std::string("/huffman:") + to_string(huffman);
 }
+static inline std::string to_string(stream_format_e format) {
+    switch (format) {
+        case stream_format_e::raw: return "raw";
+        case stream_format_e::gzip: return "gzip";
+        case stream_format_e::zlib: return "zlib";
+        default: return "error";
+    }
+}
+static inline std::string to_name(stream_format_e format) {
+    return std::string("/format:") + to_string(format);
+}
 
 static inline std::string crc_to_string(crc_type_e type) {
     switch (type) {
@@ -121,6 +137,18 @@ static inline std::string crc_to_name(crc_type_e type) {
     return std::string("/crc:") + crc_to_string(type);
 }
 
+static inline std::string to_string(parser_e parser) {
+    switch (parser) {
+        case parser_e::le: return "le";
+        case parser_e::be: return "be";
+        case parser_e::prle: return "prle";
+        default: return "error";
+    }
+}
+static inline std::string to_name(parser_e parser) {
+    return std::string("/parser:") + to_string(parser);
+}
+
 static inline std::string to_string(mem_loc_e loc) {
     switch (loc) {
         case mem_loc_e::cache: return "cache";
@@ -211,6 +239,7 @@ register_benchmarks_common(const std::string& case_name, const std::string& case
  * This function calculates and sets the counters for benchmarking based on the given state, statistics
  * and operation type.
  * The counters include latency, latency per operation, throughput and ratio.
+ * Filter operations additionally report the number of processed elements per second.
  *
  * @param [in,out] state The benchmark state object.
  * @param [in] stat The statistics object containing data read, data written, queue size and operations per thread.
@@ -220,7 +249,7 @@ static inline void base_counters(benchmark::State& state, statistics_t& stat, st
     double throughput = 0.0;
 
     if (state.iterations() != 0) {
-        if (type == stat_type_e::compression || type == stat_type_e::crc64) {
+        if (type == stat_type_e::compression || type == stat_type_e::crc64 || type == stat_type_e::filter) {
             throughput = static_cast<double>(stat.data_read / state.iterations());
         } else if (type == stat_type_e::decompression) {
             throughput = static_cast<double>(stat.data_written / state.iterations());
@@ -252,6 +281,15 @@ static inline void base_counters(benchmark::State& state, statistics_t& stat, st
     state.counters["Throughput"] = benchmark::Counter(
             throughput, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kAvgThreads,
             benchmark::Counter::kIs1000);
+
+    if (type == stat_type_e::filter) {
+        const double elements =
+                (state.iterations() != 0) ? static_cast<double>(stat.elements / state.iterations()) : 0.0;
+
+        state.counters["Elements"] = benchmark::Counter(
+                elements, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kAvgThreads,
+                benchmark::Counter::kIs1000);
+    }
 }
 
 extern std::vector<std::string> FILTER_op;
@@ -0,0 +1,240 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <data_providers.hpp>
+#include <measure.hpp>
+#include <memory>
+#include <ops/ops.hpp>
+#include <stdexcept>
+#include <utility.hpp>
+
+using namespace bench;
+
+/**
+ * Analytics source prepared from a dataset block: the packed stream and the source-2 bit-vector
+ */
+struct analytics_source_t {
+    data_t        source;
+    data_t        mask;
+    std::uint32_t elements {0U};
+};
+
+static inline qpl_parser to_qpl_parser(parser_e parser) {
+    switch (parser) {
+        case parser_e::be: return qpl_p_be_packed_array;
+        case parser_e::prle: return qpl_p_parquet_rle;
+        default: return qpl_p_le_packed_array;
+    }
+}
+
+static inline std::uint32_t out_format_to_bits(qpl_out_format out_format) {
+    switch (out_format) {
+        case qpl_ow_8: return 8U;
+        case qpl_ow_16: return 16U;
+        case qpl_ow_32: return 32U;
+        default: return 0U;
+    }
+}
+
+static inline std::string out_format_to_name(qpl_out_format out_format) {
+    return (qpl_ow_nom == out_format) ? std::string("/out:nom") : to_name(out_format_to_bits(out_format), "out");
+}
+
+static inline std::string scan_to_name(qpl_operation operation) {
+    switch (operation) {
+        case qpl_op_scan_eq: return "/pred:eq";
+        case qpl_op_scan_ne: return "/pred:ne";
+        case qpl_op_scan_lt: return "/pred:lt";
+        case qpl_op_scan_le: return "/pred:le";
+        case qpl_op_scan_gt: return "/pred:gt";
+        case qpl_op_scan_ge: return "/pred:ge";
+        case qpl_op_scan_range: return "/pred:range";
+        case qpl_op_scan_not_range: return "/pred:not_range";
+        default: return "/pred:error";
+    }
+}
+
+/**
+ * Interprets the block as a packed array of bit_width elements and, for the Parquet RLE parser,
+ * re-encodes these elements into the Parquet RLE stream
+ */
+static inline analytics_source_t make_source(const data_t& block, parser_e parser, std::uint32_t bit_width) {
+    analytics_source_t result;
+
+    const std::uint64_t elements = static_cast<std::uint64_t>(block.buffer.size()) * 8U / bit_width;
+
+    result.source.name = block.name;
+    if (parser_e::prle == parser) {
+        // Parquet bit-packed groups hold 8 elements
+        result.elements      = static_cast<std::uint32_t>(elements & ~7ULL);
+        result.source.buffer = data::pack_prle(data::unpack_le(block.buffer, bit_width, result.elements), bit_width);
+    } else {
+        result.elements      = static_cast<std::uint32_t>(elements);
+        result.source.buffer = block.buffer;
+    }
+
+    // Every other element is selected
+    result.mask.buffer.assign((result.elements + 7U) / 8U, 0x55U);
+
+    return result;
+}
+
+template <execution_e exec, api_e api, path_e path, operation_e operation>
+class analytics_t {
+public:
+    static constexpr auto exec_v = exec;
+    static constexpr auto api_v  = api;
+    static constexpr auto path_v = path;
+
+    void operator()(benchmark::State& state, const case_params_t& common_params, const data_t& data,
+                    const std::shared_ptr<analytics_source_t>& source, qpl_operation qpl_op, parser_e parser,
+                    std::uint32_t bit_width, qpl_out_format out_format, bool decompress) const {
+        try {
+            // Compress source-1 for the analytics with decompression
+            data_t stream;
+            if (decompress) {
+                const ops::deflate_params_t      comp_params(source->source, 1, huffman_type_e::fixed);
+                ops::deflate_t<api, path_e::cpu> compression;
+                compression.init(comp_params, common_params.node_);
+                compression.async_submit();
+                compression.async_wait();
+                stream.buffer = compression.get_result().stream_;
+            }
+
+            // Prepare analytics
+            const bool    is_masked = (operation_e::select == operation || operation_e::expand == operation);
+            const data_t* p_mask    = (is_masked) ? &source->mask : nullptr;
+
+            const ops::analytics_params_t params((decompress) ? stream : source->source, qpl_op, to_qpl_parser(parser),
+                                                 bit_width, source->elements, out_format, decompress, p_mask);
+            std::vector<ops::analytics_t<api, path, operation>> operations;
+
+            // Measuring loop
+            auto stat = measure<exec, path>(state, common_params, operations, params);
+
+            // Set counters
+            base_counters(state, stat, stat_type_e::filter);
+        } catch (std::runtime_error& err) { state.SkipWithError(err.what()); } catch (...) {
+            state.SkipWithError("Unknown exception");
+        }
+    }
+};
+
+template <path_e path, operation_e operation>
+static inline void register_analytics_case(const data_t& block, const std::shared_ptr<analytics_source_t>& source,
+                                           qpl_operation qpl_op, parser_e parser, std::uint32_t bit_width,
+                                           qpl_out_format out_format, bool decompress) {
+    const std::string name_ext = ((operation_e::scan == operation) ? scan_to_name(qpl_op) : std::string {}) +
+                                 to_name(parser) + to_name(bit_width, "width") + out_format_to_name(out_format) +
+                                 to_name(static_cast<std::uint32_t>(decompress), "decompress");
+
+    if (continue_register(execution_e::sync))
+        register_benchmarks_common(to_string(operation), name_ext,
+                                   analytics_t<execution_e::sync, api_e::c, path, operation> {}, case_params_t {},
+                                   block, source, qpl_op, parser, bit_width, out_format, decompress);
+
+    if (continue_register(execution_e::async))
+        register_benchmarks_common(to_string(operation), name_ext,
+                                   analytics_t<execution_e::async, api_e::c, path, operation> {}, case_params_t {},
+                                   block, source, qpl_op, parser, bit_width, out_format, decompress);
+}
+
+/**
+ * All bit widths are measured for the basic configuration: little-endian uncompressed input with nominal output.
+ * Other combinations of parser, output width and decompression are measured for the representative widths only.
+ */
+static const std::vector<std::uint32_t> representative_bit_widths {1U, 3U, 8U, 12U, 16U, 17U, 32U};
+
+static const std::vector<parser_e>       parsers {parser_e::le, parser_e::be, parser_e::prle};
+static const std::vector<qpl_out_format> out_formats {qpl_ow_nom, qpl_ow_8, qpl_ow_16, qpl_ow_32};
+
+template <path_e path, operation_e operation>
+static inline void register_block_cases(const data_t& block, const std::vector<qpl_operation>& qpl_ops) {
+    for (const auto parser : parsers) {
+        for (std::uint32_t bit_width = 1U; bit_width <= 32U; ++bit_width) {
+            const bool is_representative =
+                    std::find(representative_bit_widths.begin(), representative_bit_widths.end(), bit_width) !=
+                    representative_bit_widths.end();
+
+            if (parser_e::le != parser && !is_representative) continue;
+
+            const auto source = std::make_shared<analytics_source_t>(make_source(block, parser, bit_width));
+            if (!source->elements) continue;
+
+            for (const auto out_format : out_formats) {
+                if (qpl_ow_nom != out_format) {
+                    if (!is_representative) continue;
+
+                    const std::uint32_t out_bits = out_format_to_bits(out_format);
+                    if (operation_e::scan == operation || 1U == bit_width) {
+                        // Bit-vector outputs are stored as indices of the set bits, all of them must fit
+                        if (out_bits < 32U && source->elements > (1U << out_bits)) continue;
+                    } else if (out_bits < bit_width) {
+                        continue;
+                    }
+                }
+
+                for (const bool decompress : {false, true}) {
+                    if (decompress && !is_representative) continue;
+
+                    for (const auto qpl_op : qpl_ops) {
+                        register_analytics_case<path, operation>(block, source, qpl_op, parser, bit_width, out_format,
+                                                                 decompress);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <path_e path, operation_e operation>
+static inline void prepare_cases(const bench::dataset_t& dataset, const std::vector<qpl_operation>& qpl_ops) {
+    for (const auto& data : dataset) {
+        auto block_sizes = (cmd::get_block_size() >= 0)
+                                   ? std::vector<std::uint32_t> {static_cast<uint32_t>(cmd::get_block_size())}
+                                   : data::generate_block_sizes(data);
+
+        for (const auto& size : block_sizes) {
+            auto blocks = data::split_data(data, size);
+
+            // Analytics throughput doesn't depend on the block contents as much as compression does,
+            // so only the first block of every size is measured
+            register_block_cases<path, operation>(blocks.front(), qpl_ops);
+        }
+    }
+}
+
+template <operation_e operation>
+static inline void register_analytics(const std::vector<qpl_operation>& qpl_ops) {
+    if (!continue_register(operation)) return;
+
+    bench::dataset_t dataset = data::read_dataset(cmd::FLAGS_dataset);
+
+    if (continue_register(path_e::cpu)) prepare_cases<path_e::cpu, operation>(dataset, qpl_ops);
+
+    if (continue_register(path_e::iaa)) prepare_cases<path_e::iaa, operation>(dataset, qpl_ops);
+}
+
+BENCHMARK_SET_DELAYED(scan) {
+    register_analytics<operation_e::scan>({qpl_op_scan_eq, qpl_op_scan_ne, qpl_op_scan_lt, qpl_op_scan_le,
+                                           qpl_op_scan_gt, qpl_op_scan_ge, qpl_op_scan_range,
+                                           qpl_op_scan_not_range});
+}
+
+BENCHMARK_SET_DELAYED(extract) {
+    register_analytics<operation_e::extract>({qpl_op_extract});
+}
+
+BENCHMARK_SET_DELAYED(select) {
+    register_analytics<operation_e::select>({qpl_op_select});
+}
+
+BENCHMARK_SET_DELAYED(expand) {
+    register_analytics<operation_e::expand>({qpl_op_expand});
+}
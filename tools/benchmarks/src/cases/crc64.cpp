@@ -50,6 +50,29 @@ static inline void cases_set(data_t& data, crc_type_e type) {
                                    crc64_t<execution_e::async, api_e::c, path> {}, case_params_t {}, data, type);
 }
 
+/**
+ * Sizes of the small buffers, where the per-call setup of CRC64 is comparable with the calculation itself
+ */
+static const std::vector<std::uint32_t> small_block_sizes {64U, 256U, 1024U};
+
+/**
+ * Number of the first blocks registered for every small size, the other blocks don't change the results
+ */
+static constexpr std::uint32_t small_blocks_limit = 4U;
+
+template <path_e path>
+static inline void small_cases_set(const data_t& data) {
+    for (const auto size : small_block_sizes) {
+        auto blocks = data::split_data(data, size);
+
+        if (blocks.size() > small_blocks_limit) { blocks.resize(small_blocks_limit); }
+
+        for (auto& block : blocks) {
+            cases_set<path>(block, crc_type_e::crc64);
+        }
+    }
+}
+
 BENCHMARK_SET_DELAYED(crc64) {
     if (!continue_register(bench::operation_e::crc64)) return;
 
@@ -72,5 +95,11 @@ BENCHMARK_SET_DELAYED(crc64) {
                 }
             }
         }
+
+        if (cmd::get_block_size() < 0) {
+            if (continue_register(path_e::iaa)) small_cases_set<path_e::iaa>(data);
+
+            if (continue_register(path_e::cpu)) small_cases_set<path_e::cpu>(data);
+        }
     }
 }
@@ -24,10 +24,11 @@ public:
     static constexpr auto path_v = path;
 
     void operator()(benchmark::State& state, const case_params_t& common_params, const data_t& data,
-                    huffman_type_e huffman, const std::shared_ptr<qpl_huffman_table>& table, std::int64_t level) const {
+                    huffman_type_e huffman, const std::shared_ptr<qpl_huffman_table>& table, std::int64_t level,
+                    stream_format_e format) const {
         try {
             // Encode stream
-            const ops::deflate_params_t   comp_params(data, level, huffman, false, false, table);
+            const ops::deflate_params_t   comp_params(data, level, huffman, false, false, table, format);
             ops::deflate_t<api, com_path> compression;
             compression.init(comp_params, common_params.node_);
             compression.async_submit();
@@ -36,7 +37,7 @@ public:
             // Prepare decompression
             data_t stream;
             stream.buffer = compression.get_result().stream_;
-            const ops::inflate_params_t            params(stream, data.buffer.size(), false, huffman, table);
+            const ops::inflate_params_t            params(stream, data.buffer.size(), false, huffman, table, format);
             std::vector<ops::inflate_t<api, path>> operations;
 
             // Measuring loop
@@ -57,21 +58,24 @@ public:
 
 template <path_e path, path_e comp_path = path>
 static inline void register_inflate_case(const data_t& data, const huffman_type_e huffman,
-                                         const std::shared_ptr<qpl_huffman_table>& table, const std::int32_t& level) {
+                                         const std::shared_ptr<qpl_huffman_table>& table, const std::int32_t& level,
+                                         const stream_format_e format) {
+    const std::string name =
+            to_name(comp_path, "gen_path") + to_name(huffman) + level_to_name(level) + to_name(format);
+
     if (continue_register(execution_e::sync))
-        register_benchmarks_common("inflate", to_name(comp_path, "gen_path") + to_name(huffman) + level_to_name(level),
-                                   inflate_t<execution_e::sync, api_e::c, path, comp_path> {}, case_params_t {}, data,
-                                   huffman, table, level);
+        register_benchmarks_common("inflate", name, inflate_t<execution_e::sync, api_e::c, path, comp_path> {},
+                                   case_params_t {}, data, huffman, table, level, format);
 
     if (continue_register(execution_e::async))
-        register_benchmarks_common("inflate", to_name(comp_path, "gen_path") + to_name(huffman) + level_to_name(level),
-                                   inflate_t<execution_e::async, api_e::c, path, comp_path> {}, case_params_t {}, data,
-                                   huffman, table, level);
+        register_benchmarks_common("inflate", name, inflate_t<execution_e::async, api_e::c, path, comp_path> {},
+                                   case_params_t {}, data, huffman, table, level, format);
 }
 
 template <path_e path, path_e comp_path = path>
 static inline void prepare_cases(bench::dataset_t& dataset, const std::vector<std::int32_t>& levels,
-                                 const std::vector<huffman_type_e>& compression_mode) {
+                                 const std::vector<huffman_type_e>&  compression_mode,
+                                 const std::vector<stream_format_e>& formats) {
     for (const auto& data : dataset) {
         auto block_sizes = (cmd::get_block_size() >= 0)
                                    ? std::vector<std::uint32_t> {static_cast<uint32_t>(cmd::get_block_size())}
@@ -86,7 +90,12 @@ static inline void prepare_cases(bench::dataset_t& dataset, const std::vector<st
                 auto blocks = data::split_data(data, size);
                 for (const auto& block : blocks) {
                     for (const auto& mode : compression_mode) {
-                        register_inflate_case<path, comp_path>(block, mode, table, level);
+                        for (const auto& format : formats) {
+                            // Canned streams carry no headers, so they are never wrapped into gzip or zlib
+                            if (mode == huffman_type_e::canned && format != stream_format_e::raw) continue;
+
+                            register_inflate_case<path, comp_path>(block, mode, table, level, format);
+                        }
                     }
                 }
             }
@@ -107,15 +116,21 @@ BENCHMARK_SET_DELAYED(inflate) {
         compression_mode = to_huffman_type(FILTER_compression_mode);
     }
 
+    /**
+     * gzip and zlib streams are checked against the CRC32/Adler32 of the output,
+     * raw streams serve as a baseline for the cost of this checksum.
+    */
+    const std::vector<stream_format_e> formats {stream_format_e::raw, stream_format_e::gzip, stream_format_e::zlib};
+
     const std::vector<std::int32_t> sw_levels {1, 3};
     const std::vector<std::int32_t> hw_levels {1};
     const std::vector<std::int32_t> sw_hw_levels {3};
     bench::dataset_t                dataset = data::read_dataset(cmd::FLAGS_dataset);
 
-    if (continue_register(path_e::cpu)) prepare_cases<path_e::cpu>(dataset, sw_levels, compression_mode);
+    if (continue_register(path_e::cpu)) prepare_cases<path_e::cpu>(dataset, sw_levels, compression_mode, formats);
 
     if (continue_register(path_e::iaa)) {
-        prepare_cases<path_e::iaa>(dataset, hw_levels, compression_mode);
-        prepare_cases<path_e::iaa, path_e::cpu>(dataset, sw_hw_levels, compression_mode);
+        prepare_cases<path_e::iaa>(dataset, hw_levels, compression_mode, formats);
+        prepare_cases<path_e::iaa, path_e::cpu>(dataset, sw_hw_levels, compression_mode, formats);
     }
 }
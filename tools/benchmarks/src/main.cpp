@@ -306,7 +306,8 @@ static void parse_benchmark_filter(const std::string& filter_string) {
     std::string::const_iterator search_start(filter_string.cbegin());
     while (std::regex_search(search_start, filter_string.cend(), match, re)) {
         const std::string value = match[1].str();
-        if (value == "inflate" || value == "deflate" || value == "crc64")
+        if (value == "inflate" || value == "deflate" || value == "crc64" || value == "scan" || value == "extract" ||
+            value == "select" || value == "expand")
             FILTER_op.push_back(value);
         else if (value == "gen_path") {
             /**
@@ -34,13 +34,16 @@ protected:
 
         uint32_t job_size = 0U;
 
-        auto status = qpl_get_job_size(m_execution_path, &job_size);
+        // Tables of the high-ratio levels are reserved as well, so the tests can use every compression level
+        const uint32_t op_classes = qpl_op_class_all | qpl_op_class_high_ratio_compression;
+
+        auto status = qpl_get_job_size_by_class(m_execution_path, op_classes, &job_size);
         ASSERT_EQ(QPL_STS_OK, status);
 
         m_job_buffer = new uint8_t[job_size];
         job_ptr      = reinterpret_cast<qpl_job*>(m_job_buffer);
 
-        status = qpl_init_job(m_execution_path, job_ptr);
+        status = qpl_init_job_by_class(m_execution_path, op_classes, job_ptr);
         ASSERT_EQ(QPL_STS_OK, status);
     }
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -99,4 +100,203 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(async_multiple_jobs_submit, default_compressi
         EXPECT_TRUE(CompareVectors(source[i], uncompressed[i]));
     }
 }
+
+/* Submits a set of compression jobs and polls them with qpl_check_job
+   until every job is completed instead of blocking in qpl_wait_job. */
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(async_multiple_jobs_submit, check_job_polling) {
+    constexpr uint32_t number_of_copies = 16U;
+
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    const std::vector<uint8_t> source = dataset.get_data().begin()->second;
+
+    std::vector<std::vector<uint8_t>> destination(number_of_copies, std::vector<uint8_t>(source.size() * 2));
+
+    qpl_status status = QPL_STS_OK;
+    uint32_t   size   = 0;
+
+    status = qpl_get_job_size(path, &size);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffer(number_of_copies);
+    std::vector<qpl_job*>                   job(number_of_copies);
+
+    for (uint32_t i = 0; i < number_of_copies; i++) {
+        job_buffer[i] = std::make_unique<uint8_t[]>(size);
+        job[i]        = reinterpret_cast<qpl_job*>(job_buffer[i].get());
+
+        status = qpl_init_job(path, job[i]);
+        ASSERT_EQ(QPL_STS_OK, status);
+    }
+
+    // Jobs owned by the library can't be abandoned, so nothing returns early until all of them are completed
+    std::vector<qpl_status> submit_status(number_of_copies, QPL_STS_OK);
+    std::vector<qpl_status> check_status(number_of_copies, QPL_STS_OK);
+
+    for (uint32_t i = 0; i < number_of_copies; i++) {
+        job[i]->op            = qpl_op_compress;
+        job[i]->level         = qpl_default_level;
+        job[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        job[i]->next_in_ptr   = const_cast<uint8_t*>(source.data());
+        job[i]->available_in  = static_cast<uint32_t>(source.size());
+        job[i]->next_out_ptr  = destination[i].data();
+        job[i]->available_out = static_cast<uint32_t>(destination[i].size());
+        submit_status[i]      = qpl_submit_job(job[i]);
+    }
+
+    for (uint32_t i = 0; i < number_of_copies; i++) {
+        if (QPL_STS_OK != submit_status[i]) { continue; }
+
+        do { //NOLINT(cppcoreguidelines-avoid-do-while)
+            check_status[i] = qpl_check_job(job[i]);
+        } while (QPL_STS_BEING_PROCESSED == check_status[i]);
+    }
+
+    for (uint32_t i = 0; i < number_of_copies; i++) {
+        ASSERT_EQ(QPL_STS_OK, submit_status[i]);
+        ASSERT_EQ(QPL_STS_OK, check_status[i]);
+
+        // Completed job keeps reporting its status
+        ASSERT_EQ(QPL_STS_OK, qpl_wait_job(job[i]));
+    }
+
+    for (uint32_t i = 0; i < number_of_copies; i++) {
+        std::vector<uint8_t> uncompressed(source.size());
+
+        job[i]->op            = qpl_op_decompress;
+        job[i]->next_in_ptr   = destination[i].data();
+        job[i]->available_in  = job[i]->total_out;
+        job[i]->next_out_ptr  = uncompressed.data();
+        job[i]->available_out = static_cast<uint32_t>(uncompressed.size());
+        job[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        status                = qpl_execute_job(job[i]);
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        EXPECT_TRUE(CompareVectors(source, uncompressed));
+
+        status = qpl_fini_job(job[i]);
+        ASSERT_EQ(QPL_STS_OK, status);
+    }
+}
+
+/* Compresses a set of copies with qpl_submit_jobs/qpl_wait_jobs and decompresses them
+   with qpl_submit_jobs, polling the batch with qpl_check_jobs. */
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(async_multiple_jobs_submit, batch_submission) {
+    constexpr uint32_t number_of_copies = 32U;
+
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    const std::vector<uint8_t> source = dataset.get_data().begin()->second;
+
+    std::vector<std::vector<uint8_t>> destination(number_of_copies, std::vector<uint8_t>(source.size() * 2));
+    std::vector<std::vector<uint8_t>> uncompressed(number_of_copies, std::vector<uint8_t>(source.size()));
+
+    qpl_status status = QPL_STS_OK;
+    uint32_t   size   = 0;
+
+    status = qpl_get_job_size(path, &size);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffer(number_of_copies);
+    std::vector<qpl_job*>                   job(number_of_copies);
+
+    for (uint32_t i = 0; i < number_of_copies; i++) {
+        job_buffer[i] = std::make_unique<uint8_t[]>(size);
+        job[i]        = reinterpret_cast<qpl_job*>(job_buffer[i].get());
+
+        status = qpl_init_job(path, job[i]);
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        job[i]->op            = qpl_op_compress;
+        job[i]->level         = qpl_default_level;
+        job[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        job[i]->next_in_ptr   = const_cast<uint8_t*>(source.data());
+        job[i]->available_in  = static_cast<uint32_t>(source.size());
+        job[i]->next_out_ptr  = destination[i].data();
+        job[i]->available_out = static_cast<uint32_t>(destination[i].size());
+    }
+
+    status = qpl_submit_jobs(job.data(), number_of_copies);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    status = qpl_wait_jobs(job.data(), number_of_copies);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    for (uint32_t i = 0; i < number_of_copies; i++) {
+        job[i]->op            = qpl_op_decompress;
+        job[i]->next_in_ptr   = destination[i].data();
+        job[i]->available_in  = job[i]->total_out;
+        job[i]->next_out_ptr  = uncompressed[i].data();
+        job[i]->available_out = static_cast<uint32_t>(uncompressed[i].size());
+        job[i]->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    }
+
+    status = qpl_submit_jobs(job.data(), number_of_copies);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    uint32_t completed_count = 0U;
+    do { //NOLINT(cppcoreguidelines-avoid-do-while)
+        status = qpl_check_jobs(job.data(), number_of_copies, &completed_count);
+    } while (QPL_STS_BEING_PROCESSED == status);
+    ASSERT_EQ(QPL_STS_OK, status);
+    ASSERT_EQ(number_of_copies, completed_count);
+
+    for (uint32_t i = 0; i < number_of_copies; i++) {
+        EXPECT_EQ(source.size(), job[i]->total_out);
+        EXPECT_TRUE(CompareVectors(source, uncompressed[i]));
+
+        status = qpl_fini_job(job[i]);
+        ASSERT_EQ(QPL_STS_OK, status);
+    }
+}
+
+/* A batch with an invalid job is rejected before any of the jobs is submitted. */
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(async_multiple_jobs_submit, batch_submission_rejected) {
+    constexpr uint32_t number_of_jobs = 4U;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    std::vector<uint8_t> source(1024U, 7U);
+    std::vector<uint8_t> destination(source.size());
+
+    qpl_status status = QPL_STS_OK;
+    uint32_t   size   = 0;
+
+    status = qpl_get_job_size(path, &size);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffer(number_of_jobs);
+    std::vector<qpl_job*>                   job(number_of_jobs);
+
+    for (uint32_t i = 0; i < number_of_jobs; i++) {
+        job_buffer[i] = std::make_unique<uint8_t[]>(size);
+        job[i]        = reinterpret_cast<qpl_job*>(job_buffer[i].get());
+
+        status = qpl_init_job(path, job[i]);
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        job[i]->op            = qpl_op_crc64;
+        job[i]->crc64_poly    = 0x9A6C9329AC4BC9B5ULL;
+        job[i]->next_in_ptr   = source.data();
+        job[i]->available_in  = static_cast<uint32_t>(source.size());
+        job[i]->next_out_ptr  = destination.data();
+        job[i]->available_out = static_cast<uint32_t>(destination.size());
+    }
+
+    job[number_of_jobs - 1U]->next_in_ptr = nullptr;
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_submit_jobs(job.data(), number_of_jobs));
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_submit_jobs(nullptr, number_of_jobs));
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_check_jobs(job.data(), number_of_jobs, nullptr));
+
+    for (uint32_t i = 0; i < number_of_jobs; i++) {
+        // None of the jobs is executed, qpl_check_job isn't called as it runs the host fallback on the auto path
+        EXPECT_EQ(0U, job[i]->crc64);
+
+        status = qpl_fini_job(job[i]);
+        ASSERT_EQ(QPL_STS_OK, status);
+    }
+}
 } // namespace qpl::test
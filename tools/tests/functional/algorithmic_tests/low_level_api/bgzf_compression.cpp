@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests compress every dataset file into a BGZF stream with qpl_compress_bgzf, check the member index
+   and decompress both the whole stream and a single member picked up with the index. */
+
+namespace qpl::test {
+
+static constexpr uint32_t bgzf_eof_member_size = 28U;
+static constexpr uint32_t bgzf_header_size     = 18U;
+
+static void compress_bgzf_and_compare(uint32_t member_size, uint32_t flags) {
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    for (auto& data : dataset.get_data()) {
+        std::vector<uint8_t> source      = data.second;
+        const auto           source_size = static_cast<uint32_t>(source.size());
+        if (0U == source_size) { continue; }
+
+        const uint32_t member_count = (source_size + member_size - 1U) / member_size;
+
+        std::vector<uint8_t>              compressed(member_count * 65536U + bgzf_eof_member_size);
+        std::vector<qpl_bgzf_index_entry> entries(member_count);
+
+        qpl_bgzf_index index = {member_size, member_count, 0U, entries.data()};
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->flags         = flags;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = source_size;
+        job_ptr->next_out_ptr  = compressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+        job_ptr->num_threads   = 0U;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_compress_bgzf(job_ptr, &index)) << data.first;
+        ASSERT_EQ(source_size, job_ptr->total_in) << data.first;
+        ASSERT_EQ(member_count, index.entry_count) << data.first;
+
+        const uint32_t compressed_size = job_ptr->total_out;
+        const uint32_t bgzf_crc        = job_ptr->crc;
+
+        for (uint32_t i = 0U; i < member_count; i++) {
+            const uint8_t* member_ptr = compressed.data() + entries[i].compressed_offset;
+
+            ASSERT_EQ(static_cast<uint64_t>(i) * member_size, entries[i].uncompressed_offset) << data.first;
+            ASSERT_EQ(0x1FU, member_ptr[0]) << data.first;
+            ASSERT_EQ(0x8BU, member_ptr[1]) << data.first;
+            ASSERT_EQ('B', member_ptr[12]) << data.first;
+            ASSERT_EQ('C', member_ptr[13]) << data.first;
+        }
+
+        // The whole stream, including the end-of-file member
+        std::vector<uint8_t> decompressed(source.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE | QPL_FLAG_PARALLEL;
+        job_ptr->next_in_ptr   = compressed.data();
+        job_ptr->available_in  = compressed_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+        ASSERT_EQ(compressed_size, job_ptr->total_in) << data.first;
+        ASSERT_EQ(source_size, job_ptr->total_out) << data.first;
+        ASSERT_EQ(0, std::memcmp(source.data(), decompressed.data(), source.size())) << data.first;
+        ASSERT_EQ(bgzf_crc, job_ptr->crc) << data.first;
+
+        // The last member only, found with the index
+        const uint32_t last_member      = member_count - 1U;
+        const auto     last_offset      = static_cast<uint32_t>(entries[last_member].compressed_offset);
+        const auto     last_source_size = static_cast<uint32_t>(source_size - entries[last_member].uncompressed_offset);
+        const uint8_t* bsize_ptr        = compressed.data() + last_offset + bgzf_header_size - 2U;
+        const uint32_t last_member_size = (bsize_ptr[0] | (bsize_ptr[1] << 8U)) + 1U;
+
+        ASSERT_EQ(compressed_size - bgzf_eof_member_size, last_offset + last_member_size) << data.first;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE;
+        job_ptr->next_in_ptr   = compressed.data() + last_offset;
+        job_ptr->available_in  = last_member_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = last_source_size;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+        ASSERT_EQ(last_source_size, job_ptr->total_out) << data.first;
+        ASSERT_EQ(0, std::memcmp(source.data() + entries[last_member].uncompressed_offset, decompressed.data(),
+                                 last_source_size))
+                << data.first;
+    }
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(bgzf_compression, default_member_size) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    compress_bgzf_and_compare(QPL_BGZF_MAX_MEMBER_SIZE, QPL_FLAG_DYNAMIC_HUFFMAN);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(bgzf_compression, small_members_fixed_huffman) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    compress_bgzf_and_compare(4096U, 0U);
+}
+
+} // namespace qpl::test
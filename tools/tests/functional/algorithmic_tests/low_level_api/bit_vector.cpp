@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests compare the results of the bit-vector operations with the bitwise operation applied to every
+   pair of bits one by one. The accelerator has no bit-vector operations, so the hardware path reports
+   QPL_STS_NOT_SUPPORTED_MODE_ERR. */
+
+namespace qpl::test {
+
+static auto pack_bits(const std::vector<uint8_t>& bits, bool is_big_endian) -> std::vector<uint8_t> {
+    std::vector<uint8_t> bit_vector((bits.size() + 7U) / 8U, 0U);
+
+    for (size_t i = 0U; i < bits.size(); i++) {
+        if (bits[i]) { bit_vector[i / 8U] |= is_big_endian ? 0x80U >> (i % 8U) : 1U << (i % 8U); }
+    }
+
+    return bit_vector;
+}
+
+static uint8_t apply_operation(qpl_operation operation, uint8_t first, uint8_t second) {
+    switch (operation) {
+        case qpl_op_bit_and: return first & second;
+        case qpl_op_bit_or: return first | second;
+        case qpl_op_bit_and_not: return first & !second;
+        default: return first ^ second;
+    }
+}
+
+static void bit_vector_and_compare(qpl_operation operation, uint32_t bit_count, uint32_t drop_initial_bytes,
+                                   qpl_parser parser, bool is_source2_be, qpl_out_format out_format) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    std::mt19937 random_generator(bit_count + operation);
+
+    // Runs of set and clear bits alternate with noise, so the result is neither dense nor empty
+    std::vector<uint8_t> first_bits(bit_count);
+    std::vector<uint8_t> second_bits(bit_count);
+    for (uint32_t i = 0U; i < bit_count; i++) {
+        first_bits[i]  = ((i / 97U) & 1U) ? static_cast<uint8_t>(random_generator() % 8U != 0U)
+                                          : static_cast<uint8_t>(random_generator() % 8U == 0U);
+        second_bits[i] = static_cast<uint8_t>(random_generator() & 1U);
+    }
+
+    std::vector<uint32_t> expected_indices;
+    std::vector<uint8_t>  expected_bits(bit_count);
+    for (uint32_t i = 0U; i < bit_count; i++) {
+        expected_bits[i] = apply_operation(operation, first_bits[i], second_bits[i]);
+
+        if (expected_bits[i]) { expected_indices.push_back(i); }
+    }
+
+    std::vector<uint8_t> source(drop_initial_bytes, 0xFFU);
+    auto                 packed_source = pack_bits(first_bits, qpl_p_be_packed_array == parser);
+    source.insert(source.end(), packed_source.begin(), packed_source.end());
+
+    auto                 source2 = pack_bits(second_bits, is_source2_be);
+    std::vector<uint8_t> destination(bit_count * sizeof(uint32_t), 0xAAU);
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    job_ptr->op                 = operation;
+    job_ptr->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST | (is_source2_be ? QPL_FLAG_SRC2_BE : 0U);
+    job_ptr->parser             = parser;
+    job_ptr->src1_bit_width     = 1U;
+    job_ptr->src2_bit_width     = 1U;
+    job_ptr->num_input_elements = bit_count;
+    job_ptr->out_bit_width      = out_format;
+    job_ptr->drop_initial_bytes = drop_initial_bytes;
+    job_ptr->next_in_ptr        = source.data();
+    job_ptr->available_in       = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr       = destination.data();
+    job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+    job_ptr->next_src2_ptr      = source2.data();
+    job_ptr->available_src2     = static_cast<uint32_t>(source2.size());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+    if (qpl_ow_nom == out_format) {
+        auto expected_bit_vector = pack_bits(expected_bits, false);
+
+        ASSERT_EQ(expected_bit_vector.size(), job_ptr->total_out);
+        destination.resize(job_ptr->total_out);
+        EXPECT_TRUE(CompareVectors(expected_bit_vector, destination));
+    } else {
+        ASSERT_EQ(expected_indices.size() * sizeof(uint32_t), job_ptr->total_out);
+        EXPECT_EQ(0, std::memcmp(expected_indices.data(), destination.data(), job_ptr->total_out));
+    }
+
+    EXPECT_EQ(expected_indices.size(), job_ptr->sum_value);
+
+    if (!expected_indices.empty()) {
+        EXPECT_EQ(expected_indices.front(), job_ptr->first_index_min_value);
+        EXPECT_EQ(expected_indices.back(), job_ptr->last_index_max_value);
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(bit_vector, operations) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    for (auto operation : {qpl_op_bit_and, qpl_op_bit_or, qpl_op_bit_and_not, qpl_op_bit_xor}) {
+        for (uint32_t bit_count : {1U, 63U, 512U, 1021U, 100003U}) {
+            for (auto parser : {qpl_p_le_packed_array, qpl_p_be_packed_array}) {
+                for (bool is_source2_be : {false, true}) {
+                    bit_vector_and_compare(operation, bit_count, 0U, parser, is_source2_be, qpl_ow_nom);
+                }
+            }
+
+            bit_vector_and_compare(operation, bit_count, 3U, qpl_p_le_packed_array, false, qpl_ow_nom);
+            bit_vector_and_compare(operation, bit_count, 0U, qpl_p_le_packed_array, false, qpl_ow_32);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(bit_vector, errors) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    std::vector<uint8_t> source(64U, 0xF0U);
+    std::vector<uint8_t> source2(64U, 0x0FU);
+    std::vector<uint8_t> destination(64U);
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    auto execute = [&](uint32_t src1_bit_width, uint32_t src2_bit_width, uint32_t source2_size) {
+        job_ptr->op                 = qpl_op_bit_or;
+        job_ptr->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job_ptr->parser             = qpl_p_le_packed_array;
+        job_ptr->src1_bit_width     = src1_bit_width;
+        job_ptr->src2_bit_width     = src2_bit_width;
+        job_ptr->num_input_elements = 512U;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->next_in_ptr        = source.data();
+        job_ptr->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+        job_ptr->next_src2_ptr      = source2.data();
+        job_ptr->available_src2     = source2_size;
+
+        return qpl_execute_job(job_ptr);
+    };
+
+    EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, execute(8U, 1U, 64U));
+    EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, execute(1U, 8U, 64U));
+    EXPECT_EQ(QPL_STS_SRC2_IS_SHORT_ERR, execute(1U, 1U, 63U));
+
+    if (qpl_path_hardware == path) {
+        EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, execute(1U, 1U, 64U));
+    } else {
+        EXPECT_EQ(QPL_STS_OK, execute(1U, 1U, 64U));
+        EXPECT_EQ(512U, job_ptr->sum_value);
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+} // namespace qpl::test
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests compress every dataset file with every supported compression level, check that the streams
+   decompress back and that a higher level doesn't lose compression ratio on the whole dataset. */
+
+namespace qpl::test {
+
+static constexpr qpl_compression_levels all_compression_levels[] = {qpl_level_1, qpl_level_3, qpl_level_4,
+                                                                    qpl_level_5, qpl_level_6, qpl_level_7,
+                                                                    qpl_level_8, qpl_level_9};
+
+static constexpr uint32_t high_ratio_op_classes = qpl_op_class_all | qpl_op_class_high_ratio_compression;
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(compression_levels, round_trip_and_ratio) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_by_class(path, high_ratio_op_classes, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    uint64_t previous_total_size = UINT64_MAX;
+
+    for (const auto level : all_compression_levels) {
+        uint64_t total_size = 0U;
+
+        for (auto& data : dataset.get_data()) {
+            std::vector<uint8_t> source      = data.second;
+            const auto           source_size = static_cast<uint32_t>(source.size());
+            if (0U == source_size) { continue; }
+
+            std::vector<uint8_t> compressed(source.size() * 2U + 1024U);
+            std::vector<uint8_t> decompressed(source.size());
+
+            ASSERT_EQ(QPL_STS_OK, qpl_init_job_by_class(path, high_ratio_op_classes, job_ptr));
+
+            job_ptr->op            = qpl_op_compress;
+            job_ptr->level         = level;
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+            job_ptr->next_in_ptr   = source.data();
+            job_ptr->available_in  = source_size;
+            job_ptr->next_out_ptr  = compressed.data();
+            job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first << ", level " << level;
+
+            const uint32_t compressed_size = job_ptr->total_out;
+            total_size += compressed_size;
+
+            job_ptr->op            = qpl_op_decompress;
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+            job_ptr->next_in_ptr   = compressed.data();
+            job_ptr->available_in  = compressed_size;
+            job_ptr->next_out_ptr  = decompressed.data();
+            job_ptr->available_out = source_size;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first << ", level " << level;
+            ASSERT_EQ(source_size, job_ptr->total_out) << data.first << ", level " << level;
+            ASSERT_EQ(0, std::memcmp(source.data(), decompressed.data(), source_size))
+                    << data.first << ", level " << level;
+        }
+
+        EXPECT_LE(total_size, previous_total_size) << "level " << level;
+
+        previous_total_size = total_size;
+    }
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(compression_levels, high_ratio_tables_on_request) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t default_size    = 0U;
+    uint32_t high_ratio_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &default_size));
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_by_class(path, high_ratio_op_classes, &high_ratio_size));
+    EXPECT_GT(high_ratio_size, default_size);
+
+    std::vector<uint8_t> source(4096U, 42U);
+    std::vector<uint8_t> compressed(source.size() * 2U);
+
+    auto job_buffer = std::make_unique<uint8_t[]>(default_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN;
+    job_ptr->next_in_ptr   = source.data();
+    job_ptr->available_in  = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr  = compressed.data();
+    job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+    // The default job has no room for the tables of the levels 4-9
+    job_ptr->level = qpl_level_4;
+    EXPECT_EQ(QPL_STS_OPERATION_ERR, run_job_api(job_ptr));
+
+    job_ptr->level = qpl_high_level;
+    EXPECT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+} // namespace qpl::test
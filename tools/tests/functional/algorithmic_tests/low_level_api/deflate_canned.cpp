@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 
 #include "huffman_table_unique.hpp"
@@ -575,4 +577,154 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_canned, crc_high_level, JobFixture)
                 << "Incorrect CRC in canned mode decompression when reusing job structure.";
     }
 }
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_canned, best_table_from_set, JobFixture) {
+    auto  path    = GetExecutionPath();
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset().get_data();
+
+    // One table per dataset file
+    std::vector<unique_huffman_table> tables;
+    std::vector<qpl_huffman_table_t>  table_set;
+
+    for (auto& data : dataset) {
+        source = data.second;
+
+        tables.emplace_back(deflate_huffman_table_maker(combined_table_type, path, DEFAULT_ALLOCATOR_C),
+                            any_huffman_table_deleter);
+        ASSERT_NE(tables.back().get(), nullptr) << "Huffman Table creation failed\n";
+
+        init_compression_huffman_table(tables.back().get(), source.data(), source.data() + source.size(),
+                                       qpl_default_level, path);
+        table_set.push_back(tables.back().get());
+    }
+
+    const auto table_count = static_cast<uint32_t>(table_set.size());
+
+    auto compress = [this](qpl_huffman_table_t table) {
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+        job_ptr->huffman_table = table;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_OMIT_VERIFY;
+        job_ptr->flags |= (nullptr != table) ? QPL_FLAG_CANNED_MODE : QPL_FLAG_DYNAMIC_HUFFMAN;
+
+        return run_job_api(job_ptr);
+    };
+
+    uint32_t file_index = 0U;
+    for (auto& data : dataset) {
+        source = data.second;
+        destination.resize(source.size() * 2U + 1024U);
+
+        uint32_t table_index = table_count + 1U;
+        ASSERT_EQ(QPL_STS_OK, qpl_huffman_table_select_best(source.data(), static_cast<uint32_t>(source.size()),
+                                                            table_set.data(), table_count, qpl_default_level,
+                                                            &table_index))
+                << data.first;
+        ASSERT_LE(table_index, table_count) << data.first;
+
+        // The table built for the file itself is the reference
+        ASSERT_EQ(QPL_STS_OK, compress(table_set[file_index])) << data.first;
+        const uint32_t reference_size = job_ptr->total_out;
+
+        const qpl_huffman_table_t table = (table_index < table_count) ? table_set[table_index] : nullptr;
+
+        ASSERT_EQ(QPL_STS_OK, compress(table)) << data.first;
+        EXPECT_LE(job_ptr->total_out, reference_size + reference_size / 10U + 64U) << data.first;
+
+        const uint32_t compressed_size = job_ptr->total_out;
+
+        std::vector<uint8_t> reference(source.size());
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->next_in_ptr   = destination.data();
+        job_ptr->available_in  = compressed_size;
+        job_ptr->next_out_ptr  = reference.data();
+        job_ptr->available_out = static_cast<uint32_t>(reference.size());
+        job_ptr->huffman_table = table;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job_ptr->flags |= (nullptr != table) ? QPL_FLAG_CANNED_MODE : 0U;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+        ASSERT_TRUE(CompareVectors(reference, source, static_cast<uint32_t>(source.size()), "File: " + data.first));
+
+        file_index++;
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(deflate_canned, statistics_with_options, JobFixture) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    auto path = GetExecutionPath();
+
+    for (auto& data : util::TestEnvironment::GetInstance().GetAlgorithmicDataset().get_data()) {
+        source = data.second;
+        destination.resize(source.size() * 2U + 1024U);
+
+        const auto source_size = static_cast<uint32_t>(source.size());
+
+        for (const auto method : {qpl_statistics_full, qpl_statistics_sampled, qpl_statistics_literals}) {
+            // The histogram does not depend on the number of threads
+            qpl_histogram          histogram {};
+            qpl_statistics_options options = {method, 2U, 1U};
+
+            ASSERT_EQ(QPL_STS_OK, qpl_gather_deflate_statistics_with_options(source.data(), source_size, &histogram,
+                                                                             qpl_default_level, path, &options))
+                    << data.first;
+
+            qpl_histogram threaded_histogram {};
+            options.num_threads = 0U;
+
+            ASSERT_EQ(QPL_STS_OK,
+                      qpl_gather_deflate_statistics_with_options(source.data(), source_size, &threaded_histogram,
+                                                                 qpl_default_level, path, &options))
+                    << data.first;
+            ASSERT_EQ(0, std::memcmp(&histogram, &threaded_histogram, sizeof(histogram))) << data.first;
+
+            if (qpl_statistics_literals == method) {
+                std::array<uint32_t, 256U> reference {};
+                for (const uint8_t symbol : source) {
+                    reference[symbol]++;
+                }
+
+                for (uint32_t i = 0U; i < reference.size(); i++) {
+                    ASSERT_EQ(std::max(reference[i], 1U), histogram.literal_lengths[i]) << data.first;
+                }
+            }
+
+            // Table built from the histogram is able to compress the whole source
+            const unique_huffman_table table(
+                    deflate_huffman_table_maker(combined_table_type, path, DEFAULT_ALLOCATOR_C),
+                    any_huffman_table_deleter);
+            ASSERT_NE(table.get(), nullptr) << "Huffman Table creation failed\n";
+            ASSERT_EQ(QPL_STS_OK, qpl_huffman_table_init_with_histogram(table.get(), &histogram)) << data.first;
+
+            job_ptr->op            = qpl_op_compress;
+            job_ptr->level         = qpl_default_level;
+            job_ptr->next_in_ptr   = source.data();
+            job_ptr->available_in  = source_size;
+            job_ptr->next_out_ptr  = destination.data();
+            job_ptr->available_out = static_cast<uint32_t>(destination.size());
+            job_ptr->huffman_table = table.get();
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_CANNED_MODE;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+
+            std::vector<uint8_t> reference(source.size());
+
+            job_ptr->op            = qpl_op_decompress;
+            job_ptr->next_in_ptr   = destination.data();
+            job_ptr->available_in  = job_ptr->total_out;
+            job_ptr->next_out_ptr  = reference.data();
+            job_ptr->available_out = static_cast<uint32_t>(reference.size());
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_CANNED_MODE;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+            ASSERT_TRUE(CompareVectors(reference, source, source_size, "File: " + data.first));
+        }
+    }
+}
 } // namespace qpl::test
@@ -5,6 +5,8 @@
  ******************************************************************************/
 
 #include <algorithm>
+#include <random>
+#include <vector>
 
 // tests_common
 #include "huffman_table_unique.hpp"
@@ -303,6 +305,70 @@ protected:
         }
     }
 
+    // Compresses the source with the table built for it and checks that Huffman only decompression restores it
+    void RunHuffmanOnlyRoundTripTest(const std::vector<uint8_t>& test_source, bool is_big_endian) {
+        source                   = test_source;
+        const uint32_t file_size = static_cast<uint32_t>(source.size());
+
+        destination.assign(file_size * 2U + 64U, 0U);
+        std::vector<uint8_t> reference_buffer(file_size, 0U);
+
+        const unique_huffman_table c_table(
+                huffman_only_huffman_table_maker(compression_table_type, GetExecutionPath(), DEFAULT_ALLOCATOR_C),
+                any_huffman_table_deleter);
+        ASSERT_NE(c_table.get(), nullptr) << "Compression Huffman Table creation failed\n";
+
+        job_ptr->op              = qpl_op_compress;
+        job_ptr->next_in_ptr     = source.data();
+        job_ptr->next_out_ptr    = destination.data();
+        job_ptr->available_in    = file_size;
+        job_ptr->available_out   = static_cast<uint32_t>(destination.size());
+        job_ptr->total_in        = 0;
+        job_ptr->total_out       = 0;
+        job_ptr->last_bit_offset = 0;
+        job_ptr->crc             = 0;
+        job_ptr->huffman_table   = c_table.get();
+        job_ptr->flags           = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_NO_HDRS | QPL_FLAG_GEN_LITERALS |
+                         QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY |
+                         ((is_big_endian) ? QPL_FLAG_HUFFMAN_BE : no_flag);
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "size " << file_size;
+
+        const unique_huffman_table d_table(
+                huffman_only_huffman_table_maker(decompression_table_type, GetExecutionPath(), DEFAULT_ALLOCATOR_C),
+                any_huffman_table_deleter);
+        ASSERT_NE(d_table.get(), nullptr) << "Decompression Huffman Table creation failed\n";
+
+        ASSERT_EQ(QPL_STS_OK, qpl_huffman_table_init_with_other(d_table.get(), c_table.get()));
+
+        decompression_job_ptr->op            = qpl_op_decompress;
+        decompression_job_ptr->next_in_ptr   = destination.data();
+        decompression_job_ptr->next_out_ptr  = reference_buffer.data();
+        decompression_job_ptr->available_in  = job_ptr->total_out;
+        decompression_job_ptr->available_out = file_size;
+        decompression_job_ptr->total_in      = 0;
+        decompression_job_ptr->total_out     = 0;
+        decompression_job_ptr->crc           = 0;
+        decompression_job_ptr->huffman_table = d_table.get();
+        decompression_job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_NO_HDRS |
+                                       ((is_big_endian) ? QPL_FLAG_HUFFMAN_BE : no_flag);
+        decompression_job_ptr->ignore_end_bits = (is_big_endian) ? (16 - job_ptr->last_bit_offset) & 15
+                                                                 : (8 - job_ptr->last_bit_offset) & 7;
+
+        const uint32_t status = run_job_api(decompression_job_ptr);
+
+        // IAA 1.0 limitation: cannot work if ignore_end_bits is greater than 7 bits for BE16 decompress
+        if (qpl_path_hardware == job_ptr->data_ptr.path && is_big_endian &&
+            decompression_job_ptr->ignore_end_bits > 7 && !are_iaa_gen_2_min_capabilities_present()) {
+            ASSERT_EQ(QPL_STS_HUFFMAN_BE_IGNORE_MORE_THAN_7_BITS_ERR, status);
+            return;
+        }
+
+        ASSERT_EQ(QPL_STS_OK, status) << "size " << file_size;
+        ASSERT_EQ(file_size, decompression_job_ptr->total_out) << "size " << file_size;
+        ASSERT_TRUE(CompareVectors(source, reference_buffer, file_size)) << "size " << file_size;
+    }
+
     // Huffman only compression on SW path was inefficient due to incorrect huffman table construction
     // ISAL routine to compute histogram for HT construction did not do huffman only
     // Manually computing the histogram with a for loop and then constructing HT works properly
@@ -400,4 +466,43 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, dynamic_correct_single_value_
     RunHuffmanOnlyDynamicCorrectnessTest();
 }
 
+/* Halving literal frequencies give codes up to the maximum 15 bits length, which are longer than the lookup index
+   of the software decoder, shuffled literals make long and short codes alternate in the stream. */
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, long_codes, DeflateTestHuffmanOnly) {
+    std::vector<uint8_t> long_codes_source;
+
+    for (uint32_t literal = 0U; literal < 24U; literal++) {
+        const uint32_t count = (literal < 16U) ? (1U << (16U - literal)) : 1U;
+        long_codes_source.insert(long_codes_source.end(), count, static_cast<uint8_t>(literal * 7U));
+    }
+
+    std::shuffle(long_codes_source.begin(), long_codes_source.end(), std::mt19937(42U));
+
+    for (const bool is_big_endian : {false, true}) {
+        RunHuffmanOnlyRoundTripTest(long_codes_source, is_big_endian);
+
+        if (HasFatalFailure()) { return; }
+    }
+}
+
+/* Software decoder resolves up to 3 literals per lookup, so every short source size is checked with 1, 2 and 4 bit
+   codes: several literals per lookup, stream end in the middle of an entry and 3 codes that take all lookup bits. */
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(huffman_only, lookup_entry_boundaries, DeflateTestHuffmanOnly) {
+    for (const uint32_t alphabet_size : {2U, 4U, 16U}) {
+        for (uint32_t size = 1U; size <= 40U; size++) {
+            std::vector<uint8_t> boundary_source(size);
+
+            for (uint32_t i = 0U; i < size; i++) {
+                boundary_source[i] = static_cast<uint8_t>('a' + (i * 5U + i / alphabet_size) % alphabet_size);
+            }
+
+            for (const bool is_big_endian : {false, true}) {
+                RunHuffmanOnlyRoundTripTest(boundary_source, is_big_endian);
+
+                if (HasFatalFailure()) { return; }
+            }
+        }
+    }
+}
+
 } // namespace qpl::test
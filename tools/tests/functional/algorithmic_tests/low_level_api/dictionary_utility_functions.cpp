@@ -6,6 +6,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
+#include <vector>
 
 #include "ta_ll_common.hpp"
 #include "util.hpp"
@@ -69,4 +71,106 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(dictionary, dictionary_id) {
 
     ASSERT_EQ(dictionary_id, dest) << "get_dictionary_id does not match the original id";
 }
+
+// qpl_train_dictionary() is given the dataset split into 1 KB samples, the trained content must fit
+// into the history size of the hardware level, and the dictionary built from it must be usable on software path
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(dictionary, train_dictionary) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    constexpr size_t sample_size  = 1024U;
+    constexpr size_t tested_count = 64U;
+
+    std::vector<uint8_t> samples;
+    std::vector<size_t>  sample_sizes;
+
+    for (auto& dataset : util::TestEnvironment::GetInstance().GetAlgorithmicDataset().get_data()) {
+        for (size_t offset = 0U; offset < dataset.second.size(); offset += sample_size) {
+            sample_sizes.push_back(std::min(sample_size, dataset.second.size() - offset));
+        }
+
+        samples.insert(samples.end(), dataset.second.begin(), dataset.second.end());
+    }
+
+    const auto sample_count = static_cast<uint32_t>(sample_sizes.size());
+
+    for (const hw_compression_level hw_compr_level : {HW_NONE, HW_LEVEL_1, HW_LEVEL_3}) {
+        const size_t history_size = (HW_LEVEL_1 == hw_compr_level) ? 2048U : 4096U;
+
+        std::vector<uint8_t>           dictionary_raw(2U * history_size);
+        size_t                         dictionary_size = dictionary_raw.size();
+        qpl_dictionary_training_report report {};
+
+        auto status = qpl_train_dictionary(samples.data(), sample_sizes.data(), sample_count, LEVEL_1,
+                                           hw_compr_level, dictionary_raw.data(), &dictionary_size, &report);
+        ASSERT_EQ(QPL_STS_OK, status);
+        ASSERT_GT(dictionary_size, 0U);
+        ASSERT_LE(dictionary_size, history_size);
+
+        ASSERT_EQ(sample_count, report.sample_count);
+        ASSERT_EQ(samples.size(), report.source_size);
+        ASSERT_GT(report.compressed_size, 0U);
+        ASSERT_GT(report.dictionary_compressed_size, 0U);
+
+        const size_t dictionary_buffer_size = qpl_get_dictionary_size(LEVEL_1, HW_NONE, dictionary_size);
+
+        auto            dictionary_buffer = std::make_unique<uint8_t[]>(dictionary_buffer_size);
+        qpl_dictionary* dictionary_ptr    = reinterpret_cast<qpl_dictionary*>(dictionary_buffer.get());
+
+        status = qpl_build_dictionary(dictionary_ptr, LEVEL_1, HW_NONE, dictionary_raw.data(), dictionary_size);
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        uint32_t job_size = 0U;
+        ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &job_size));
+
+        auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+        auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, job_ptr));
+
+        std::vector<uint8_t> compressed(2U * sample_size + 1024U);
+        std::vector<uint8_t> decompressed(sample_size);
+
+        const uint8_t* sample_ptr = samples.data();
+        for (uint32_t i = 0U; i < std::min<size_t>(tested_count, sample_count); sample_ptr += sample_sizes[i], i++) {
+            const auto source_size = static_cast<uint32_t>(sample_sizes[i]);
+
+            job_ptr->op            = qpl_op_compress;
+            job_ptr->level         = qpl_default_level;
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+            job_ptr->next_in_ptr   = const_cast<uint8_t*>(sample_ptr);
+            job_ptr->available_in  = source_size;
+            job_ptr->next_out_ptr  = compressed.data();
+            job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+            job_ptr->dictionary    = dictionary_ptr;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+            const uint32_t compressed_size = job_ptr->total_out;
+
+            job_ptr->op            = qpl_op_decompress;
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+            job_ptr->next_in_ptr   = compressed.data();
+            job_ptr->available_in  = compressed_size;
+            job_ptr->next_out_ptr  = decompressed.data();
+            job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+            job_ptr->dictionary    = dictionary_ptr;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+            ASSERT_EQ(source_size, job_ptr->total_out);
+            ASSERT_EQ(0, std::memcmp(sample_ptr, decompressed.data(), source_size));
+        }
+
+        ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+    }
+
+    // Sample sets that fit into the dictionary are used as is
+    const size_t         small_sizes[] = {100U, 200U, 300U};
+    size_t               small_size    = 4096U;
+    std::vector<uint8_t> dictionary_raw(small_size);
+
+    ASSERT_EQ(QPL_STS_OK, qpl_train_dictionary(samples.data(), small_sizes, 3U, LEVEL_1, HW_NONE,
+                                               dictionary_raw.data(), &small_size, nullptr));
+    ASSERT_EQ(600U, small_size);
+    ASSERT_EQ(0, std::memcmp(samples.data(), dictionary_raw.data(), small_size));
+}
 } // namespace qpl::test
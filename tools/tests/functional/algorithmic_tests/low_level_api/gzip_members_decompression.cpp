@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests split every dataset file into parts, compress each part into its own gzip member
+   (plain or BGZF one that keeps the member size in the extra field) and decompress the concatenated
+   members with a single QPL_FLAG_GZIP_MODE | QPL_FLAG_PARALLEL job. */
+
+namespace qpl::test {
+
+static constexpr uint32_t gzip_member_part_size = 32U * 1024U;
+
+static void append_le(std::vector<uint8_t>& stream, uint32_t value, uint32_t byte_count) {
+    for (uint32_t i = 0U; i < byte_count; i++) {
+        stream.push_back(static_cast<uint8_t>(value >> (8U * i)));
+    }
+}
+
+static void append_member(qpl_job* job_ptr, const uint8_t* source_ptr, uint32_t source_size, bool is_bgzf,
+                          std::vector<uint8_t>& stream) {
+    std::vector<uint8_t> deflate_stream(source_size * 2U + 1024U);
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN;
+    job_ptr->next_in_ptr   = const_cast<uint8_t*>(source_ptr);
+    job_ptr->available_in  = source_size;
+    job_ptr->next_out_ptr  = deflate_stream.data();
+    job_ptr->available_out = static_cast<uint32_t>(deflate_stream.size());
+    job_ptr->total_in      = 0U;
+    job_ptr->total_out     = 0U;
+
+    if (!is_bgzf) { job_ptr->flags |= QPL_FLAG_GZIP_MODE; }
+
+    ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+    if (!is_bgzf) {
+        stream.insert(stream.end(), deflate_stream.begin(), deflate_stream.begin() + job_ptr->total_out);
+        return;
+    }
+
+    // BGZF header: gzip header with the "BC" extra subfield that keeps the member size minus one
+    constexpr uint32_t bgzf_header_size  = 18U;
+    constexpr uint32_t gzip_trailer_size = 8U;
+
+    const uint32_t member_size = bgzf_header_size + job_ptr->total_out + gzip_trailer_size;
+
+    const uint8_t header[] = {0x1F, 0x8B, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+                              0x00, 0xFF, 0x06, 0x00, 'B',  'C',  0x02, 0x00};
+    stream.insert(stream.end(), std::begin(header), std::end(header));
+    append_le(stream, member_size - 1U, 2U);
+
+    stream.insert(stream.end(), deflate_stream.begin(), deflate_stream.begin() + job_ptr->total_out);
+
+    append_le(stream, job_ptr->crc, 4U);
+    append_le(stream, source_size, 4U);
+}
+
+static void decompress_members_and_compare(bool is_bgzf) {
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    for (auto& data : dataset.get_data()) {
+        std::vector<uint8_t> source      = data.second;
+        const auto           source_size = static_cast<uint32_t>(source.size());
+        if (0U == source_size) { continue; }
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        std::vector<uint8_t> stream;
+        for (uint32_t offset = 0U; offset < source_size; offset += gzip_member_part_size) {
+            append_member(job_ptr, source.data() + offset, std::min(gzip_member_part_size, source_size - offset),
+                          is_bgzf, stream);
+        }
+
+        // Reference CRC32 of the whole file
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        std::vector<uint8_t> reference_stream(source.size() * 2U + 1024U);
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = source_size;
+        job_ptr->next_out_ptr  = reference_stream.data();
+        job_ptr->available_out = static_cast<uint32_t>(reference_stream.size());
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+
+        const uint32_t reference_crc = job_ptr->crc;
+
+        for (const uint32_t num_threads : {1U, 0U}) {
+            std::vector<uint8_t> decompressed(source.size());
+
+            ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+            job_ptr->op            = qpl_op_decompress;
+            job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE | QPL_FLAG_PARALLEL;
+            job_ptr->next_in_ptr   = stream.data();
+            job_ptr->available_in  = static_cast<uint32_t>(stream.size());
+            job_ptr->next_out_ptr  = decompressed.data();
+            job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+            job_ptr->num_threads   = num_threads;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+            ASSERT_EQ(stream.size(), job_ptr->total_in) << data.first;
+            ASSERT_EQ(source_size, job_ptr->total_out) << data.first;
+            ASSERT_EQ(0, std::memcmp(source.data(), decompressed.data(), source.size())) << data.first;
+            ASSERT_EQ(reference_crc, job_ptr->crc) << data.first;
+        }
+
+        // Mismatch between the data and the CRC32 of the last member is reported
+        stream[stream.size() - 8U] ^= 1U;
+
+        std::vector<uint8_t> decompressed(source.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE | QPL_FLAG_PARALLEL;
+        job_ptr->next_in_ptr   = stream.data();
+        job_ptr->available_in  = static_cast<uint32_t>(stream.size());
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+        EXPECT_EQ(QPL_STS_INTL_VERIFY_ERR, run_job_api(job_ptr)) << data.first;
+    }
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+/* Members of a few bytes end close to the next member header, so their ends can only be taken from the inflate,
+   job arguments are checked before the members are looked for. */
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(gzip_members_decompression, small_members) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> stream;
+
+    for (uint32_t part_size = 1U; part_size <= 16U; part_size++) {
+        const size_t part_offset = source.size();
+
+        for (uint32_t i = 0U; i < part_size; i++) {
+            source.push_back(static_cast<uint8_t>(part_size * 31U + i));
+        }
+
+        append_member(job_ptr, source.data() + part_offset, part_size, false, stream);
+    }
+
+    std::vector<uint8_t> decompressed(source.size());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE | QPL_FLAG_PARALLEL;
+    job_ptr->next_in_ptr   = stream.data();
+    job_ptr->available_in  = static_cast<uint32_t>(stream.size());
+    job_ptr->next_out_ptr  = decompressed.data();
+    job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+    ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+    ASSERT_EQ(stream.size(), job_ptr->total_in);
+    ASSERT_EQ(source.size(), job_ptr->total_out);
+    ASSERT_EQ(0, std::memcmp(source.data(), decompressed.data(), source.size()));
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    job_ptr->op            = qpl_op_decompress;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_GZIP_MODE | QPL_FLAG_PARALLEL;
+    job_ptr->next_in_ptr   = stream.data();
+    job_ptr->available_in  = static_cast<uint32_t>(stream.size());
+    job_ptr->next_out_ptr  = stream.data() + 1U;
+    job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+    EXPECT_EQ(QPL_STS_BUFFER_OVERLAP_ERR, run_job_api(job_ptr));
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(gzip_members_decompression, plain_members) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    decompress_members_and_compare(false);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(gzip_members_decompression, bgzf_members) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    decompress_members_and_compare(true);
+}
+
+} // namespace qpl::test
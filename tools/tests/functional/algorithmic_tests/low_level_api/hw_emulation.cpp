@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+
+/* These tests run descriptors through the device emulated in the -DQPL_HW_EMULATION=ON build. Jobs are created
+   on qpl_path_hardware whatever path is requested for the run, results are compared with the software path. */
+
+#if defined(QPL_HW_EMULATION)
+
+namespace qpl::test {
+
+static constexpr uint32_t emulation_job_count     = 256U;
+static constexpr uint32_t emulation_element_count = 4096U;
+
+/**
+ * @brief Allocates and initializes a job, the job is finalized together with its last owner
+ */
+static auto make_emulation_job(qpl_path_t path, uint32_t& status) -> std::shared_ptr<qpl_job> {
+    uint32_t job_size = 0U;
+
+    status = qpl_get_job_size(path, &job_size);
+    if (QPL_STS_OK != status) { return nullptr; }
+
+    auto* const job_ptr = reinterpret_cast<qpl_job*>(new uint8_t[job_size]);
+
+    status = qpl_init_job(path, job_ptr);
+
+    return std::shared_ptr<qpl_job>(job_ptr, [](qpl_job* ptr) {
+        qpl_fini_job(ptr);
+        delete[] reinterpret_cast<uint8_t*>(ptr);
+    });
+}
+
+static void set_scan_job(qpl_job* job_ptr, std::vector<uint8_t>& source, std::vector<uint8_t>& destination,
+                         uint32_t param) {
+    job_ptr->op                 = qpl_op_scan_le;
+    job_ptr->flags              = QPL_FLAG_OMIT_CHECKSUMS;
+    job_ptr->src1_bit_width     = 8U;
+    job_ptr->out_bit_width      = qpl_ow_nom;
+    job_ptr->param_low          = param;
+    job_ptr->num_input_elements = static_cast<uint32_t>(source.size());
+    job_ptr->next_in_ptr        = source.data();
+    job_ptr->available_in       = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr       = destination.data();
+    job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(hw_emulation, scan_with_full_work_queues) {
+    uint32_t status = QPL_STS_OK;
+
+    std::vector<std::shared_ptr<qpl_job>> jobs(emulation_job_count);
+    std::vector<std::vector<uint8_t>>     sources(emulation_job_count);
+    std::vector<std::vector<uint8_t>>     destinations(emulation_job_count);
+
+    for (uint32_t i = 0U; i < emulation_job_count; i++) {
+        jobs[i] = make_emulation_job(qpl_path_hardware, status);
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        sources[i].resize(emulation_element_count);
+        destinations[i].resize(emulation_element_count / 8U);
+
+        for (uint32_t j = 0U; j < emulation_element_count; j++) {
+            sources[i][j] = static_cast<uint8_t>(j * 7U + i);
+        }
+
+        set_scan_job(jobs[i].get(), sources[i], destinations[i], i % 256U);
+    }
+
+    // More jobs are kept in flight than the emulated work queues accept, a busy device is waited for
+    std::deque<uint32_t> in_flight;
+
+    for (uint32_t i = 0U; i < emulation_job_count; i++) {
+        status = qpl_submit_job(jobs[i].get());
+
+        while (QPL_STS_QUEUES_ARE_BUSY_ERR == status && !in_flight.empty()) {
+            ASSERT_EQ(QPL_STS_OK, qpl_wait_job(jobs[in_flight.front()].get()));
+            in_flight.pop_front();
+
+            status = qpl_submit_job(jobs[i].get());
+        }
+
+        ASSERT_EQ(QPL_STS_OK, status) << i;
+        in_flight.push_back(i);
+    }
+
+    for (const uint32_t i : in_flight) {
+        ASSERT_EQ(QPL_STS_OK, qpl_wait_job(jobs[i].get())) << i;
+    }
+
+    auto reference_job = make_emulation_job(qpl_path_software, status);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    std::vector<uint8_t> reference(emulation_element_count / 8U);
+
+    for (uint32_t i = 0U; i < emulation_job_count; i++) {
+        set_scan_job(reference_job.get(), sources[i], reference, i % 256U);
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(reference_job.get()));
+
+        ASSERT_EQ(reference_job->total_out, jobs[i]->total_out) << i;
+        ASSERT_EQ(reference_job->sum_value, jobs[i]->sum_value) << i;
+        ASSERT_EQ(reference_job->first_index_min_value, jobs[i]->first_index_min_value) << i;
+        ASSERT_EQ(reference_job->last_index_max_value, jobs[i]->last_index_max_value) << i;
+        ASSERT_EQ(0, std::memcmp(reference.data(), destinations[i].data(), reference.size())) << i;
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(hw_emulation, crc64) {
+    uint32_t status = QPL_STS_OK;
+
+    auto job = make_emulation_job(qpl_path_hardware, status);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    auto reference_job = make_emulation_job(qpl_path_software, status);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    std::vector<uint8_t> source(emulation_element_count);
+
+    for (uint32_t i = 0U; i < emulation_element_count; i++) {
+        source[i] = static_cast<uint8_t>(i * 13U);
+    }
+
+    for (auto* job_ptr : {job.get(), reference_job.get()}) {
+        job_ptr->op           = qpl_op_crc64;
+        job_ptr->flags        = QPL_FLAG_CRC64_BE;
+        job_ptr->crc64_poly   = 0x42F0E1EBA9EA3693ULL;
+        job_ptr->next_in_ptr  = source.data();
+        job_ptr->available_in = static_cast<uint32_t>(source.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+    }
+
+    ASSERT_EQ(reference_job->crc64, job->crc64);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(hw_emulation, deflate_is_not_emulated) {
+    std::vector<uint8_t> source(emulation_element_count, 42U);
+    std::vector<uint8_t> compressed(source.size() * 2U);
+    std::vector<uint8_t> decompressed(source.size());
+
+    uint32_t compressed_size = 0U;
+
+    // The device completes the deflate descriptors with an error, the auto path falls back to the host
+    for (const auto path : {qpl_path_hardware, qpl_path_auto}) {
+        const uint32_t expected_status = (qpl_path_hardware == path) ? QPL_STS_INTL_UNSUPPORTED_OPCODE : QPL_STS_OK;
+
+        uint32_t status = QPL_STS_OK;
+
+        auto job = make_emulation_job(path, status);
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        job->op            = qpl_op_compress;
+        job->level         = qpl_default_level;
+        job->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        job->next_in_ptr   = source.data();
+        job->available_in  = static_cast<uint32_t>(source.size());
+        job->next_out_ptr  = compressed.data();
+        job->available_out = static_cast<uint32_t>(compressed.size());
+
+        EXPECT_EQ(expected_status, qpl_execute_job(job.get())) << path;
+
+        if (qpl_path_auto == path) { compressed_size = job->total_out; }
+    }
+
+    for (const auto path : {qpl_path_hardware, qpl_path_auto}) {
+        const uint32_t expected_status = (qpl_path_hardware == path) ? QPL_STS_INTL_UNSUPPORTED_OPCODE : QPL_STS_OK;
+
+        uint32_t status = QPL_STS_OK;
+
+        auto job = make_emulation_job(path, status);
+        ASSERT_EQ(QPL_STS_OK, status);
+
+        job->op            = qpl_op_decompress;
+        job->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job->next_in_ptr   = compressed.data();
+        job->available_in  = compressed_size;
+        job->next_out_ptr  = decompressed.data();
+        job->available_out = static_cast<uint32_t>(decompressed.size());
+
+        EXPECT_EQ(expected_status, qpl_execute_job(job.get())) << path;
+    }
+
+    EXPECT_EQ(source, decompressed);
+}
+
+} // namespace qpl::test
+
+#endif //QPL_HW_EMULATION
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests compress every dataset file with indexing enabled and decompress the whole stream
+   with qpl_decompress_indexed, using a single and multiple deflate blocks. */
+
+namespace qpl::test {
+
+static constexpr uint32_t index_test_block_size = 32U * 1024U;
+
+static void decompress_indexed_and_compare(qpl_mini_block_size mini_block_size, bool is_multiple_blocks,
+                                           bool is_gzip) {
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    const uint32_t mini_block_bytes = 1U << (mini_block_size + 8U);
+
+    for (auto& data : dataset.get_data()) {
+        std::vector<uint8_t> source      = data.second;
+        const auto           source_size = static_cast<uint32_t>(source.size());
+        if (0U == source_size) { continue; }
+
+        const uint32_t block_size       = is_multiple_blocks ? index_test_block_size : source_size;
+        const uint32_t mini_block_count = (source_size + mini_block_bytes - 1U) / mini_block_bytes;
+        const uint32_t mini_blocks_per_block =
+                is_multiple_blocks ? index_test_block_size / mini_block_bytes : mini_block_count;
+
+        size_t table_size = 0U;
+        ASSERT_EQ(QPL_STS_OK, qpl_get_index_table_size(mini_block_count, mini_blocks_per_block, &table_size));
+
+        std::vector<uint64_t> indices(table_size / sizeof(uint64_t));
+        std::vector<uint8_t>  compressed(source.size() * 2U + 1024U);
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op              = qpl_op_compress;
+        job_ptr->level           = qpl_default_level;
+        job_ptr->mini_block_size = mini_block_size;
+        job_ptr->idx_array       = indices.data();
+        job_ptr->idx_max_size    = static_cast<uint32_t>(indices.size());
+        job_ptr->next_in_ptr     = source.data();
+        job_ptr->next_out_ptr    = compressed.data();
+        job_ptr->available_out   = static_cast<uint32_t>(compressed.size());
+
+        uint32_t flags = QPL_FLAG_FIRST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_START_NEW_BLOCK;
+        if (is_gzip) { flags |= QPL_FLAG_GZIP_MODE; }
+
+        for (uint32_t offset = 0U; offset < source_size; offset += block_size) {
+            job_ptr->available_in = std::min(block_size, source_size - offset);
+            job_ptr->flags        = flags | ((offset + block_size >= source_size) ? QPL_FLAG_LAST : 0U);
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+
+            flags &= ~QPL_FLAG_FIRST;
+        }
+
+        const uint32_t compressed_size = job_ptr->total_out;
+
+        qpl_index_table table;
+        table.block_count           = (mini_block_count + mini_blocks_per_block - 1U) / mini_blocks_per_block;
+        table.mini_block_count      = mini_block_count;
+        table.mini_blocks_per_block = mini_blocks_per_block;
+        table.indices_ptr           = reinterpret_cast<qpl_index*>(indices.data());
+
+        for (const uint32_t num_threads : {1U, 0U}) {
+            std::vector<uint8_t> decompressed(source.size());
+
+            ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+            job_ptr->next_in_ptr     = compressed.data();
+            job_ptr->available_in    = compressed_size;
+            job_ptr->next_out_ptr    = decompressed.data();
+            job_ptr->available_out   = static_cast<uint32_t>(decompressed.size());
+            job_ptr->mini_block_size = mini_block_size;
+            job_ptr->num_threads     = num_threads;
+
+            ASSERT_EQ(QPL_STS_OK, qpl_decompress_indexed(job_ptr, &table)) << data.first;
+            ASSERT_EQ(source_size, job_ptr->total_out) << data.first;
+            ASSERT_EQ(0, std::memcmp(source.data(), decompressed.data(), source.size())) << data.first;
+            ASSERT_EQ(indices[2U * table.block_count + mini_block_count - 1U] >> 32U, job_ptr->crc) << data.first;
+        }
+
+        // Mismatch between the data and the stored CRC is reported
+        indices[2U * table.block_count + mini_block_count - 1U] ^= 1ULL << 32U;
+
+        std::vector<uint8_t> decompressed(source.size());
+
+        job_ptr->next_in_ptr   = compressed.data();
+        job_ptr->available_in  = compressed_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+        EXPECT_EQ(QPL_STS_INDEX_CRC_ERR, qpl_decompress_indexed(job_ptr, &table)) << data.first;
+
+        // Destination that can't keep the last byte is reported as short rather than as a CRC mismatch
+        indices[2U * table.block_count + mini_block_count - 1U] ^= 1ULL << 32U;
+
+        job_ptr->next_in_ptr   = compressed.data();
+        job_ptr->available_in  = compressed_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(decompressed.size()) - 1U;
+
+        EXPECT_EQ(QPL_STS_DST_IS_SHORT_ERR, qpl_decompress_indexed(job_ptr, &table)) << data.first;
+    }
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(index_parallel_decompression, single_block) {
+    decompress_indexed_and_compare(qpl_mblk_size_4k, false, false);
+    decompress_indexed_and_compare(qpl_mblk_size_32k, false, true);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(index_parallel_decompression, multiple_blocks) {
+    decompress_indexed_and_compare(qpl_mblk_size_512, true, false);
+    decompress_indexed_and_compare(qpl_mblk_size_8k, true, true);
+}
+
+} // namespace qpl::test
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests decompress every dataset file into a destination buffer that is smaller than the output,
+   so the job is resubmitted after each QPL_STS_MORE_OUTPUT_NEEDED, and check that the CRC32 accumulated
+   over all the chunks matches the one calculated during compression. */
+
+namespace qpl::test {
+
+static void decompress_in_chunks_and_compare_crc(uint32_t chunk_size) {
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    for (auto& data : dataset.get_data()) {
+        std::vector<uint8_t> source = data.second;
+        std::vector<uint8_t> compressed(source.size() * 2U + 1024U);
+        std::vector<uint8_t> decompressed(source.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr  = compressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << data.first;
+
+        const uint32_t compressed_size = job_ptr->total_out;
+        const uint32_t reference_crc   = job_ptr->crc;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op           = qpl_op_decompress;
+        job_ptr->flags        = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job_ptr->next_in_ptr  = compressed.data();
+        job_ptr->available_in = compressed_size;
+        job_ptr->next_out_ptr = decompressed.data();
+
+        qpl_status status = QPL_STS_MORE_OUTPUT_NEEDED;
+
+        while (QPL_STS_MORE_OUTPUT_NEEDED == status) {
+            job_ptr->available_out = std::min(chunk_size, static_cast<uint32_t>(source.size()) - job_ptr->total_out);
+
+            status = run_job_api(job_ptr);
+            job_ptr->flags &= ~QPL_FLAG_FIRST;
+        }
+
+        ASSERT_EQ(QPL_STS_OK, status) << data.first;
+        ASSERT_EQ(source.size(), job_ptr->total_out) << data.first;
+        ASSERT_EQ(0, std::memcmp(source.data(), decompressed.data(), source.size())) << data.first;
+        ASSERT_EQ(reference_crc, job_ptr->crc) << data.first;
+    }
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(inflate_checksums, crc32_with_output_chunks) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    for (const uint32_t chunk_size : {1024U, 4096U}) {
+        decompress_in_chunks_and_compare_crc(chunk_size);
+    }
+}
+
+} // namespace qpl::test
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests validate jobs initialized with qpl_init_job_by_class:
+   such jobs are smaller than the default ones, produce the same results for the requested operations
+   and reject the operations they were not initialized for. */
+
+namespace qpl::test {
+
+static std::unique_ptr<uint8_t[]> make_job_by_class(qpl_path_t path, uint32_t op_classes, qpl_job** job_ptr) {
+    uint32_t size = 0U;
+    if (QPL_STS_OK != qpl_get_job_size_by_class(path, op_classes, &size)) { return nullptr; }
+
+    auto job_buffer = std::make_unique<uint8_t[]>(size);
+    *job_ptr        = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    if (QPL_STS_OK != qpl_init_job_by_class(path, op_classes, *job_ptr)) { return nullptr; }
+
+    return job_buffer;
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(job_op_class, job_size) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t default_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &default_size));
+
+    uint32_t all_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_by_class(path, qpl_op_class_all, &all_size));
+    ASSERT_EQ(default_size, all_size);
+
+    for (uint32_t op_class : {qpl_op_class_compression, qpl_op_class_decompression, qpl_op_class_analytics}) {
+        uint32_t size = 0U;
+        ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_by_class(path, op_class, &size));
+        EXPECT_LE(size, default_size) << "Class " << op_class;
+    }
+
+    uint32_t crc_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size_by_class(path, qpl_op_class_crc, &crc_size));
+    EXPECT_LT(crc_size, default_size);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(job_op_class, compression_decompression) {
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    qpl_job* compression_job_ptr   = nullptr;
+    qpl_job* decompression_job_ptr = nullptr;
+
+    auto compression_job_buffer = make_job_by_class(path, qpl_op_class_compression, &compression_job_ptr);
+    ASSERT_NE(nullptr, compression_job_buffer);
+    auto decompression_job_buffer = make_job_by_class(path, qpl_op_class_decompression, &decompression_job_ptr);
+    ASSERT_NE(nullptr, decompression_job_buffer);
+
+    for (auto& data : dataset.get_data()) {
+        std::vector<uint8_t> source = data.second;
+        std::vector<uint8_t> compressed(source.size() * 2U + 1024U);
+        std::vector<uint8_t> decompressed(source.size());
+
+        compression_job_ptr->op            = qpl_op_compress;
+        compression_job_ptr->level         = qpl_default_level;
+        compression_job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN;
+        compression_job_ptr->next_in_ptr   = source.data();
+        compression_job_ptr->available_in  = static_cast<uint32_t>(source.size());
+        compression_job_ptr->next_out_ptr  = compressed.data();
+        compression_job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+        compression_job_ptr->total_in      = 0U;
+        compression_job_ptr->total_out     = 0U;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(compression_job_ptr)) << data.first;
+
+        decompression_job_ptr->op            = qpl_op_decompress;
+        decompression_job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        decompression_job_ptr->next_in_ptr   = compressed.data();
+        decompression_job_ptr->available_in  = compression_job_ptr->total_out;
+        decompression_job_ptr->next_out_ptr  = decompressed.data();
+        decompression_job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+        decompression_job_ptr->total_in      = 0U;
+        decompression_job_ptr->total_out     = 0U;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(decompression_job_ptr)) << data.first;
+        ASSERT_EQ(source.size(), decompression_job_ptr->total_out) << data.first;
+        ASSERT_EQ(0, std::memcmp(source.data(), decompressed.data(), source.size())) << data.first;
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(job_op_class, analytics_and_crc64) {
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto  path    = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    qpl_job* analytics_job_ptr = nullptr;
+    qpl_job* crc_job_ptr       = nullptr;
+
+    auto analytics_job_buffer = make_job_by_class(path, qpl_op_class_analytics, &analytics_job_ptr);
+    ASSERT_NE(nullptr, analytics_job_buffer);
+    auto crc_job_buffer = make_job_by_class(path, qpl_op_class_crc, &crc_job_ptr);
+    ASSERT_NE(nullptr, crc_job_buffer);
+
+    std::vector<uint8_t> source = dataset.get_data().begin()->second;
+    std::vector<uint8_t> destination((source.size() + 7U) / 8U);
+
+    analytics_job_ptr->op                 = qpl_op_scan_lt;
+    analytics_job_ptr->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    analytics_job_ptr->next_in_ptr        = source.data();
+    analytics_job_ptr->available_in       = static_cast<uint32_t>(source.size());
+    analytics_job_ptr->next_out_ptr       = destination.data();
+    analytics_job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+    analytics_job_ptr->src1_bit_width     = 8U;
+    analytics_job_ptr->num_input_elements = static_cast<uint32_t>(source.size());
+    analytics_job_ptr->out_bit_width      = qpl_ow_nom;
+    analytics_job_ptr->param_low          = 128U;
+
+    ASSERT_EQ(QPL_STS_OK, run_job_api(analytics_job_ptr));
+
+    uint32_t expected_count = 0U;
+    for (const auto value : source) {
+        expected_count += (value < 128U) ? 1U : 0U;
+    }
+    EXPECT_EQ(expected_count, analytics_job_ptr->sum_value);
+
+    crc_job_ptr->op           = qpl_op_crc64;
+    crc_job_ptr->flags        = 0U;
+    crc_job_ptr->next_in_ptr  = source.data();
+    crc_job_ptr->available_in = static_cast<uint32_t>(source.size());
+    crc_job_ptr->crc64_poly   = 0x9A6C9329AC4BC9B5ULL;
+
+    ASSERT_EQ(QPL_STS_OK, run_job_api(crc_job_ptr));
+
+    // Operations the job was not initialized for are rejected
+    crc_job_ptr->op = qpl_op_scan_lt;
+    EXPECT_EQ(QPL_STS_OPERATION_ERR, run_job_api(crc_job_ptr));
+
+    analytics_job_ptr->op = qpl_op_compress;
+    EXPECT_EQ(QPL_STS_OPERATION_ERR, run_job_api(analytics_job_ptr));
+}
+
+/* Operations outside of the job classes are rejected before the job is dispatched to any path,
+   so the check is done on every path the library can initialize a job for. */
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(job_op_class, rejected_on_every_path) {
+    std::vector<uint8_t> source(4096U, 7U);
+    std::vector<uint8_t> destination(source.size() * 2U);
+
+    for (const auto path : {qpl_path_software, qpl_path_hardware, qpl_path_auto}) {
+        qpl_job* crc_job_ptr    = nullptr;
+        auto     crc_job_buffer = make_job_by_class(path, qpl_op_class_crc, &crc_job_ptr);
+
+        // Accelerator is not available
+        if (nullptr == crc_job_buffer) { continue; }
+
+        for (const auto operation : {qpl_op_compress, qpl_op_decompress, qpl_op_scan_lt, qpl_op_extract}) {
+            crc_job_ptr->op            = operation;
+            crc_job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+            crc_job_ptr->next_in_ptr   = source.data();
+            crc_job_ptr->available_in  = static_cast<uint32_t>(source.size());
+            crc_job_ptr->next_out_ptr  = destination.data();
+            crc_job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+            EXPECT_EQ(QPL_STS_OPERATION_ERR, qpl_execute_job(crc_job_ptr)) << "path " << path << ", op " << operation;
+            EXPECT_EQ(QPL_STS_OPERATION_ERR, qpl_submit_job(crc_job_ptr)) << "path " << path << ", op " << operation;
+        }
+
+        EXPECT_EQ(QPL_STS_OK, qpl_fini_job(crc_job_ptr)) << "path " << path;
+    }
+}
+
+} // namespace qpl::test
@@ -144,4 +144,30 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(job_reusage, compression_by_chunks_high_le
     CompressWithJobReusage(true, qpl_high_level);
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(job_reusage, compression_high_ratio_levels, JobReusageTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == JobReusageTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support high compression levels on the hardware path";
+        }
+        return;
+    }
+
+    for (auto level : {qpl_level_4, qpl_level_5, qpl_level_6, qpl_level_7, qpl_level_8, qpl_level_9}) {
+        CompressWithJobReusage(false, level);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(job_reusage, compression_by_chunks_high_ratio_levels, JobReusageTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == JobReusageTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support high compression levels on the hardware path";
+        }
+        return;
+    }
+
+    for (auto level : {qpl_level_4, qpl_level_5, qpl_level_6, qpl_level_7, qpl_level_8, qpl_level_9}) {
+        CompressWithJobReusage(true, level);
+    }
+}
+
 } // namespace qpl::test
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests compress inputs around the split size of the parallel software deflate with QPL_FLAG_PARALLEL,
+   decompress the result and compare the data and the checksums with a regular single job compression. */
+
+namespace qpl::test {
+
+static constexpr uint32_t parallel_deflate_split_size = 512U * 1024U;
+
+static auto make_parallel_deflate_source(uint32_t size) -> std::vector<uint8_t> {
+    auto& dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+
+    std::vector<uint8_t> source;
+    source.reserve(size);
+
+    while (source.size() < size) {
+        for (auto& data : dataset.get_data()) {
+            const size_t count = std::min(data.second.size(), size - source.size());
+            source.insert(source.end(), data.second.begin(), data.second.begin() + count);
+        }
+    }
+
+    return source;
+}
+
+static void compress_parallel_and_compare(uint32_t size, uint32_t mode_flags) {
+    // Streams are decompressed by the test itself, so the built-in verification is not needed
+    mode_flags |= QPL_FLAG_OMIT_VERIFY;
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    const std::vector<uint8_t> source = make_parallel_deflate_source(size);
+
+    std::vector<uint8_t> reference(size + size / 8U + 1024U);
+    std::vector<uint8_t> compressed(reference.size());
+
+    // Single job compression gives the reference checksums and trailer
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | mode_flags;
+    job_ptr->next_in_ptr   = const_cast<uint8_t*>(source.data());
+    job_ptr->available_in  = size;
+    job_ptr->next_out_ptr  = reference.data();
+    job_ptr->available_out = static_cast<uint32_t>(reference.size());
+
+    ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+    const uint32_t reference_size = job_ptr->total_out;
+    const uint32_t reference_crc  = job_ptr->crc;
+
+    for (const uint32_t num_threads : {0U, 2U, 3U}) {
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_PARALLEL | mode_flags;
+        job_ptr->next_in_ptr   = const_cast<uint8_t*>(source.data());
+        job_ptr->available_in  = size;
+        job_ptr->next_out_ptr  = compressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+        job_ptr->num_threads   = num_threads;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << num_threads;
+        ASSERT_EQ(size, job_ptr->total_in) << num_threads;
+        ASSERT_EQ(reference_crc, job_ptr->crc) << num_threads;
+
+        const uint32_t compressed_size = job_ptr->total_out;
+
+        // Gzip and zlib trailers keep CRC32 and Adler32 of the whole input
+        if (mode_flags & (QPL_FLAG_GZIP_MODE | QPL_FLAG_ZLIB_MODE)) {
+            const uint32_t trailer_size = (mode_flags & QPL_FLAG_GZIP_MODE) ? 8U : 4U;
+
+            ASSERT_EQ(0, std::memcmp(reference.data() + reference_size - trailer_size,
+                                     compressed.data() + compressed_size - trailer_size, trailer_size))
+                    << num_threads;
+        }
+
+        std::vector<uint8_t> decompressed(size);
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | (mode_flags & (QPL_FLAG_GZIP_MODE | QPL_FLAG_ZLIB_MODE));
+        job_ptr->next_in_ptr   = compressed.data();
+        job_ptr->available_in  = compressed_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = size;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << num_threads;
+        ASSERT_EQ(size, job_ptr->total_out) << num_threads;
+        ASSERT_EQ(0, std::memcmp(source.data(), decompressed.data(), size)) << num_threads;
+
+        // Zlib decompression reports Adler32 in the crc field, so it is compared with the trailer above only
+        if (!(mode_flags & QPL_FLAG_ZLIB_MODE)) { ASSERT_EQ(reference_crc, job_ptr->crc) << num_threads; }
+    }
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+static void compress_parallel_around_split_size(uint32_t mode_flags) {
+    // Input just below two parts is compressed in a single pass, just above it is split
+    for (const uint32_t size : {2U * parallel_deflate_split_size - 1U, 2U * parallel_deflate_split_size + 1U,
+                                4U * parallel_deflate_split_size + 7U}) {
+        compress_parallel_and_compare(size, mode_flags);
+
+        if (::testing::Test::HasFatalFailure()) { return; }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_deflate, raw_dynamic_huffman) {
+    compress_parallel_around_split_size(QPL_FLAG_DYNAMIC_HUFFMAN);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_deflate, raw_fixed_huffman) {
+    compress_parallel_around_split_size(0U);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_deflate, gzip_dynamic_huffman) {
+    compress_parallel_around_split_size(QPL_FLAG_GZIP_MODE | QPL_FLAG_DYNAMIC_HUFFMAN);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_deflate, gzip_fixed_huffman) {
+    compress_parallel_around_split_size(QPL_FLAG_GZIP_MODE);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_deflate, zlib_dynamic_huffman) {
+    compress_parallel_around_split_size(QPL_FLAG_ZLIB_MODE | QPL_FLAG_DYNAMIC_HUFFMAN);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_deflate, zlib_fixed_huffman) {
+    compress_parallel_around_split_size(QPL_FLAG_ZLIB_MODE);
+}
+
+} // namespace qpl::test
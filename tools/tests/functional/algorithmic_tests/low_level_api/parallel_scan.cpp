@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests scan inputs of several segments with QPL_FLAG_PARALLEL and compare the bit-vector, aggregates
+   and checksums with a single software path job. The hardware path doesn't split jobs. On hosts without
+   the accelerator the auto path job is split between the host threads only. */
+
+namespace qpl::test {
+
+static constexpr uint32_t parallel_scan_segment_size = 512U * 1024U;
+
+static void scan_in_parallel_and_compare(qpl_operation operation, uint32_t bit_width, qpl_parser parser,
+                                         uint32_t flags, uint32_t num_threads) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    // Two and a half segments with an incomplete last byte of the bit-vector
+    const uint32_t segment_elements = parallel_scan_segment_size * 8U / bit_width;
+    const uint32_t element_count    = segment_elements * 5U / 2U + 13U;
+    const uint32_t source_size =
+            static_cast<uint32_t>((static_cast<uint64_t>(element_count) * bit_width + 7U) / 8U);
+
+    std::mt19937         random_generator(bit_width * 131U + operation);
+    std::vector<uint8_t> source(source_size);
+
+    for (auto& byte : source) {
+        byte = static_cast<uint8_t>(random_generator() & random_generator());
+    }
+
+    const uint32_t max_value  = (32U == bit_width) ? UINT32_MAX : (1U << bit_width) - 1U;
+    const uint32_t param_low  = max_value / 4U;
+    const uint32_t param_high = max_value / 2U;
+
+    std::vector<uint8_t> reference_destination(source_size / bit_width + 64U, 0xAAU);
+    std::vector<uint8_t> destination(reference_destination.size(), 0xAAU);
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &job_size));
+    auto reference_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto reference_ptr    = reinterpret_cast<qpl_job*>(reference_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, reference_ptr));
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    for (auto* current_ptr : {reference_ptr, job_ptr}) {
+        auto& current_destination = (current_ptr == job_ptr) ? destination : reference_destination;
+
+        current_ptr->op                 = operation;
+        current_ptr->flags              = flags | ((current_ptr == job_ptr) ? QPL_FLAG_PARALLEL : 0U);
+        current_ptr->parser             = parser;
+        current_ptr->src1_bit_width     = bit_width;
+        current_ptr->num_input_elements = element_count;
+        current_ptr->out_bit_width      = qpl_ow_nom;
+        current_ptr->param_low          = param_low;
+        current_ptr->param_high         = param_high;
+        current_ptr->next_in_ptr        = source.data();
+        current_ptr->available_in       = source_size;
+        current_ptr->next_out_ptr       = current_destination.data();
+        current_ptr->available_out      = static_cast<uint32_t>(current_destination.size());
+        current_ptr->num_threads        = num_threads;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(current_ptr));
+    }
+
+    EXPECT_EQ(reference_ptr->total_in, job_ptr->total_in);
+    EXPECT_EQ(reference_ptr->total_out, job_ptr->total_out);
+    EXPECT_EQ(reference_ptr->available_out, job_ptr->available_out);
+    EXPECT_EQ(reference_ptr->last_bit_offset, job_ptr->last_bit_offset);
+    EXPECT_EQ(reference_ptr->first_index_min_value, job_ptr->first_index_min_value);
+    EXPECT_EQ(reference_ptr->last_index_max_value, job_ptr->last_index_max_value);
+    EXPECT_EQ(reference_ptr->sum_value, job_ptr->sum_value);
+    EXPECT_EQ(reference_ptr->crc, job_ptr->crc);
+    EXPECT_EQ(reference_ptr->xor_checksum, job_ptr->xor_checksum);
+    EXPECT_TRUE(CompareVectors(reference_destination, destination));
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(reference_ptr));
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_scan, operations) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    for (auto operation : {qpl_op_scan_eq, qpl_op_scan_ne, qpl_op_scan_lt, qpl_op_scan_le, qpl_op_scan_gt,
+                           qpl_op_scan_ge, qpl_op_scan_range, qpl_op_scan_not_range}) {
+        scan_in_parallel_and_compare(operation, 8U, qpl_p_le_packed_array, 0U, 0U);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_scan, bit_widths) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    for (uint32_t bit_width : {1U, 3U, 13U, 16U, 27U, 32U}) {
+        for (auto parser : {qpl_p_le_packed_array, qpl_p_be_packed_array}) {
+            scan_in_parallel_and_compare(qpl_op_scan_range, bit_width, parser, 0U, 0U);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(parallel_scan, flags_and_threads) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    for (uint32_t flags : {QPL_FLAG_OUT_BE, QPL_FLAG_OMIT_AGGREGATES, QPL_FLAG_OMIT_CHECKSUMS}) {
+        scan_in_parallel_and_compare(qpl_op_scan_lt, 5U, qpl_p_le_packed_array, flags, 0U);
+    }
+
+    for (uint32_t num_threads : {1U, 2U, 3U}) {
+        scan_in_parallel_and_compare(qpl_op_scan_ge, 8U, qpl_p_le_packed_array, 0U, num_threads);
+    }
+}
+
+} // namespace qpl::test
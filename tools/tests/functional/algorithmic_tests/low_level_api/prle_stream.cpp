@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <random>
 #include <vector>
 
 #include "prle_generator.hpp"
@@ -28,6 +29,11 @@ constexpr uint32_t rle_burst_src2_bit_width = 11U;
 
 constexpr qpl_parser second_source_parser = qpl_p_le_packed_array;
 
+constexpr uint32_t mixed_stream_group_count = 48U;
+constexpr uint32_t mixed_stream_cut_count   = 5U;
+
+constexpr uint32_t cut_group_elements_left = 5U;
+
 namespace qpl::test {
 
 typedef qpl_status (*reference_function_ptr_t)(qpl_job*);
@@ -80,6 +86,136 @@ public:
         ASSERT_TRUE(CompareVectors(destination, reference_destination, job_ptr->total_out));
     }
 
+    /**
+     * Creates a stream of long and short RLE runs mixed with bit-packed groups, the last group is cut
+     * by the number of elements.
+     */
+    auto create_mixed_groups_source(uint32_t bit_width) -> uint32_t {
+        std::mt19937   random_generator(GetSeed());
+        const uint32_t max_value      = static_cast<uint32_t>((1ULL << bit_width) - 1U);
+        const uint32_t run_values[]   = {0U, max_value / 3U, max_value / 2U, max_value};
+        uint32_t       elements_count = 0U;
+
+        source.assign(1U, static_cast<uint8_t>(bit_width));
+
+        for (uint32_t group = 0U; group < mixed_stream_group_count; group++) {
+            if (0U == group % 3U) {
+                const uint32_t octets_count = 1U + random_generator() % 16U;
+                auto           header       = create_prle_header(prle_encoding_t::parquet, octets_count);
+                const size_t   values_begin = source.size() + header.size();
+
+                source.insert(source.end(), header.begin(), header.end());
+                source.resize(values_begin + octets_count * bit_width, 0U);
+
+                for (uint32_t i = 0U; i < octets_count * parquet_group_size; i++) {
+                    const uint64_t value = random_generator() & max_value;
+
+                    for (uint32_t bit = 0U; bit < bit_width; bit++) {
+                        const uint64_t bit_index = static_cast<uint64_t>(i) * bit_width + bit;
+                        const uint64_t bit_value = (value >> bit) & 1U;
+
+                        source[values_begin + bit_index / 8U] |= static_cast<uint8_t>(bit_value << (bit_index % 8U));
+                    }
+                }
+
+                elements_count += octets_count * parquet_group_size;
+            } else {
+                rle_element_t rle_element;
+                rle_element.bit_width     = bit_width;
+                rle_element.element_value = run_values[random_generator() % 4U];
+                rle_element.repeat_count  = (1U == group % 3U) ? 1U + random_generator() % 63U
+                                                               : 64U + random_generator() % 20000U;
+
+                auto rle_group = create_rle_group(rle_element);
+                source.insert(source.end(), rle_group.begin(), rle_group.end());
+
+                elements_count += rle_element.repeat_count;
+            }
+        }
+
+        return elements_count - mixed_stream_cut_count;
+    }
+
+    template <reference_function_ptr_t reference_function_ptr>
+    void verify_operation_on_mixed_groups(uint32_t bit_width) {
+        const uint32_t elements_count   = create_mixed_groups_source(bit_width);
+        const uint32_t destination_size = elements_count * (bits_to_bytes(bit_width));
+
+        destination.assign(destination_size, 0U);
+        reference_destination.assign(destination_size, 0U);
+
+        for (auto* current_job_ptr : {job_ptr, reference_job_ptr}) {
+            current_job_ptr->next_in_ptr        = source.data();
+            current_job_ptr->available_in       = static_cast<uint32_t>(source.size());
+            current_job_ptr->num_input_elements = elements_count;
+            current_job_ptr->parser             = qpl_p_parquet_rle;
+            current_job_ptr->src1_bit_width     = bit_width;
+        }
+
+        job_ptr->next_out_ptr            = destination.data();
+        job_ptr->available_out           = static_cast<uint32_t>(destination.size());
+        reference_job_ptr->next_out_ptr  = reference_destination.data();
+        reference_job_ptr->available_out = static_cast<uint32_t>(reference_destination.size());
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+        ASSERT_EQ(QPL_STS_OK, reference_function_ptr(reference_job_ptr));
+
+        ASSERT_EQ(reference_job_ptr->total_out, job_ptr->total_out);
+        ASSERT_TRUE(CompareVectors(destination, reference_destination, job_ptr->total_out));
+    }
+
+    /**
+     * Runs the operation on a single bit-packed run, whose last group is cut by the number of elements
+     * and starts fewer than 8 elements before the end.
+     */
+    template <reference_function_ptr_t reference_function_ptr>
+    void verify_operation_on_cut_bit_packed_group(uint32_t bit_width, uint32_t octets_count) {
+        const uint32_t max_value      = static_cast<uint32_t>((1ULL << bit_width) - 1U);
+        const uint32_t elements_count = (octets_count - 1U) * parquet_group_size + cut_group_elements_left;
+
+        auto         header       = create_prle_header(prle_encoding_t::parquet, octets_count);
+        const size_t values_begin = 1U + header.size();
+
+        source.assign(1U, static_cast<uint8_t>(bit_width));
+        source.insert(source.end(), header.begin(), header.end());
+        source.resize(values_begin + octets_count * bit_width, 0U);
+
+        for (uint32_t i = 0U; i < octets_count * parquet_group_size; i++) {
+            const uint64_t value = (i * 7U + 1U) & max_value;
+
+            for (uint32_t bit = 0U; bit < bit_width; bit++) {
+                const uint64_t bit_index = static_cast<uint64_t>(i) * bit_width + bit;
+                const uint64_t bit_value = (value >> bit) & 1U;
+
+                source[values_begin + bit_index / 8U] |= static_cast<uint8_t>(bit_value << (bit_index % 8U));
+            }
+        }
+
+        const uint32_t destination_size = elements_count * (bits_to_bytes(bit_width));
+
+        destination.assign(destination_size, 0U);
+        reference_destination.assign(destination_size, 0U);
+
+        for (auto* current_job_ptr : {job_ptr, reference_job_ptr}) {
+            current_job_ptr->next_in_ptr        = source.data();
+            current_job_ptr->available_in       = static_cast<uint32_t>(source.size());
+            current_job_ptr->num_input_elements = elements_count;
+            current_job_ptr->parser             = qpl_p_parquet_rle;
+            current_job_ptr->src1_bit_width     = bit_width;
+        }
+
+        job_ptr->next_out_ptr            = destination.data();
+        job_ptr->available_out           = static_cast<uint32_t>(destination.size());
+        reference_job_ptr->next_out_ptr  = reference_destination.data();
+        reference_job_ptr->available_out = static_cast<uint32_t>(reference_destination.size());
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+        ASSERT_EQ(QPL_STS_OK, reference_function_ptr(reference_job_ptr));
+
+        ASSERT_EQ(reference_job_ptr->total_out, job_ptr->total_out);
+        ASSERT_TRUE(CompareVectors(destination, reference_destination, job_ptr->total_out));
+    }
+
     void verify_rle_burst_on_single_rle_group(rle_element_t& rle_element) {
         auto parquet_group = create_rle_group(rle_element);
 
@@ -169,6 +305,63 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_parser, extract_large_single_rle_group
     verify_operation_on_single_rle_group<ref_extract>(rle_element);
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_parser, scan_mixed_groups, ParquetRLEParserTest) {
+    for (uint32_t bit_width : {1U, 5U, 8U, 13U, 16U, 24U, 32U}) {
+        const uint32_t max_value = static_cast<uint32_t>((1ULL << bit_width) - 1U);
+
+        for (auto operation : {qpl_op_scan_eq, qpl_op_scan_ne, qpl_op_scan_lt, qpl_op_scan_ge, qpl_op_scan_range,
+                               qpl_op_scan_not_range}) {
+            for (auto* current_job_ptr : {job_ptr, reference_job_ptr}) {
+                current_job_ptr->op         = operation;
+                current_job_ptr->param_low  = max_value / 3U;
+                current_job_ptr->param_high = max_value / 2U;
+            }
+
+            verify_operation_on_mixed_groups<ref_compare>(bit_width);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_parser, extract_mixed_groups, ParquetRLEParserTest) {
+    for (uint32_t bit_width : {1U, 5U, 8U, 13U, 16U, 24U, 32U}) {
+        for (auto* current_job_ptr : {job_ptr, reference_job_ptr}) {
+            current_job_ptr->op         = qpl_op_extract;
+            current_job_ptr->param_low  = extract_lower_index;
+            current_job_ptr->param_high = extract_upper_index * 100U;
+        }
+
+        verify_operation_on_mixed_groups<ref_extract>(bit_width);
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_parser, scan_cut_bit_packed_group, ParquetRLEParserTest) {
+    for (uint32_t bit_width : {1U, 5U, 8U, 17U, 32U}) {
+        for (auto* current_job_ptr : {job_ptr, reference_job_ptr}) {
+            current_job_ptr->op         = qpl_op_scan_ge;
+            current_job_ptr->param_low  = 8U;
+            current_job_ptr->param_high = 0U;
+        }
+
+        for (uint32_t octets_count : {1U, 2U, 1025U, 4097U}) {
+            verify_operation_on_cut_bit_packed_group<ref_compare>(bit_width, octets_count);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_parser, extract_cut_bit_packed_group, ParquetRLEParserTest) {
+    for (uint32_t bit_width : {1U, 5U, 8U, 17U, 32U}) {
+        for (auto* current_job_ptr : {job_ptr, reference_job_ptr}) {
+            current_job_ptr->op         = qpl_op_extract;
+            current_job_ptr->param_low  = 1U;
+            current_job_ptr->param_high = cut_group_elements_left - 2U;
+        }
+
+        for (uint32_t octets_count : {1U, 2U, 1025U, 4097U}) {
+            verify_operation_on_cut_bit_packed_group<ref_extract>(bit_width, octets_count);
+        }
+    }
+}
+
 QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(prle_parser, expand_large_single_rle_group, ParquetRLEParserTest) {
     job_ptr->op           = qpl_op_expand;
     reference_job_ptr->op = qpl_op_expand;
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests compare the scan in set results with the membership of every element checked one by one.
+   The set is passed either as a bitmap or as sorted 32-bit values. The accelerator has no set lookup,
+   so the hardware path reports QPL_STS_NOT_SUPPORTED_MODE_ERR. */
+
+namespace qpl::test {
+
+static constexpr uint32_t scan_in_set_element_count = 5003U;
+
+static auto pack_elements(const std::vector<uint32_t>& elements, uint32_t bit_width, qpl_parser parser)
+        -> std::vector<uint8_t> {
+    std::vector<uint8_t> source((static_cast<uint64_t>(elements.size()) * bit_width + 7U) / 8U, 0U);
+
+    uint64_t bit_index = 0U;
+
+    for (auto element : elements) {
+        for (uint32_t bit = 0U; bit < bit_width; bit++, bit_index++) {
+            const uint32_t value_bit = (qpl_p_be_packed_array == parser) ? bit_width - 1U - bit : bit;
+
+            if ((element >> value_bit) & 1U) {
+                source[bit_index / 8U] |= (qpl_p_be_packed_array == parser) ? 0x80U >> (bit_index % 8U)
+                                                                            : 1U << (bit_index % 8U);
+            }
+        }
+    }
+
+    return source;
+}
+
+static void scan_in_set_and_compare(uint32_t bit_width, uint32_t set_size, uint32_t src2_bit_width,
+                                    qpl_parser parser, qpl_out_format out_format) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    const uint32_t max_value = (32U == bit_width) ? UINT32_MAX : (1U << bit_width) - 1U;
+
+    std::mt19937 random_generator(bit_width * 131U + set_size);
+
+    std::vector<uint32_t> set_values(set_size);
+    for (auto& value : set_values) {
+        value = static_cast<uint32_t>(random_generator()) & max_value;
+    }
+    std::sort(set_values.begin(), set_values.end());
+
+    // Half of the elements are taken from the set
+    std::vector<uint32_t> elements(scan_in_set_element_count);
+    for (auto& element : elements) {
+        element = (random_generator() & 1U) ? set_values[random_generator() % set_size]
+                                            : static_cast<uint32_t>(random_generator()) & max_value;
+    }
+
+    std::vector<uint8_t> set;
+
+    if (1U == src2_bit_width) {
+        set.resize((static_cast<uint64_t>(max_value) + 8U) / 8U, 0U);
+
+        for (auto value : set_values) {
+            set[value / 8U] |= 1U << (value % 8U);
+        }
+    } else {
+        set.resize(set_values.size() * sizeof(uint32_t));
+        std::memcpy(set.data(), set_values.data(), set.size());
+    }
+
+    std::vector<uint32_t> expected_indices;
+    for (uint32_t i = 0U; i < scan_in_set_element_count; i++) {
+        if (std::binary_search(set_values.begin(), set_values.end(), elements[i])) { expected_indices.push_back(i); }
+    }
+
+    auto                 source = pack_elements(elements, bit_width, parser);
+    std::vector<uint8_t> destination(scan_in_set_element_count * sizeof(uint32_t), 0xAAU);
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    job_ptr->op                 = qpl_op_scan_in_set;
+    job_ptr->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    job_ptr->parser             = parser;
+    job_ptr->src1_bit_width     = bit_width;
+    job_ptr->num_input_elements = scan_in_set_element_count;
+    job_ptr->out_bit_width      = out_format;
+    job_ptr->next_in_ptr        = source.data();
+    job_ptr->available_in       = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr       = destination.data();
+    job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+    job_ptr->next_src2_ptr      = set.data();
+    job_ptr->available_src2     = static_cast<uint32_t>(set.size());
+    job_ptr->src2_bit_width     = src2_bit_width;
+
+    ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+    if (qpl_ow_nom == out_format) {
+        std::vector<uint8_t> expected_bit_vector((scan_in_set_element_count + 7U) / 8U, 0U);
+
+        for (auto index : expected_indices) {
+            expected_bit_vector[index / 8U] |= 1U << (index % 8U);
+        }
+
+        ASSERT_EQ(expected_bit_vector.size(), job_ptr->total_out);
+        destination.resize(job_ptr->total_out);
+        EXPECT_TRUE(CompareVectors(expected_bit_vector, destination));
+    } else {
+        ASSERT_EQ(expected_indices.size() * sizeof(uint32_t), job_ptr->total_out);
+        EXPECT_EQ(0, std::memcmp(expected_indices.data(), destination.data(), job_ptr->total_out));
+    }
+
+    EXPECT_EQ(expected_indices.size(), job_ptr->sum_value);
+
+    if (!expected_indices.empty()) {
+        EXPECT_EQ(expected_indices.front(), job_ptr->first_index_min_value);
+        EXPECT_EQ(expected_indices.back(), job_ptr->last_index_max_value);
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(scan_in_set, bitmap) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    for (uint32_t bit_width : {1U, 5U, 8U, 12U, 16U}) {
+        for (auto parser : {qpl_p_le_packed_array, qpl_p_be_packed_array}) {
+            scan_in_set_and_compare(bit_width, 3U, 1U, parser, qpl_ow_nom);
+            scan_in_set_and_compare(bit_width, 100U, 1U, parser, qpl_ow_32);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(scan_in_set, sorted_values) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    for (uint32_t bit_width : {1U, 5U, 8U, 12U, 16U, 20U, 32U}) {
+        for (uint32_t set_size : {1U, 8U, 9U, 1000U}) {
+            for (auto parser : {qpl_p_le_packed_array, qpl_p_be_packed_array}) {
+                scan_in_set_and_compare(bit_width, set_size, 32U, parser, qpl_ow_nom);
+            }
+
+            scan_in_set_and_compare(bit_width, set_size, 32U, qpl_p_le_packed_array, qpl_ow_32);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(scan_in_set, set_errors) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    std::vector<uint8_t>  source(128U, 5U);
+    std::vector<uint8_t>  destination(64U);
+    std::vector<uint32_t> set_values = {7U, 5U, 3U};
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    auto execute = [&](uint32_t bit_width, uint32_t src2_bit_width, uint32_t set_byte_size) {
+        job_ptr->op                 = qpl_op_scan_in_set;
+        job_ptr->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job_ptr->parser             = qpl_p_le_packed_array;
+        job_ptr->src1_bit_width     = bit_width;
+        job_ptr->num_input_elements = 32U;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->next_in_ptr        = source.data();
+        job_ptr->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+        job_ptr->next_src2_ptr      = reinterpret_cast<uint8_t*>(set_values.data());
+        job_ptr->available_src2     = set_byte_size;
+        job_ptr->src2_bit_width     = src2_bit_width;
+
+        return qpl_execute_job(job_ptr);
+    };
+
+    EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, execute(8U, 8U, 12U));
+    EXPECT_EQ(QPL_STS_SIZE_ERR, execute(8U, 32U, 10U));
+
+    if (qpl_path_hardware == path) {
+        EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, execute(8U, 32U, 12U));
+    } else {
+        EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, execute(8U, 32U, 12U));
+        EXPECT_EQ(QPL_STS_SRC2_IS_SHORT_ERR, execute(8U, 1U, 12U));
+        EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, execute(17U, 1U, 12U));
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+} // namespace qpl::test
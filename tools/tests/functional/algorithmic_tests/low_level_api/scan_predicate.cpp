@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests compare the compound scan results with the predicate program evaluated for every element
+   one by one. The accelerator can't evaluate programs, so the hardware path reports
+   QPL_STS_NOT_SUPPORTED_MODE_ERR. */
+
+namespace qpl::test {
+
+static constexpr uint32_t scan_predicate_element_count = 5003U;
+
+static auto pack_predicate_elements(const std::vector<uint32_t>& elements, uint32_t bit_width, qpl_parser parser)
+        -> std::vector<uint8_t> {
+    std::vector<uint8_t> source((static_cast<uint64_t>(elements.size()) * bit_width + 7U) / 8U, 0U);
+
+    uint64_t bit_index = 0U;
+
+    for (auto element : elements) {
+        for (uint32_t bit = 0U; bit < bit_width; bit++, bit_index++) {
+            const uint32_t value_bit = (qpl_p_be_packed_array == parser) ? bit_width - 1U - bit : bit;
+
+            if ((element >> value_bit) & 1U) {
+                source[bit_index / 8U] |= (qpl_p_be_packed_array == parser) ? 0x80U >> (bit_index % 8U)
+                                                                            : 1U << (bit_index % 8U);
+            }
+        }
+    }
+
+    return source;
+}
+
+static bool is_comparison_true(qpl_operation comparator, uint32_t value, uint32_t low, uint32_t high) {
+    switch (comparator) {
+        case qpl_op_scan_eq: return value == low;
+        case qpl_op_scan_ne: return value != low;
+        case qpl_op_scan_lt: return value < low;
+        case qpl_op_scan_le: return value <= low;
+        case qpl_op_scan_gt: return value > low;
+        case qpl_op_scan_ge: return value >= low;
+        case qpl_op_scan_range: return value >= low && value <= high;
+        default: return value < low || value > high;
+    }
+}
+
+static bool is_predicate_true(const std::vector<qpl_scan_predicate>& program, uint32_t value, uint32_t max_value) {
+    std::vector<bool> results;
+
+    for (const auto& instruction : program) {
+        if (qpl_predicate_compare == instruction.opcode) {
+            // Parameters are truncated to the element bit width, the same as for the scan operation
+            results.push_back(is_comparison_true(instruction.comparator, value, instruction.param_low & max_value,
+                                                 instruction.param_high & max_value));
+        } else if (qpl_predicate_not == instruction.opcode) {
+            results.back() = !results.back();
+        } else {
+            const bool right = results.back();
+            results.pop_back();
+            results.back() = (qpl_predicate_and == instruction.opcode) ? results.back() && right
+                                                                       : results.back() || right;
+        }
+    }
+
+    return results.front();
+}
+
+static void scan_predicate_and_compare(uint32_t bit_width, const std::vector<qpl_scan_predicate>& program,
+                                       qpl_parser parser, qpl_out_format out_format) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    const uint32_t max_value = (32U == bit_width) ? UINT32_MAX : (1U << bit_width) - 1U;
+
+    std::mt19937 random_generator(bit_width * 131U + static_cast<uint32_t>(program.size()));
+
+    // Most of the elements are small to hit the parameters of the comparisons
+    std::vector<uint32_t> elements(scan_predicate_element_count);
+    for (auto& element : elements) {
+        element = (random_generator() & 1U) ? static_cast<uint32_t>(random_generator() % 256U) & max_value
+                                            : static_cast<uint32_t>(random_generator()) & max_value;
+    }
+
+    std::vector<uint32_t> expected_indices;
+    for (uint32_t i = 0U; i < scan_predicate_element_count; i++) {
+        if (is_predicate_true(program, elements[i], max_value)) { expected_indices.push_back(i); }
+    }
+
+    auto                 source = pack_predicate_elements(elements, bit_width, parser);
+    std::vector<uint8_t> destination(scan_predicate_element_count * sizeof(uint32_t), 0xAAU);
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    job_ptr->op                 = qpl_op_scan_predicate;
+    job_ptr->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    job_ptr->parser             = parser;
+    job_ptr->src1_bit_width     = bit_width;
+    job_ptr->num_input_elements = scan_predicate_element_count;
+    job_ptr->out_bit_width      = out_format;
+    job_ptr->next_in_ptr        = source.data();
+    job_ptr->available_in       = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr       = destination.data();
+    job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+    job_ptr->next_src2_ptr      = reinterpret_cast<uint8_t*>(const_cast<qpl_scan_predicate*>(program.data()));
+    job_ptr->available_src2     = static_cast<uint32_t>(program.size() * sizeof(qpl_scan_predicate));
+
+    ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+    if (qpl_ow_nom == out_format) {
+        std::vector<uint8_t> expected_bit_vector((scan_predicate_element_count + 7U) / 8U, 0U);
+
+        for (auto index : expected_indices) {
+            expected_bit_vector[index / 8U] |= 1U << (index % 8U);
+        }
+
+        ASSERT_EQ(expected_bit_vector.size(), job_ptr->total_out);
+        destination.resize(job_ptr->total_out);
+        EXPECT_TRUE(CompareVectors(expected_bit_vector, destination));
+    } else {
+        ASSERT_EQ(expected_indices.size() * sizeof(uint32_t), job_ptr->total_out);
+        EXPECT_EQ(0, std::memcmp(expected_indices.data(), destination.data(), job_ptr->total_out));
+    }
+
+    EXPECT_EQ(expected_indices.size(), job_ptr->sum_value);
+
+    if (!expected_indices.empty()) {
+        EXPECT_EQ(expected_indices.front(), job_ptr->first_index_min_value);
+        EXPECT_EQ(expected_indices.back(), job_ptr->last_index_max_value);
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(scan_predicate, programs) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    // 10 <= x < 100 and x != 42
+    const std::vector<qpl_scan_predicate> conjunction = {{qpl_predicate_compare, qpl_op_scan_ge, 10U, 0U},
+                                                         {qpl_predicate_compare, qpl_op_scan_lt, 100U, 0U},
+                                                         {qpl_predicate_and, qpl_op_scan_eq, 0U, 0U},
+                                                         {qpl_predicate_compare, qpl_op_scan_ne, 42U, 0U},
+                                                         {qpl_predicate_and, qpl_op_scan_eq, 0U, 0U}};
+
+    // x == 1 or not (5 <= x <= 200) or (x > 150 and x <= 160)
+    const std::vector<qpl_scan_predicate> disjunction = {{qpl_predicate_compare, qpl_op_scan_eq, 1U, 0U},
+                                                         {qpl_predicate_compare, qpl_op_scan_range, 5U, 200U},
+                                                         {qpl_predicate_not, qpl_op_scan_eq, 0U, 0U},
+                                                         {qpl_predicate_or, qpl_op_scan_eq, 0U, 0U},
+                                                         {qpl_predicate_compare, qpl_op_scan_gt, 150U, 0U},
+                                                         {qpl_predicate_compare, qpl_op_scan_le, 160U, 0U},
+                                                         {qpl_predicate_and, qpl_op_scan_eq, 0U, 0U},
+                                                         {qpl_predicate_or, qpl_op_scan_eq, 0U, 0U}};
+
+    const std::vector<qpl_scan_predicate> single = {{qpl_predicate_compare, qpl_op_scan_not_range, 3U, 7U}};
+
+    for (uint32_t bit_width : {1U, 5U, 8U, 12U, 16U, 20U, 32U}) {
+        for (const auto& program : {conjunction, disjunction, single}) {
+            for (auto parser : {qpl_p_le_packed_array, qpl_p_be_packed_array}) {
+                scan_predicate_and_compare(bit_width, program, parser, qpl_ow_nom);
+            }
+
+            scan_predicate_and_compare(bit_width, program, qpl_p_le_packed_array, qpl_ow_32);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(scan_predicate, program_errors) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    std::vector<uint8_t> source(128U, 5U);
+    std::vector<uint8_t> destination(64U);
+
+    const qpl_scan_predicate compare     = {qpl_predicate_compare, qpl_op_scan_eq, 5U, 0U};
+    const qpl_scan_predicate logical_and = {qpl_predicate_and, qpl_op_scan_eq, 0U, 0U};
+    const qpl_scan_predicate extract     = {qpl_predicate_compare, qpl_op_extract, 5U, 0U};
+
+    uint32_t job_size = 0U;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto job_ptr    = reinterpret_cast<qpl_job*>(job_buffer.get());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr));
+
+    auto execute = [&](std::vector<qpl_scan_predicate> program, uint32_t program_byte_size) {
+        job_ptr->op                 = qpl_op_scan_predicate;
+        job_ptr->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job_ptr->parser             = qpl_p_le_packed_array;
+        job_ptr->src1_bit_width     = 8U;
+        job_ptr->num_input_elements = 32U;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->next_in_ptr        = source.data();
+        job_ptr->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+        job_ptr->next_src2_ptr      = reinterpret_cast<uint8_t*>(program.data());
+        job_ptr->available_src2     = program_byte_size;
+
+        return qpl_execute_job(job_ptr);
+    };
+
+    constexpr uint32_t instruction_size = sizeof(qpl_scan_predicate);
+
+    EXPECT_EQ(QPL_STS_SIZE_ERR, execute({compare}, instruction_size - 1U));
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, execute({compare, logical_and}, 2U * instruction_size));
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, execute({compare, compare}, 2U * instruction_size));
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, execute({extract}, instruction_size));
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR,
+              execute(std::vector<qpl_scan_predicate>(QPL_MAX_PREDICATE_LENGTH + 1U, compare),
+                      (QPL_MAX_PREDICATE_LENGTH + 1U) * instruction_size));
+
+    if (qpl_path_hardware == path) {
+        EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, execute({compare}, instruction_size));
+    } else {
+        EXPECT_EQ(QPL_STS_OK, execute({compare}, instruction_size));
+        EXPECT_EQ(32U, job_ptr->sum_value);
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+} // namespace qpl::test
@@ -91,6 +91,7 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(select, analytic_only, SelectTest) {
 
     EXPECT_TRUE(CompareTotalInOutWithReference());
     EXPECT_TRUE(compare_checksum_fields(job_ptr, reference_job_ptr));
+    EXPECT_EQ(reference_job_ptr->last_bit_offset, job_ptr->last_bit_offset);
     EXPECT_TRUE(CompareVectors(destination, reference_destination));
 }
 
@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "gtest/gtest.h"
+#include "ta_ll_common.hpp"
+#include "util.hpp"
+
+/* These tests compare the results of the filter operations on 33..64-bit elements with the reference computed
+   element by element. Such elements are supported on the software path only, so the hardware path reports
+   QPL_STS_NOT_SUPPORTED_MODE_ERR. */
+
+namespace qpl::test {
+
+static auto pack_elements(const std::vector<uint64_t>& elements, uint32_t bit_width, bool is_big_endian)
+        -> std::vector<uint8_t> {
+    std::vector<uint8_t> packed((elements.size() * bit_width + 7U) / 8U, 0U);
+
+    uint64_t bit_index = 0U;
+    for (const auto element : elements) {
+        for (uint32_t i = 0U; i < bit_width; i++, bit_index++) {
+            const uint64_t bit = is_big_endian ? (element >> (bit_width - 1U - i)) & 1U : (element >> i) & 1U;
+
+            if (bit) {
+                packed[bit_index / 8U] |= is_big_endian ? 0x80U >> (bit_index % 8U) : 1U << (bit_index % 8U);
+            }
+        }
+    }
+
+    return packed;
+}
+
+static auto generate_elements(uint32_t element_count, uint32_t bit_width, std::mt19937_64& random_generator)
+        -> std::vector<uint64_t> {
+    const uint64_t max_value = (64U == bit_width) ? UINT64_MAX : (1ULL << bit_width) - 1U;
+
+    // Half of the values repeat, so equality comparisons hit
+    std::vector<uint64_t> elements(element_count);
+    for (auto& element : elements) {
+        element = (random_generator() & 1U) ? (random_generator() & max_value) : max_value - random_generator() % 16U;
+    }
+
+    return elements;
+}
+
+static bool satisfies(qpl_operation operation, uint64_t value, uint64_t low, uint64_t high) {
+    switch (operation) {
+        case qpl_op_scan_eq: return value == low;
+        case qpl_op_scan_ne: return value != low;
+        case qpl_op_scan_lt: return value < low;
+        case qpl_op_scan_le: return value <= low;
+        case qpl_op_scan_gt: return value > low;
+        case qpl_op_scan_ge: return value >= low;
+        case qpl_op_scan_range: return low <= value && value <= high;
+        default: return value < low || value > high;
+    }
+}
+
+class WideElementsTest {
+public:
+    WideElementsTest() {
+        auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+        uint32_t job_size = 0U;
+        EXPECT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+        job_buffer_ = std::make_unique<uint8_t[]>(job_size);
+        job_ptr_    = reinterpret_cast<qpl_job*>(job_buffer_.get());
+
+        EXPECT_EQ(QPL_STS_OK, qpl_init_job(path, job_ptr_));
+    }
+
+    ~WideElementsTest() { qpl_fini_job(job_ptr_); }
+
+    WideElementsTest(const WideElementsTest&)            = delete;
+    WideElementsTest& operator=(const WideElementsTest&) = delete;
+
+    auto job() -> qpl_job* { return job_ptr_; }
+
+    void prepare(qpl_operation operation, uint32_t bit_width, uint32_t element_count, bool is_big_endian,
+                 std::vector<uint8_t>& source, std::vector<uint8_t>& destination) {
+        job_ptr_->op                 = operation;
+        job_ptr_->flags              = QPL_FLAG_FIRST | QPL_FLAG_LAST | (is_big_endian ? QPL_FLAG_OUT_BE : 0U);
+        job_ptr_->parser             = is_big_endian ? qpl_p_be_packed_array : qpl_p_le_packed_array;
+        job_ptr_->src1_bit_width     = bit_width;
+        job_ptr_->num_input_elements = element_count;
+        job_ptr_->out_bit_width      = qpl_ow_nom;
+        job_ptr_->next_in_ptr        = source.data();
+        job_ptr_->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr_->next_out_ptr       = destination.data();
+        job_ptr_->available_out      = static_cast<uint32_t>(destination.size());
+    }
+
+private:
+    std::unique_ptr<uint8_t[]> job_buffer_;
+    qpl_job*                   job_ptr_ = nullptr;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(wide_elements, scan) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    WideElementsTest test;
+    auto*            job_ptr = test.job();
+
+    for (uint32_t bit_width : {33U, 40U, 48U, 63U, 64U}) {
+        for (uint32_t element_count : {1U, 37U, 1000U, 50003U}) {
+            std::mt19937_64 random_generator(bit_width * element_count);
+
+            auto elements = generate_elements(element_count, bit_width, random_generator);
+
+            for (bool is_big_endian : {false, true}) {
+                auto source = pack_elements(elements, bit_width, is_big_endian);
+
+                for (auto operation : {qpl_op_scan_eq, qpl_op_scan_ne, qpl_op_scan_lt, qpl_op_scan_le, qpl_op_scan_gt,
+                                       qpl_op_scan_ge, qpl_op_scan_range, qpl_op_scan_not_range}) {
+                    const uint64_t low  = std::min(elements.front(), elements.back());
+                    const uint64_t high = std::max(elements.front(), elements.back());
+
+                    std::vector<uint64_t> expected_bits(element_count);
+                    std::vector<uint32_t> expected_indices;
+                    for (uint32_t i = 0U; i < element_count; i++) {
+                        expected_bits[i] = static_cast<uint64_t>(satisfies(operation, elements[i], low, high));
+
+                        if (expected_bits[i]) { expected_indices.push_back(i); }
+                    }
+
+                    auto expected = pack_elements(expected_bits, 1U, is_big_endian);
+
+                    std::vector<uint8_t> destination(expected.size() + 8U, 0xAAU);
+                    test.prepare(operation, bit_width, element_count, is_big_endian, source, destination);
+                    job_ptr->param_low_64  = low;
+                    job_ptr->param_high_64 = high;
+
+                    ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+                    ASSERT_EQ(expected.size(), job_ptr->total_out);
+                    destination.resize(job_ptr->total_out);
+                    EXPECT_TRUE(CompareVectors(expected, destination));
+
+                    EXPECT_EQ(element_count, job_ptr->num_output_elements);
+                    EXPECT_EQ(expected_indices.size(), job_ptr->sum_value_64);
+
+                    if (!expected_indices.empty()) {
+                        EXPECT_EQ(expected_indices.front(), job_ptr->first_index_min_value_64);
+                        EXPECT_EQ(expected_indices.back(), job_ptr->last_index_max_value_64);
+                    }
+                }
+            }
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(wide_elements, extract) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    WideElementsTest test;
+    auto*            job_ptr = test.job();
+
+    for (uint32_t bit_width : {33U, 47U, 56U, 64U}) {
+        for (uint32_t element_count : {1U, 1000U, 50003U}) {
+            std::mt19937_64 random_generator(bit_width + element_count);
+
+            auto elements = generate_elements(element_count, bit_width, random_generator);
+
+            for (bool is_big_endian : {false, true}) {
+                auto source = pack_elements(elements, bit_width, is_big_endian);
+
+                const uint32_t low  = element_count / 3U;
+                const uint32_t high = element_count - 1U;
+
+                std::vector<uint64_t> expected_elements(elements.begin() + low, elements.end());
+                auto                  expected = pack_elements(expected_elements, bit_width, is_big_endian);
+
+                std::vector<uint8_t> destination(expected.size() + 8U, 0xAAU);
+                test.prepare(qpl_op_extract, bit_width, element_count, is_big_endian, source, destination);
+                job_ptr->param_low  = low;
+                job_ptr->param_high = high;
+
+                ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+                ASSERT_EQ(expected.size(), job_ptr->total_out);
+                destination.resize(job_ptr->total_out);
+                EXPECT_TRUE(CompareVectors(expected, destination));
+
+                uint64_t expected_sum = 0U;
+                for (const auto element : expected_elements) {
+                    expected_sum += element;
+                }
+
+                EXPECT_EQ(expected_elements.size(), job_ptr->num_output_elements);
+                EXPECT_EQ(*std::min_element(expected_elements.begin(), expected_elements.end()),
+                          job_ptr->first_index_min_value_64);
+                EXPECT_EQ(*std::max_element(expected_elements.begin(), expected_elements.end()),
+                          job_ptr->last_index_max_value_64);
+                EXPECT_EQ(expected_sum, job_ptr->sum_value_64);
+                EXPECT_EQ(static_cast<uint32_t>(expected_sum), job_ptr->sum_value);
+            }
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(wide_elements, select_and_expand) {
+    QPL_SKIP_TEST_FOR(qpl_path_hardware);
+
+    WideElementsTest test;
+    auto*            job_ptr = test.job();
+
+    for (uint32_t bit_width : {35U, 52U, 64U}) {
+        for (uint32_t element_count : {8U, 1000U, 50000U}) {
+            std::mt19937_64 random_generator(bit_width ^ element_count);
+
+            auto elements = generate_elements(element_count, bit_width, random_generator);
+
+            std::vector<uint64_t> mask_bits(element_count);
+            for (auto& bit : mask_bits) {
+                bit = random_generator() & 1U;
+            }
+            mask_bits.front() = 1U;
+
+            auto mask = pack_elements(mask_bits, 1U, false);
+
+            // Select keeps the elements marked in the mask
+            std::vector<uint64_t> selected;
+            for (uint32_t i = 0U; i < element_count; i++) {
+                if (mask_bits[i]) { selected.push_back(elements[i]); }
+            }
+
+            auto                 source   = pack_elements(elements, bit_width, false);
+            auto                 expected = pack_elements(selected, bit_width, false);
+            std::vector<uint8_t> destination(expected.size() + 8U, 0xAAU);
+
+            test.prepare(qpl_op_select, bit_width, element_count, false, source, destination);
+            job_ptr->src2_bit_width = 1U;
+            job_ptr->next_src2_ptr  = mask.data();
+            job_ptr->available_src2 = static_cast<uint32_t>(mask.size());
+
+            ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+            ASSERT_EQ(expected.size(), job_ptr->total_out);
+            destination.resize(job_ptr->total_out);
+            EXPECT_TRUE(CompareVectors(expected, destination));
+            EXPECT_EQ(selected.size(), job_ptr->num_output_elements);
+
+            // Expand puts the selected elements back to their places and zeroes the others
+            std::vector<uint64_t> expanded(element_count, 0U);
+            for (uint32_t i = 0U; i < element_count; i++) {
+                if (mask_bits[i]) { expanded[i] = elements[i]; }
+            }
+
+            source   = pack_elements(selected, bit_width, false);
+            expected = pack_elements(expanded, bit_width, false);
+            destination.assign(expected.size() + 8U, 0xAAU);
+
+            test.prepare(qpl_op_expand, bit_width, element_count, false, source, destination);
+            job_ptr->src2_bit_width = 1U;
+            job_ptr->next_src2_ptr  = mask.data();
+            job_ptr->available_src2 = static_cast<uint32_t>(mask.size());
+
+            ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+            ASSERT_EQ(expected.size(), job_ptr->total_out);
+            destination.resize(job_ptr->total_out);
+            EXPECT_TRUE(CompareVectors(expected, destination));
+            EXPECT_EQ(expanded.size(), job_ptr->num_output_elements);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(wide_elements, errors) {
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+
+    WideElementsTest test;
+    auto*            job_ptr = test.job();
+
+    std::vector<uint8_t> source(64U * sizeof(uint64_t), 0x5AU);
+    std::vector<uint8_t> destination(64U * sizeof(uint64_t));
+    std::vector<uint8_t> set(16U * sizeof(uint32_t));
+
+    test.prepare(qpl_op_scan_in_set, 40U, 64U, false, source, destination);
+    job_ptr->src2_bit_width = 32U;
+    job_ptr->next_src2_ptr  = set.data();
+    job_ptr->available_src2 = static_cast<uint32_t>(set.size());
+    EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, qpl_execute_job(job_ptr));
+
+    test.prepare(qpl_op_extract, 65U, 64U, false, source, destination);
+    EXPECT_EQ(QPL_STS_BIT_WIDTH_ERR, qpl_execute_job(job_ptr));
+
+    test.prepare(qpl_op_extract, 40U, 64U, false, source, destination);
+    job_ptr->out_bit_width = qpl_ow_32;
+    job_ptr->param_low     = 0U;
+    job_ptr->param_high    = 63U;
+    EXPECT_EQ(QPL_STS_OUT_FORMAT_ERR, qpl_execute_job(job_ptr));
+
+    test.prepare(qpl_op_scan_ge, 40U, 64U, false, source, destination);
+    job_ptr->param_low_64 = 0U;
+
+    if (qpl_path_hardware == path) {
+        EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, qpl_execute_job(job_ptr));
+    } else {
+        EXPECT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+        EXPECT_EQ(64U, job_ptr->sum_value_64);
+    }
+}
+
+} // namespace qpl::test
@@ -317,4 +317,43 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(huffman_table, deserialize) {
     EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(table));
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(huffman_table, select_best) {
+    uint8_t  source[16]  = {};
+    uint32_t table_index = 0U;
+
+    qpl_huffman_table_t table {};
+
+    auto status = qpl_deflate_huffman_table_create(combined_table_type, GetExecutionPath(), DEFAULT_ALLOCATOR_C, &table);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR,
+              qpl_huffman_table_select_best(nullptr, sizeof(source), &table, 1U, qpl_default_level, &table_index));
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR,
+              qpl_huffman_table_select_best(source, sizeof(source), nullptr, 1U, qpl_default_level, &table_index));
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR,
+              qpl_huffman_table_select_best(source, sizeof(source), &table, 1U, qpl_default_level, nullptr));
+
+    EXPECT_EQ(QPL_STS_SIZE_ERR,
+              qpl_huffman_table_select_best(source, 0U, &table, 1U, qpl_default_level, &table_index));
+    EXPECT_EQ(QPL_STS_SIZE_ERR,
+              qpl_huffman_table_select_best(source, sizeof(source), &table, 0U, qpl_default_level, &table_index));
+
+    EXPECT_EQ(QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL,
+              qpl_huffman_table_select_best(source, sizeof(source), &table, 1U,
+                                            static_cast<qpl_compression_levels>(0xFF), &table_index));
+
+    qpl_huffman_table_t huffman_only_table {};
+
+    status = qpl_huffman_only_table_create(combined_table_type, GetExecutionPath(), DEFAULT_ALLOCATOR_C,
+                                           &huffman_only_table);
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    EXPECT_EQ(QPL_STS_HUFFMAN_TABLE_TYPE_ERROR,
+              qpl_huffman_table_select_best(source, sizeof(source), &huffman_only_table, 1U, qpl_default_level,
+                                            &table_index));
+
+    EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(huffman_only_table));
+    EXPECT_EQ(QPL_STS_OK, qpl_huffman_table_destroy(table));
+}
+
 } // namespace qpl::test
@@ -127,4 +127,66 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(index_table, find_mini_block_index) {
 
     EXPECT_EQ(QPL_STS_NULL_PTR_ERR, status);
 }
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(index_table, decompress_indexed) {
+    uint64_t        indices[4] = {0U, 8U, 16U, 16U};
+    qpl_index_table table      = {1U, 1U, 1U, reinterpret_cast<qpl_index*>(indices)};
+
+    uint8_t source[4]      = {};
+    uint8_t destination[4] = {};
+
+    job_ptr->next_in_ptr     = source;
+    job_ptr->available_in    = sizeof(source);
+    job_ptr->next_out_ptr    = destination;
+    job_ptr->available_out   = sizeof(destination);
+    job_ptr->mini_block_size = qpl_mblk_size_512;
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_decompress_indexed(nullptr, &table));
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_decompress_indexed(job_ptr, nullptr));
+
+    job_ptr->mini_block_size = qpl_mblk_size_none;
+    EXPECT_EQ(QPL_STS_INVALID_BLOCK_SIZE_ERR, qpl_decompress_indexed(job_ptr, &table));
+    job_ptr->mini_block_size = qpl_mblk_size_512;
+
+    table.indices_ptr = nullptr;
+    EXPECT_EQ(QPL_STS_MISSING_INDEX_TABLE_ERR, qpl_decompress_indexed(job_ptr, &table));
+    table.indices_ptr = reinterpret_cast<qpl_index*>(indices);
+
+    table.block_count = 2U;
+    EXPECT_EQ(QPL_STS_SIZE_ERR, qpl_decompress_indexed(job_ptr, &table));
+    table.block_count = 1U;
+
+    job_ptr->available_in = 1U;
+    EXPECT_EQ(QPL_STS_SRC_IS_SHORT_ERR, qpl_decompress_indexed(job_ptr, &table));
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(index_table, compress_bgzf) {
+    qpl_bgzf_index_entry entries[1] = {};
+    qpl_bgzf_index       index      = {4096U, 1U, 0U, entries};
+
+    uint8_t source[8192]     = {};
+    uint8_t destination[256] = {};
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->next_in_ptr   = source;
+    job_ptr->available_in  = sizeof(source);
+    job_ptr->next_out_ptr  = destination;
+    job_ptr->available_out = sizeof(destination);
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_compress_bgzf(nullptr, &index));
+
+    job_ptr->next_in_ptr = nullptr;
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_compress_bgzf(job_ptr, &index));
+    job_ptr->next_in_ptr = source;
+
+    index.member_size = QPL_BGZF_MAX_MEMBER_SIZE + 1U;
+    EXPECT_EQ(QPL_STS_INVALID_BLOCK_SIZE_ERR, qpl_compress_bgzf(job_ptr, &index));
+    index.member_size = 4096U;
+
+    EXPECT_EQ(QPL_STS_INDEX_ARRAY_TOO_SMALL, qpl_compress_bgzf(job_ptr, &index));
+
+    job_ptr->available_out = 16U;
+    EXPECT_EQ(QPL_STS_DST_IS_SHORT_ERR, qpl_compress_bgzf(job_ptr, nullptr));
+}
+
 } // namespace qpl::test
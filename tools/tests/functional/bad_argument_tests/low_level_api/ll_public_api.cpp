@@ -40,6 +40,40 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_init, test) {
     EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_get_job_size_by_class, test) {
+    uint32_t size = 0U;
+
+    qpl_status status = qpl_get_job_size_by_class(PATH, qpl_op_class_crc, nullptr);
+
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on job_ptr == nullptr";
+
+    status = qpl_get_job_size_by_class(INCORRECT_PATH, qpl_op_class_crc, &size);
+
+    EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
+
+    status = qpl_get_job_size_by_class(PATH, 0U, &size);
+
+    EXPECT_EQ(status, QPL_STS_INVALID_PARAM_ERR) << "Failed on empty operation classes";
+
+    status = qpl_get_job_size_by_class(PATH, qpl_op_class_all + 1U, &size);
+
+    EXPECT_EQ(status, QPL_STS_INVALID_PARAM_ERR) << "Failed on unknown operation class";
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_init_by_class, test) {
+    qpl_status status = qpl_init_job_by_class(PATH, qpl_op_class_crc, nullptr);
+
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on job_ptr == nullptr";
+
+    status = qpl_init_job_by_class(INCORRECT_PATH, qpl_op_class_crc, job_ptr);
+
+    EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
+
+    status = qpl_init_job_by_class(PATH, 0U, job_ptr);
+
+    EXPECT_EQ(status, QPL_STS_INVALID_PARAM_ERR) << "Failed on empty operation classes";
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_submit, test) {
     uint8_t* stored_ptr = nullptr;
 
@@ -154,6 +188,44 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_gather_deflate_statistics, test) {
     EXPECT_EQ(status, QPL_STS_PATH_ERR);
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_gather_deflate_statistics_with_options, test) {
+    uint8_t                      source        = 0U;
+    const uint32_t               source_length = 1U;
+    qpl_histogram                deflate_histogram {};
+    qpl_statistics_options       options = {qpl_statistics_sampled, 0U, 0U};
+    const qpl_path_t             path    = qpl_path_software;
+    const qpl_compression_levels level   = qpl_default_level;
+
+    qpl_status status = qpl_gather_deflate_statistics_with_options(nullptr, source_length, &deflate_histogram, level,
+                                                                   path, &options);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_gather_deflate_statistics_with_options(&source, source_length, nullptr, level, path, &options);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_gather_deflate_statistics_with_options(&source, source_length, &deflate_histogram, level, path,
+                                                        nullptr);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_gather_deflate_statistics_with_options(&source, source_length, &deflate_histogram, INCORRECT_LEVEL,
+                                                        path, &options);
+    EXPECT_EQ(status, QPL_STS_UNSUPPORTED_COMPRESSION_LEVEL);
+
+    status = qpl_gather_deflate_statistics_with_options(&source, source_length, &deflate_histogram, level,
+                                                        INCORRECT_PATH, &options);
+    EXPECT_EQ(status, QPL_STS_PATH_ERR);
+
+    status = qpl_gather_deflate_statistics_with_options(&source, source_length, &deflate_histogram, level,
+                                                        qpl_path_hardware, &options);
+    EXPECT_EQ(status, QPL_STS_NOT_SUPPORTED_MODE_ERR);
+
+    options.method = static_cast<qpl_statistics_method>(0xFF);
+
+    status = qpl_gather_deflate_statistics_with_options(&source, source_length, &deflate_histogram, level, path,
+                                                        &options);
+    EXPECT_EQ(status, QPL_STS_INVALID_PARAM_ERR);
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_get_existing_dict_size, test) {
     size_t dictionary_size = 0U;
 
@@ -182,6 +254,34 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_build_dictionary, test) {
     EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_train_dictionary, test) {
+    std::array<uint8_t, dictionary_test_size> samples {};
+    std::array<uint8_t, dictionary_test_size> dictionary_raw {};
+
+    const size_t sample_size     = dictionary_test_size;
+    size_t       dictionary_size = dictionary_test_size;
+
+    auto status = qpl_train_dictionary(NULL, &sample_size, 1U, sw_compression_level::LEVEL_1,
+                                       hw_compression_level::HW_NONE, dictionary_raw.data(), &dictionary_size, NULL);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_train_dictionary(samples.data(), NULL, 1U, sw_compression_level::LEVEL_1,
+                                  hw_compression_level::HW_NONE, dictionary_raw.data(), &dictionary_size, NULL);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_train_dictionary(samples.data(), &sample_size, 1U, sw_compression_level::LEVEL_1,
+                                  hw_compression_level::HW_NONE, NULL, &dictionary_size, NULL);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_train_dictionary(samples.data(), &sample_size, 1U, sw_compression_level::LEVEL_1,
+                                  hw_compression_level::HW_NONE, dictionary_raw.data(), NULL, NULL);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
+
+    status = qpl_train_dictionary(samples.data(), &sample_size, 0U, sw_compression_level::LEVEL_1,
+                                  hw_compression_level::HW_NONE, dictionary_raw.data(), &dictionary_size, NULL);
+    EXPECT_EQ(status, QPL_STS_SIZE_ERR);
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_set_dictionary_id, test) {
     auto status = qpl_set_dictionary_id(NULL, dictionary_id_test);
     EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR);
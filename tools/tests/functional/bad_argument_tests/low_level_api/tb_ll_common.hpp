@@ -39,7 +39,7 @@ constexpr qpl_parser             INPUT_FORMAT             = qpl_p_le_packed_arra
 constexpr qpl_out_format         OUTPUT_BIT_WIDTH         = qpl_ow_nom;
 constexpr qpl_path_t             PATH                     = qpl_path_auto;
 constexpr qpl_path_t             INCORRECT_PATH           = static_cast<qpl_path_t>(qpl_path_software + 1U);
-constexpr qpl_compression_levels INCORRECT_LEVEL          = static_cast<qpl_compression_levels>(qpl_high_level + 1U);
+constexpr qpl_compression_levels INCORRECT_LEVEL          = static_cast<qpl_compression_levels>(qpl_level_9 + 1U);
 constexpr uint32_t               NOT_APPLICABLE_PARAMETER = 0U;
 constexpr uint32_t               INDEX_ARRAY_SIZE         = 3U;
 constexpr qpl_mini_block_size    INDEX_MBLK_SIZE          = qpl_mblk_size_8k;
@@ -13,6 +13,7 @@
 #define QPL_TEST_MAX_8U  0xFFU
 #define QPL_TEST_MAX_16U 0xFFFFU
 #define QPL_TEST_MAX_32U 0xFFFFFFFFU
+#define QPL_TEST_MAX_64U 0xFFFFFFFFFFFFFFFFU
 
 #include "dispatcher.hpp"
 #include "qplc_api.h"
@@ -23,8 +24,8 @@ qplc_aggregates_t_ptr qplc_aggregates(uint32_t index) {
     return (qplc_aggregates_t_ptr)table[index];
 }
 
-static void ref_qplc_bit_aggregates_8u(const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr,
-                                       uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr) {
+static void ref_qplc_bit_aggregates_8u(const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr,
+                                       uint64_t* max_value_ptr, uint64_t* sum_ptr, uint32_t* index_ptr) {
 
     for (uint32_t idx = 0U; idx < length; idx++) {
         *sum_ptr += src_ptr[idx];
@@ -36,8 +37,8 @@ static void ref_qplc_bit_aggregates_8u(const uint8_t* src_ptr, uint32_t length,
     *index_ptr += length;
 }
 
-static void ref_qplc_aggregates_8u(const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr,
-                                   uint32_t* max_value_ptr, uint32_t* sum_ptr) {
+static void ref_qplc_aggregates_8u(const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr,
+                                   uint64_t* max_value_ptr, uint64_t* sum_ptr) {
     for (uint32_t idx = 0U; idx < length; idx++) {
         *sum_ptr += src_ptr[idx];
         *min_value_ptr = (src_ptr[idx] < *min_value_ptr) ? src_ptr[idx] : *min_value_ptr;
@@ -45,8 +46,8 @@ static void ref_qplc_aggregates_8u(const uint8_t* src_ptr, uint32_t length, uint
     }
 }
 
-static void ref_qplc_aggregates_16u(const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr,
-                                    uint32_t* max_value_ptr, uint32_t* sum_ptr) {
+static void ref_qplc_aggregates_16u(const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr,
+                                    uint64_t* max_value_ptr, uint64_t* sum_ptr) {
     const uint16_t* src_16u_ptr = (uint16_t*)src_ptr;
     for (uint32_t idx = 0U; idx < length; idx++) {
         *sum_ptr += src_16u_ptr[idx];
@@ -55,8 +56,8 @@ static void ref_qplc_aggregates_16u(const uint8_t* src_ptr, uint32_t length, uin
     }
 }
 
-static void ref_qplc_aggregates_32u(const uint8_t* src_ptr, uint32_t length, uint32_t* min_value_ptr,
-                                    uint32_t* max_value_ptr, uint32_t* sum_ptr) {
+static void ref_qplc_aggregates_32u(const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr,
+                                    uint64_t* max_value_ptr, uint64_t* sum_ptr) {
     const uint32_t* src_32u_ptr = (uint32_t*)src_ptr;
     for (uint32_t idx = 0U; idx < length; idx++) {
         *sum_ptr += src_32u_ptr[idx];
@@ -65,10 +66,21 @@ static void ref_qplc_aggregates_32u(const uint8_t* src_ptr, uint32_t length, uin
     }
 }
 
+static void ref_qplc_aggregates_64u(const uint8_t* src_ptr, uint32_t length, uint64_t* min_value_ptr,
+                                    uint64_t* max_value_ptr, uint64_t* sum_ptr) {
+    const uint64_t* src_64u_ptr = (uint64_t*)src_ptr;
+    for (uint32_t idx = 0U; idx < length; idx++) {
+        *sum_ptr += src_64u_ptr[idx];
+        *min_value_ptr = (src_64u_ptr[idx] < *min_value_ptr) ? src_64u_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_64u_ptr[idx] > *max_value_ptr) ? src_64u_ptr[idx] : *max_value_ptr;
+    }
+}
+
 constexpr uint32_t fun_indx_bit_aggregates_8u = 0U;
 constexpr uint32_t fun_indx_aggregates_8u     = 1U;
 constexpr uint32_t fun_indx_aggregates_16u    = 2U;
 constexpr uint32_t fun_indx_aggregates_32u    = 3U;
+constexpr uint32_t fun_indx_aggregates_64u    = 4U;
 
 constexpr uint32_t TEST_BUFFER_SIZE = 128U;
 
@@ -78,13 +90,13 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_bit_aggregates_8u, base) {
     std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint8_t)> source {};
     const uint64_t                                          seed = util::TestEnvironment::GetInstance().GetSeed();
     randomizer                                              random_value(0U, static_cast<double>(UINT8_MAX), seed);
-    uint32_t                                                min_value_ptr     = 0U;
-    uint32_t                                                max_value_ptr     = 0U;
-    uint32_t                                                sum_ptr           = 0U;
+    uint64_t                                                min_value_ptr     = 0U;
+    uint64_t                                                max_value_ptr     = 0U;
+    uint64_t                                                sum_ptr           = 0U;
     uint32_t                                                index_ptr         = 0U;
-    uint32_t                                                ref_min_value_ptr = 0U;
-    uint32_t                                                ref_max_value_ptr = 0U;
-    uint32_t                                                ref_sum_ptr       = 0U;
+    uint64_t                                                ref_min_value_ptr = 0U;
+    uint64_t                                                ref_max_value_ptr = 0U;
+    uint64_t                                                ref_sum_ptr       = 0U;
     uint32_t                                                ref_index_ptr     = 0U;
 
     {
@@ -182,17 +194,59 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_bit_aggregates_8u, base) {
     }
 }
 
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_bit_aggregates_8u, sequential_chunks) {
+    std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint8_t)> source {};
+    std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint8_t)> zero_source {};
+    const uint64_t                                          seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer                                              random_value(0U, static_cast<double>(UINT8_MAX), seed);
+
+    {
+        uint8_t* p_source_8u = (uint8_t*)source.data();
+        for (uint32_t indx = 0U; indx < TEST_BUFFER_SIZE; indx++) {
+            p_source_8u[indx] = 1U & static_cast<uint8_t>(random_value);
+        }
+        p_source_8u[0] = 1U;
+    }
+
+    // The chunks without set bits must keep the minimum and maximum found in the previous chunks
+    for (uint32_t first_length = 1U; first_length <= TEST_BUFFER_SIZE; first_length++) {
+        for (uint32_t zero_length = 1U; zero_length <= TEST_BUFFER_SIZE; zero_length++) {
+            uint64_t min_value_ptr     = QPL_TEST_MAX_32U;
+            uint64_t max_value_ptr     = 0U;
+            uint64_t sum_ptr           = 0U;
+            uint32_t index_ptr         = 0U;
+            uint64_t ref_min_value_ptr = QPL_TEST_MAX_32U;
+            uint64_t ref_max_value_ptr = 0U;
+            uint64_t ref_sum_ptr       = 0U;
+            uint32_t ref_index_ptr     = 0U;
+
+            qplc_aggregates(fun_indx_bit_aggregates_8u)(source.data(), first_length, &min_value_ptr, &max_value_ptr,
+                                                        &sum_ptr, &index_ptr);
+            qplc_aggregates(fun_indx_bit_aggregates_8u)(zero_source.data(), zero_length, &min_value_ptr,
+                                                        &max_value_ptr, &sum_ptr, &index_ptr);
+            ref_qplc_bit_aggregates_8u(source.data(), first_length, &ref_min_value_ptr, &ref_max_value_ptr,
+                                       &ref_sum_ptr, &ref_index_ptr);
+            ref_qplc_bit_aggregates_8u(zero_source.data(), zero_length, &ref_min_value_ptr, &ref_max_value_ptr,
+                                       &ref_sum_ptr, &ref_index_ptr);
+            ASSERT_EQ(min_value_ptr, ref_min_value_ptr);
+            ASSERT_EQ(max_value_ptr, ref_max_value_ptr);
+            ASSERT_EQ(sum_ptr, ref_sum_ptr);
+            ASSERT_EQ(index_ptr, ref_index_ptr);
+        }
+    }
+}
+
 QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_8u, base) {
     std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint8_t)> source {};
     const uint64_t                                          seed = util::TestEnvironment::GetInstance().GetSeed();
     randomizer                                              random_value(0U, static_cast<double>(UINT8_MAX), seed);
-    uint32_t                                                min_value_ptr     = 0U;
-    uint32_t                                                max_value_ptr     = 0U;
-    uint32_t                                                sum_ptr           = 0U;
+    uint64_t                                                min_value_ptr     = 0U;
+    uint64_t                                                max_value_ptr     = 0U;
+    uint64_t                                                sum_ptr           = 0U;
     uint32_t                                                index_ptr         = 0U;
-    uint32_t                                                ref_min_value_ptr = 0U;
-    uint32_t                                                ref_max_value_ptr = 0U;
-    uint32_t                                                ref_sum_ptr       = 0U;
+    uint64_t                                                ref_min_value_ptr = 0U;
+    uint64_t                                                ref_max_value_ptr = 0U;
+    uint64_t                                                ref_sum_ptr       = 0U;
     uint32_t                                                ref_index_ptr     = 0U;
 
     {
@@ -328,13 +382,13 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_16u, base) {
     std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint16_t)> source {};
     const uint64_t                                           seed = util::TestEnvironment::GetInstance().GetSeed();
     randomizer                                               random_value(0U, static_cast<double>(UINT16_MAX), seed);
-    uint32_t                                                 min_value_ptr     = 0U;
-    uint32_t                                                 max_value_ptr     = 0U;
-    uint32_t                                                 sum_ptr           = 0U;
+    uint64_t                                                 min_value_ptr     = 0U;
+    uint64_t                                                 max_value_ptr     = 0U;
+    uint64_t                                                 sum_ptr           = 0U;
     uint32_t                                                 index_ptr         = 0U;
-    uint32_t                                                 ref_min_value_ptr = 0U;
-    uint32_t                                                 ref_max_value_ptr = 0U;
-    uint32_t                                                 ref_sum_ptr       = 0U;
+    uint64_t                                                 ref_min_value_ptr = 0U;
+    uint64_t                                                 ref_max_value_ptr = 0U;
+    uint64_t                                                 ref_sum_ptr       = 0U;
     uint32_t                                                 ref_index_ptr     = 0U;
 
     {
@@ -470,13 +524,13 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_32u, base) {
     std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint32_t)> source {};
     const uint64_t                                           seed = util::TestEnvironment::GetInstance().GetSeed();
     randomizer                                               random_value(0U, static_cast<double>(UINT32_MAX), seed);
-    uint32_t                                                 min_value_ptr     = 0U;
-    uint32_t                                                 max_value_ptr     = 0U;
-    uint32_t                                                 sum_ptr           = 0U;
+    uint64_t                                                 min_value_ptr     = 0U;
+    uint64_t                                                 max_value_ptr     = 0U;
+    uint64_t                                                 sum_ptr           = 0U;
     uint32_t                                                 index_ptr         = 0U;
-    uint32_t                                                 ref_min_value_ptr = 0U;
-    uint32_t                                                 ref_max_value_ptr = 0U;
-    uint32_t                                                 ref_sum_ptr       = 0U;
+    uint64_t                                                 ref_min_value_ptr = 0U;
+    uint64_t                                                 ref_max_value_ptr = 0U;
+    uint64_t                                                 ref_sum_ptr       = 0U;
     uint32_t                                                 ref_index_ptr     = 0U;
 
     {
@@ -607,4 +661,64 @@ QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_32u, base) {
         ASSERT_EQ(index_ptr, ref_index_ptr);
     }
 }
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_aggregates_64u, base) {
+    std::array<uint8_t, TEST_BUFFER_SIZE * sizeof(uint64_t)> source {};
+    const uint64_t                                           seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer                                               random_value(0U, static_cast<double>(UINT32_MAX), seed);
+    uint64_t                                                 min_value_ptr     = 0U;
+    uint64_t                                                 max_value_ptr     = 0U;
+    uint64_t                                                 sum_ptr           = 0U;
+    uint32_t                                                 index_ptr         = 0U;
+    uint64_t                                                 ref_min_value_ptr = 0U;
+    uint64_t                                                 ref_max_value_ptr = 0U;
+    uint64_t                                                 ref_sum_ptr       = 0U;
+    uint32_t                                                 ref_index_ptr     = 0U;
+
+    {
+        uint64_t* p_source_64u = (uint64_t*)source.data();
+        for (uint32_t indx = 0U; indx < TEST_BUFFER_SIZE; indx++) {
+            p_source_64u[indx] = (static_cast<uint64_t>(static_cast<uint32_t>(random_value)) << 24U) ^
+                                 static_cast<uint64_t>(static_cast<uint32_t>(random_value));
+        }
+    }
+
+    for (uint32_t length = 1U; length <= TEST_BUFFER_SIZE; length++) {
+        min_value_ptr     = QPL_TEST_MAX_64U;
+        max_value_ptr     = 0U;
+        sum_ptr           = 0U;
+        index_ptr         = 0U;
+        ref_min_value_ptr = QPL_TEST_MAX_64U;
+        ref_max_value_ptr = 0U;
+        ref_sum_ptr       = 0U;
+        ref_index_ptr     = 0U;
+
+        qplc_aggregates(fun_indx_aggregates_64u)(source.data(), length, &min_value_ptr, &max_value_ptr, &sum_ptr,
+                                                 &index_ptr);
+        ref_qplc_aggregates_64u(source.data(), length, &ref_min_value_ptr, &ref_max_value_ptr, &ref_sum_ptr);
+        ASSERT_EQ(min_value_ptr, ref_min_value_ptr);
+        ASSERT_EQ(max_value_ptr, ref_max_value_ptr);
+        ASSERT_EQ(sum_ptr, ref_sum_ptr);
+        ASSERT_EQ(index_ptr, ref_index_ptr);
+    }
+
+    for (uint32_t length = 1U; length <= TEST_BUFFER_SIZE; length++) {
+        min_value_ptr     = 1U;
+        max_value_ptr     = QPL_TEST_MAX_64U;
+        sum_ptr           = 0U;
+        index_ptr         = 0U;
+        ref_min_value_ptr = 1U;
+        ref_max_value_ptr = QPL_TEST_MAX_64U;
+        ref_sum_ptr       = 0U;
+        ref_index_ptr     = 0U;
+
+        qplc_aggregates(fun_indx_aggregates_64u)(source.data(), length, &min_value_ptr, &max_value_ptr, &sum_ptr,
+                                                 &index_ptr);
+        ref_qplc_aggregates_64u(source.data(), length, &ref_min_value_ptr, &ref_max_value_ptr, &ref_sum_ptr);
+        ASSERT_EQ(min_value_ptr, ref_min_value_ptr);
+        ASSERT_EQ(max_value_ptr, ref_max_value_ptr);
+        ASSERT_EQ(sum_ptr, ref_sum_ptr);
+        ASSERT_EQ(index_ptr, ref_index_ptr);
+    }
+}
 } // namespace qpl::test
@@ -0,0 +1,471 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ * AVX2 (L9) kernels are checked against the px kernels of the same table entry, so every hand-written
+ * L9 kernel has to produce exactly the output of its scalar counterpart.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "t_common.hpp"
+
+#include "dispatcher.hpp"
+#include "qplc_api.h"
+
+namespace qpl::core_sw::dispatcher {
+extern unpack_table_t px_unpack_table;
+extern unpack_table_t avx2_unpack_table;
+
+extern scan_i_table_t px_scan_i_table;
+extern scan_i_table_t avx2_scan_i_table;
+
+extern scan_table_t px_scan_table;
+extern scan_table_t avx2_scan_table;
+
+extern scan_bits_table_t px_scan_bits_table;
+extern scan_bits_table_t avx2_scan_bits_table;
+
+extern scan_in_set_i_table_t px_scan_in_set_i_table;
+extern scan_in_set_i_table_t avx2_scan_in_set_i_table;
+
+extern bit_vector_table_t px_bit_vector_table;
+extern bit_vector_table_t avx2_bit_vector_table;
+
+extern aggregates_table_t px_aggregates_table;
+extern aggregates_table_t avx2_aggregates_table;
+
+extern memory_copy_table_t px_memory_copy_table;
+extern memory_copy_table_t avx2_memory_copy_table;
+
+extern zero_table_t px_zero_table;
+extern zero_table_t avx2_zero_table;
+
+extern move_table_t px_move_table;
+extern move_table_t avx2_move_table;
+
+extern crc64_table_t px_crc64_table;
+extern crc64_table_t avx2_crc64_table;
+
+extern xor_checksum_table_t px_xor_checksum_table;
+extern xor_checksum_table_t avx2_xor_checksum_table;
+} // namespace qpl::core_sw::dispatcher
+
+namespace qpl::test {
+using randomizer = qpl::test::random;
+
+namespace dispatcher = qpl::core_sw::dispatcher;
+
+constexpr uint32_t max_elements_count = 1024U;
+constexpr uint32_t buffer_padding     = 64U;
+constexpr uint32_t in_set_values_size = 64U;
+
+static auto is_avx2_supported() -> bool {
+    return dispatcher::arch_t::px_arch != dispatcher::detect_platform();
+}
+
+static auto get_test_lengths() -> std::vector<uint32_t> {
+    std::vector<uint32_t> lengths;
+
+    // Every tail length of the 8u, 16u and 32u vector loops plus several full iterations
+    for (uint32_t length = 1U; length <= 130U; length++) {
+        lengths.push_back(length);
+    }
+    lengths.insert(lengths.end(), {255U, 256U, 257U, 1000U, max_elements_count});
+
+    return lengths;
+}
+
+static auto get_random_bytes(uint32_t size, uint64_t seed) -> std::vector<uint8_t> {
+    randomizer           random_value(0U, static_cast<double>(UINT8_MAX), seed);
+    std::vector<uint8_t> bytes(size);
+
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(random_value);
+    }
+
+    return bytes;
+}
+
+static auto get_element(const std::vector<uint8_t>& source, uint32_t index, uint32_t element_size) -> uint32_t {
+    switch (element_size) {
+        case sizeof(uint8_t): return source[index];
+        case sizeof(uint16_t): return reinterpret_cast<const uint16_t*>(source.data())[index];
+        default: return reinterpret_cast<const uint32_t*>(source.data())[index];
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, scan) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer     random_index(0U, static_cast<double>(UINT32_MAX), seed);
+
+    const std::vector<uint8_t> source = get_random_bytes(max_elements_count * sizeof(uint32_t), seed);
+    std::vector<uint8_t>       reference(max_elements_count + buffer_padding);
+    std::vector<uint8_t>       destination(max_elements_count + buffer_padding);
+
+    for (uint32_t kernel_index = 0U; kernel_index < dispatcher::px_scan_table.size(); kernel_index++) {
+        // Scan table contains 8u, 16u and 32u kernels for every predicate
+        const uint32_t element_size = 1U << (kernel_index % 3U);
+
+        for (const uint32_t length : get_test_lengths()) {
+            // Boundaries are taken from the source, so every predicate has matches
+            uint32_t low_value  = get_element(source, static_cast<uint32_t>(random_index) % length, element_size);
+            uint32_t high_value = get_element(source, static_cast<uint32_t>(random_index) % length, element_size);
+            if (low_value > high_value) { std::swap(low_value, high_value); }
+
+            std::fill(reference.begin(), reference.end(), 0U);
+            std::fill(destination.begin(), destination.end(), 0U);
+
+            dispatcher::px_scan_table[kernel_index](source.data(), reference.data(), length, low_value, high_value);
+            dispatcher::avx2_scan_table[kernel_index](source.data(), destination.data(), length, low_value,
+                                                      high_value);
+
+            ASSERT_EQ(reference, destination) << "kernel index: " << kernel_index << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, scan_i) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer     random_index(0U, static_cast<double>(UINT32_MAX), seed);
+
+    const std::vector<uint8_t> source = get_random_bytes(max_elements_count * sizeof(uint32_t), seed);
+
+    for (uint32_t kernel_index = 0U; kernel_index < dispatcher::px_scan_i_table.size(); kernel_index++) {
+        const uint32_t element_size = 1U << (kernel_index % 3U);
+
+        for (const uint32_t length : get_test_lengths()) {
+            uint32_t low_value  = get_element(source, static_cast<uint32_t>(random_index) % length, element_size);
+            uint32_t high_value = get_element(source, static_cast<uint32_t>(random_index) % length, element_size);
+            if (low_value > high_value) { std::swap(low_value, high_value); }
+
+            std::vector<uint8_t> reference   = source;
+            std::vector<uint8_t> destination = source;
+
+            dispatcher::px_scan_i_table[kernel_index](reference.data(), length, low_value, high_value);
+            dispatcher::avx2_scan_i_table[kernel_index](destination.data(), length, low_value, high_value);
+
+            ASSERT_TRUE(std::equal(reference.begin(), reference.begin() + length, destination.begin()))
+                    << "kernel index: " << kernel_index << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, scan_bits) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer     random_value(0U, static_cast<double>(UINT32_MAX), seed);
+
+    const std::vector<uint8_t> source =
+            get_random_bytes(max_elements_count * sizeof(uint32_t) + buffer_padding, seed);
+    std::vector<uint8_t> reference(max_elements_count / 8U + buffer_padding);
+    std::vector<uint8_t> destination(max_elements_count / 8U + buffer_padding);
+
+    for (uint32_t kernel_index = 0U; kernel_index < dispatcher::px_scan_bits_table.size(); kernel_index++) {
+        // Scan bits table contains 1..32-bit kernels for LE input, then the same for BE input
+        const uint32_t bit_width = kernel_index % 32U + 1U;
+        const uint32_t max_value = static_cast<uint32_t>(UINT32_MAX >> (32U - bit_width));
+
+        for (const uint32_t length : get_test_lengths()) {
+            uint32_t low_value  = static_cast<uint32_t>(random_value) & max_value;
+            uint32_t high_value = static_cast<uint32_t>(random_value) & max_value;
+            if (low_value > high_value) { std::swap(low_value, high_value); }
+
+            for (const uint8_t inversion_flag : {0U, 1U}) {
+                uint32_t reference_min   = std::numeric_limits<uint32_t>::max();
+                uint32_t reference_max   = 0U;
+                uint32_t reference_sum   = 0U;
+                uint32_t reference_index = 0U;
+                uint32_t min_value       = std::numeric_limits<uint32_t>::max();
+                uint32_t max_value_found = 0U;
+                uint32_t sum             = 0U;
+                uint32_t index           = 0U;
+
+                std::fill(reference.begin(), reference.end(), 0U);
+                std::fill(destination.begin(), destination.end(), 0U);
+
+                dispatcher::px_scan_bits_table[kernel_index](source.data(), length, low_value, high_value,
+                                                             inversion_flag, reference.data(), &reference_min,
+                                                             &reference_max, &reference_sum, &reference_index);
+                dispatcher::avx2_scan_bits_table[kernel_index](source.data(), length, low_value, high_value,
+                                                               inversion_flag, destination.data(), &min_value,
+                                                               &max_value_found, &sum, &index);
+
+                ASSERT_EQ(reference, destination) << "kernel index: " << kernel_index << ", length: " << length;
+                ASSERT_EQ(reference_min, min_value) << "kernel index: " << kernel_index << ", length: " << length;
+                ASSERT_EQ(reference_max, max_value_found)
+                        << "kernel index: " << kernel_index << ", length: " << length;
+                ASSERT_EQ(reference_sum, sum) << "kernel index: " << kernel_index << ", length: " << length;
+                ASSERT_EQ(reference_index, index) << "kernel index: " << kernel_index << ", length: " << length;
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, scan_in_set_i) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer     random_index(0U, static_cast<double>(UINT32_MAX), seed);
+
+    const std::vector<uint8_t> source = get_random_bytes(max_elements_count * sizeof(uint32_t), seed);
+
+    // 8u and 16u kernels take a bitmap of the set, 32u kernel takes sorted set values
+    const std::vector<uint8_t> bitmap = get_random_bytes((UINT16_MAX + 1U) / 8U, seed);
+    std::vector<uint32_t>      values(in_set_values_size);
+    for (auto& value : values) {
+        value = get_element(source, static_cast<uint32_t>(random_index) % max_elements_count, sizeof(uint32_t));
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    for (uint32_t kernel_index = 0U; kernel_index < dispatcher::px_scan_in_set_i_table.size(); kernel_index++) {
+        const bool     is_32u   = (2U == kernel_index);
+        const uint8_t* set_ptr  = is_32u ? reinterpret_cast<const uint8_t*>(values.data()) : bitmap.data();
+        const uint32_t set_size = is_32u ? static_cast<uint32_t>(values.size()) : 0U;
+
+        for (const uint32_t length : get_test_lengths()) {
+            std::vector<uint8_t> reference   = source;
+            std::vector<uint8_t> destination = source;
+
+            dispatcher::px_scan_in_set_i_table[kernel_index](reference.data(), length, set_ptr, set_size);
+            dispatcher::avx2_scan_in_set_i_table[kernel_index](destination.data(), length, set_ptr, set_size);
+
+            ASSERT_TRUE(std::equal(reference.begin(), reference.begin() + length, destination.begin()))
+                    << "kernel index: " << kernel_index << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, bit_vector) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    const std::vector<uint8_t> source_1 = get_random_bytes(max_elements_count / 8U + buffer_padding, seed);
+    const std::vector<uint8_t> source_2 = get_random_bytes(max_elements_count / 8U + buffer_padding, seed + 1U);
+    std::vector<uint8_t>       reference(max_elements_count / 8U + buffer_padding);
+    std::vector<uint8_t>       destination(max_elements_count / 8U + buffer_padding);
+
+    for (uint32_t kernel_index = 0U; kernel_index < dispatcher::px_bit_vector_table.size(); kernel_index++) {
+        for (const uint32_t length : get_test_lengths()) {
+            uint32_t reference_min   = std::numeric_limits<uint32_t>::max();
+            uint32_t reference_max   = 0U;
+            uint32_t reference_sum   = 0U;
+            uint32_t reference_index = 0U;
+            uint32_t min_value       = std::numeric_limits<uint32_t>::max();
+            uint32_t max_value       = 0U;
+            uint32_t sum             = 0U;
+            uint32_t index           = 0U;
+
+            std::fill(reference.begin(), reference.end(), 0U);
+            std::fill(destination.begin(), destination.end(), 0U);
+
+            dispatcher::px_bit_vector_table[kernel_index](source_1.data(), source_2.data(), length,
+                                                          reference.data(), &reference_min, &reference_max,
+                                                          &reference_sum, &reference_index);
+            dispatcher::avx2_bit_vector_table[kernel_index](source_1.data(), source_2.data(), length,
+                                                            destination.data(), &min_value, &max_value, &sum,
+                                                            &index);
+
+            ASSERT_EQ(reference, destination) << "kernel index: " << kernel_index << ", length: " << length;
+            ASSERT_EQ(reference_min, min_value) << "kernel index: " << kernel_index << ", length: " << length;
+            ASSERT_EQ(reference_max, max_value) << "kernel index: " << kernel_index << ", length: " << length;
+            ASSERT_EQ(reference_sum, sum) << "kernel index: " << kernel_index << ", length: " << length;
+            ASSERT_EQ(reference_index, index) << "kernel index: " << kernel_index << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, aggregates) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    std::vector<uint8_t> source = get_random_bytes(max_elements_count * sizeof(uint64_t), seed);
+
+    for (uint32_t kernel_index = 0U; kernel_index < dispatcher::px_aggregates_table.size(); kernel_index++) {
+        // Bit aggregates kernel expects 0 or 1 in every byte
+        std::vector<uint8_t> kernel_source = source;
+        if (0U == kernel_index) {
+            for (auto& byte : kernel_source) {
+                byte &= 1U;
+            }
+        }
+
+        const uint64_t initial_min = (dispatcher::px_aggregates_table.size() - 1U == kernel_index)
+                                             ? std::numeric_limits<uint64_t>::max()
+                                             : std::numeric_limits<uint32_t>::max();
+
+        for (const uint32_t length : get_test_lengths()) {
+            uint64_t reference_min   = initial_min;
+            uint64_t reference_max   = 0U;
+            uint64_t reference_sum   = 0U;
+            uint32_t reference_index = 0U;
+            uint64_t min_value       = initial_min;
+            uint64_t max_value       = 0U;
+            uint64_t sum             = 0U;
+            uint32_t index           = 0U;
+
+            // The second call continues aggregates of the first one
+            for (uint32_t chunk = 0U; chunk < 2U; chunk++) {
+                dispatcher::px_aggregates_table[kernel_index](kernel_source.data(), length, &reference_min,
+                                                              &reference_max, &reference_sum, &reference_index);
+                dispatcher::avx2_aggregates_table[kernel_index](kernel_source.data(), length, &min_value,
+                                                                &max_value, &sum, &index);
+            }
+
+            ASSERT_EQ(reference_min, min_value) << "kernel index: " << kernel_index << ", length: " << length;
+            ASSERT_EQ(reference_max, max_value) << "kernel index: " << kernel_index << ", length: " << length;
+            ASSERT_EQ(reference_sum, sum) << "kernel index: " << kernel_index << ", length: " << length;
+            ASSERT_EQ(reference_index, index) << "kernel index: " << kernel_index << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, unpack) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    const std::vector<uint8_t> source =
+            get_random_bytes(max_elements_count * sizeof(uint64_t) + buffer_padding, seed);
+    std::vector<uint8_t> reference(max_elements_count * sizeof(uint64_t) + buffer_padding);
+    std::vector<uint8_t> destination(max_elements_count * sizeof(uint64_t) + buffer_padding);
+
+    for (uint32_t kernel_index = 0U; kernel_index < dispatcher::px_unpack_table.size(); kernel_index++) {
+        // Unpack table contains 1..32-bit kernels for LE and BE input, then 33..64-bit kernels for LE and BE input
+        const uint32_t bit_width = (64U > kernel_index) ? kernel_index % 32U + 1U : kernel_index % 32U + 33U;
+
+        // Start bit keeps the elements at the same positions in a byte as in a stream packed from bit 0,
+        // kernels don't support other start bits
+        const uint32_t start_bit_step = std::min(bit_width & (0U - bit_width), 8U);
+
+        for (const uint32_t length : get_test_lengths()) {
+            for (uint32_t start_bit = 0U; start_bit < 8U; start_bit += start_bit_step) {
+                std::fill(reference.begin(), reference.end(), 0U);
+                std::fill(destination.begin(), destination.end(), 0U);
+
+                dispatcher::px_unpack_table[kernel_index](source.data(), length, start_bit, reference.data());
+                dispatcher::avx2_unpack_table[kernel_index](source.data(), length, start_bit, destination.data());
+
+                ASSERT_EQ(reference, destination) << "bit width: " << bit_width << ", kernel index: " << kernel_index
+                                                  << ", length: " << length << ", start bit: " << start_bit;
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, memory_operations) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    const std::vector<uint8_t> source = get_random_bytes(max_elements_count * sizeof(uint32_t), seed);
+
+    for (uint32_t kernel_index = 0U; kernel_index < dispatcher::px_memory_copy_table.size(); kernel_index++) {
+        for (const uint32_t length : get_test_lengths()) {
+            std::vector<uint8_t> reference(source.size());
+            std::vector<uint8_t> destination(source.size());
+
+            dispatcher::px_memory_copy_table[kernel_index](source.data(), reference.data(), length);
+            dispatcher::avx2_memory_copy_table[kernel_index](source.data(), destination.data(), length);
+
+            ASSERT_EQ(reference, destination) << "kernel index: " << kernel_index << ", length: " << length;
+        }
+    }
+
+    for (const uint32_t length : get_test_lengths()) {
+        std::vector<uint8_t> reference   = source;
+        std::vector<uint8_t> destination = source;
+
+        dispatcher::px_zero_table[0](reference.data(), length);
+        dispatcher::avx2_zero_table[0](destination.data(), length);
+
+        ASSERT_EQ(reference, destination) << "zero, length: " << length;
+    }
+
+    // Move is checked on overlapping buffers in both directions
+    for (const uint32_t length : get_test_lengths()) {
+        for (const uint32_t offset : {1U, 31U, 33U}) {
+            if (length + offset > source.size()) { continue; }
+
+            std::vector<uint8_t> reference   = source;
+            std::vector<uint8_t> destination = source;
+
+            dispatcher::px_move_table[0](reference.data(), reference.data() + offset, length);
+            dispatcher::avx2_move_table[0](destination.data(), destination.data() + offset, length);
+            ASSERT_EQ(reference, destination) << "forward move, length: " << length << ", offset: " << offset;
+
+            dispatcher::px_move_table[0](reference.data() + offset, reference.data(), length);
+            dispatcher::avx2_move_table[0](destination.data() + offset, destination.data(), length);
+            ASSERT_EQ(reference, destination) << "backward move, length: " << length << ", offset: " << offset;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, xor_checksum) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer     random_value(0U, static_cast<double>(UINT32_MAX), seed);
+
+    const std::vector<uint8_t> source = get_random_bytes(max_elements_count * sizeof(uint32_t), seed);
+
+    for (const uint32_t length : get_test_lengths()) {
+        const auto init_xor = static_cast<uint32_t>(random_value);
+
+        ASSERT_EQ(dispatcher::px_xor_checksum_table[0](source.data(), length, init_xor),
+                  dispatcher::avx2_xor_checksum_table[0](source.data(), length, init_xor))
+                << "length: " << length;
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_kernels, crc64) {
+    if (!is_avx2_supported()) { GTEST_SKIP() << "AVX2 kernels are not supported on this CPU"; }
+
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    const std::vector<uint8_t> source = get_random_bytes(max_elements_count * sizeof(uint32_t), seed);
+
+    // CRC64 table contains the checksum kernel, then the constants initializer
+    const auto px_crc64        = reinterpret_cast<qplc_crc64_t_ptr>(dispatcher::px_crc64_table[0]);
+    const auto px_crc64_init   = reinterpret_cast<qplc_crc64_init_t_ptr>(dispatcher::px_crc64_table[1]);
+    const auto avx2_crc64      = reinterpret_cast<qplc_crc64_t_ptr>(dispatcher::avx2_crc64_table[0]);
+    const auto avx2_crc64_init = reinterpret_cast<qplc_crc64_init_t_ptr>(dispatcher::avx2_crc64_table[1]);
+
+    auto reference_constants = std::make_unique<qplc_crc64_constants_t>();
+    auto constants           = std::make_unique<qplc_crc64_constants_t>();
+
+    // ECMA-182 and Jones polynomials
+    for (const uint64_t polynomial : {0x42F0E1EBA9EA3693ULL, 0xAD93D23594C935A9ULL}) {
+        for (const uint8_t be_flag : {0U, 1U}) {
+            px_crc64_init(polynomial, be_flag, reference_constants.get());
+            avx2_crc64_init(polynomial, be_flag, constants.get());
+
+            for (const uint8_t inversion_flag : {0U, 1U}) {
+                for (const uint32_t length : get_test_lengths()) {
+                    ASSERT_EQ(px_crc64(source.data(), length, reference_constants.get(), inversion_flag),
+                              avx2_crc64(source.data(), length, constants.get(), inversion_flag))
+                            << "polynomial: " << polynomial << ", be: " << static_cast<uint32_t>(be_flag)
+                            << ", length: " << length;
+                }
+            }
+        }
+    }
+}
+} // namespace qpl::test
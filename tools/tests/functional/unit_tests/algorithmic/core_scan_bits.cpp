@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+#include <vector>
+
+#include "dispatcher.hpp"
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "qplc_api.h"
+#include "random_generator.h"
+#include "t_common.hpp"
+
+#define QPL_TEST_MAX_32U 0xFFFFFFFFU
+
+static inline qplc_scan_bits_t_ptr qplc_scan_bits(uint32_t index) {
+    static const auto& table = qpl::core_sw::dispatcher::kernels_dispatcher::get_instance().get_scan_bits_table();
+
+    return (qplc_scan_bits_t_ptr)table[index];
+}
+
+static void ref_pack_bits(const std::vector<uint32_t>& source, uint32_t bit_width, bool is_be, uint8_t* dst_ptr) {
+    for (uint32_t idx = 0U; idx < source.size(); idx++) {
+        for (uint32_t bit = 0U; bit < bit_width; bit++) {
+            const uint64_t position  = static_cast<uint64_t>(idx) * bit_width + bit;
+            const uint32_t bit_value = (is_be) ? (source[idx] >> (bit_width - 1U - bit)) & 1U
+                                               : (source[idx] >> bit) & 1U;
+
+            if (0U == bit_value) { continue; }
+
+            dst_ptr[position >> 3U] |= (is_be) ? (0x80U >> (position & 7U)) : (1U << (position & 7U));
+        }
+    }
+}
+
+static void ref_qplc_scan_bits(const std::vector<uint32_t>& source, uint32_t low_value, uint32_t high_value,
+                               uint8_t inversion_flag, uint8_t* dst_ptr, uint32_t* min_value_ptr,
+                               uint32_t* max_value_ptr, uint32_t* sum_ptr, uint32_t* index_ptr) {
+    for (uint32_t idx = 0U; idx < source.size(); idx++) {
+        const bool is_in_range = (source[idx] >= low_value) && (source[idx] <= high_value);
+
+        if (is_in_range == (0U != inversion_flag)) { continue; }
+
+        dst_ptr[idx >> 3U] |= 1U << (idx & 7U);
+
+        if (QPL_TEST_MAX_32U == *min_value_ptr) { *min_value_ptr = *index_ptr + idx; }
+        *max_value_ptr = *index_ptr + idx;
+        *sum_ptr += 1U;
+    }
+    *index_ptr += static_cast<uint32_t>(source.size());
+}
+
+constexpr uint32_t TEST_BUFFER_SIZE = 1100U;
+
+namespace qpl::test {
+using randomizer = qpl::test::random;
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan_bits, base) {
+    const uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+    randomizer     random_value(0U, static_cast<double>(UINT32_MAX), seed);
+
+    for (uint32_t is_be = 0U; is_be < 2U; is_be++) {
+        for (uint32_t bit_width = 1U; bit_width <= 32U; bit_width++) {
+            const uint32_t element_mask = static_cast<uint32_t>((1ULL << bit_width) - 1U);
+
+            for (uint32_t length : {1U, 7U, 63U, 64U, 65U, 130U, 511U, 512U, 513U, TEST_BUFFER_SIZE}) {
+                std::vector<uint32_t> source(length);
+                std::vector<uint8_t>  source_pack((static_cast<uint64_t>(length) * bit_width + 7U) >> 3U, 0U);
+
+                for (auto& element : source) {
+                    element = static_cast<uint32_t>(random_value) & element_mask;
+                }
+
+                ref_pack_bits(source, bit_width, is_be, source_pack.data());
+
+                const uint32_t low_value  = source[length / 2U];
+                const uint32_t high_value = low_value + ((element_mask - low_value) >> 1U);
+
+                for (uint8_t inversion_flag = 0U; inversion_flag < 2U; inversion_flag++) {
+                    // One extra byte checks that nothing is written behind the bit-vector
+                    std::vector<uint8_t> destination(((length + 7U) >> 3U) + 1U, 0xAAU);
+                    std::vector<uint8_t> reference(((length + 7U) >> 3U) + 1U, 0U);
+
+                    reference.back() = 0xAAU;
+
+                    uint32_t min_value     = QPL_TEST_MAX_32U;
+                    uint32_t max_value     = 0U;
+                    uint32_t sum           = 0U;
+                    uint32_t index         = 3U;
+                    uint32_t ref_min_value = QPL_TEST_MAX_32U;
+                    uint32_t ref_max_value = 0U;
+                    uint32_t ref_sum       = 0U;
+                    uint32_t ref_index     = 3U;
+
+                    const uint32_t kernel_index = qpl::core_sw::dispatcher::get_scan_bits_index(is_be, bit_width);
+
+                    qplc_scan_bits(kernel_index)(source_pack.data(), length, low_value, high_value, inversion_flag,
+                                                 destination.data(), &min_value, &max_value, &sum, &index);
+                    ref_qplc_scan_bits(source, low_value, high_value, inversion_flag, reference.data(),
+                                       &ref_min_value, &ref_max_value, &ref_sum, &ref_index);
+
+                    ASSERT_TRUE(CompareVectors(destination, reference, 0U, "FAIL qplc_scan_bits!!! "));
+                    ASSERT_EQ(min_value, ref_min_value);
+                    ASSERT_EQ(max_value, ref_max_value);
+                    ASSERT_EQ(sum, ref_sum);
+                    ASSERT_EQ(index, ref_index);
+                }
+            }
+        }
+    }
+}
+} // namespace qpl::test
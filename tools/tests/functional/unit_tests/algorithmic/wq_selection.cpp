@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "t_common.hpp"
+
+// tool_common
+#include "util.hpp"
+
+// internals
+#include "dispatcher/hw_queue_order.hpp"
+
+namespace qpl::test {
+
+#ifdef __linux__
+
+using qpl::ml::dispatcher::hw_queue_candidate_t;
+using qpl::ml::dispatcher::latency_sensitive_transfer_size;
+using qpl::ml::dispatcher::order_work_queues;
+
+constexpr uint64_t test_small_transfer_size = 4U * 1024U;
+constexpr uint64_t test_large_transfer_size = 2U * 1024U * 1024U;
+
+auto get_order(const std::vector<hw_queue_candidate_t>& queues, uint64_t transfer_size, uint32_t start_index = 0U)
+        -> std::vector<uint32_t> {
+    std::vector<uint32_t> order(queues.size());
+
+    const uint32_t count = order_work_queues(queues.data(), static_cast<uint32_t>(queues.size()), transfer_size,
+                                             start_index, order.data());
+    order.resize(count);
+
+    return order;
+}
+
+/**
+ * WQs with the same properties are tried one after another starting from the start index.
+ */
+QPL_UNIT_API_ALGORITHMIC_TEST(wq_selection, round_robin) {
+    QPL_SKIP_TEST_FOR(qpl_path_software);
+    QPL_SKIP_TEST_FOR(qpl_path_auto);
+
+    const std::vector<hw_queue_candidate_t> queues(4U, {0, 0U, true, false});
+
+    ASSERT_EQ(get_order(queues, test_small_transfer_size, 0U), (std::vector<uint32_t> {0U, 1U, 2U, 3U}));
+    ASSERT_EQ(get_order(queues, test_small_transfer_size, 2U), (std::vector<uint32_t> {2U, 3U, 0U, 1U}));
+    ASSERT_EQ(get_order(queues, test_large_transfer_size, 3U), (std::vector<uint32_t> {3U, 0U, 1U, 2U}));
+}
+
+/**
+ * Small descriptors try the higher priority WQs first, large descriptors try the lower priority WQs first.
+ */
+QPL_UNIT_API_ALGORITHMIC_TEST(wq_selection, priority_by_transfer_size) {
+    QPL_SKIP_TEST_FOR(qpl_path_software);
+    QPL_SKIP_TEST_FOR(qpl_path_auto);
+
+    const std::vector<hw_queue_candidate_t> queues = {
+            {1, 0U, true, false}, {10, 0U, true, false}, {5, 0U, true, false}, {10, 0U, true, false}};
+
+    ASSERT_EQ(get_order(queues, test_small_transfer_size, 0U), (std::vector<uint32_t> {1U, 3U, 2U, 0U}));
+    ASSERT_EQ(get_order(queues, test_small_transfer_size, 2U), (std::vector<uint32_t> {3U, 1U, 2U, 0U}));
+    ASSERT_EQ(get_order(queues, latency_sensitive_transfer_size, 0U), (std::vector<uint32_t> {1U, 3U, 2U, 0U}));
+    ASSERT_EQ(get_order(queues, test_large_transfer_size, 0U), (std::vector<uint32_t> {0U, 2U, 1U, 3U}));
+}
+
+/**
+ * WQs that do not support the operation or the transfer size are not tried.
+ */
+QPL_UNIT_API_ALGORITHMIC_TEST(wq_selection, unsupported_queues) {
+    QPL_SKIP_TEST_FOR(qpl_path_software);
+    QPL_SKIP_TEST_FOR(qpl_path_auto);
+
+    const std::vector<hw_queue_candidate_t> queues = {{0, 0U, false, false},
+                                                      {0, test_small_transfer_size, true, false},
+                                                      {0, test_large_transfer_size, true, false},
+                                                      {0, 0U, true, false}};
+
+    ASSERT_EQ(get_order(queues, test_small_transfer_size, 0U), (std::vector<uint32_t> {1U, 2U, 3U}));
+    ASSERT_EQ(get_order(queues, test_large_transfer_size, 0U), (std::vector<uint32_t> {2U, 3U}));
+    ASSERT_EQ(get_order(queues, test_large_transfer_size + 1U, 0U), (std::vector<uint32_t> {3U}));
+
+    const std::vector<hw_queue_candidate_t> disabled_queues(2U, {0, 0U, false, false});
+
+    ASSERT_TRUE(get_order(disabled_queues, test_small_transfer_size).empty());
+}
+
+/**
+ * WQs that reported retry are tried after all other WQs regardless of the priority.
+ */
+QPL_UNIT_API_ALGORITHMIC_TEST(wq_selection, congested_queues) {
+    QPL_SKIP_TEST_FOR(qpl_path_software);
+    QPL_SKIP_TEST_FOR(qpl_path_auto);
+
+    const std::vector<hw_queue_candidate_t> queues = {
+            {10, 0U, true, true}, {1, 0U, true, false}, {5, 0U, true, true}, {1, 0U, true, false}};
+
+    ASSERT_EQ(get_order(queues, test_small_transfer_size, 0U), (std::vector<uint32_t> {1U, 3U, 0U, 2U}));
+    ASSERT_EQ(get_order(queues, test_large_transfer_size, 3U), (std::vector<uint32_t> {3U, 1U, 2U, 0U}));
+}
+
+#endif // __linux__
+
+} // namespace qpl::test
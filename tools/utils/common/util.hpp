@@ -109,12 +109,24 @@ static std::string OperationToString(qpl_operation operation) {
 
         case qpl_op_scan_not_range: return "ScanNotRange";
 
+        case qpl_op_scan_in_set: return "ScanInSet";
+
+        case qpl_op_scan_predicate: return "ScanPredicate";
+
         case qpl_op_extract: return "Extract";
 
         case qpl_op_select: return "Select";
 
         case qpl_op_expand: return "Expand";
 
+        case qpl_op_bit_and: return "BitAnd";
+
+        case qpl_op_bit_or: return "BitOr";
+
+        case qpl_op_bit_and_not: return "BitAndNot";
+
+        case qpl_op_bit_xor: return "BitXor";
+
         case qpl_op_compress: return "Compress";
 
         case qpl_op_decompress: return "Decompress";
@@ -221,6 +233,11 @@ static uint32_t get_second_source_bit_length(qpl_operation operation, uint32_t f
 
         case qpl_op_expand: result_bit_length = first_source_number_of_elements; break;
 
+        case qpl_op_bit_and:
+        case qpl_op_bit_or:
+        case qpl_op_bit_and_not:
+        case qpl_op_bit_xor: result_bit_length = first_source_number_of_elements; break;
+
         default: result_bit_length = 0U; break;
     }
 